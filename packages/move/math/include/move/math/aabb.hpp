@@ -0,0 +1,337 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/mat4x4.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    /**
+     * @brief An axis-aligned bounding box stored as its minimum and maximum
+     * corners.
+     *
+     * A default constructed box is empty, with the minimum at +infinity and
+     * the maximum at -infinity, so growing it by any point or box gives
+     * that point or box.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct aabb
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using mat4x4_t = mat4x4<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using component_type = T;
+
+    private:
+        rtm_vec4_t _min;
+        rtm_vec4_t _max;
+
+        // Constructors
+    public:
+        MVM_INLINE aabb() :
+            _min(rtm::vector_set(std::numeric_limits<T>::infinity())),
+            _max(rtm::vector_set(-std::numeric_limits<T>::infinity()))
+        {
+        }
+
+        MVM_INLINE aabb(const vec3_t& min, const vec3_t& max) :
+            _min(min.to_rtm()), _max(max.to_rtm())
+        {
+        }
+
+        MVM_INLINE aabb(const aabb& other) :
+            _min(other._min), _max(other._max)
+        {
+        }
+
+        MVM_INLINE aabb& operator=(const aabb& other)
+        {
+            _min = other._min;
+            _max = other._max;
+            return *this;
+        }
+
+        MVM_INLINE_NODISCARD static aabb from_rtm(const rtm_vec4_t& min,
+                                                  const rtm_vec4_t& max)
+        {
+            aabb result;
+            result._min = min;
+            result._max = max;
+            return result;
+        }
+
+        MVM_INLINE_NODISCARD static aabb from_center_extents(
+            const vec3_t& center,
+            const vec3_t& extents)
+        {
+            using namespace rtm;
+            const rtm_vec4_t c = center.to_rtm();
+            const rtm_vec4_t e = extents.to_rtm();
+            return from_rtm(vector_sub(c, e), vector_add(c, e));
+        }
+
+        /**
+         * @brief Creates the smallest box enclosing a set of points.
+         *
+         * @param points The points to enclose
+         * @param count The number of points.  The box is empty if this is
+         * zero.
+         */
+        MVM_INLINE_NODISCARD static aabb from_points(
+            const vec3<T, Acceleration::Scalar>* points,
+            size_t count)
+        {
+            using namespace rtm;
+            aabb result;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const rtm_vec4_t p = vector_load3(points[i].to_array());
+                result._min = vector_min(result._min, p);
+                result._max = vector_max(result._max, p);
+            }
+            return result;
+        }
+
+        MVM_INLINE_NODISCARD static aabb merged(const aabb& a, const aabb& b)
+        {
+            using namespace rtm;
+            return from_rtm(vector_min(a._min, b._min),
+                            vector_max(a._max, b._max));
+        }
+
+        // Stream overload operators
+    public:
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(
+            std::basic_ostream<CharT, Traits>& os, const aabb& box)
+        {
+#if defined(MVM_HAS_MOVE_CORE)
+            os << move::meta::type_name<aabb>() << "(";
+#else
+            os << "aabb(";
+#endif
+            os << box.get_min() << ", " << box.get_max() << ")";
+            return os;
+        }
+
+        // Comparison operators
+    public:
+        MVM_INLINE_NODISCARD bool operator==(const aabb& other) const
+        {
+            return rtm::vector_all_near_equal3(_min, other._min) &&
+                   rtm::vector_all_near_equal3(_max, other._max);
+        }
+
+        MVM_INLINE_NODISCARD bool operator!=(const aabb& other) const
+        {
+            return !(*this == other);
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD vec3_t get_min() const
+        {
+            return vec3_t::from_rtm(_min);
+        }
+
+        MVM_INLINE_NODISCARD vec3_t get_max() const
+        {
+            return vec3_t::from_rtm(_max);
+        }
+
+        MVM_INLINE_NODISCARD rtm_vec4_t min_rtm() const
+        {
+            return _min;
+        }
+
+        MVM_INLINE_NODISCARD rtm_vec4_t max_rtm() const
+        {
+            return _max;
+        }
+
+        MVM_INLINE_NODISCARD vec3_t center() const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(vector_mul(vector_add(_min, _max), T(0.5)));
+        }
+
+        // Half the size along each axis
+        MVM_INLINE_NODISCARD vec3_t extents() const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(vector_mul(vector_sub(_max, _min), T(0.5)));
+        }
+
+        MVM_INLINE_NODISCARD vec3_t size() const
+        {
+            return vec3_t::from_rtm(rtm::vector_sub(_max, _min));
+        }
+
+        // Geometric queries
+    public:
+        MVM_INLINE_NODISCARD bool is_empty() const
+        {
+            return rtm::vector_any_greater_than3(_min, _max);
+        }
+
+        /**
+         * @brief The surface area of the box, the usual cost metric for
+         * building bounding volume hierarchies.  Zero for an empty box.
+         */
+        MVM_INLINE_NODISCARD T surface_area() const
+        {
+            using namespace rtm;
+            if (is_empty())
+            {
+                return T(0);
+            }
+            const rtm_vec4_t d = vector_sub(_max, _min);
+            const T x = vector_get_x(d);
+            const T y = vector_get_y(d);
+            const T z = vector_get_z(d);
+            return T(2) * (x * y + y * z + z * x);
+        }
+
+        MVM_INLINE_NODISCARD bool contains(const vec3_t& point) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t p = point.to_rtm();
+            return vector_all_less_equal3(_min, p) &&
+                   vector_all_less_equal3(p, _max);
+        }
+
+        MVM_INLINE_NODISCARD bool contains(const aabb& other) const
+        {
+            using namespace rtm;
+            return vector_all_less_equal3(_min, other._min) &&
+                   vector_all_less_equal3(other._max, _max);
+        }
+
+        // True if the boxes overlap or touch
+        MVM_INLINE_NODISCARD bool intersects(const aabb& other) const
+        {
+            using namespace rtm;
+            return vector_all_less_equal3(_min, other._max) &&
+                   vector_all_less_equal3(other._min, _max);
+        }
+
+        // The point of the box closest to `point`
+        MVM_INLINE_NODISCARD vec3_t closest_point(const vec3_t& point) const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(
+                vector_min(vector_max(point.to_rtm(), _min), _max));
+        }
+
+        /**
+         * @brief The corner farthest along `direction`, the box's support
+         * mapping for gjk_distance.
+         */
+        MVM_INLINE_NODISCARD vec3_t support(const vec3_t& direction) const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(vector_select(
+                vector_less_than(direction.to_rtm(), vector_zero()), _min,
+                _max));
+        }
+
+        MVM_INLINE_NODISCARD T distance_squared(const vec3_t& point) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t p = point.to_rtm();
+            const rtm_vec4_t d =
+                vector_sub(vector_min(vector_max(p, _min), _max), p);
+            return T(vector_dot3(d, d));
+        }
+
+        /**
+         * @brief Transforms the box by an affine matrix and returns the box
+         * enclosing the result.  Each output axis takes the smaller and
+         * larger product of every matrix element with the input bounds,
+         * which is exact for the transformed corners without transforming
+         * all eight.
+         *
+         * @param mat The transform to apply
+         * @return aabb The enclosing box
+         */
+        MVM_INLINE_NODISCARD aabb transformed(const mat4x4_t& mat) const
+        {
+            using namespace rtm;
+            if (is_empty())
+            {
+                return *this;
+            }
+
+            const auto m = mat.to_rtm();
+            rtm_vec4_t min = m.w_axis;
+            rtm_vec4_t max = m.w_axis;
+            const rtm_vec4_t axes[3] = {m.x_axis, m.y_axis, m.z_axis};
+            T lo[4];
+            T hi[4];
+            vector_store(_min, lo);
+            vector_store(_max, hi);
+            for (size_t i = 0; i < 3; ++i)
+            {
+                const rtm_vec4_t a = vector_mul(axes[i], lo[i]);
+                const rtm_vec4_t b = vector_mul(axes[i], hi[i]);
+                min = vector_add(min, vector_min(a, b));
+                max = vector_add(max, vector_max(a, b));
+            }
+            return from_rtm(min, max);
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE aabb& expand(const vec3_t& point)
+        {
+            using namespace rtm;
+            const rtm_vec4_t p = point.to_rtm();
+            _min = vector_min(_min, p);
+            _max = vector_max(_max, p);
+            return *this;
+        }
+
+        MVM_INLINE aabb& expand(const aabb& other)
+        {
+            *this = merged(*this, other);
+            return *this;
+        }
+
+        // Grows the box by `margin` on every side
+        MVM_INLINE aabb& inflate(const T& margin)
+        {
+            using namespace rtm;
+            const rtm_vec4_t m = vector_set(margin);
+            _min = vector_sub(_min, m);
+            _max = vector_add(_max, m);
+            return *this;
+        }
+    };
+
+    using aabbf = aabb<float>;
+    using aabbd = aabb<double>;
+
+    template <typename T>
+    MVM_INLINE_NODISCARD bool approx_equal(
+        const aabb<T>& a,
+        const aabb<T>& b,
+        const T& epsilon = std::numeric_limits<T>::epsilon())
+    {
+        return rtm::vector_all_near_equal3(a.min_rtm(), b.min_rtm(),
+                                           epsilon) &&
+               rtm::vector_all_near_equal3(a.max_rtm(), b.max_rtm(), epsilon);
+    }
+}  // namespace move::math
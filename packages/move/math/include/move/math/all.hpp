@@ -1,10 +1,30 @@
 #pragma once
 
+#include <move/math/aabb.hpp>
+#include <move/math/animation_clip.hpp>
+#include <move/math/bvh.hpp>
+#include <move/math/capsule.hpp>
+#include <move/math/closest_point.hpp>
+#include <move/math/convex_hull.hpp>
+#include <move/math/collision_world.hpp>
 #include <move/math/common.hpp>
+#include <move/math/curve.hpp>
+#include <move/math/dual_quat.hpp>
+#include <move/math/gjk.hpp>
 #include <move/math/macros.hpp>
 #include <move/math/mat3x3.hpp>
 #include <move/math/mat4x4.hpp>
+#include <move/math/obb.hpp>
+#include <move/math/plane.hpp>
 #include <move/math/quat.hpp>
+#include <move/math/quat_track.hpp>
+#include <move/math/radix_sort.hpp>
+#include <move/math/ray.hpp>
+#include <move/math/skinning.hpp>
+#include <move/math/space_filling_curve.hpp>
+#include <move/math/spatial_hash_grid.hpp>
+#include <move/math/sphere.hpp>
+#include <move/math/transform_qvv.hpp>
 #include <move/math/vec2.hpp>
 #include <move/math/vec3.hpp>
 #include <move/math/vec4.hpp>
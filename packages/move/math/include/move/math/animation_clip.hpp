@@ -0,0 +1,353 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/quat.hpp>
+#include <move/math/transform_qvv.hpp>
+
+namespace move::math
+{
+    namespace detail
+    {
+        // Rotations are packed "smallest three" into 48 bits: the largest
+        // component is dropped and rebuilt from the unit length, and the
+        // others lie in [-1/sqrt(2), 1/sqrt(2)].  Its index takes the top
+        // bit of the first two words, leaving 15, 15 and 16 bits.
+        template <typename T>
+        struct packed_rotation
+        {
+            constexpr static T range = T(0.70710678118654752);
+
+            MVM_INLINE static void pack(const quat<T>& rotation,
+                                        uint16_t out[3])
+            {
+                T c[4] = {rotation.get_x(), rotation.get_y(),
+                          rotation.get_z(), rotation.get_w()};
+                uint16_t largest = 0;
+                for (uint16_t i = 1; i < 4; ++i)
+                {
+                    if (math::abs(c[i]) > math::abs(c[largest]))
+                    {
+                        largest = i;
+                    }
+                }
+
+                // q and -q are the same rotation, so make the dropped
+                // component positive
+                const T sign = c[largest] < T(0) ? T(-1) : T(1);
+                T rest[3];
+                for (uint16_t i = 0, j = 0; i < 4; ++i)
+                {
+                    if (i != largest)
+                    {
+                        rest[j++] = c[i] * sign;
+                    }
+                }
+
+                out[0] = uint16_t(((largest >> 1) << 15) |
+                                  quantize(rest[0], 0x7fff));
+                out[1] =
+                    uint16_t(((largest & 1) << 15) | quantize(rest[1], 0x7fff));
+                out[2] = quantize(rest[2], 0xffff);
+            }
+
+            MVM_INLINE_NODISCARD static typename quat<T>::rtm_quat_t unpack(
+                const uint16_t in[3])
+            {
+                const uint16_t largest = uint16_t(((in[0] >> 15) << 1) |
+                                                  (in[1] >> 15));
+                const T a = dequantize(in[0] & 0x7fff, 0x7fff);
+                const T b = dequantize(in[1] & 0x7fff, 0x7fff);
+                const T c = dequantize(in[2], 0xffff);
+                const T d = math::sqrt(
+                    math::max(T(0), T(1) - a * a - b * b - c * c));
+
+                switch (largest)
+                {
+                    case 0:
+                        return rtm::quat_set(d, a, b, c);
+                    case 1:
+                        return rtm::quat_set(a, d, b, c);
+                    case 2:
+                        return rtm::quat_set(a, b, d, c);
+                    default:
+                        return rtm::quat_set(a, b, c, d);
+                }
+            }
+
+        private:
+            MVM_INLINE_NODISCARD static uint16_t quantize(const T& value,
+                                                          uint32_t max)
+            {
+                const T unit = math::clamp((value / range + T(1)) * T(0.5),
+                                           T(0), T(1));
+                return uint16_t(unit * T(max) + T(0.5));
+            }
+
+            MVM_INLINE_NODISCARD static T dequantize(uint32_t value,
+                                                     uint32_t max)
+            {
+                return (T(value) / T(max) * T(2) - T(1)) * range;
+            }
+        };
+    }  // namespace detail
+
+    /**
+     * @brief A uniformly sampled animation clip with quantized keys.
+     *
+     * Each frame stores every track's rotation, translation and scale in
+     * 16-bit words, 18 bytes per track instead of the 48 of a float
+     * transform_qvv.  Rotations use the smallest-three encoding.
+     * Translations and scales are normalized to the range each track
+     * covers over the clip.  Frames are laid out one after another, so
+     * sampling any time reads exactly two contiguous runs of memory.
+     *
+     * Sampling interpolates translation and scale linearly and rotation
+     * along the shortest path, which is accurate at typical sample rates.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct animation_clip
+    {
+    public:
+        using component_type = T;
+        using transform_t = transform_qvv<T>;
+        using quat_t = quat<T>;
+        using rtm_vec4_t = typename transform_t::rtm_vec4_t;
+
+        // Words per track per frame: 3 rotation, 3 translation, 3 scale
+        constexpr static size_t words_per_track = 9;
+
+    private:
+        // Dequantization is `min + word * step`, per component
+        struct track_range
+        {
+            rtm_vec4_t translation_min;
+            rtm_vec4_t translation_step;
+            rtm_vec4_t scale_min;
+            rtm_vec4_t scale_step;
+        };
+
+        std::vector<track_range> _ranges;
+        std::vector<uint16_t> _words;
+        size_t _track_count;
+        size_t _frame_count;
+        T _sample_rate;
+
+        // Constructors
+    public:
+        MVM_INLINE animation_clip() :
+            _track_count(0), _frame_count(0), _sample_rate(T(30))
+        {
+        }
+
+        /**
+         * @brief Compresses a clip from full-precision poses.
+         *
+         * @param poses The poses, frame by frame: `poses[frame * track_count
+         * + track]`
+         * @param track_count The number of tracks, usually one per bone
+         * @param frame_count The number of frames.  Must be at least one.
+         * @param sample_rate The number of frames per second
+         */
+        animation_clip(const transform_t* poses,
+                       size_t track_count,
+                       size_t frame_count,
+                       T sample_rate) :
+            _ranges(track_count),
+            _words(track_count * frame_count * words_per_track),
+            _track_count(track_count),
+            _frame_count(frame_count),
+            _sample_rate(sample_rate)
+        {
+            using namespace rtm;
+            for (size_t track = 0; track < track_count; ++track)
+            {
+                rtm_vec4_t t_min = poses[track].get_translation().to_rtm();
+                rtm_vec4_t t_max = t_min;
+                rtm_vec4_t s_min = poses[track].get_scale().to_rtm();
+                rtm_vec4_t s_max = s_min;
+                for (size_t frame = 1; frame < frame_count; ++frame)
+                {
+                    const transform_t& pose =
+                        poses[frame * track_count + track];
+                    const rtm_vec4_t t = pose.get_translation().to_rtm();
+                    const rtm_vec4_t s = pose.get_scale().to_rtm();
+                    t_min = vector_min(t_min, t);
+                    t_max = vector_max(t_max, t);
+                    s_min = vector_min(s_min, s);
+                    s_max = vector_max(s_max, s);
+                }
+
+                track_range& range = _ranges[track];
+                range.translation_min = t_min;
+                range.translation_step = step(t_min, t_max);
+                range.scale_min = s_min;
+                range.scale_step = step(s_min, s_max);
+            }
+
+            for (size_t frame = 0; frame < frame_count; ++frame)
+            {
+                for (size_t track = 0; track < track_count; ++track)
+                {
+                    const transform_t& pose =
+                        poses[frame * track_count + track];
+                    const track_range& range = _ranges[track];
+                    uint16_t* words = frame_words(frame) +
+                                      track * words_per_track;
+                    detail::packed_rotation<T>::pack(pose.get_rotation(),
+                                                     words);
+                    quantize(pose.get_translation().to_rtm(),
+                             range.translation_min, range.translation_step,
+                             words + 3);
+                    quantize(pose.get_scale().to_rtm(), range.scale_min,
+                             range.scale_step, words + 6);
+                }
+            }
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD size_t track_count() const
+        {
+            return _track_count;
+        }
+
+        MVM_INLINE_NODISCARD size_t frame_count() const
+        {
+            return _frame_count;
+        }
+
+        MVM_INLINE_NODISCARD T sample_rate() const
+        {
+            return _sample_rate;
+        }
+
+        MVM_INLINE_NODISCARD T duration() const
+        {
+            return _frame_count > 1 ? T(_frame_count - 1) / _sample_rate
+                                    : T(0);
+        }
+
+        /**
+         * @brief The number of bytes the clip's keys and track ranges take
+         * up, excluding the fixed size of this object.
+         */
+        MVM_INLINE_NODISCARD size_t memory_size() const
+        {
+            return _words.size() * sizeof(uint16_t) +
+                   _ranges.size() * sizeof(track_range);
+        }
+
+        /**
+         * @brief The number of bytes the same clip takes up as uncompressed
+         * transform_qvv poses, for comparison with memory_size.
+         */
+        MVM_INLINE_NODISCARD size_t uncompressed_size() const
+        {
+            return _track_count * _frame_count * sizeof(transform_t);
+        }
+
+        // Sampling
+    public:
+        /**
+         * @brief Decodes every track at a time into a pose buffer.
+         *
+         * @param time The time in seconds.  Clamped to the clip.
+         * @param pose Receives one transform per track
+         */
+        void sample(const T& time, transform_t* pose) const
+        {
+            using namespace rtm;
+            if (_frame_count == 0)
+            {
+                return;
+            }
+
+            const T position =
+                math::clamp(time * _sample_rate, T(0), T(_frame_count - 1));
+            const size_t frame0 = size_t(position);
+            const size_t frame1 = math::min(frame0 + 1, _frame_count - 1);
+            const T alpha = position - T(frame0);
+
+            const uint16_t* words0 = frame_words(frame0);
+            const uint16_t* words1 = frame_words(frame1);
+            for (size_t track = 0; track < _track_count; ++track)
+            {
+                const track_range& range = _ranges[track];
+                const uint16_t* a = words0 + track * words_per_track;
+                const uint16_t* b = words1 + track * words_per_track;
+
+                const auto rotation = quat_lerp(
+                    detail::packed_rotation<T>::unpack(a),
+                    detail::packed_rotation<T>::unpack(b), alpha);
+                const rtm_vec4_t translation = vector_lerp(
+                    dequantize(a + 3, range.translation_min,
+                               range.translation_step),
+                    dequantize(b + 3, range.translation_min,
+                               range.translation_step),
+                    alpha);
+                const rtm_vec4_t scale = vector_lerp(
+                    dequantize(a + 6, range.scale_min, range.scale_step),
+                    dequantize(b + 6, range.scale_min, range.scale_step),
+                    alpha);
+                pose[track] = qvv_set(rotation, translation, scale);
+            }
+        }
+
+    private:
+        MVM_INLINE_NODISCARD uint16_t* frame_words(size_t frame)
+        {
+            return _words.data() + frame * _track_count * words_per_track;
+        }
+
+        MVM_INLINE_NODISCARD const uint16_t* frame_words(size_t frame) const
+        {
+            return _words.data() + frame * _track_count * words_per_track;
+        }
+
+        // A constant component gets a zero step, so every word decodes to
+        // the minimum
+        MVM_INLINE_NODISCARD static rtm_vec4_t step(const rtm_vec4_t& min,
+                                                    const rtm_vec4_t& max)
+        {
+            using namespace rtm;
+            return vector_mul(vector_sub(max, min), T(1) / T(0xffff));
+        }
+
+        MVM_INLINE static void quantize(const rtm_vec4_t& value,
+                                        const rtm_vec4_t& min,
+                                        const rtm_vec4_t& step,
+                                        uint16_t out[3])
+        {
+            using namespace rtm;
+            T offset[4];
+            T steps[4];
+            vector_store(vector_sub(value, min), offset);
+            vector_store(step, steps);
+            for (size_t i = 0; i < 3; ++i)
+            {
+                const T words =
+                    steps[i] > T(0) ? offset[i] / steps[i] + T(0.5) : T(0);
+                out[i] = uint16_t(math::clamp(words, T(0), T(0xffff)));
+            }
+        }
+
+        MVM_INLINE_NODISCARD static rtm_vec4_t dequantize(
+            const uint16_t in[3],
+            const rtm_vec4_t& min,
+            const rtm_vec4_t& step)
+        {
+            using namespace rtm;
+            return vector_mul_add(vector_set(T(in[0]), T(in[1]), T(in[2])),
+                                  step, min);
+        }
+    };
+
+    using animation_clipf = animation_clip<float>;
+    using animation_clipd = animation_clip<double>;
+}  // namespace move::math
@@ -0,0 +1,779 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/aabb.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/radix_sort.hpp>
+#include <move/math/ray.hpp>
+#include <move/math/space_filling_curve.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    /**
+     * @brief A binary bounding volume hierarchy over boxes, built as a
+     * linear BVH (Karras, "Maximizing parallelism in the construction of
+     * BVHs, octrees, and k-d trees", 2012) for scenes rebuilt every frame.
+     *
+     * `build` sorts the boxes by the Morton code of their centers, after
+     * which every internal node finds its own range and split from the
+     * codes alone, so the hierarchy is emitted in one parallel pass rather
+     * than top down.  The trees are looser than SAH builds but take a
+     * fraction of the time.
+     *
+     * The `count - 1` internal nodes come first, with the root at index 0,
+     * followed by one leaf per box in Morton order.  Each node holds an
+     * aabb_t, so custom traversals can use the ray and box tests directly.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct bvh
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using aabb_t = aabb<T>;
+        using ray_t = ray<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using component_type = T;
+
+        constexpr static uint32_t invalid_index =
+            std::numeric_limits<uint32_t>::max();
+        // Every level of the tree splits the 96 bit key of Morton code and
+        // index at a lower bit, so no path is longer than this
+        constexpr static size_t max_depth = 97;
+
+        struct node
+        {
+            aabb_t bounds;
+            // Internal nodes hold the indices of their children.  Leaves
+            // hold their primitive, the index of its box, in `left`.
+            uint32_t left;
+            uint32_t right;
+
+            MVM_INLINE_NODISCARD bool is_leaf() const
+            {
+                return right == invalid_index;
+            }
+        };
+
+    private:
+        std::vector<node> _nodes;
+        std::vector<uint32_t> _parents;
+        // The leaf holding each primitive
+        std::vector<uint32_t> _leaves;
+        // The length of the longest path down from each node
+        std::vector<uint8_t> _heights;
+        // The children of each internal node still to be refit, which is
+        // zero outside of build and refit
+        std::vector<uint32_t> _pending;
+        // The summed surface area of the internal nodes
+        double _area_sum = 0;
+        // Refit scratch, one bit per leaf in leaf order
+        std::vector<uint64_t> _dirty_leaves;
+
+        // Build scratch, kept to avoid reallocating every frame
+        std::vector<uint64_t> _codes;
+        std::vector<uint64_t> _scratch_codes;
+        std::vector<uint32_t> _order;
+        std::vector<uint32_t> _scratch_order;
+
+        // Constructors
+    public:
+        bvh() = default;
+
+        // Element access
+    public:
+        // The number of primitives, which is also the number of leaves
+        MVM_INLINE_NODISCARD size_t size() const
+        {
+            return (_nodes.size() + 1) / 2;
+        }
+
+        MVM_INLINE_NODISCARD bool empty() const
+        {
+            return _nodes.empty();
+        }
+
+        MVM_INLINE_NODISCARD size_t node_count() const
+        {
+            return _nodes.size();
+        }
+
+        MVM_INLINE_NODISCARD const node* nodes() const
+        {
+            return _nodes.data();
+        }
+
+        MVM_INLINE_NODISCARD const node& get_node(uint32_t index) const
+        {
+            return _nodes[index];
+        }
+
+        // The parent of a node, or invalid_index for the root
+        MVM_INLINE_NODISCARD uint32_t parent_of(uint32_t index) const
+        {
+            return _parents[index];
+        }
+
+        // The leaf node holding a primitive
+        MVM_INLINE_NODISCARD uint32_t leaf_of(uint32_t primitive) const
+        {
+            return _leaves[primitive];
+        }
+
+        // The bounds of every box, which is empty for an empty tree
+        MVM_INLINE_NODISCARD aabb_t bounds() const
+        {
+            return empty() ? aabb_t() : _nodes[0].bounds;
+        }
+
+        /**
+         * @brief The surface area heuristic cost of the tree, the summed
+         * surface area of its internal nodes over that of the root.  This
+         * is the expected number of internal nodes a ray through the root
+         * visits, so it grows as refits stretch the nodes.  Compare it to
+         * its value after the last build to decide when to rebuild.
+         */
+        MVM_INLINE_NODISCARD T sah_cost() const
+        {
+            const T root_area =
+                empty() ? T(0) : _nodes[0].bounds.surface_area();
+            return root_area > T(0) ? T(_area_sum / root_area) : T(0);
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE void clear()
+        {
+            _nodes.clear();
+            _parents.clear();
+            _leaves.clear();
+            _heights.clear();
+            _area_sum = 0;
+        }
+
+        /**
+         * @brief Replaces the hierarchy with one over `boxes`.  Queries
+         * report a box by its index in this array.
+         *
+         * @param boxes The boxes to build over
+         * @param count The number of boxes
+         */
+        void build(const aabb_t* boxes, size_t count)
+        {
+            build(boxes, count,
+                  [](size_t chunk_count, auto&& job)
+                  {
+                      for (size_t i = 0; i < chunk_count; ++i)
+                      {
+                          job(i);
+                      }
+                  });
+        }
+
+        /**
+         * @brief Chunked variant of build for use with a job system.
+         *
+         * `parallel_for(chunk_count, job)` must invoke `job(chunk_index)`
+         * exactly once for each index in `[0, chunk_count)`, from any thread,
+         * and return once all of them have completed.  Every pass works on
+         * chunks of `chunk_size` boxes or nodes: the Morton codes, the radix
+         * sort, the nodes, and a bottom up refit in which the second child
+         * to finish computes its parent's bounds, counted with atomics.
+         * The tree does not depend on the dispatcher or the chunk size.
+         *
+         * @param boxes The boxes to build over
+         * @param count The number of boxes
+         * @param parallel_for The dispatcher that runs the chunks
+         * @param chunk_size The number of boxes or nodes per chunk
+         */
+        template <typename ParallelFor>
+        void build(const aabb_t* boxes,
+                   size_t count,
+                   ParallelFor&& parallel_for,
+                   size_t chunk_size = 16384)
+        {
+            // Node indices and the index tie break of equal codes fit 32 bits
+            MVM_ASSERT_PRECONDITION(count <= (size_t(1) << 31));
+            if (count == 0)
+            {
+                clear();
+                return;
+            }
+
+            _nodes.resize(2 * count - 1);
+            _parents.resize(2 * count - 1);
+            _leaves.resize(count);
+            _heights.resize(2 * count - 1);
+            _parents[0] = invalid_index;
+            _area_sum = 0;
+            if (count == 1)
+            {
+                _nodes[0] = node{boxes[0], 0, invalid_index};
+                _leaves[0] = 0;
+                _heights[0] = 0;
+                return;
+            }
+
+            _codes.resize(count);
+            _scratch_codes.resize(count);
+            _order.resize(count);
+            _scratch_order.resize(count);
+            _pending.resize(count - 1);
+
+            chunk_size = chunk_size == 0 ? count : chunk_size;
+            const size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+            std::vector<aabb_t> chunk_bounds(chunk_count);
+            aabb_t* bounds = chunk_bounds.data();
+            uint64_t* codes = _codes.data();
+            uint32_t* order = _order.data();
+
+            parallel_for(chunk_count,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             aabb_t local;
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 local.expand(vec3_t::from_rtm(
+                                     centroid(boxes[i])));
+                             }
+                             bounds[chunk_index] = local;
+                         });
+
+            aabb_t centers;
+            for (size_t c = 0; c < chunk_count; ++c)
+            {
+                centers.expand(chunk_bounds[c]);
+            }
+            const vec3_t lo = centers.get_min();
+            const vec3_t size = centers.size();
+            const T min_x = lo.get_x();
+            const T min_y = lo.get_y();
+            const T min_z = lo.get_z();
+            const T scale_x = detail::quantize_scale(size.get_x());
+            const T scale_y = detail::quantize_scale(size.get_y());
+            const T scale_z = detail::quantize_scale(size.get_z());
+
+            parallel_for(
+                chunk_count,
+                [=](size_t chunk_index)
+                {
+                    const size_t begin = chunk_index * chunk_size;
+                    const size_t end = math::min(begin + chunk_size, count);
+                    T c[4];
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        rtm::vector_store(centroid(boxes[i]), c);
+                        codes[i] = morton_encode(
+                            detail::quantize_axis(c[0], min_x, scale_x),
+                            detail::quantize_axis(c[1], min_y, scale_y),
+                            detail::quantize_axis(c[2], min_z, scale_z));
+                        order[i] = uint32_t(i);
+                    }
+                });
+
+            radix_sort_by_key(codes, order, _scratch_codes.data(),
+                              _scratch_order.data(), count, parallel_for,
+                              chunk_size, 3 * curve3_axis_bits);
+
+            node* nodes = _nodes.data();
+            uint32_t* parents = _parents.data();
+            uint32_t* leaves = _leaves.data();
+            uint8_t* heights = _heights.data();
+            uint32_t* pending = _pending.data();
+            parallel_for(chunk_count,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 // The boxes are gathered in Morton order
+                                 if (i + 16 < end)
+                                 {
+                                     MVM_PREFETCH(boxes + order[i + 16]);
+                                 }
+                                 nodes[count - 1 + i] = node{
+                                     boxes[order[i]], order[i], invalid_index};
+                                 leaves[order[i]] = uint32_t(count - 1 + i);
+                                 heights[count - 1 + i] = 0;
+                                 if (i + 1 < count)
+                                 {
+                                     emit_internal(codes, nodes, parents,
+                                                   uint32_t(count),
+                                                   uint32_t(i));
+                                     pending[i] = 2;
+                                 }
+                             }
+                         });
+
+            parallel_for(chunk_count,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 refit_from(nodes, parents, heights, pending,
+                                            parents[count - 1 + i]);
+                             }
+                         });
+
+            // Summed per chunk of internal nodes, then in chunk order, so
+            // the total does not depend on the dispatcher either
+            std::vector<double> chunk_areas(chunk_count);
+            double* areas = chunk_areas.data();
+            parallel_for(chunk_count,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count - 1);
+                             double area = 0;
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 area += nodes[i].bounds.surface_area();
+                             }
+                             areas[chunk_index] = area;
+                         });
+            for (size_t c = 0; c < chunk_count; ++c)
+            {
+                _area_sum += chunk_areas[c];
+            }
+        }
+
+        struct refit_stats
+        {
+            // Nodes whose bounds were rewritten, leaves included
+            uint32_t nodes_touched = 0;
+            uint32_t rotations = 0;
+            T sah_before = 0;
+            T sah_after = 0;
+
+            MVM_INLINE_NODISCARD T sah_delta() const
+            {
+                return sah_after - sah_before;
+            }
+        };
+
+        /**
+         * @brief Updates the tree after some boxes moved, without changing
+         * which primitives it holds.
+         *
+         * Only the leaves of the dirty primitives and their ancestors are
+         * refit, each once, after all of its children.  The work is
+         * proportional to the dirty leaves and their paths to the root, so
+         * it runs on the calling thread.  Refit trees keep the build's
+         * structure and loosen as boxes travel; with `rotate`, each refit
+         * node also swaps a child with a grandchild (Kensler, "Tree
+         * rotations for improving bounding volume hierarchies", 2008)
+         * when that shrinks the child, which never deepens the tree.
+         *
+         * @param boxes Every box, indexed by primitive as in build
+         * @param dirty One bit per primitive, bit `i % 64` of word `i / 64`,
+         * set for the boxes that changed
+         * @param rotate Whether to rotate refit nodes to reduce the cost
+         * @return refit_stats The work done and the change in sah_cost
+         */
+        refit_stats refit(const aabb_t* boxes,
+                          const uint64_t* dirty,
+                          bool rotate = false)
+        {
+            refit_stats stats;
+            stats.sah_before = sah_cost();
+            const size_t count = size();
+            const size_t words = (count + 63) / 64;
+            const uint32_t leaf_base = uint32_t(count - 1);
+            uint32_t* pending = _pending.data();
+
+            // Walking up from the leaves in Morton order, rather than in
+            // primitive order, keeps the shared ancestors in cache
+            _dirty_leaves.assign(words, 0);
+            for (size_t w = 0; w < words; ++w)
+            {
+                for (uint64_t bits = dirty[w]; bits != 0; bits &= bits - 1)
+                {
+                    const size_t primitive = w * 64 + std::countr_zero(bits);
+                    MVM_ASSERT_PRECONDITION(primitive < count);
+                    const uint32_t leaf = _leaves[primitive];
+                    _nodes[leaf].bounds = boxes[primitive];
+                    _dirty_leaves[(leaf - leaf_base) / 64] |=
+                        uint64_t(1) << ((leaf - leaf_base) % 64);
+                    ++stats.nodes_touched;
+                }
+            }
+
+            // Count the children to wait for on the paths to the root
+            for (size_t w = 0; w < words; ++w)
+            {
+                for (uint64_t bits = _dirty_leaves[w]; bits != 0;
+                     bits &= bits - 1)
+                {
+                    const size_t leaf =
+                        leaf_base + w * 64 + std::countr_zero(bits);
+                    for (uint32_t n = _parents[leaf];
+                         n != invalid_index && pending[n]++ == 0;
+                         n = _parents[n])
+                    {
+                    }
+                }
+            }
+
+            for (size_t w = 0; w < words; ++w)
+            {
+                for (uint64_t bits = _dirty_leaves[w]; bits != 0;
+                     bits &= bits - 1)
+                {
+                    const size_t leaf =
+                        leaf_base + w * 64 + std::countr_zero(bits);
+                    for (uint32_t n = _parents[leaf];
+                         n != invalid_index && --pending[n] == 0;
+                         n = _parents[n])
+                    {
+                        refit_node(n);
+                        ++stats.nodes_touched;
+                        if (rotate && rotate_node(n))
+                        {
+                            ++stats.rotations;
+                            ++stats.nodes_touched;
+                        }
+                    }
+                }
+            }
+
+            stats.sah_after = sah_cost();
+            return stats;
+        }
+
+        // Queries
+    public:
+        /**
+         * @brief Calls `callback(primitive)` for each box that overlaps or
+         * touches `box`.
+         *
+         * @param box The query box
+         * @param callback Invoked with the index of each overlapping box
+         */
+        template <typename Callback>
+        void query(const aabb_t& box, Callback&& callback) const
+        {
+            if (empty())
+            {
+                return;
+            }
+
+            uint32_t stack[max_depth + 1];
+            size_t depth = 0;
+            stack[depth++] = 0;
+            while (depth > 0)
+            {
+                const node& n = _nodes[stack[--depth]];
+                if (!box.intersects(n.bounds))
+                {
+                    continue;
+                }
+
+                if (n.is_leaf())
+                {
+                    callback(n.left);
+                }
+                else
+                {
+                    stack[depth++] = n.right;
+                    stack[depth++] = n.left;
+                }
+            }
+        }
+
+        /**
+         * @brief Finds the nearest primitive along `r`, visiting nearer
+         * children first and skipping any box behind the best hit so far.
+         *
+         * `callback(primitive, t)` tests one primitive.  `t` holds the
+         * distance of the best hit so far; if the ray hits the primitive
+         * nearer than that, the callback writes the new distance and
+         * returns true.
+         *
+         * @param r The ray to cast
+         * @param callback The primitive test
+         * @param t Receives the distance of the hit.  Only written on a hit.
+         * @return uint32_t The primitive hit, or invalid_index
+         */
+        template <typename Callback>
+        uint32_t raycast(const ray_t& r, Callback&& callback, T& t) const
+        {
+            T t_near;
+            T t_far;
+            if (empty() || !r.intersect_aabb(_nodes[0].bounds, t_near, t_far))
+            {
+                return invalid_index;
+            }
+
+            T best = r.get_t_max();
+            uint32_t hit = invalid_index;
+            uint32_t stack[max_depth + 1];
+            T stack_t[max_depth + 1];
+            size_t depth = 0;
+            stack[depth] = 0;
+            stack_t[depth++] = t_near;
+            while (depth > 0)
+            {
+                --depth;
+                if (stack_t[depth] > best)
+                {
+                    continue;
+                }
+
+                const node& n = _nodes[stack[depth]];
+                if (n.is_leaf())
+                {
+                    if (callback(n.left, best))
+                    {
+                        hit = n.left;
+                    }
+                    continue;
+                }
+
+                T left_near = T(0);
+                T right_near = T(0);
+                const bool left_hit =
+                    r.intersect_aabb(_nodes[n.left].bounds, left_near, t_far) &&
+                    left_near <= best;
+                const bool right_hit =
+                    r.intersect_aabb(_nodes[n.right].bounds, right_near,
+                                     t_far) &&
+                    right_near <= best;
+                if (left_hit && right_hit)
+                {
+                    // The nearer child is popped first
+                    const bool left_first = left_near <= right_near;
+                    stack[depth] = left_first ? n.right : n.left;
+                    stack_t[depth++] = left_first ? right_near : left_near;
+                    stack[depth] = left_first ? n.left : n.right;
+                    stack_t[depth++] = left_first ? left_near : right_near;
+                }
+                else if (left_hit || right_hit)
+                {
+                    stack[depth] = left_hit ? n.left : n.right;
+                    stack_t[depth++] = left_hit ? left_near : right_near;
+                }
+            }
+
+            if (hit != invalid_index)
+            {
+                t = best;
+            }
+            return hit;
+        }
+
+    private:
+        MVM_INLINE_NODISCARD static rtm_vec4_t centroid(const aabb_t& box)
+        {
+            using namespace rtm;
+            return vector_mul(vector_add(box.min_rtm(), box.max_rtm()),
+                              T(0.5));
+        }
+
+        // The length of the common prefix of the keys of sorted leaves i
+        // and j, where equal codes are told apart by index, or -1 if j is
+        // out of range
+        MVM_INLINE_NODISCARD static int32_t common_prefix(
+            const uint64_t* codes, uint32_t count, uint32_t i, int64_t j)
+        {
+            if (j < 0 || j >= int64_t(count))
+            {
+                return -1;
+            }
+
+            const uint64_t a = codes[i];
+            const uint64_t b = codes[j];
+            return a != b ? std::countl_zero(a ^ b)
+                          : 64 + std::countl_zero(i ^ uint32_t(j));
+        }
+
+        // Finds the range of leaves internal node i covers and where it
+        // splits, and links it to its children
+        static void emit_internal(const uint64_t* codes,
+                                  node* nodes,
+                                  uint32_t* parents,
+                                  uint32_t count,
+                                  uint32_t i)
+        {
+            // The range extends towards the neighbour sharing more bits
+            const int64_t d =
+                common_prefix(codes, count, i, int64_t(i) + 1) >
+                        common_prefix(codes, count, i, int64_t(i) - 1)
+                    ? 1
+                    : -1;
+            const int32_t prefix_min = common_prefix(codes, count, i, i - d);
+
+            int64_t length_max = 2;
+            while (common_prefix(codes, count, i, i + length_max * d) >
+                   prefix_min)
+            {
+                length_max *= 2;
+            }
+            int64_t length = 0;
+            for (int64_t step = length_max / 2; step > 0; step /= 2)
+            {
+                if (common_prefix(codes, count, i, i + (length + step) * d) >
+                    prefix_min)
+                {
+                    length += step;
+                }
+            }
+            const int64_t j = i + length * d;
+
+            // Binary search for the last leaf sharing more than the range
+            const int32_t prefix_node = common_prefix(codes, count, i, j);
+            int64_t split = 0;
+            int64_t step = length;
+            do
+            {
+                step = (step + 1) / 2;
+                if (common_prefix(codes, count, i, i + (split + step) * d) >
+                    prefix_node)
+                {
+                    split += step;
+                }
+            } while (step > 1);
+            const int64_t gamma = i + split * d + math::min<int64_t>(d, 0);
+
+            const uint32_t leaf_base = count - 1;
+            const uint32_t left = math::min<int64_t>(i, j) == gamma
+                                      ? leaf_base + uint32_t(gamma)
+                                      : uint32_t(gamma);
+            const uint32_t right = math::max<int64_t>(i, j) == gamma + 1
+                                       ? leaf_base + uint32_t(gamma + 1)
+                                       : uint32_t(gamma + 1);
+            nodes[i].left = left;
+            nodes[i].right = right;
+            parents[left] = i;
+            parents[right] = i;
+        }
+
+        // Walks up from a leaf's parent.  The first child to arrive at a
+        // node stops there, and the second, which knows both children are
+        // final, computes its bounds and carries on.
+        static void refit_from(node* nodes,
+                               const uint32_t* parents,
+                               uint8_t* heights,
+                               uint32_t* pending,
+                               uint32_t index)
+        {
+            while (index != invalid_index)
+            {
+                if (std::atomic_ref<uint32_t>(pending[index])
+                        .fetch_sub(1u, std::memory_order_acq_rel) == 2)
+                {
+                    return;
+                }
+
+                node& n = nodes[index];
+                n.bounds = aabb_t::merged(nodes[n.left].bounds,
+                                          nodes[n.right].bounds);
+                heights[index] = uint8_t(
+                    1 + math::max(heights[n.left], heights[n.right]));
+                index = parents[index];
+            }
+        }
+
+        // Recomputes an internal node from its children
+        void refit_node(uint32_t index)
+        {
+            node& n = _nodes[index];
+            const T old_area = n.bounds.surface_area();
+            n.bounds = aabb_t::merged(_nodes[n.left].bounds,
+                                      _nodes[n.right].bounds);
+            _area_sum += double(n.bounds.surface_area()) - double(old_area);
+            _heights[index] = uint8_t(
+                1 + math::max(_heights[n.left], _heights[n.right]));
+        }
+
+        // Swaps a child of the node with a grandchild under its other
+        // child if that shrinks the other child the most, as long as the
+        // node gets no taller
+        bool rotate_node(uint32_t index)
+        {
+            const node& n = _nodes[index];
+            uint32_t best_child = invalid_index;
+            uint32_t best_grandchild = invalid_index;
+            T best_area = T(0);
+            const auto consider =
+                [&](uint32_t child, uint32_t other, uint32_t grandchild,
+                    uint32_t sibling)
+            {
+                const uint8_t child_height = uint8_t(
+                    1 + math::max(_heights[child], _heights[sibling]));
+                if (1 + math::max(_heights[grandchild], child_height) >
+                    _heights[index])
+                {
+                    return;
+                }
+
+                const T area = _nodes[other].bounds.surface_area() -
+                               aabb_t::merged(_nodes[child].bounds,
+                                              _nodes[sibling].bounds)
+                                   .surface_area();
+                if (area > best_area)
+                {
+                    best_area = area;
+                    best_child = child;
+                    best_grandchild = grandchild;
+                }
+            };
+
+            for (const auto& [child, other] :
+                 {std::pair(n.left, n.right), std::pair(n.right, n.left)})
+            {
+                const node& o = _nodes[other];
+                if (!o.is_leaf())
+                {
+                    consider(child, other, o.left, o.right);
+                    consider(child, other, o.right, o.left);
+                }
+            }
+            if (best_child == invalid_index)
+            {
+                return false;
+            }
+
+            // The grandchild takes the child's place and vice versa
+            const uint32_t other = _parents[best_grandchild];
+            node& parent = _nodes[index];
+            node& o = _nodes[other];
+            (parent.left == best_child ? parent.left : parent.right) =
+                best_grandchild;
+            (o.left == best_grandchild ? o.left : o.right) = best_child;
+            _parents[best_grandchild] = index;
+            _parents[best_child] = other;
+            refit_node(other);
+            refit_node(index);
+            return true;
+        }
+    };
+
+    using bvhf = bvh<float>;
+    using bvhd = bvh<double>;
+}  // namespace move::math
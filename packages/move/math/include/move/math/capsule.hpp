@@ -0,0 +1,752 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/aabb.hpp>
+#include <move/math/closest_point.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/plane.hpp>
+#include <move/math/sphere.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    namespace detail
+    {
+        // Closest features between a segment and the shapes a capsule can
+        // collide with.  Every query returns a contact: the point on the
+        // shape's surface, the unit normal pointing from the shape toward
+        // the segment, and the signed distance between them, negative when
+        // the segment passes inside the shape.
+        template <typename T>
+        struct segment_queries
+        {
+            using v4 = typename simd_rtm::detail::v4<T>::type;
+            using features = closest_features<T>;
+
+            struct contact
+            {
+                v4 point;
+                v4 normal;
+                T distance;
+            };
+
+            constexpr static T epsilon = std::numeric_limits<T>::epsilon();
+
+            MVM_INLINE_NODISCARD static v4 up()
+            {
+                return rtm::vector_set(T(0), T(1), T(0), T(0));
+            }
+
+            // The plane is treated as the boundary of a solid half-space
+            MVM_INLINE_NODISCARD static contact plane_contact(
+                const v4& a,
+                const v4& b,
+                const v4& plane)
+            {
+                using namespace rtm;
+                const T offset = vector_get_w(plane);
+                const T sa = T(vector_dot3(plane, a)) + offset;
+                const T sb = T(vector_dot3(plane, b)) + offset;
+
+                // Parallel segments touch along their length, so report
+                // the middle rather than an arbitrary end
+                const v4 p = math::abs(sa - sb) <= epsilon
+                                 ? vector_mul(vector_add(a, b), T(0.5))
+                                 : (sa < sb ? a : b);
+                const T distance = math::min(sa, sb);
+                return {vector_neg_mul_sub(plane, distance, p),
+                        vector_set_w(plane, T(0)), distance};
+            }
+
+            MVM_INLINE_NODISCARD static contact sphere_contact(
+                const v4& a,
+                const v4& b,
+                const v4& center,
+                const T& radius)
+            {
+                using namespace rtm;
+                const v4 p = features::on_segment(center, a, b);
+                const v4 offset = vector_sub(p, center);
+                const T length = T(vector_length3(offset));
+                const v4 normal = length > epsilon
+                                      ? vector_mul(offset, T(1) / length)
+                                      : up();
+                return {vector_mul_add(normal, radius, center), normal,
+                        length - radius};
+            }
+
+            MVM_INLINE_NODISCARD static contact box_contact(const v4& a,
+                                                            const v4& b,
+                                                            const v4& min,
+                                                            const v4& max)
+            {
+                using namespace rtm;
+                const v4 ab = vector_sub(b, a);
+                T t0 = T(0);
+                T t1 = T(1);
+                if (clip_to_box(a, ab, min, max, t0, t1))
+                {
+                    return box_overlap(vector_mul_add(ab, t0, a),
+                                       vector_mul_add(ab, t1, a), min, max);
+                }
+
+                // The squared distance to the box along the segment is
+                // convex, so a golden section search finds its minimum
+                constexpr T ratio = T(0.6180339887498949);
+                T lo = T(0);
+                T hi = T(1);
+                T x1 = hi - ratio * (hi - lo);
+                T x2 = lo + ratio * (hi - lo);
+                T f1 = box_distance_sq(vector_mul_add(ab, x1, a), min, max);
+                T f2 = box_distance_sq(vector_mul_add(ab, x2, a), min, max);
+                for (uint32_t i = 0; i < 40 && hi - lo > T(1e-5); ++i)
+                {
+                    if (f1 < f2)
+                    {
+                        hi = x2;
+                        x2 = x1;
+                        f2 = f1;
+                        x1 = hi - ratio * (hi - lo);
+                        f1 = box_distance_sq(vector_mul_add(ab, x1, a), min,
+                                             max);
+                    }
+                    else
+                    {
+                        lo = x1;
+                        x1 = x2;
+                        f1 = f2;
+                        x2 = lo + ratio * (hi - lo);
+                        f2 = box_distance_sq(vector_mul_add(ab, x2, a), min,
+                                             max);
+                    }
+                }
+
+                const v4 p = vector_mul_add(ab, (lo + hi) * T(0.5), a);
+                const v4 q = vector_min(vector_max(p, min), max);
+                const v4 offset = vector_sub(p, q);
+                const T length = T(vector_length3(offset));
+                const v4 normal = length > epsilon
+                                      ? vector_mul(offset, T(1) / length)
+                                      : up();
+                return {q, normal, length};
+            }
+
+            // The triangle is two-sided
+            MVM_INLINE_NODISCARD static contact triangle_contact(
+                const v4& a,
+                const v4& b,
+                const v4& v0,
+                const v4& v1,
+                const v4& v2)
+            {
+                using namespace rtm;
+                const v4 n = vector_cross3(vector_sub(v1, v0),
+                                           vector_sub(v2, v0));
+                const T n_length = T(vector_length3(n));
+                const v4 face = n_length > epsilon
+                                    ? vector_mul(n, T(1) / n_length)
+                                    : up();
+                const T sa = T(vector_dot3(face, vector_sub(a, v0)));
+                const T sb = T(vector_dot3(face, vector_sub(b, v0)));
+
+                // A segment through the face is pushed out the side the
+                // deeper end is on, by the depth of the shallower end
+                if ((sa < T(0) && sb > T(0)) || (sa > T(0) && sb < T(0)))
+                {
+                    const v4 x =
+                        vector_mul_add(vector_sub(b, a), sa / (sa - sb), a);
+                    const v4 on_face = features::on_triangle(x, v0, v1, v2);
+                    const v4 gap = vector_sub(x, on_face);
+                    if (T(vector_dot3(gap, gap)) <= T(1e-10))
+                    {
+                        const bool a_deeper = math::abs(sa) >= math::abs(sb);
+                        const T side = (a_deeper ? sa : sb) > T(0) ? T(1)
+                                                                   : T(-1);
+                        return {x, vector_mul(face, side),
+                                -math::min(math::abs(sa), math::abs(sb))};
+                    }
+                }
+
+                v4 best_segment = a;
+                v4 best_triangle = features::on_triangle(a, v0, v1, v2);
+                v4 offset = vector_sub(best_segment, best_triangle);
+                T best = T(vector_dot3(offset, offset));
+
+                const v4 on_b = features::on_triangle(b, v0, v1, v2);
+                offset = vector_sub(b, on_b);
+                if (T(vector_dot3(offset, offset)) < best)
+                {
+                    best = T(vector_dot3(offset, offset));
+                    best_segment = b;
+                    best_triangle = on_b;
+                }
+
+                const v4 edges[3][2] = {{v0, v1}, {v1, v2}, {v2, v0}};
+                for (const auto& edge : edges)
+                {
+                    v4 c1;
+                    v4 c2;
+                    const T d = features::on_segments(a, b, edge[0], edge[1],
+                                                      c1, c2);
+                    if (d < best)
+                    {
+                        best = d;
+                        best_segment = c1;
+                        best_triangle = c2;
+                    }
+                }
+
+                const T length = math::sqrt(best);
+                const v4 normal =
+                    length > epsilon
+                        ? vector_mul(vector_sub(best_segment, best_triangle),
+                                     T(1) / length)
+                        : vector_mul(face, sa + sb >= T(0) ? T(1) : T(-1));
+                return {best_triangle, normal, length};
+            }
+
+        private:
+            // Clips the segment a + ab * t to the box, narrowing [t0, t1]
+            MVM_INLINE static bool clip_to_box(const v4& a,
+                                               const v4& ab,
+                                               const v4& min,
+                                               const v4& max,
+                                               T& t0,
+                                               T& t1)
+            {
+                using namespace rtm;
+                T origin[4];
+                T direction[4];
+                T lo[4];
+                T hi[4];
+                vector_store(a, origin);
+                vector_store(ab, direction);
+                vector_store(min, lo);
+                vector_store(max, hi);
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    if (math::abs(direction[i]) <= epsilon)
+                    {
+                        if (origin[i] < lo[i] || origin[i] > hi[i])
+                        {
+                            return false;
+                        }
+                        continue;
+                    }
+                    const T inv = T(1) / direction[i];
+                    const T near = (lo[i] - origin[i]) * inv;
+                    const T far = (hi[i] - origin[i]) * inv;
+                    t0 = math::max(t0, math::min(near, far));
+                    t1 = math::min(t1, math::max(near, far));
+                    if (t0 > t1)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            MVM_INLINE_NODISCARD static T box_distance_sq(const v4& p,
+                                                          const v4& min,
+                                                          const v4& max)
+            {
+                using namespace rtm;
+                const v4 d =
+                    vector_sub(p, vector_min(vector_max(p, min), max));
+                return T(vector_dot3(d, d));
+            }
+
+            // Pushes the part of a segment inside the box, from p0 to p1,
+            // out through the face that needs the shortest push
+            MVM_INLINE_NODISCARD static contact box_overlap(const v4& p0,
+                                                            const v4& p1,
+                                                            const v4& min,
+                                                            const v4& max)
+            {
+                using namespace rtm;
+                T lo_point[4];
+                T hi_point[4];
+                T lo[4];
+                T hi[4];
+                vector_store(vector_min(p0, p1), lo_point);
+                vector_store(vector_max(p0, p1), hi_point);
+                vector_store(min, lo);
+                vector_store(max, hi);
+
+                size_t axis = 0;
+                T side = T(-1);
+                T depth = std::numeric_limits<T>::infinity();
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    if (hi_point[i] - lo[i] < depth)
+                    {
+                        depth = hi_point[i] - lo[i];
+                        axis = i;
+                        side = T(-1);
+                    }
+                    if (hi[i] - lo_point[i] < depth)
+                    {
+                        depth = hi[i] - lo_point[i];
+                        axis = i;
+                        side = T(1);
+                    }
+                }
+
+                T point[4];
+                T normal[4] = {T(0), T(0), T(0), T(0)};
+                vector_store(vector_mul(vector_add(p0, p1), T(0.5)), point);
+                normal[axis] = side;
+                point[axis] = side > T(0) ? hi[axis] : lo[axis];
+                return {vector_load3(point), vector_load3(normal), -depth};
+            }
+        };
+    }  // namespace detail
+
+    /**
+     * @brief The first contact found by a capsule sweep.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct sweep_hit
+    {
+        using vec3_t = vec3<T, Acceleration::RTM>;
+
+        // How far along the displacement the contact happens, from 0 to 1
+        T fraction = T(1);
+        // The contact point on the surface that was hit
+        vec3_t point = vec3_t(0, 0, 0);
+        // The surface normal, pointing back toward the capsule
+        vec3_t normal = vec3_t(0, 1, 0);
+        // The capsule already overlapped the shape before moving
+        bool started_penetrating = false;
+    };
+
+    /**
+     * @brief A capsule: every point within `radius` of the segment from `a`
+     * to `b`.
+     *
+     * Sweeps move the capsule by a displacement, without rotating it, and
+     * report the first contact.  They advance along the displacement by
+     * the separation divided by the closing speed, which never passes the
+     * first contact because the separation between a translating convex
+     * shape and a fixed one is a convex function of time.  Planes are
+     * solid half-spaces, while triangles are two-sided.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct capsule
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using plane_t = plane<T>;
+        using sphere_t = sphere<T>;
+        using aabb_t = aabb<T>;
+        using hit_t = sweep_hit<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using component_type = T;
+
+        // Separations within this distance count as touching
+        constexpr static T contact_tolerance = T(1e-4);
+        // The most steps a sweep takes toward a contact
+        constexpr static uint32_t max_sweep_iterations = 32;
+
+    private:
+        using queries = detail::segment_queries<T>;
+        using contact_t = typename queries::contact;
+
+        rtm_vec4_t _a;
+        rtm_vec4_t _b;
+        T _radius;
+
+        // Constructors
+    public:
+        MVM_INLINE capsule() :
+            _a(rtm::vector_zero()), _b(rtm::vector_zero()), _radius(T(0))
+        {
+        }
+
+        MVM_INLINE capsule(const vec3_t& a, const vec3_t& b, const T& radius) :
+            _a(rtm::vector_set_w(a.to_rtm(), T(0))),
+            _b(rtm::vector_set_w(b.to_rtm(), T(0))),
+            _radius(radius)
+        {
+        }
+
+        MVM_INLINE capsule(const capsule& other) :
+            _a(other._a), _b(other._b), _radius(other._radius)
+        {
+        }
+
+        MVM_INLINE capsule& operator=(const capsule& other)
+        {
+            _a = other._a;
+            _b = other._b;
+            _radius = other._radius;
+            return *this;
+        }
+
+        /**
+         * @brief Creates an upright capsule, the usual character shape.
+         *
+         * @param center The middle of the capsule
+         * @param radius The radius
+         * @param half_height Half the length of the segment, so the capsule
+         * is `2 * (half_height + radius)` tall
+         */
+        MVM_INLINE_NODISCARD static capsule vertical(const vec3_t& center,
+                                                     const T& radius,
+                                                     const T& half_height)
+        {
+            const vec3_t offset(T(0), half_height, T(0));
+            return capsule(vec3_t(center - offset), vec3_t(center + offset),
+                           radius);
+        }
+
+        // Stream overload operators
+    public:
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(
+            std::basic_ostream<CharT, Traits>& os, const capsule& c)
+        {
+#if defined(MVM_HAS_MOVE_CORE)
+            os << move::meta::type_name<capsule>() << "(";
+#else
+            os << "capsule(";
+#endif
+            os << c.get_a() << ", " << c.get_b() << ", " << c.get_radius()
+               << ")";
+            return os;
+        }
+
+        // Comparison operators
+    public:
+        MVM_INLINE_NODISCARD bool operator==(const capsule& other) const
+        {
+            return rtm::vector_all_near_equal3(_a, other._a) &&
+                   rtm::vector_all_near_equal3(_b, other._b) &&
+                   math::abs(_radius - other._radius) <=
+                       std::numeric_limits<T>::epsilon();
+        }
+
+        MVM_INLINE_NODISCARD bool operator!=(const capsule& other) const
+        {
+            return !(*this == other);
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD vec3_t get_a() const
+        {
+            return vec3_t::from_rtm(_a);
+        }
+
+        MVM_INLINE_NODISCARD vec3_t get_b() const
+        {
+            return vec3_t::from_rtm(_b);
+        }
+
+        MVM_INLINE_NODISCARD T get_radius() const
+        {
+            return _radius;
+        }
+
+        // The ends of the segment, with w zeroed
+        MVM_INLINE_NODISCARD rtm_vec4_t a_rtm() const
+        {
+            return _a;
+        }
+
+        MVM_INLINE_NODISCARD rtm_vec4_t b_rtm() const
+        {
+            return _b;
+        }
+
+        MVM_INLINE_NODISCARD vec3_t center() const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(vector_mul(vector_add(_a, _b), T(0.5)));
+        }
+
+        MVM_INLINE_NODISCARD aabb_t bounds() const
+        {
+            using namespace rtm;
+            const rtm_vec4_t r = vector_set(_radius);
+            return aabb_t::from_rtm(vector_sub(vector_min(_a, _b), r),
+                                    vector_add(vector_max(_a, _b), r));
+        }
+
+        /**
+         * @brief The point of the capsule farthest along `direction`, its
+         * support mapping for gjk_distance.  A zero direction picks +Y.
+         */
+        MVM_INLINE_NODISCARD vec3_t support(const vec3_t& direction) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t d = direction.to_rtm();
+            const T length_sq = T(vector_dot3(d, d));
+            const rtm_vec4_t unit =
+                length_sq > std::numeric_limits<T>::min()
+                    ? vector_mul(d, T(1) / math::sqrt(length_sq))
+                    : queries::up();
+            const rtm_vec4_t end =
+                T(vector_dot3(vector_sub(_b, _a), d)) > T(0) ? _b : _a;
+            return vec3_t::from_rtm(vector_mul_add(unit, _radius, end));
+        }
+
+        /**
+         * @brief The capsule as its segment grown by its radius, which
+         * lets gjk_distance work on the segment alone and add the radius
+         * back.
+         */
+        MVM_INLINE_NODISCARD vec3_t core_support(
+            const vec3_t& direction) const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(
+                T(vector_dot3(vector_sub(_b, _a), direction.to_rtm())) > T(0)
+                    ? _b
+                    : _a);
+        }
+
+        MVM_INLINE_NODISCARD T margin() const
+        {
+            return _radius;
+        }
+
+        // The box covering the capsule over a whole sweep
+        MVM_INLINE_NODISCARD aabb_t swept_bounds(
+            const vec3_t& displacement) const
+        {
+            return aabb_t::merged(bounds(), translated(displacement).bounds());
+        }
+
+        MVM_INLINE_NODISCARD capsule translated(const vec3_t& offset) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t d = vector_set_w(offset.to_rtm(), T(0));
+            capsule result;
+            result._a = vector_add(_a, d);
+            result._b = vector_add(_b, d);
+            result._radius = _radius;
+            return result;
+        }
+
+        // Sweeps
+    public:
+        /**
+         * @brief Sweeps the capsule against a solid half-space.
+         *
+         * @param p The plane bounding the half-space.  Must be normalized.
+         * @param displacement The full movement of the capsule
+         * @param hit Receives the first contact.  Only written on a hit.
+         * @return bool True if the capsule touches the shape while moving,
+         * or already overlaps it
+         */
+        MVM_INLINE bool sweep(const plane_t& p,
+                              const vec3_t& displacement,
+                              hit_t& hit) const
+        {
+            const rtm_vec4_t value = p.to_rtm();
+            return sweep_impl(
+                [&](const rtm_vec4_t& a, const rtm_vec4_t& b) {
+                    return queries::plane_contact(a, b, value);
+                },
+                displacement, hit);
+        }
+
+        // Sweeps the capsule against a solid sphere.  See the plane
+        // overload.
+        MVM_INLINE bool sweep(const sphere_t& s,
+                              const vec3_t& displacement,
+                              hit_t& hit) const
+        {
+            const rtm_vec4_t center = rtm::vector_set_w(s.to_rtm(), T(0));
+            const T radius = s.get_radius();
+            return sweep_impl(
+                [&](const rtm_vec4_t& a, const rtm_vec4_t& b) {
+                    return queries::sphere_contact(a, b, center, radius);
+                },
+                displacement, hit);
+        }
+
+        // Sweeps the capsule against a solid box.  See the plane overload.
+        MVM_INLINE bool sweep(const aabb_t& box,
+                              const vec3_t& displacement,
+                              hit_t& hit) const
+        {
+            const rtm_vec4_t min = box.min_rtm();
+            const rtm_vec4_t max = box.max_rtm();
+            return sweep_impl(
+                [&](const rtm_vec4_t& a, const rtm_vec4_t& b) {
+                    return queries::box_contact(a, b, min, max);
+                },
+                displacement, hit);
+        }
+
+        // Sweeps the capsule against a two-sided triangle.  See the plane
+        // overload.
+        MVM_INLINE bool sweep_triangle(const vec3_t& v0,
+                                       const vec3_t& v1,
+                                       const vec3_t& v2,
+                                       const vec3_t& displacement,
+                                       hit_t& hit) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t p0 = vector_set_w(v0.to_rtm(), T(0));
+            const rtm_vec4_t p1 = vector_set_w(v1.to_rtm(), T(0));
+            const rtm_vec4_t p2 = vector_set_w(v2.to_rtm(), T(0));
+            return sweep_impl(
+                [&](const rtm_vec4_t& a, const rtm_vec4_t& b) {
+                    return queries::triangle_contact(a, b, p0, p1, p2);
+                },
+                displacement, hit);
+        }
+
+        // Penetration
+    public:
+        /**
+         * @brief Finds the smallest translation that separates the capsule
+         * from a solid half-space.
+         *
+         * @param p The plane bounding the half-space.  Must be normalized.
+         * @param push Receives the translation.  Only written on overlap.
+         * @return bool True if the capsule overlaps the shape
+         */
+        MVM_INLINE bool penetration(const plane_t& p, vec3_t& push) const
+        {
+            return resolve(queries::plane_contact(_a, _b, p.to_rtm()), push);
+        }
+
+        MVM_INLINE bool penetration(const sphere_t& s, vec3_t& push) const
+        {
+            return resolve(
+                queries::sphere_contact(_a, _b,
+                                        rtm::vector_set_w(s.to_rtm(), T(0)),
+                                        s.get_radius()),
+                push);
+        }
+
+        /**
+         * @brief Finds the smallest push along a box axis that separates
+         * the capsule from a solid box.
+         */
+        MVM_INLINE bool penetration(const aabb_t& box, vec3_t& push) const
+        {
+            return resolve(
+                queries::box_contact(_a, _b, box.min_rtm(), box.max_rtm()),
+                push);
+        }
+
+        MVM_INLINE bool penetration_triangle(const vec3_t& v0,
+                                             const vec3_t& v1,
+                                             const vec3_t& v2,
+                                             vec3_t& push) const
+        {
+            using namespace rtm;
+            return resolve(
+                queries::triangle_contact(_a, _b,
+                                          vector_set_w(v0.to_rtm(), T(0)),
+                                          vector_set_w(v1.to_rtm(), T(0)),
+                                          vector_set_w(v2.to_rtm(), T(0))),
+                push);
+        }
+
+    private:
+        template <typename Contact>
+        MVM_INLINE bool sweep_impl(const Contact& contact,
+                                   const vec3_t& displacement,
+                                   hit_t& hit) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t d = vector_set_w(displacement.to_rtm(), T(0));
+            T t = T(0);
+            for (uint32_t i = 0; i < max_sweep_iterations; ++i)
+            {
+                const contact_t c =
+                    contact(vector_mul_add(d, t, _a), vector_mul_add(d, t, _b));
+                const T gap = c.distance - _radius;
+                const T closing = -T(vector_dot3(d, c.normal));
+
+                if (i == 0 && gap < -contact_tolerance)
+                {
+                    write_hit(c, T(0), true, hit);
+                    return true;
+                }
+                if (gap <= contact_tolerance)
+                {
+                    // Touching, but sliding along or away from the surface
+                    if (closing <= T(0))
+                    {
+                        return false;
+                    }
+                    write_hit(c, t, false, hit);
+                    return true;
+                }
+                if (closing <= queries::epsilon)
+                {
+                    return false;
+                }
+
+                t += gap / closing;
+                if (t > T(1))
+                {
+                    return false;
+                }
+            }
+
+            // Still closing in after every step.  Stopping short is safer
+            // than tunnelling through.
+            write_hit(contact(vector_mul_add(d, t, _a),
+                              vector_mul_add(d, t, _b)),
+                      t, false, hit);
+            return true;
+        }
+
+        MVM_INLINE static void write_hit(const contact_t& c,
+                                         const T& fraction,
+                                         bool started_penetrating,
+                                         hit_t& hit)
+        {
+            hit.fraction = fraction;
+            hit.point = vec3_t::from_rtm(c.point);
+            hit.normal = vec3_t::from_rtm(c.normal);
+            hit.started_penetrating = started_penetrating;
+        }
+
+        MVM_INLINE bool resolve(const contact_t& c, vec3_t& push) const
+        {
+            const T gap = c.distance - _radius;
+            if (gap >= T(0))
+            {
+                return false;
+            }
+            push = vec3_t::from_rtm(rtm::vector_mul(c.normal, -gap));
+            return true;
+        }
+    };
+
+    using capsulef = capsule<float>;
+    using capsuled = capsule<double>;
+
+    template <typename T>
+    MVM_INLINE_NODISCARD bool approx_equal(
+        const capsule<T>& a,
+        const capsule<T>& b,
+        const T& epsilon = std::numeric_limits<T>::epsilon())
+    {
+        return approx_equal(a.get_a(), b.get_a(), epsilon) &&
+               approx_equal(a.get_b(), b.get_b(), epsilon) &&
+               math::abs(a.get_radius() - b.get_radius()) <= epsilon;
+    }
+}  // namespace move::math
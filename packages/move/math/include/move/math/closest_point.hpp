@@ -0,0 +1,750 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/vec3.hpp>
+#include <move/math/vec4.hpp>
+
+namespace move::math
+{
+    namespace detail
+    {
+        // Closest feature queries on RTM registers, shared by the public
+        // functions below and by the capsule queries
+        template <typename T>
+        struct closest_features
+        {
+            using v4 = typename simd_rtm::detail::v4<T>::type;
+
+            constexpr static T epsilon = std::numeric_limits<T>::epsilon();
+            // Segments with a squared length this small are points
+            constexpr static T degenerate_sq = std::numeric_limits<T>::min();
+
+            // `condition ? if_true : if_false`, done on the bit patterns.
+            // GCC moves arithmetic used by only one side of a ?: under a
+            // branch, and will not vectorize a packet loop around it.
+            MVM_INLINE_NODISCARD static T select(bool condition,
+                                                 const T& if_true,
+                                                 const T& if_false)
+            {
+                using bits_t =
+                    std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+                const bits_t mask = bits_t(0) - bits_t(condition);
+                return std::bit_cast<T>(
+                    (std::bit_cast<bits_t>(if_true) & mask) |
+                    (std::bit_cast<bits_t>(if_false) & ~mask));
+            }
+
+            // math::clamp to [0, 1] through select, for the same reason
+            MVM_INLINE_NODISCARD static T saturate(const T& value)
+            {
+                const T low = select(value > T(0), value, T(0));
+                return select(low < T(1), low, T(1));
+            }
+
+            // Zero unless the denominator is positive.  The division runs
+            // either way, so packet loops stay free of branches.
+            MVM_INLINE_NODISCARD static T safe_divide(const T& numerator,
+                                                      const T& denominator)
+            {
+                return select(denominator > T(0), numerator / denominator,
+                              T(0));
+            }
+
+            MVM_INLINE_NODISCARD static v4 on_segment(const v4& p,
+                                                      const v4& a,
+                                                      const v4& b)
+            {
+                using namespace rtm;
+                const v4 ab = vector_sub(b, a);
+                const T length_sq = T(vector_dot3(ab, ab));
+                const T s =
+                    length_sq > degenerate_sq
+                        ? math::clamp(T(vector_dot3(vector_sub(p, a), ab)) /
+                                          length_sq,
+                                      T(0), T(1))
+                        : T(0);
+                return vector_mul_add(ab, s, a);
+            }
+
+            /**
+             * Closest points between segments p1-q1 and p2-q2, after
+             * Ericson's Real-Time Collision Detection 5.1.9.  Segments of
+             * zero length are treated as points, and nearly parallel ones
+             * as parallel, rather than dividing by a vanishing determinant.
+             * Returns the squared distance.
+             */
+            MVM_INLINE static T on_segments(const v4& p1,
+                                            const v4& q1,
+                                            const v4& p2,
+                                            const v4& q2,
+                                            v4& c1,
+                                            v4& c2)
+            {
+                using namespace rtm;
+                const v4 d1 = vector_sub(q1, p1);
+                const v4 d2 = vector_sub(q2, p2);
+                const v4 r = vector_sub(p1, p2);
+                const T a = T(vector_dot3(d1, d1));
+                const T e = T(vector_dot3(d2, d2));
+                const T f = T(vector_dot3(d2, r));
+
+                T s = T(0);
+                T t = T(0);
+                if (a <= degenerate_sq && e <= degenerate_sq)
+                {
+                }
+                else if (a <= degenerate_sq)
+                {
+                    t = math::clamp(f / e, T(0), T(1));
+                }
+                else
+                {
+                    const T c = T(vector_dot3(d1, r));
+                    if (e <= degenerate_sq)
+                    {
+                        s = math::clamp(-c / a, T(0), T(1));
+                    }
+                    else
+                    {
+                        // Parallel segments start from p1 and slide below
+                        const T b = T(vector_dot3(d1, d2));
+                        const T denom = a * e - b * b;
+                        s = denom > epsilon * a * e
+                                ? math::clamp((b * f - c * e) / denom, T(0),
+                                              T(1))
+                                : T(0);
+                        t = (b * s + f) / e;
+                        if (t < T(0))
+                        {
+                            t = T(0);
+                            s = math::clamp(-c / a, T(0), T(1));
+                        }
+                        else if (t > T(1))
+                        {
+                            t = T(1);
+                            s = math::clamp((b - c) / a, T(0), T(1));
+                        }
+                    }
+                }
+
+                c1 = vector_mul_add(d1, s, p1);
+                c2 = vector_mul_add(d2, t, p2);
+                const v4 d = vector_sub(c1, c2);
+                return T(vector_dot3(d, d));
+            }
+
+            /**
+             * Closest point on triangle abc to p, by Voronoi region, after
+             * Ericson's Real-Time Collision Detection 5.1.5.  Triangles
+             * that collapse to a segment or a point, where the regions are
+             * undefined, use the closest point on their edges instead.
+             */
+            MVM_INLINE_NODISCARD static v4 on_triangle(const v4& p,
+                                                       const v4& a,
+                                                       const v4& b,
+                                                       const v4& c)
+            {
+                using namespace rtm;
+                const v4 ab = vector_sub(b, a);
+                const v4 ac = vector_sub(c, a);
+                const v4 n = vector_cross3(ab, ac);
+                if (T(vector_dot3(n, n)) <=
+                    epsilon * epsilon * T(vector_dot3(ab, ab)) *
+                        T(vector_dot3(ac, ac)))
+                {
+                    return on_edges(p, a, b, c);
+                }
+
+                const v4 ap = vector_sub(p, a);
+                const T d1 = T(vector_dot3(ab, ap));
+                const T d2 = T(vector_dot3(ac, ap));
+                if (d1 <= T(0) && d2 <= T(0))
+                {
+                    return a;
+                }
+
+                const v4 bp = vector_sub(p, b);
+                const T d3 = T(vector_dot3(ab, bp));
+                const T d4 = T(vector_dot3(ac, bp));
+                if (d3 >= T(0) && d4 <= d3)
+                {
+                    return b;
+                }
+
+                const T vc = d1 * d4 - d3 * d2;
+                if (vc <= T(0) && d1 >= T(0) && d3 <= T(0))
+                {
+                    return vector_mul_add(ab, safe_divide(d1, d1 - d3), a);
+                }
+
+                const v4 cp = vector_sub(p, c);
+                const T d5 = T(vector_dot3(ab, cp));
+                const T d6 = T(vector_dot3(ac, cp));
+                if (d6 >= T(0) && d5 <= d6)
+                {
+                    return c;
+                }
+
+                const T vb = d5 * d2 - d1 * d6;
+                if (vb <= T(0) && d2 >= T(0) && d6 <= T(0))
+                {
+                    return vector_mul_add(ac, safe_divide(d2, d2 - d6), a);
+                }
+
+                const T va = d3 * d6 - d5 * d4;
+                if (va <= T(0) && (d4 - d3) >= T(0) && (d5 - d6) >= T(0))
+                {
+                    return vector_mul_add(
+                        vector_sub(c, b),
+                        safe_divide(d4 - d3, (d4 - d3) + (d5 - d6)), b);
+                }
+
+                // Rounding can leave a sliver with no positive area
+                const T sum = va + vb + vc;
+                if (!(sum > T(0)))
+                {
+                    return on_edges(p, a, b, c);
+                }
+                const T denom = T(1) / sum;
+                return vector_add(a, vector_add(vector_mul(ab, vb * denom),
+                                                vector_mul(ac, vc * denom)));
+            }
+
+            MVM_INLINE_NODISCARD static v4 on_edges(const v4& p,
+                                                    const v4& a,
+                                                    const v4& b,
+                                                    const v4& c)
+            {
+                using namespace rtm;
+                v4 best = on_segment(p, a, b);
+                v4 offset = vector_sub(p, best);
+                T best_sq = T(vector_dot3(offset, offset));
+                for (const v4& candidate :
+                     {on_segment(p, b, c), on_segment(p, c, a)})
+                {
+                    offset = vector_sub(p, candidate);
+                    const T d = T(vector_dot3(offset, offset));
+                    if (d < best_sq)
+                    {
+                        best_sq = d;
+                        best = candidate;
+                    }
+                }
+                return best;
+            }
+        };
+    }  // namespace detail
+
+    /**
+     * @brief The closest point on segment ab to p.  A segment of zero
+     * length is the point a.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD vec3<T, Acceleration::RTM> closest_point_on_segment(
+        const vec3<T, Acceleration::RTM>& p,
+        const vec3<T, Acceleration::RTM>& a,
+        const vec3<T, Acceleration::RTM>& b)
+    {
+        return vec3<T, Acceleration::RTM>::from_rtm(
+            detail::closest_features<T>::on_segment(p.to_rtm(), a.to_rtm(),
+                                                    b.to_rtm()));
+    }
+
+    /**
+     * @brief The closest point on triangle abc to p.  Triangles that
+     * collapse to a segment or a point are handled as such.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD vec3<T, Acceleration::RTM> closest_point_on_triangle(
+        const vec3<T, Acceleration::RTM>& p,
+        const vec3<T, Acceleration::RTM>& a,
+        const vec3<T, Acceleration::RTM>& b,
+        const vec3<T, Acceleration::RTM>& c)
+    {
+        return vec3<T, Acceleration::RTM>::from_rtm(
+            detail::closest_features<T>::on_triangle(
+                p.to_rtm(), a.to_rtm(), b.to_rtm(), c.to_rtm()));
+    }
+
+    /**
+     * @brief The closest points between segments p1-q1 and p2-q2.  When
+     * several pairs are equally close, as for overlapping parallel
+     * segments, one of them is returned.
+     *
+     * @param c1 Receives the closest point on p1-q1
+     * @param c2 Receives the closest point on p2-q2
+     * @return T The squared distance between the segments
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE T closest_points_on_segments(
+        const vec3<T, Acceleration::RTM>& p1,
+        const vec3<T, Acceleration::RTM>& q1,
+        const vec3<T, Acceleration::RTM>& p2,
+        const vec3<T, Acceleration::RTM>& q2,
+        vec3<T, Acceleration::RTM>& c1,
+        vec3<T, Acceleration::RTM>& c2)
+    {
+        typename detail::closest_features<T>::v4 on_first;
+        typename detail::closest_features<T>::v4 on_second;
+        const T distance_sq = detail::closest_features<T>::on_segments(
+            p1.to_rtm(), q1.to_rtm(), p2.to_rtm(), q2.to_rtm(), on_first,
+            on_second);
+        c1 = vec3<T, Acceleration::RTM>::from_rtm(on_first);
+        c2 = vec3<T, Acceleration::RTM>::from_rtm(on_second);
+        return distance_sq;
+    }
+
+    // The squared distance between segments p1-q1 and p2-q2
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD T
+    segment_distance_sq(const vec3<T, Acceleration::RTM>& p1,
+                        const vec3<T, Acceleration::RTM>& q1,
+                        const vec3<T, Acceleration::RTM>& p2,
+                        const vec3<T, Acceleration::RTM>& q2)
+    {
+        vec3<T, Acceleration::RTM> c1;
+        vec3<T, Acceleration::RTM> c2;
+        return closest_points_on_segments(p1, q1, p2, q2, c1, c2);
+    }
+
+    /**
+     * @brief A structure-of-arrays packet of `Width` triangles, for finding
+     * closest points on many triangles at once.
+     *
+     * Every lane runs the same branch-free arithmetic: each Voronoi region
+     * is evaluated and the first that applies is selected.  GCC vectorizes
+     * the loop across the packet at -O3 once AVX2 is enabled, which
+     * building the mask of degenerate lanes with per-lane shifts needs.
+     * Lanes whose triangle collapses to a segment or a point are redone
+     * one at a time with closest_point_on_triangle afterwards.
+     */
+    template <typename T, size_t Width>
+        requires std::is_floating_point_v<T> && (Width == 4 || Width == 8)
+    struct alignas(Width * sizeof(T)) triangle_packet
+    {
+    public:
+        using vec3_t = vec3<T, Acceleration::RTM>;
+        using component_type = T;
+
+        constexpr static size_t width = Width;
+
+        T a_x[Width];
+        T a_y[Width];
+        T a_z[Width];
+        T b_x[Width];
+        T b_y[Width];
+        T b_z[Width];
+        T c_x[Width];
+        T c_y[Width];
+        T c_z[Width];
+
+        // Constructors
+    public:
+        /**
+         * @brief Gathers up to `Width` triangles into a packet.  Lanes past
+         * `count` repeat the first triangle.
+         *
+         * @param vertices Three vertices per triangle
+         * @param count The number of triangles, at most Width
+         */
+        MVM_INLINE_NODISCARD static triangle_packet load(
+            const vec3_t* vertices,
+            size_t count)
+        {
+            MVM_ASSERT_PRECONDITION(count <= Width);
+            triangle_packet packet;
+            for (size_t i = 0; i < Width; ++i)
+            {
+                const vec3_t* v = vertices + 3 * (i < count ? i : 0);
+                packet.a_x[i] = v[0].get_x();
+                packet.a_y[i] = v[0].get_y();
+                packet.a_z[i] = v[0].get_z();
+                packet.b_x[i] = v[1].get_x();
+                packet.b_y[i] = v[1].get_y();
+                packet.b_z[i] = v[1].get_z();
+                packet.c_x[i] = v[2].get_x();
+                packet.c_y[i] = v[2].get_y();
+                packet.c_z[i] = v[2].get_z();
+            }
+            return packet;
+        }
+
+        // Queries
+    public:
+        /**
+         * @brief Finds the closest point on each lane's triangle to the
+         * same lane's point.  None of the arrays may overlap.
+         *
+         * @param points `Width` points
+         * @param out Receives `Width` closest points
+         * @param distance_sq Receives the squared distance of each lane
+         */
+        MVM_INLINE void closest_points(soa_vec3<const T> points,
+                                       soa_vec3<T> out,
+                                       T* distance_sq) const
+        {
+            const uint32_t degenerate =
+                lanes(points.x, points.y, points.z, out.x, out.y, out.z,
+                      distance_sq);
+            redo(degenerate, points, out, distance_sq);
+        }
+
+        /**
+         * @brief Finds the closest point on each lane's triangle to one
+         * point.
+         *
+         * @param point The point
+         * @param out Receives `Width` closest points
+         * @param distance_sq Receives the squared distance of each lane
+         */
+        MVM_INLINE void closest_points(const vec3_t& point,
+                                       soa_vec3<T> out,
+                                       T* distance_sq) const
+        {
+            T xs[Width];
+            T ys[Width];
+            T zs[Width];
+            for (size_t i = 0; i < Width; ++i)
+            {
+                xs[i] = point.get_x();
+                ys[i] = point.get_y();
+                zs[i] = point.get_z();
+            }
+            closest_points(soa_vec3<const T>{xs, ys, zs}, out, distance_sq);
+        }
+
+    private:
+        // Runs every lane and returns the mask of degenerate ones.  None of
+        // the arrays may overlap, which spares GCC more run-time overlap
+        // checks than it allows before vectorizing.
+        MVM_INLINE uint32_t lanes(const T* MVM_RESTRICT px,
+                                  const T* MVM_RESTRICT py,
+                                  const T* MVM_RESTRICT pz,
+                                  T* MVM_RESTRICT out_x,
+                                  T* MVM_RESTRICT out_y,
+                                  T* MVM_RESTRICT out_z,
+                                  T* MVM_RESTRICT distance_sq) const
+        {
+            uint32_t degenerate = 0;
+            for (size_t i = 0; i < Width; ++i)
+            {
+                degenerate |= uint32_t(lane(i, px[i], py[i], pz[i], out_x[i],
+                                            out_y[i], out_z[i],
+                                            distance_sq[i]))
+                              << i;
+            }
+            return degenerate;
+        }
+
+        // Returns whether the triangle is degenerate, which leaves the
+        // outputs to be redone
+        MVM_INLINE bool lane(size_t i,
+                             const T& px,
+                             const T& py,
+                             const T& pz,
+                             T& out_x,
+                             T& out_y,
+                             T& out_z,
+                             T& distance_sq) const
+        {
+            using features = detail::closest_features<T>;
+            constexpr T epsilon = features::epsilon;
+
+            const T abx = b_x[i] - a_x[i];
+            const T aby = b_y[i] - a_y[i];
+            const T abz = b_z[i] - a_z[i];
+            const T acx = c_x[i] - a_x[i];
+            const T acy = c_y[i] - a_y[i];
+            const T acz = c_z[i] - a_z[i];
+            const T apx = px - a_x[i];
+            const T apy = py - a_y[i];
+            const T apz = pz - a_z[i];
+            const T bpx = px - b_x[i];
+            const T bpy = py - b_y[i];
+            const T bpz = pz - b_z[i];
+            const T cpx = px - c_x[i];
+            const T cpy = py - c_y[i];
+            const T cpz = pz - c_z[i];
+
+            const T d1 = abx * apx + aby * apy + abz * apz;
+            const T d2 = acx * apx + acy * apy + acz * apz;
+            const T d3 = abx * bpx + aby * bpy + abz * bpz;
+            const T d4 = acx * bpx + acy * bpy + acz * bpz;
+            const T d5 = abx * cpx + aby * cpy + abz * cpz;
+            const T d6 = acx * cpx + acy * cpy + acz * cpz;
+            const T va = d3 * d6 - d5 * d4;
+            const T vb = d5 * d2 - d1 * d6;
+            const T vc = d1 * d4 - d3 * d2;
+            const T sum = va + vb + vc;
+
+            // The barycentric weights of b and c, from the lowest priority
+            // region up, so the first region that applies wins
+            // A sum that is not positive is left to redo if no region
+            // applies, so its reciprocal needs no guard
+            const T inv_sum = T(1) / sum;
+            T v = vb * inv_sum;
+            T w = vc * inv_sum;
+
+            const bool on_bc = (va <= T(0)) & (d4 - d3 >= T(0)) &
+                               (d5 - d6 >= T(0));
+            const T bc =
+                features::safe_divide(d4 - d3, (d4 - d3) + (d5 - d6));
+            v = features::select(on_bc, T(1) - bc, v);
+            w = features::select(on_bc, bc, w);
+
+            const bool on_ac = (vb <= T(0)) & (d2 >= T(0)) & (d6 <= T(0));
+            v = features::select(on_ac, T(0), v);
+            w = features::select(on_ac, features::safe_divide(d2, d2 - d6),
+                                 w);
+
+            const bool at_c = (d6 >= T(0)) & (d5 <= d6);
+            v = features::select(at_c, T(0), v);
+            w = features::select(at_c, T(1), w);
+
+            const bool on_ab = (vc <= T(0)) & (d1 >= T(0)) & (d3 <= T(0));
+            v = features::select(on_ab, features::safe_divide(d1, d1 - d3),
+                                 v);
+            w = features::select(on_ab, T(0), w);
+
+            const bool at_b = (d3 >= T(0)) & (d4 <= d3);
+            v = features::select(at_b, T(1), v);
+            w = features::select(at_b, T(0), w);
+
+            const bool at_a = (d1 <= T(0)) & (d2 <= T(0));
+            v = features::select(at_a, T(0), v);
+            w = features::select(at_a, T(0), w);
+
+            out_x = a_x[i] + abx * v + acx * w;
+            out_y = a_y[i] + aby * v + acy * w;
+            out_z = a_z[i] + abz * v + acz * w;
+            const T dx = px - out_x;
+            const T dy = py - out_y;
+            const T dz = pz - out_z;
+            distance_sq = dx * dx + dy * dy + dz * dz;
+
+            const T nx = aby * acz - abz * acy;
+            const T ny = abz * acx - abx * acz;
+            const T nz = abx * acy - aby * acx;
+            const bool inside = !(at_a | at_b | on_ab | at_c | on_ac | on_bc);
+            return (nx * nx + ny * ny + nz * nz <=
+                    epsilon * epsilon * (abx * abx + aby * aby + abz * abz) *
+                        (acx * acx + acy * acy + acz * acz)) |
+                   (inside & !(sum > T(0)));
+        }
+
+        MVM_INLINE void redo(uint32_t lanes,
+                             soa_vec3<const T> points,
+                             soa_vec3<T> out,
+                             T* distance_sq) const
+        {
+            for (; lanes != 0; lanes &= lanes - 1)
+            {
+                const size_t i = size_t(std::countr_zero(lanes));
+                const vec3_t p(points.x[i], points.y[i], points.z[i]);
+                const vec3_t q = closest_point_on_triangle(
+                    p, vec3_t(a_x[i], a_y[i], a_z[i]),
+                    vec3_t(b_x[i], b_y[i], b_z[i]),
+                    vec3_t(c_x[i], c_y[i], c_z[i]));
+                out.x[i] = q.get_x();
+                out.y[i] = q.get_y();
+                out.z[i] = q.get_z();
+                const vec3_t d = vec3_t(p - q);
+                distance_sq[i] = d.get_x() * d.get_x() +
+                                 d.get_y() * d.get_y() +
+                                 d.get_z() * d.get_z();
+            }
+        }
+    };
+
+    /**
+     * @brief A structure-of-arrays packet of `Width` segments, for finding
+     * closest points between many pairs of segments at once.
+     *
+     * Every lane runs the same branch-free arithmetic as
+     * closest_points_on_segments, degenerate and parallel cases included,
+     * so a lane gives the same points as the single query up to rounding.
+     * GCC vectorizes the loop across the packet at -O3 once AVX2 is
+     * enabled.
+     * Results are the parameters `s` along this packet's segments and `t`
+     * along the others, from 0 at the first point to 1 at the second.
+     */
+    template <typename T, size_t Width>
+        requires std::is_floating_point_v<T> && (Width == 4 || Width == 8)
+    struct alignas(Width * sizeof(T)) segment_packet
+    {
+    public:
+        using vec3_t = vec3<T, Acceleration::RTM>;
+        using component_type = T;
+
+        constexpr static size_t width = Width;
+
+        T p_x[Width];
+        T p_y[Width];
+        T p_z[Width];
+        T q_x[Width];
+        T q_y[Width];
+        T q_z[Width];
+
+        // Constructors
+    public:
+        /**
+         * @brief Gathers up to `Width` segments into a packet.  Lanes past
+         * `count` repeat the first segment.
+         *
+         * @param endpoints Two endpoints per segment
+         * @param count The number of segments, at most Width
+         */
+        MVM_INLINE_NODISCARD static segment_packet load(
+            const vec3_t* endpoints,
+            size_t count)
+        {
+            MVM_ASSERT_PRECONDITION(count <= Width);
+            segment_packet packet;
+            for (size_t i = 0; i < Width; ++i)
+            {
+                const vec3_t* v = endpoints + 2 * (i < count ? i : 0);
+                packet.p_x[i] = v[0].get_x();
+                packet.p_y[i] = v[0].get_y();
+                packet.p_z[i] = v[0].get_z();
+                packet.q_x[i] = v[1].get_x();
+                packet.q_y[i] = v[1].get_y();
+                packet.q_z[i] = v[1].get_z();
+            }
+            return packet;
+        }
+
+        // Queries
+    public:
+        /**
+         * @brief Finds the closest points between each lane's segment and
+         * the same lane of `other`.
+         *
+         * @param other The segments to measure against
+         * @param s Receives the parameter along this packet's segments
+         * @param t Receives the parameter along `other`'s segments
+         * @param distance_sq Receives the squared distance of each lane
+         */
+        MVM_INLINE void closest_points(const segment_packet& other,
+                                       T* s,
+                                       T* t,
+                                       T* distance_sq) const
+        {
+            for (size_t i = 0; i < Width; ++i)
+            {
+                lane(i, other.p_x[i], other.p_y[i], other.p_z[i],
+                     other.q_x[i], other.q_y[i], other.q_z[i], s[i], t[i],
+                     distance_sq[i]);
+            }
+        }
+
+        /**
+         * @brief Finds the closest points between each lane's segment and
+         * one segment p-q.
+         *
+         * @param s Receives the parameter along this packet's segments
+         * @param t Receives the parameter along p-q
+         * @param distance_sq Receives the squared distance of each lane
+         */
+        MVM_INLINE void closest_points(const vec3_t& p,
+                                       const vec3_t& q,
+                                       T* s,
+                                       T* t,
+                                       T* distance_sq) const
+        {
+            const T px = p.get_x();
+            const T py = p.get_y();
+            const T pz = p.get_z();
+            const T qx = q.get_x();
+            const T qy = q.get_y();
+            const T qz = q.get_z();
+            for (size_t i = 0; i < Width; ++i)
+            {
+                lane(i, px, py, pz, qx, qy, qz, s[i], t[i], distance_sq[i]);
+            }
+        }
+
+    private:
+        MVM_INLINE void lane(size_t i,
+                             const T& p2x,
+                             const T& p2y,
+                             const T& p2z,
+                             const T& q2x,
+                             const T& q2y,
+                             const T& q2z,
+                             T& out_s,
+                             T& out_t,
+                             T& distance_sq) const
+        {
+            using features = detail::closest_features<T>;
+            constexpr T epsilon = features::epsilon;
+            constexpr T degenerate_sq = features::degenerate_sq;
+
+            const T d1x = q_x[i] - p_x[i];
+            const T d1y = q_y[i] - p_y[i];
+            const T d1z = q_z[i] - p_z[i];
+            const T d2x = q2x - p2x;
+            const T d2y = q2y - p2y;
+            const T d2z = q2z - p2z;
+            const T rx = p_x[i] - p2x;
+            const T ry = p_y[i] - p2y;
+            const T rz = p_z[i] - p2z;
+            const T a = d1x * d1x + d1y * d1y + d1z * d1z;
+            const T e = d2x * d2x + d2y * d2y + d2z * d2z;
+            const T f = d2x * rx + d2y * ry + d2z * rz;
+            const T c = d1x * rx + d1y * ry + d1z * rz;
+            const T b = d1x * d2x + d1y * d2y + d1z * d2z;
+            const bool first_point = a <= degenerate_sq;
+            const bool second_point = e <= degenerate_sq;
+            const T inv_a = features::select(first_point, T(0), T(1) / a);
+            const T inv_e = features::select(second_point, T(0), T(1) / e);
+
+            // A point first segment stays at s = 0 through the clamps
+            // below, as inv_a is zero; a point second segment needs s
+            // projected onto the first
+            const T denom = a * e - b * b;
+            const bool parallel = !(denom > epsilon * a * e);
+            // denom > 0 whenever the segments are not parallel
+            const T s_general = features::saturate((b * f - c * e) / denom);
+            T s = features::select(parallel, T(0), s_general);
+            T t = (b * s + f) * inv_e;
+            const T s_at_0 = features::saturate(-c * inv_a);
+            const T s_at_1 = features::saturate((b - c) * inv_a);
+            const bool below = t < T(0);
+            const bool above = t > T(1);
+            s = features::select(above, s_at_1, s);
+            s = features::select(below, s_at_0, s);
+            t = features::saturate(t);
+            s = features::select(second_point, s_at_0, s);
+            t = features::select(second_point, T(0), t);
+
+            const T dx = rx + d1x * s - d2x * t;
+            const T dy = ry + d1y * s - d2y * t;
+            const T dz = rz + d1z * s - d2z * t;
+            out_s = s;
+            out_t = t;
+            distance_sq = dx * dx + dy * dy + dz * dz;
+        }
+    };
+
+    template <typename T>
+    using triangle_packet4 = triangle_packet<T, 4>;
+    template <typename T>
+    using triangle_packet8 = triangle_packet<T, 8>;
+    template <typename T>
+    using segment_packet4 = segment_packet<T, 4>;
+    template <typename T>
+    using segment_packet8 = segment_packet<T, 8>;
+}  // namespace move::math
@@ -0,0 +1,676 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/aabb.hpp>
+#include <move/math/capsule.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/plane.hpp>
+#include <move/math/sphere.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    enum class collision_shape_type : uint8_t
+    {
+        sphere,
+        box,
+        triangle
+    };
+
+    /**
+     * @brief A static set of planes, spheres, boxes and triangles that
+     * capsules can be swept through and pushed out of, enough to back a
+     * character controller.
+     *
+     * Planes are unbounded and always tested.  The other shapes go through
+     * a sort and sweep broadphase: `build` sorts their bounds by minimum x
+     * into separate arrays per component, so a query binary searches the
+     * range of shapes that can reach it along x and tests the rest of the
+     * bounds a block at a time in a loop the compiler vectorizes.
+     *
+     * Shapes added after `build` are not found until it is called again.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct collision_world
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using plane_t = plane<T>;
+        using sphere_t = sphere<T>;
+        using aabb_t = aabb<T>;
+        using capsule_t = capsule<T>;
+        using hit_t = sweep_hit<T>;
+        using component_type = T;
+
+        // How many candidates a query tests per vectorized block
+        constexpr static size_t query_block_size = 64;
+        // The most capsules `sweep_capsules` takes at once
+        constexpr static size_t packet_width = 8;
+        // How far past touching depenetration pushes, so the next sweep
+        // starts clear of the surface
+        constexpr static T depenetration_slop =
+            T(2) * capsule_t::contact_tolerance;
+
+        struct shape_ref
+        {
+            collision_shape_type type;
+            uint32_t index;
+        };
+
+    private:
+        std::vector<plane_t> _planes;
+        std::vector<sphere_t> _spheres;
+        std::vector<aabb_t> _boxes;
+        std::vector<vec3_t> _triangles;
+
+        // Broadphase, sorted by _min_x
+        std::vector<shape_ref> _refs;
+        std::vector<T> _min_x;
+        std::vector<T> _min_y;
+        std::vector<T> _min_z;
+        std::vector<T> _max_x;
+        std::vector<T> _max_y;
+        std::vector<T> _max_z;
+        T _max_width = T(0);
+
+        // Constructors
+    public:
+        collision_world() = default;
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD size_t plane_count() const
+        {
+            return _planes.size();
+        }
+
+        MVM_INLINE_NODISCARD size_t sphere_count() const
+        {
+            return _spheres.size();
+        }
+
+        MVM_INLINE_NODISCARD size_t box_count() const
+        {
+            return _boxes.size();
+        }
+
+        MVM_INLINE_NODISCARD size_t triangle_count() const
+        {
+            return _triangles.size() / 3;
+        }
+
+        // Mutators
+    public:
+        // The plane must be normalized.  Its back is solid.
+        MVM_INLINE uint32_t add_plane(const plane_t& p)
+        {
+            _planes.push_back(p);
+            return uint32_t(_planes.size() - 1);
+        }
+
+        MVM_INLINE uint32_t add_sphere(const sphere_t& s)
+        {
+            _spheres.push_back(s);
+            return uint32_t(_spheres.size() - 1);
+        }
+
+        MVM_INLINE uint32_t add_box(const aabb_t& box)
+        {
+            _boxes.push_back(box);
+            return uint32_t(_boxes.size() - 1);
+        }
+
+        // Triangles are two-sided, so the winding does not matter
+        MVM_INLINE uint32_t add_triangle(const vec3_t& v0,
+                                         const vec3_t& v1,
+                                         const vec3_t& v2)
+        {
+            _triangles.push_back(v0);
+            _triangles.push_back(v1);
+            _triangles.push_back(v2);
+            return uint32_t(_triangles.size() / 3 - 1);
+        }
+
+        void clear()
+        {
+            _planes.clear();
+            _spheres.clear();
+            _boxes.clear();
+            _triangles.clear();
+            build();
+        }
+
+        /**
+         * @brief Rebuilds the broadphase from every shape added so far.
+         * Must be called before querying.
+         */
+        void build()
+        {
+            const size_t count =
+                _spheres.size() + _boxes.size() + triangle_count();
+            std::vector<shape_ref> refs;
+            std::vector<aabb_t> bounds;
+            refs.reserve(count);
+            bounds.reserve(count);
+            for (uint32_t i = 0; i < _spheres.size(); ++i)
+            {
+                const T r = _spheres[i].get_radius();
+                refs.push_back({collision_shape_type::sphere, i});
+                bounds.push_back(aabb_t::from_center_extents(
+                    _spheres[i].get_center(), vec3_t(r, r, r)));
+            }
+            for (uint32_t i = 0; i < _boxes.size(); ++i)
+            {
+                refs.push_back({collision_shape_type::box, i});
+                bounds.push_back(_boxes[i]);
+            }
+            for (uint32_t i = 0; i < triangle_count(); ++i)
+            {
+                aabb_t box;
+                box.expand(_triangles[i * 3]);
+                box.expand(_triangles[i * 3 + 1]);
+                box.expand(_triangles[i * 3 + 2]);
+                refs.push_back({collision_shape_type::triangle, i});
+                bounds.push_back(box);
+            }
+
+            std::vector<uint32_t> order(count);
+            std::iota(order.begin(), order.end(), uint32_t(0));
+            std::sort(order.begin(), order.end(),
+                      [&bounds](uint32_t a, uint32_t b) {
+                          return rtm::vector_get_x(bounds[a].min_rtm()) <
+                                 rtm::vector_get_x(bounds[b].min_rtm());
+                      });
+
+            _refs.resize(count);
+            _min_x.resize(count);
+            _min_y.resize(count);
+            _min_z.resize(count);
+            _max_x.resize(count);
+            _max_y.resize(count);
+            _max_z.resize(count);
+            _max_width = T(0);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const aabb_t& box = bounds[order[i]];
+                T lo[4];
+                T hi[4];
+                rtm::vector_store(box.min_rtm(), lo);
+                rtm::vector_store(box.max_rtm(), hi);
+                _refs[i] = refs[order[i]];
+                _min_x[i] = lo[0];
+                _min_y[i] = lo[1];
+                _min_z[i] = lo[2];
+                _max_x[i] = hi[0];
+                _max_y[i] = hi[1];
+                _max_z[i] = hi[2];
+                _max_width = math::max(_max_width, hi[0] - lo[0]);
+            }
+        }
+
+        // Queries
+    public:
+        /**
+         * @brief Calls `callback(shape_ref)` for every bounded shape whose
+         * bounds overlap `box`.  Planes are not reported.
+         */
+        template <typename Callback>
+        MVM_INLINE void query(const aabb_t& box, Callback&& callback) const
+        {
+            query_sorted(box,
+                         [&](size_t index) { callback(_refs[index]); });
+        }
+
+        /**
+         * @brief Sweeps a capsule through the world and reports the
+         * earliest contact.
+         *
+         * @param c The capsule at the start of the move
+         * @param displacement The full movement
+         * @param hit Receives the earliest contact.  Only written on a hit.
+         * @return bool True if anything was hit, or already overlapped
+         */
+        MVM_INLINE bool sweep_capsule(const capsule_t& c,
+                                      const vec3_t& displacement,
+                                      hit_t& hit) const
+        {
+            bool found = false;
+            hit_t candidate;
+            const auto keep = [&](bool touched) {
+                if (touched && (!found || precedes(candidate, hit)))
+                {
+                    hit = candidate;
+                    found = true;
+                }
+            };
+
+            for (const plane_t& p : _planes)
+            {
+                keep(c.sweep(p, displacement, candidate));
+            }
+
+            aabb_t bounds = c.swept_bounds(displacement);
+            bounds.inflate(capsule_t::contact_tolerance);
+            query(bounds, [&](const shape_ref& ref) {
+                keep(sweep_shape(c, ref, displacement, candidate));
+            });
+            return found;
+        }
+
+        /**
+         * @brief Sweeps a packet of capsules together.  The packet shares
+         * one broadphase query over the union of its swept bounds, and
+         * each shape found is checked against the bounds of every lane at
+         * once before any narrowphase work, so packets of nearby capsules
+         * share most of the cost.
+         *
+         * @param capsules The capsule of each lane
+         * @param displacements The full movement of each lane
+         * @param count The number of lanes, at most `packet_width`
+         * @param mask Bit `i` set to sweep lane `i`
+         * @param hits Receives the earliest contact of each lane.  Only
+         * written for lanes that hit.
+         * @return uint32_t Bit `i` set when lane `i` hit anything
+         */
+        MVM_INLINE uint32_t sweep_capsules(const capsule_t* capsules,
+                                           const vec3_t* displacements,
+                                           size_t count,
+                                           uint32_t mask,
+                                           hit_t* hits) const
+        {
+            MVM_ASSERT_PRECONDITION(count <= packet_width);
+            mask &= (uint32_t(1) << count) - 1;
+            if (mask == 0)
+            {
+                return 0;
+            }
+
+            // Lanes outside the mask get empty bounds, which overlap nothing
+            T lo_x[packet_width];
+            T lo_y[packet_width];
+            T lo_z[packet_width];
+            T hi_x[packet_width];
+            T hi_y[packet_width];
+            T hi_z[packet_width];
+            aabb_t packet_bounds;
+            for (size_t lane = 0; lane < packet_width; ++lane)
+            {
+                aabb_t bounds;
+                if ((mask >> lane) & 1)
+                {
+                    bounds = capsules[lane].swept_bounds(displacements[lane]);
+                    bounds.inflate(capsule_t::contact_tolerance);
+                    packet_bounds.expand(bounds);
+                }
+                T lo[4];
+                T hi[4];
+                rtm::vector_store(bounds.min_rtm(), lo);
+                rtm::vector_store(bounds.max_rtm(), hi);
+                lo_x[lane] = lo[0];
+                lo_y[lane] = lo[1];
+                lo_z[lane] = lo[2];
+                hi_x[lane] = hi[0];
+                hi_y[lane] = hi[1];
+                hi_z[lane] = hi[2];
+            }
+
+            uint32_t hit_mask = 0;
+            hit_t candidate;
+            const auto keep = [&](size_t lane, bool touched) {
+                if (touched && (!((hit_mask >> lane) & 1) ||
+                                precedes(candidate, hits[lane])))
+                {
+                    hits[lane] = candidate;
+                    hit_mask |= uint32_t(1) << lane;
+                }
+            };
+
+            sweep_planes(capsules, displacements, count, mask, hits,
+                         hit_mask);
+
+            query_sorted(packet_bounds, [&](size_t index) {
+                uint8_t overlap[packet_width];
+                for (size_t lane = 0; lane < packet_width; ++lane)
+                {
+                    overlap[lane] = uint8_t((_min_x[index] <= hi_x[lane]) &
+                                            (_max_x[index] >= lo_x[lane]) &
+                                            (_min_y[index] <= hi_y[lane]) &
+                                            (_max_y[index] >= lo_y[lane]) &
+                                            (_min_z[index] <= hi_z[lane]) &
+                                            (_max_z[index] >= lo_z[lane]));
+                }
+                for (size_t lane = 0; lane < count; ++lane)
+                {
+                    if (overlap[lane])
+                    {
+                        keep(lane, sweep_shape(capsules[lane], _refs[index],
+                                               displacements[lane],
+                                               candidate));
+                    }
+                }
+            });
+            return hit_mask;
+        }
+
+        /**
+         * @brief Finds an offset that moves a capsule out of everything it
+         * overlaps.  Each pass pushes it out of the shapes one at a time,
+         * which settles in a few passes unless the capsule is wedged
+         * between shapes.
+         *
+         * @param c The capsule
+         * @param offset Receives the total push.  Only written on overlap.
+         * @param passes The most passes over the overlapping shapes
+         * @return bool True if the capsule overlapped anything
+         */
+        MVM_INLINE bool depenetrate_capsule(const capsule_t& c,
+                                            vec3_t& offset,
+                                            uint32_t passes = 4) const
+        {
+            vec3_t total(0, 0, 0);
+            bool overlapped = false;
+            for (uint32_t pass = 0; pass < passes; ++pass)
+            {
+                bool moved = false;
+                vec3_t push;
+                const auto apply = [&](bool touched) {
+                    if (touched)
+                    {
+                        // Overlaps always push a nonzero distance
+                        const T length = push.length();
+                        total = vec3_t(total + push * ((length +
+                                                        depenetration_slop) /
+                                                       length));
+                        moved = true;
+                    }
+                };
+
+                for (const plane_t& p : _planes)
+                {
+                    apply(c.translated(total).penetration(p, push));
+                }
+                query(c.translated(total).bounds(),
+                      [&](const shape_ref& ref) {
+                          apply(penetration_shape(c.translated(total), ref,
+                                                  push));
+                      });
+
+                overlapped |= moved;
+                if (!moved)
+                {
+                    break;
+                }
+            }
+
+            if (overlapped)
+            {
+                offset = total;
+            }
+            return overlapped;
+        }
+
+        /**
+         * @brief Sweeps a capsule straight down to look for ground.
+         *
+         * @param c The capsule
+         * @param distance How far below the capsule to look
+         * @param normal Receives the normal of the ground found
+         * @return bool True if there was ground within `distance`
+         */
+        MVM_INLINE bool probe_ground(const capsule_t& c,
+                                     const T& distance,
+                                     vec3_t& normal) const
+        {
+            hit_t hit;
+            if (!sweep_capsule(c, vec3_t(T(0), -distance, T(0)), hit))
+            {
+                return false;
+            }
+            normal = hit.normal;
+            return true;
+        }
+
+    private:
+        using queries = detail::segment_queries<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+
+        // Calls `callback(index)` with the sorted index of every bounded
+        // shape whose bounds overlap `box`
+        template <typename Callback>
+        MVM_INLINE void query_sorted(const aabb_t& box,
+                                     Callback&& callback) const
+        {
+            T lo[4];
+            T hi[4];
+            rtm::vector_store(box.min_rtm(), lo);
+            rtm::vector_store(box.max_rtm(), hi);
+
+            // Sorted by minimum x, so only shapes starting within the widest
+            // shape's width of the query can reach it
+            const size_t first = size_t(
+                std::lower_bound(_min_x.begin(), _min_x.end(),
+                                 lo[0] - _max_width) -
+                _min_x.begin());
+            const size_t last = size_t(
+                std::upper_bound(_min_x.begin(), _min_x.end(), hi[0]) -
+                _min_x.begin());
+
+            uint8_t overlap[query_block_size];
+            for (size_t start = first; start < last;
+                 start += query_block_size)
+            {
+                const size_t n = math::min(query_block_size, last - start);
+                const T* max_x = _max_x.data() + start;
+                const T* min_y = _min_y.data() + start;
+                const T* max_y = _max_y.data() + start;
+                const T* min_z = _min_z.data() + start;
+                const T* max_z = _max_z.data() + start;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    overlap[i] = uint8_t((max_x[i] >= lo[0]) &
+                                         (min_y[i] <= hi[1]) &
+                                         (max_y[i] >= lo[1]) &
+                                         (min_z[i] <= hi[2]) &
+                                         (max_z[i] >= lo[2]));
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (overlap[i])
+                    {
+                        callback(start + i);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Sweeps a packet against every plane.  Both ends of a capsule
+         * move together, so the end nearest a plane stays nearest and the
+         * contact time is a single division.  The lanes are laid out one
+         * array per component and solved in one loop per plane, which
+         * matches capsule::sweep lane for lane.
+         */
+        MVM_INLINE void sweep_planes(const capsule_t* capsules,
+                                     const vec3_t* displacements,
+                                     size_t count,
+                                     uint32_t mask,
+                                     hit_t* hits,
+                                     uint32_t& hit_mask) const
+        {
+            using namespace rtm;
+            if (_planes.empty())
+            {
+                return;
+            }
+
+            constexpr T tolerance = capsule_t::contact_tolerance;
+            constexpr T epsilon = std::numeric_limits<T>::epsilon();
+            T ax[packet_width];
+            T ay[packet_width];
+            T az[packet_width];
+            T bx[packet_width];
+            T by[packet_width];
+            T bz[packet_width];
+            T dx[packet_width];
+            T dy[packet_width];
+            T dz[packet_width];
+            T radius[packet_width];
+            for (size_t lane = 0; lane < packet_width; ++lane)
+            {
+                T a[4] = {T(0), T(0), T(0), T(0)};
+                T b[4] = {T(0), T(0), T(0), T(0)};
+                T d[4] = {T(0), T(0), T(0), T(0)};
+                radius[lane] = T(0);
+                if (lane < count)
+                {
+                    vector_store(capsules[lane].a_rtm(), a);
+                    vector_store(capsules[lane].b_rtm(), b);
+                    vector_store(displacements[lane].to_rtm(), d);
+                    radius[lane] = capsules[lane].get_radius();
+                }
+                ax[lane] = a[0];
+                ay[lane] = a[1];
+                az[lane] = a[2];
+                bx[lane] = b[0];
+                by[lane] = b[1];
+                bz[lane] = b[2];
+                dx[lane] = d[0];
+                dy[lane] = d[1];
+                dz[lane] = d[2];
+            }
+
+            for (const plane_t& p : _planes)
+            {
+                T value[4];
+                vector_store(p.to_rtm(), value);
+                const T nx = value[0];
+                const T ny = value[1];
+                const T nz = value[2];
+                const T offset = value[3];
+
+                T fraction[packet_width];
+                uint8_t touched[packet_width];
+                uint8_t inside[packet_width];
+                for (size_t lane = 0; lane < packet_width; ++lane)
+                {
+                    const T sa =
+                        nx * ax[lane] + ny * ay[lane] + nz * az[lane] + offset;
+                    const T sb =
+                        nx * bx[lane] + ny * by[lane] + nz * bz[lane] + offset;
+                    const T nearest = sa < sb ? sa : sb;
+                    const T gap = nearest - radius[lane];
+                    const T closing =
+                        -(nx * dx[lane] + ny * dy[lane] + nz * dz[lane]);
+                    const T t =
+                        gap > tolerance ? gap / (closing > epsilon ? closing
+                                                                   : T(1))
+                                        : T(0);
+
+                    inside[lane] = uint8_t(gap < -tolerance);
+                    touched[lane] =
+                        uint8_t(inside[lane] |
+                                ((gap <= tolerance) & (closing > T(0))) |
+                                ((gap > tolerance) & (closing > epsilon) &
+                                 (t <= T(1))));
+                    fraction[lane] = t;
+                }
+
+                for (size_t lane = 0; lane < count; ++lane)
+                {
+                    if (!((mask >> lane) & 1) || !touched[lane])
+                    {
+                        continue;
+                    }
+
+                    hit_t candidate;
+                    candidate.fraction = fraction[lane];
+                    candidate.started_penetrating = inside[lane] != 0;
+                    if (((hit_mask >> lane) & 1) &&
+                        !precedes(candidate, hits[lane]))
+                    {
+                        continue;
+                    }
+
+                    // Only winning contacts pay for a contact point
+                    const rtm_vec4_t d =
+                        vector_set_w(displacements[lane].to_rtm(), T(0));
+                    const auto contact = queries::plane_contact(
+                        vector_mul_add(d, candidate.fraction,
+                                       capsules[lane].a_rtm()),
+                        vector_mul_add(d, candidate.fraction,
+                                       capsules[lane].b_rtm()),
+                        p.to_rtm());
+                    candidate.point = vec3_t::from_rtm(contact.point);
+                    candidate.normal = vec3_t::from_rtm(contact.normal);
+                    hits[lane] = candidate;
+                    hit_mask |= uint32_t(1) << lane;
+                }
+            }
+        }
+
+        // Overlaps come first, then the smallest fraction
+        MVM_INLINE_NODISCARD static bool precedes(const hit_t& a,
+                                                  const hit_t& b)
+        {
+            return a.fraction < b.fraction ||
+                   (a.started_penetrating && !b.started_penetrating);
+        }
+
+        MVM_INLINE bool sweep_shape(const capsule_t& c,
+                                    const shape_ref& ref,
+                                    const vec3_t& displacement,
+                                    hit_t& hit) const
+        {
+            switch (ref.type)
+            {
+                case collision_shape_type::sphere:
+                    return c.sweep(_spheres[ref.index], displacement, hit);
+                case collision_shape_type::box:
+                    return c.sweep(_boxes[ref.index], displacement, hit);
+                case collision_shape_type::triangle:
+                    return c.sweep_triangle(_triangles[ref.index * 3],
+                                            _triangles[ref.index * 3 + 1],
+                                            _triangles[ref.index * 3 + 2],
+                                            displacement, hit);
+            }
+            return false;
+        }
+
+        MVM_INLINE bool penetration_shape(const capsule_t& c,
+                                          const shape_ref& ref,
+                                          vec3_t& push) const
+        {
+            switch (ref.type)
+            {
+                case collision_shape_type::sphere:
+                    return c.penetration(_spheres[ref.index], push);
+                case collision_shape_type::box:
+                    return c.penetration(_boxes[ref.index], push);
+                case collision_shape_type::triangle:
+                    return c.penetration_triangle(_triangles[ref.index * 3],
+                                                  _triangles[ref.index * 3 + 1],
+                                                  _triangles[ref.index * 3 + 2],
+                                                  push);
+            }
+            return false;
+        }
+    };
+
+    using collision_worldf = collision_world<float>;
+    using collision_worldd = collision_world<double>;
+}  // namespace move::math
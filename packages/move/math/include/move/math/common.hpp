@@ -36,7 +36,7 @@ namespace move::math
     }
 
     template <typename T>
-    MVM_INLINE_NODISCARD T abs(const T& value)
+    MVM_INLINE_NODISCARD constexpr T abs(const T& value)
     {
         if constexpr (std::is_unsigned_v<T>)
         {
@@ -44,6 +44,11 @@ namespace move::math
         }
         else
         {
+            // std::abs is not constexpr until C++23
+            if (std::is_constant_evaluated())
+            {
+                return value < T(0) ? T(-value) : value;
+            }
             return std::abs(value);
         }
     }
@@ -96,12 +101,74 @@ namespace move::math
         }
     }
 
+    /**
+     * @brief Returns `a * b + c`.  Floating point values are fused into a
+     * single rounding when the target has a fast hardware FMA.
+     */
+    template <typename T>
+    MVM_INLINE_NODISCARD constexpr T mul_add(const T& a, const T& b, const T& c)
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+#if defined(FP_FAST_FMAF)
+            if (!std::is_constant_evaluated())
+            {
+                return std::fma(a, b, c);
+            }
+#endif
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+#if defined(FP_FAST_FMA)
+            if (!std::is_constant_evaluated())
+            {
+                return std::fma(a, b, c);
+            }
+#endif
+        }
+        return a * b + c;
+    }
+
+    /**
+     * @brief Returns `a * b - c`.
+     */
+    template <typename T>
+    MVM_INLINE_NODISCARD constexpr T mul_sub(const T& a, const T& b, const T& c)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            return mul_add(a, b, T(-c));
+        }
+        else
+        {
+            return T(a * b - c);
+        }
+    }
+
+    /**
+     * @brief Returns `c - a * b`.  Matches `rtm::vector_neg_mul_sub`.
+     */
+    template <typename T>
+    MVM_INLINE_NODISCARD constexpr T neg_mul_sub(const T& a,
+                                                 const T& b,
+                                                 const T& c)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            return mul_add(T(-a), b, c);
+        }
+        else
+        {
+            return T(c - a * b);
+        }
+    }
+
     template <typename T>
     MVM_INLINE_NODISCARD constexpr T lerp_unclamped(const T& a,
                                                     const T& b,
                                                     const T& t)
     {
-        return a + (b - a) * t;
+        return mul_add(T(b - a), t, a);
     }
 
     template <typename T>
@@ -358,8 +425,8 @@ namespace move::math
                 return Vec::zero();
             }
 
-            return incident * eta +
-                   working_normal * (eta * cos_i - sqrt(k));
+            return Vec::mul_add(incident, eta,
+                                working_normal * (eta * cos_i - sqrt(k)));
         }
     }  // namespace detail
 
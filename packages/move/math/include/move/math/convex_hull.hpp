@@ -0,0 +1,814 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/common.hpp>
+#include <move/math/gjk.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/plane.hpp>
+#include <move/math/vec3.hpp>
+#include <move/math/vec4.hpp>
+
+namespace move::math
+{
+    namespace detail
+    {
+        // The working state of one quickhull build.  Points live in
+        // structure-of-arrays form so every distance pass runs four points
+        // per SIMD register.
+        template <typename T>
+        struct quickhull
+        {
+            using v4 = typename simd_rtm::detail::v4<T>::type;
+            using storage_vec3_t = vec3<T, Acceleration::Scalar>;
+
+            constexpr static uint32_t invalid_index =
+                std::numeric_limits<uint32_t>::max();
+
+            struct face
+            {
+                uint32_t v[3];
+                // The face across the edge from v[k] to v[k + 1]
+                uint32_t adjacent[3];
+                // The outward unit plane, `n . p + d` above the face
+                T nx;
+                T ny;
+                T nz;
+                T d;
+                uint32_t outside = invalid_index;
+                uint32_t visited = 0;
+                bool visible = false;
+                bool alive = true;
+            };
+
+            // Points above a face and not yet on the hull.  The arrays
+            // only grow, so recycled sets fill without reallocating.
+            struct point_set
+            {
+                std::vector<T> x;
+                std::vector<T> y;
+                std::vector<T> z;
+                std::vector<uint32_t> index;
+                size_t count = 0;
+                size_t farthest = 0;
+
+                MVM_INLINE void clear()
+                {
+                    count = 0;
+                }
+
+                MVM_INLINE void reserve(const size_t capacity)
+                {
+                    if (x.size() < capacity)
+                    {
+                        x.resize(capacity);
+                        y.resize(capacity);
+                        z.resize(capacity);
+                        index.resize(capacity);
+                    }
+                }
+
+                MVM_INLINE void append(const point_set& other,
+                                       const size_t skip)
+                {
+                    reserve(count + other.count);
+                    for (size_t i = 0; i < other.count; ++i)
+                    {
+                        x[count] = other.x[i];
+                        y[count] = other.y[i];
+                        z[count] = other.z[i];
+                        index[count] = other.index[i];
+                        count += i != skip;
+                    }
+                }
+            };
+
+            struct horizon_edge
+            {
+                uint32_t a;
+                uint32_t b;
+                uint32_t across;
+            };
+
+            std::vector<T> x;
+            std::vector<T> y;
+            std::vector<T> z;
+            std::vector<face> faces;
+            std::vector<point_set> sets;
+            std::vector<uint32_t> free_sets;
+            std::vector<uint32_t> pending;
+            std::vector<uint32_t> visible;
+            std::vector<horizon_edge> horizon;
+            std::vector<horizon_edge> loop;
+            std::vector<T> distances;
+            point_set orphans;
+            // Points this close to a plane count as on it
+            T tolerance = T(0);
+            uint32_t pass = 0;
+
+            /**
+             * Writes `n . p + d` for every point, four at a time.  This is
+             * the inner loop of the build: the first partition, the
+             * reassignment of orphaned points, and the extreme point
+             * searches all run through it.
+             */
+            MVM_INLINE static void plane_distances(const T* xs,
+                                                   const T* ys,
+                                                   const T* zs,
+                                                   const size_t count,
+                                                   const T& nx,
+                                                   const T& ny,
+                                                   const T& nz,
+                                                   const T& d,
+                                                   T* out)
+            {
+                using namespace rtm;
+                const v4 vx = vector_set(nx);
+                const v4 vy = vector_set(ny);
+                const v4 vz = vector_set(nz);
+                const v4 vd = vector_set(d);
+                size_t i = 0;
+                for (; i + 4 <= count; i += 4)
+                {
+                    const v4 px = vector_load(xs + i);
+                    const v4 py = vector_load(ys + i);
+                    const v4 pz = vector_load(zs + i);
+                    vector_store(
+                        vector_mul_add(
+                            pz, vz,
+                            vector_mul_add(py, vy, vector_mul_add(px, vx, vd))),
+                        out + i);
+                }
+                for (; i < count; ++i)
+                {
+                    out[i] = xs[i] * nx + ys[i] * ny + zs[i] * nz + d;
+                }
+            }
+
+            // The index of the largest value, found by a SIMD maximum and
+            // a scan for the first lane that holds it
+            MVM_INLINE static size_t arg_max(const T* values,
+                                             const size_t count)
+            {
+                using namespace rtm;
+                T best = -std::numeric_limits<T>::infinity();
+                size_t i = 0;
+                if (count >= 4)
+                {
+                    v4 lanes = vector_load(values);
+                    for (i = 4; i + 4 <= count; i += 4)
+                    {
+                        lanes = vector_max(lanes, vector_load(values + i));
+                    }
+                    best = math::max(
+                        math::max(T(vector_get_x(lanes)),
+                                  T(vector_get_y(lanes))),
+                        math::max(T(vector_get_z(lanes)),
+                                  T(vector_get_w(lanes))));
+                }
+                for (; i < count; ++i)
+                {
+                    best = math::max(best, values[i]);
+                }
+                for (i = 0; i < count; ++i)
+                {
+                    if (values[i] == best)
+                    {
+                        return i;
+                    }
+                }
+                return 0;
+            }
+
+            // The point farthest along a direction, with an offset so the
+            // same pass measures distance from a plane
+            MVM_INLINE size_t farthest(const T& nx,
+                                       const T& ny,
+                                       const T& nz,
+                                       const T& d)
+            {
+                plane_distances(x.data(), y.data(), z.data(), x.size(), nx, ny,
+                                nz, d, distances.data());
+                return arg_max(distances.data(), x.size());
+            }
+
+            MVM_INLINE_NODISCARD v4 point(const uint32_t i) const
+            {
+                return rtm::vector_set(x[i], y[i], z[i], T(0));
+            }
+
+            MVM_INLINE void load(const storage_vec3_t* points,
+                                 const size_t count)
+            {
+                x.resize(count);
+                y.resize(count);
+                z.resize(count);
+                distances.resize(count);
+                T extent = T(0);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    x[i] = points[i].get_x();
+                    y[i] = points[i].get_y();
+                    z[i] = points[i].get_z();
+                    extent = math::max(
+                        extent, math::abs(x[i]) + math::abs(y[i]) +
+                                    math::abs(z[i]));
+                }
+                // After qhull: rounding in a plane distance grows with the
+                // coordinates that went into it
+                tolerance = T(3) * extent * std::numeric_limits<T>::epsilon();
+            }
+
+            MVM_INLINE uint32_t add_face(const uint32_t a,
+                                         const uint32_t b,
+                                         const uint32_t c)
+            {
+                using namespace rtm;
+                face f;
+                f.v[0] = a;
+                f.v[1] = b;
+                f.v[2] = c;
+                f.adjacent[0] = f.adjacent[1] = f.adjacent[2] = invalid_index;
+                const v4 pa = point(a);
+                const v4 n = vector_cross3(vector_sub(point(b), pa),
+                                           vector_sub(point(c), pa));
+                const T length_sq = T(vector_dot3(n, n));
+                const v4 unit =
+                    length_sq > std::numeric_limits<T>::min()
+                        ? vector_mul(n, T(1) / math::sqrt(length_sq))
+                        : vector_zero();
+                f.nx = vector_get_x(unit);
+                f.ny = vector_get_y(unit);
+                f.nz = vector_get_z(unit);
+                f.d = -T(vector_dot3(unit, pa));
+                faces.push_back(f);
+                return uint32_t(faces.size() - 1);
+            }
+
+            MVM_INLINE_NODISCARD T distance(const face& f,
+                                            const uint32_t i) const
+            {
+                return f.nx * x[i] + f.ny * y[i] + f.nz * z[i] + f.d;
+            }
+
+            // Points the face across edge a-b of `from` at `to`
+            MVM_INLINE void relink(const uint32_t from,
+                                   const uint32_t a,
+                                   const uint32_t b,
+                                   const uint32_t to)
+            {
+                face& f = faces[from];
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    if (f.v[k] == b && f.v[(k + 1) % 3] == a)
+                    {
+                        f.adjacent[k] = to;
+                    }
+                }
+            }
+
+            MVM_INLINE uint32_t acquire_set()
+            {
+                if (free_sets.empty())
+                {
+                    sets.emplace_back();
+                    return uint32_t(sets.size() - 1);
+                }
+                const uint32_t s = free_sets.back();
+                free_sets.pop_back();
+                sets[s].clear();
+                return s;
+            }
+
+            MVM_INLINE void release_set(face& f)
+            {
+                if (f.outside != invalid_index)
+                {
+                    free_sets.push_back(f.outside);
+                    f.outside = invalid_index;
+                }
+            }
+
+            // Hands each orphan to the first new face it is above.  The
+            // rest are inside the hull and dropped.
+            MVM_INLINE void assign(const uint32_t first, const uint32_t last)
+            {
+                for (uint32_t fi = first; fi < last && orphans.count > 0; ++fi)
+                {
+                    const size_t count = orphans.count;
+                    const face& f = faces[fi];
+                    plane_distances(orphans.x.data(), orphans.y.data(),
+                                    orphans.z.data(), count, f.nx, f.ny, f.nz,
+                                    f.d, distances.data());
+
+                    const uint32_t s = acquire_set();
+                    point_set& above = sets[s];
+                    above.reserve(count);
+                    size_t up = 0;
+                    size_t kept = 0;
+                    T farthest_distance = tolerance;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        // Which side a point falls is unpredictable, so it
+                        // is written to both and only one cursor moves
+                        const T distance = distances[i];
+                        const bool is_above = distance > tolerance;
+                        const bool is_farther = distance > farthest_distance;
+                        above.x[up] = orphans.x[i];
+                        above.y[up] = orphans.y[i];
+                        above.z[up] = orphans.z[i];
+                        above.index[up] = orphans.index[i];
+                        orphans.x[kept] = orphans.x[i];
+                        orphans.y[kept] = orphans.y[i];
+                        orphans.z[kept] = orphans.z[i];
+                        orphans.index[kept] = orphans.index[i];
+                        farthest_distance =
+                            is_farther ? distance : farthest_distance;
+                        above.farthest = is_farther ? up : above.farthest;
+                        up += is_above;
+                        kept += !is_above;
+                    }
+                    above.count = up;
+                    orphans.count = kept;
+                    if (up == 0)
+                    {
+                        free_sets.push_back(s);
+                        continue;
+                    }
+                    faces[fi].outside = s;
+                    pending.push_back(fi);
+                }
+                orphans.clear();
+            }
+
+            // Builds the first tetrahedron from extreme points.  Returns
+            // false when the points span no volume.
+            MVM_INLINE bool start()
+            {
+                using namespace rtm;
+                // The widest pair of axis extremes
+                uint32_t extremes[6];
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    const T n[3] = {T(axis == 0), T(axis == 1), T(axis == 2)};
+                    extremes[2 * axis] =
+                        uint32_t(farthest(n[0], n[1], n[2], T(0)));
+                    extremes[2 * axis + 1] =
+                        uint32_t(farthest(-n[0], -n[1], -n[2], T(0)));
+                }
+                uint32_t i0 = extremes[0];
+                uint32_t i1 = extremes[1];
+                T widest = T(-1);
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    const v4 span = vector_sub(point(extremes[2 * axis]),
+                                               point(extremes[2 * axis + 1]));
+                    const T length_sq = T(vector_dot3(span, span));
+                    if (length_sq > widest)
+                    {
+                        widest = length_sq;
+                        i0 = extremes[2 * axis + 1];
+                        i1 = extremes[2 * axis];
+                    }
+                }
+                if (widest <= tolerance * tolerance)
+                {
+                    return false;
+                }
+
+                // The point farthest from the line through them, by the
+                // squared length of its offset less the part along the line
+                const v4 p0 = point(i0);
+                const v4 along = vector_sub(point(i1), p0);
+                const v4 unit_along =
+                    vector_mul(along, T(1) / math::sqrt(widest));
+                const size_t count = x.size();
+                {
+                    const v4 ox = vector_set(T(vector_get_x(p0)));
+                    const v4 oy = vector_set(T(vector_get_y(p0)));
+                    const v4 oz = vector_set(T(vector_get_z(p0)));
+                    const v4 ux = vector_set(T(vector_get_x(unit_along)));
+                    const v4 uy = vector_set(T(vector_get_y(unit_along)));
+                    const v4 uz = vector_set(T(vector_get_z(unit_along)));
+                    size_t i = 0;
+                    for (; i + 4 <= count; i += 4)
+                    {
+                        const v4 dx = vector_sub(vector_load(x.data() + i), ox);
+                        const v4 dy = vector_sub(vector_load(y.data() + i), oy);
+                        const v4 dz = vector_sub(vector_load(z.data() + i), oz);
+                        const v4 t = vector_mul_add(
+                            dz, uz, vector_mul_add(dy, uy, vector_mul(dx, ux)));
+                        const v4 length_sq = vector_mul_add(
+                            dz, dz, vector_mul_add(dy, dy, vector_mul(dx, dx)));
+                        vector_store(vector_neg_mul_sub(t, t, length_sq),
+                                     distances.data() + i);
+                    }
+                    for (; i < count; ++i)
+                    {
+                        const v4 offset = vector_sub(point(uint32_t(i)), p0);
+                        const T t = T(vector_dot3(offset, unit_along));
+                        distances[i] = T(vector_dot3(offset, offset)) - t * t;
+                    }
+                }
+                // The difference of squares cancels near the line, so it
+                // only picks the point; the cross product measures it
+                uint32_t i2 = uint32_t(arg_max(distances.data(), count));
+                const v4 n = vector_cross3(along, vector_sub(point(i2), p0));
+                const T n_length = T(vector_length3(n));
+                if (n_length <= tolerance * math::sqrt(widest))
+                {
+                    return false;
+                }
+
+                // The point farthest from the plane of the first three, on
+                // either side
+                const v4 unit = vector_mul(n, T(1) / n_length);
+                const T d = -T(vector_dot3(unit, p0));
+                plane_distances(x.data(), y.data(), z.data(), count,
+                                vector_get_x(unit), vector_get_y(unit),
+                                vector_get_z(unit), d, distances.data());
+                for (size_t i = 0; i < count; ++i)
+                {
+                    distances[i] = math::abs(distances[i]);
+                }
+                const uint32_t i3 = uint32_t(arg_max(distances.data(), count));
+                if (distances[i3] <= tolerance)
+                {
+                    return false;
+                }
+
+                // Wind the base away from the apex so every face is
+                // outward
+                if (T(vector_dot3(unit, point(i3))) + d > T(0))
+                {
+                    std::swap(i1, i2);
+                }
+                add_face(i0, i1, i2);
+                add_face(i0, i3, i1);
+                add_face(i0, i2, i3);
+                add_face(i1, i3, i2);
+                for (uint32_t f = 0; f < 4; ++f)
+                {
+                    for (uint32_t k = 0; k < 3; ++k)
+                    {
+                        const uint32_t a = faces[f].v[k];
+                        const uint32_t b = faces[f].v[(k + 1) % 3];
+                        for (uint32_t g = 0; g < 4; ++g)
+                        {
+                            if (g != f)
+                            {
+                                relink(g, a, b, f);
+                            }
+                        }
+                    }
+                }
+
+                orphans.reserve(count);
+                orphans.x = x;
+                orphans.y = y;
+                orphans.z = z;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    orphans.index[i] = uint32_t(i);
+                }
+                orphans.count = count;
+                assign(0, 4);
+                return true;
+            }
+
+            /**
+             * Finds the faces the eye sees by walking outward from `seed`,
+             * and the loop of edges bounding them.  Returns false if the
+             * loop is not a single cycle, which rounding can cause for an
+             * eye barely above the hull.
+             */
+            MVM_INLINE bool find_horizon(const uint32_t seed,
+                                         const uint32_t eye)
+            {
+                ++pass;
+                visible.clear();
+                horizon.clear();
+                faces[seed].visited = pass;
+                faces[seed].visible = true;
+                visible.push_back(seed);
+                for (size_t next = 0; next < visible.size(); ++next)
+                {
+                    const uint32_t fi = visible[next];
+                    for (uint32_t k = 0; k < 3; ++k)
+                    {
+                        const uint32_t gi = faces[fi].adjacent[k];
+                        face& g = faces[gi];
+                        if (g.visited != pass)
+                        {
+                            g.visited = pass;
+                            g.visible = distance(g, eye) > tolerance;
+                            if (g.visible)
+                            {
+                                visible.push_back(gi);
+                            }
+                        }
+                        if (!g.visible)
+                        {
+                            horizon.push_back({faces[fi].v[k],
+                                               faces[fi].v[(k + 1) % 3], gi});
+                        }
+                    }
+                }
+
+                // Chain the edges end to start
+                loop.clear();
+                loop.push_back(horizon[0]);
+                while (loop.size() < horizon.size())
+                {
+                    const uint32_t end = loop.back().b;
+                    bool found = false;
+                    for (const horizon_edge& edge : horizon)
+                    {
+                        if (edge.a == end)
+                        {
+                            loop.push_back(edge);
+                            found = true;
+                            break;
+                        }
+                    }
+                    if (!found || loop.back().b == loop.front().a)
+                    {
+                        break;
+                    }
+                }
+                return loop.size() == horizon.size() &&
+                       loop.back().b == loop.front().a;
+            }
+
+            /**
+             * Finds a horizon for the farthest point of `fi`'s set that
+             * has one, trying them farthest first, and returns its slot.
+             * An eye whose horizon breaks is passed over rather than
+             * dropped: it stays in the set, so it is handed to the new
+             * faces and tried again once the hull around it has changed.
+             * Returns `count` if no point in the set has a horizon.
+             */
+            MVM_INLINE size_t find_eye(const uint32_t fi)
+            {
+                const point_set& seed_set = sets[faces[fi].outside];
+                const size_t count = seed_set.count;
+                if (find_horizon(fi, seed_set.index[seed_set.farthest]))
+                {
+                    return seed_set.farthest;
+                }
+
+                const face& f = faces[fi];
+                plane_distances(seed_set.x.data(), seed_set.y.data(),
+                                seed_set.z.data(), count, f.nx, f.ny, f.nz,
+                                f.d, distances.data());
+                size_t slot = seed_set.farthest;
+                while (true)
+                {
+                    for (const uint32_t vi : visible)
+                    {
+                        faces[vi].visible = false;
+                    }
+                    distances[slot] = -std::numeric_limits<T>::infinity();
+                    slot = arg_max(distances.data(), count);
+                    if (!(distances[slot] > tolerance))
+                    {
+                        return count;
+                    }
+                    if (find_horizon(fi, seed_set.index[slot]))
+                    {
+                        return slot;
+                    }
+                }
+            }
+
+            MVM_INLINE void expand(const uint32_t fi)
+            {
+                point_set& seed_set = sets[faces[fi].outside];
+                const size_t eye_slot = find_eye(fi);
+                if (eye_slot == seed_set.count)
+                {
+                    // Leave the farthest point off the hull rather than
+                    // build a broken one
+                    orphans.clear();
+                    orphans.append(seed_set, seed_set.farthest);
+                    release_set(faces[fi]);
+                    assign(fi, fi + 1);
+                    return;
+                }
+                const uint32_t eye = seed_set.index[eye_slot];
+
+                for (const uint32_t vi : visible)
+                {
+                    face& f = faces[vi];
+                    f.alive = false;
+                    if (f.outside != invalid_index)
+                    {
+                        orphans.append(sets[f.outside],
+                                       vi == fi ? eye_slot : size_t(-1));
+                        release_set(f);
+                    }
+                }
+
+                const uint32_t first = uint32_t(faces.size());
+                const uint32_t sides = uint32_t(loop.size());
+                for (uint32_t k = 0; k < sides; ++k)
+                {
+                    const horizon_edge& edge = loop[k];
+                    const uint32_t nf = add_face(edge.a, edge.b, eye);
+                    face& f = faces[nf];
+                    f.adjacent[0] = edge.across;
+                    f.adjacent[1] = first + (k + 1) % sides;
+                    f.adjacent[2] = first + (k + sides - 1) % sides;
+                    relink(edge.across, edge.a, edge.b, nf);
+                }
+                assign(first, first + sides);
+            }
+
+            MVM_INLINE void run()
+            {
+                for (size_t next = 0; next < pending.size(); ++next)
+                {
+                    const uint32_t fi = pending[next];
+                    const face& f = faces[fi];
+                    if (f.alive && f.outside != invalid_index)
+                    {
+                        expand(fi);
+                    }
+                }
+            }
+        };
+    }  // namespace detail
+
+    /**
+     * @brief The convex hull of a point cloud as triangles, with an
+     * outward plane per face.
+     *
+     * `build` runs quickhull (Barber, Dobkin and Huhdanpaa, 1996): start
+     * from a tetrahedron of extreme points, then repeatedly take the
+     * point farthest above some face, cut away the faces it sees and
+     * cone the hole to it.  Points are held in structure-of-arrays form
+     * per face, so the searches for the farthest point and the face each
+     * orphaned point lies above measure four points per SIMD register.
+     *
+     * Faces are triangles wound counter-clockwise seen from outside, and
+     * coplanar neighbours are left as separate triangles.  The hull
+     * provides a support mapping, so it can be passed straight to
+     * gjk_distance and collide_convex.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct convex_hull
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using storage_vec3_t = vec3<T, Acceleration::Scalar>;
+        using plane_t = plane<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using component_type = T;
+
+    private:
+        std::vector<vec3_t> _vertices;
+        // Three vertex indices per face
+        std::vector<uint32_t> _indices;
+        std::vector<plane_t> _planes;
+
+        // Queries
+    public:
+        MVM_INLINE_NODISCARD bool empty() const
+        {
+            return _planes.empty();
+        }
+
+        MVM_INLINE_NODISCARD size_t vertex_count() const
+        {
+            return _vertices.size();
+        }
+
+        MVM_INLINE_NODISCARD size_t face_count() const
+        {
+            return _planes.size();
+        }
+
+        MVM_INLINE_NODISCARD const vec3_t* vertices() const
+        {
+            return _vertices.data();
+        }
+
+        // Three indices into vertices() per face
+        MVM_INLINE_NODISCARD const uint32_t* indices() const
+        {
+            return _indices.data();
+        }
+
+        // One normalized plane per face, facing out of the hull
+        MVM_INLINE_NODISCARD const plane_t* planes() const
+        {
+            return _planes.data();
+        }
+
+        // The vertices as a support mapping that outlives the hull only as
+        // long as it is not rebuilt
+        MVM_INLINE_NODISCARD convex_point_set<T> points() const
+        {
+            return convex_point_set<T>(_vertices.data(), _vertices.size());
+        }
+
+        MVM_INLINE_NODISCARD vec3_t support(const vec3_t& direction) const
+        {
+            return points().support(direction);
+        }
+
+        // True if the point is inside or within `tolerance` of every face
+        MVM_INLINE_NODISCARD bool contains(const vec3_t& point,
+                                           const T& tolerance = T(0)) const
+        {
+            for (const plane_t& p : _planes)
+            {
+                if (p.signed_distance(point) > tolerance)
+                {
+                    return false;
+                }
+            }
+            return !empty();
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE void clear()
+        {
+            _vertices.clear();
+            _indices.clear();
+            _planes.clear();
+        }
+
+        /**
+         * @brief Replaces the hull with that of `points`.  Points that
+         * span no volume, fewer than four or all in a plane, give an
+         * empty hull.
+         *
+         * Points within a tolerance scaled to the extent of the cloud
+         * count as on a face.  Rounding can also stop a point barely
+         * above a nearly flat stretch of the hull from joining it.  Such
+         * a point waits until nearer ones have changed the hull around
+         * it, and is left off if it still cannot join, so it may lie
+         * outside by more than the tolerance.
+         *
+         * @param points The points to enclose
+         * @param count The number of points
+         */
+        void build(const storage_vec3_t* points, size_t count)
+        {
+            MVM_ASSERT_PRECONDITION(count < size_t(
+                detail::quickhull<T>::invalid_index));
+            clear();
+            if (count < 4)
+            {
+                return;
+            }
+
+            detail::quickhull<T> hull;
+            hull.load(points, count);
+            if (!hull.start())
+            {
+                return;
+            }
+            hull.run();
+
+            // Keep the live faces and the vertices they use, in the order
+            // they are first used
+            std::vector<uint32_t> remap(count, hull.invalid_index);
+            for (const auto& f : hull.faces)
+            {
+                if (!f.alive)
+                {
+                    continue;
+                }
+                for (const uint32_t v : f.v)
+                {
+                    if (remap[v] == hull.invalid_index)
+                    {
+                        remap[v] = uint32_t(_vertices.size());
+                        _vertices.emplace_back(hull.x[v], hull.y[v],
+                                               hull.z[v]);
+                    }
+                    _indices.push_back(remap[v]);
+                }
+                _planes.emplace_back(vec3_t(f.nx, f.ny, f.nz), f.d);
+            }
+        }
+    };
+
+    using convex_hullf = convex_hull<float>;
+    using convex_hulld = convex_hull<double>;
+}  // namespace move::math
@@ -0,0 +1,412 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/rtm/base_vec4.hpp>
+#include <move/math/vec2.hpp>
+#include <move/math/vec3.hpp>
+#include <move/math/vec4.hpp>
+
+namespace move::math
+{
+    /**
+     * @brief The cubic bases supported by `cubic_curve`.  Each one blends
+     * four control values, but they are interpreted differently.
+     */
+    enum class CurveBasis
+    {
+        // Two points and their tangents: (p0, m0, p1, m1)
+        Hermite,
+        // Two end points and two handles: (p0, h0, h1, p1)
+        Bezier,
+        // Passes through the middle two of four points, tension 0.5
+        CatmullRom,
+        // Uniform cubic B-spline.  Smoother, but passes through no points.
+        BSpline
+    };
+
+    namespace detail
+    {
+        // Row i holds the coefficients of t^i for each control value, so
+        // the weights at t are [1 t t^2 t^3] * m
+        template <typename T>
+        struct curve_basis_matrix
+        {
+            T m[4][4];
+        };
+
+        template <typename T>
+        constexpr curve_basis_matrix<T> make_curve_basis(CurveBasis basis)
+        {
+            switch (basis)
+            {
+                case CurveBasis::Hermite:
+                    return {{{1, 0, 0, 0},
+                             {0, 1, 0, 0},
+                             {-3, -2, 3, -1},
+                             {2, 1, -2, 1}}};
+                case CurveBasis::Bezier:
+                    return {{{1, 0, 0, 0},
+                             {-3, 3, 0, 0},
+                             {3, -6, 3, 0},
+                             {-1, 3, -3, 1}}};
+                case CurveBasis::CatmullRom:
+                    return {{{0, 1, 0, 0},
+                             {T(-0.5), 0, T(0.5), 0},
+                             {1, T(-2.5), 2, T(-0.5)},
+                             {T(-0.5), T(1.5), T(-1.5), T(0.5)}}};
+                case CurveBasis::BSpline:
+                default:
+                    return {{{T(1) / 6, T(4) / 6, T(1) / 6, 0},
+                             {T(-0.5), 0, T(0.5), 0},
+                             {T(0.5), -1, T(0.5), 0},
+                             {T(-1) / 6, T(0.5), T(-0.5), T(1) / 6}}};
+            }
+        }
+    }  // namespace detail
+
+    /**
+     * @brief A single cubic curve segment over `vec2`, `vec3` or `vec4`.
+     *
+     * All four bases are evaluated the same way: the parameter is turned
+     * into four weights, which then blend the control values.  Longer
+     * splines are a sequence of segments; see `segment` for how each basis
+     * lays out its control values.
+     *
+     * @tparam V The vector type
+     * @tparam Basis How the four control values are interpreted
+     */
+    template <typename V, CurveBasis Basis>
+    struct cubic_curve
+    {
+    public:
+        using vector_type = V;
+        using component_type = typename V::component_type;
+        constexpr static CurveBasis basis = Basis;
+
+        // How far the control window moves from one segment to the next
+        constexpr static size_t segment_stride =
+            Basis == CurveBasis::Bezier    ? 3
+            : Basis == CurveBasis::Hermite ? 2
+                                           : 1;
+
+    private:
+        using T = component_type;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        constexpr static detail::curve_basis_matrix<T> matrix =
+            detail::make_curve_basis<T>(Basis);
+
+    public:
+        V controls[4];
+
+        // Constructors
+    public:
+        MVM_INLINE cubic_curve() : controls{}
+        {
+        }
+
+        MVM_INLINE cubic_curve(const V& c0,
+                               const V& c1,
+                               const V& c2,
+                               const V& c3) :
+            controls{c0, c1, c2, c3}
+        {
+        }
+
+        /**
+         * @brief Returns one segment of a spline stored as a flat array of
+         * control values.  Catmull-Rom and B-spline segments share three
+         * points with their neighbours, Bezier segments share an end point,
+         * and Hermite splines interleave points and tangents as
+         * (p0, m0, p1, m1, p2, m2, ...).
+         *
+         * @param controls The control values of the whole spline
+         * @param index The segment index.  Must be less than segment_count.
+         * @return cubic_curve The segment
+         */
+        MVM_INLINE_NODISCARD static cubic_curve segment(const V* controls,
+                                                        size_t index)
+        {
+            const V* c = controls + index * segment_stride;
+            return cubic_curve(c[0], c[1], c[2], c[3]);
+        }
+
+        /**
+         * @brief The number of segments a spline with this many control
+         * values has.
+         */
+        MVM_INLINE_NODISCARD constexpr static size_t segment_count(
+            size_t control_count)
+        {
+            return control_count < 4
+                       ? 0
+                       : (control_count - 4) / segment_stride + 1;
+        }
+
+        // Evaluation
+    public:
+        MVM_INLINE_NODISCARD V evaluate(const T& t) const
+        {
+            T w[4];
+            weights(t, w);
+            return blend(w);
+        }
+
+        /**
+         * @brief The first derivative with respect to t, i.e. the tangent
+         * scaled by the speed at which t moves along the curve.
+         */
+        MVM_INLINE_NODISCARD V derivative(const T& t) const
+        {
+            T w[4];
+            derivative_weights(t, w);
+            return blend(w);
+        }
+
+        MVM_INLINE_NODISCARD V second_derivative(const T& t) const
+        {
+            T w[4];
+            for (size_t k = 0; k < 4; ++k)
+            {
+                w[k] = T(2) * matrix.m[2][k] + T(6) * t * matrix.m[3][k];
+            }
+            return blend(w);
+        }
+
+        /**
+         * @brief Evaluates the curve at many parameters.  The weights of
+         * four parameters are computed together in one SIMD register per
+         * control value, leaving only the blend per output.
+         *
+         * @param params The parameters to evaluate at
+         * @param out Receives the points
+         * @param count The number of parameters
+         */
+        MVM_INLINE void sample(const T* params, V* out, size_t count) const
+        {
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                sample4(rtm::vector_load(params + i), out + i);
+            }
+            for (; i < count; ++i)
+            {
+                out[i] = evaluate(params[i]);
+            }
+        }
+
+        /**
+         * @brief Evaluates the curve at `count` evenly spaced parameters
+         * from 0 to 1 inclusive.
+         *
+         * @param out Receives the points
+         * @param count The number of points.  Must be at least two.
+         */
+        MVM_INLINE void sample_uniform(V* out, size_t count) const
+        {
+            using namespace rtm;
+            const T step = T(1) / T(count - 1);
+            const rtm_vec4_t lane = vector_set(T(0), T(1), T(2), T(3));
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                sample4(vector_mul(vector_add(lane, vector_set(T(i))),
+                                   vector_set(step)),
+                        out + i);
+            }
+            for (; i < count; ++i)
+            {
+                out[i] = evaluate(T(i) * step);
+            }
+        }
+
+        // Statics
+    public:
+        /**
+         * @brief Computes the weight of each control value at t.
+         *
+         * @param t The curve parameter, from 0 to 1
+         * @param out Receives the four weights
+         */
+        MVM_INLINE static void weights(const T& t, T out[4])
+        {
+            for (size_t k = 0; k < 4; ++k)
+            {
+                out[k] = ((matrix.m[3][k] * t + matrix.m[2][k]) * t +
+                          matrix.m[1][k]) *
+                             t +
+                         matrix.m[0][k];
+            }
+        }
+
+        MVM_INLINE static void derivative_weights(const T& t, T out[4])
+        {
+            for (size_t k = 0; k < 4; ++k)
+            {
+                out[k] = (T(3) * matrix.m[3][k] * t + T(2) * matrix.m[2][k]) *
+                             t +
+                         matrix.m[1][k];
+            }
+        }
+
+    private:
+        MVM_INLINE_NODISCARD V blend(const T w[4]) const
+        {
+            V result = controls[0] * w[0];
+            result += controls[1] * w[1];
+            result += controls[2] * w[2];
+            result += controls[3] * w[3];
+            return result;
+        }
+
+        // Weights for four parameters at once, one lane per parameter
+        MVM_INLINE void sample4(const rtm_vec4_t& t, V* out) const
+        {
+            using namespace rtm;
+            T w[4][4];
+            for (size_t k = 0; k < 4; ++k)
+            {
+                rtm_vec4_t wk = vector_mul_add(vector_set(matrix.m[3][k]), t,
+                                               vector_set(matrix.m[2][k]));
+                wk = vector_mul_add(wk, t, vector_set(matrix.m[1][k]));
+                wk = vector_mul_add(wk, t, vector_set(matrix.m[0][k]));
+                vector_store(wk, w[k]);
+            }
+
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                const T lane_weights[4] = {w[0][lane], w[1][lane], w[2][lane],
+                                           w[3][lane]};
+                out[lane] = blend(lane_weights);
+            }
+        }
+    };
+
+    template <typename V>
+    using hermite_curve = cubic_curve<V, CurveBasis::Hermite>;
+
+    template <typename V>
+    using bezier_curve = cubic_curve<V, CurveBasis::Bezier>;
+
+    template <typename V>
+    using catmull_rom_curve = cubic_curve<V, CurveBasis::CatmullRom>;
+
+    template <typename V>
+    using bspline_curve = cubic_curve<V, CurveBasis::BSpline>;
+
+    /**
+     * @brief A table of cumulative arc length along a curve, for moving
+     * along it at constant speed.  Curve parameters are not proportional to
+     * distance, so a camera on a rail stepping t uniformly speeds up and
+     * slows down; looking up t by distance fixes that.
+     *
+     * The curve is approximated by `Samples` chords, so the error shrinks
+     * with more samples at the cost of a larger table.
+     *
+     * @tparam T The component type
+     * @tparam Samples The number of chords
+     */
+    template <typename T, size_t Samples = 64>
+        requires std::is_floating_point_v<T> && (Samples > 0)
+    struct arc_length_table
+    {
+    public:
+        constexpr static size_t sample_count = Samples;
+
+        // Cumulative length at t = i / Samples
+        T lengths[Samples + 1];
+
+        // Constructors
+    public:
+        MVM_INLINE arc_length_table() : lengths{}
+        {
+        }
+
+        template <typename Curve>
+        MVM_INLINE explicit arc_length_table(const Curve& curve)
+        {
+            build(curve);
+        }
+
+        /**
+         * @brief Fills the table by sampling a curve such as `cubic_curve`
+         * uniformly.
+         */
+        template <typename Curve>
+        MVM_INLINE void build(const Curve& curve)
+        {
+            using V = typename Curve::vector_type;
+            V points[Samples + 1];
+            curve.sample_uniform(points, Samples + 1);
+
+            lengths[0] = T(0);
+            for (size_t i = 1; i <= Samples; ++i)
+            {
+                lengths[i] =
+                    lengths[i - 1] + V(points[i] - points[i - 1]).length();
+            }
+        }
+
+        MVM_INLINE_NODISCARD T total_length() const
+        {
+            return lengths[Samples];
+        }
+
+        /**
+         * @brief Finds the curve parameter at a distance along the curve.
+         *
+         * @param distance The distance from the start.  Clamped to the
+         * length of the curve.
+         * @return T The curve parameter, from 0 to 1
+         */
+        MVM_INLINE_NODISCARD T parameter_at_distance(const T& distance) const
+        {
+            if (distance <= T(0))
+            {
+                return T(0);
+            }
+            if (distance >= total_length())
+            {
+                return T(1);
+            }
+
+            // Find the first sample at or past the distance
+            size_t low = 0;
+            size_t high = Samples;
+            while (high - low > 1)
+            {
+                const size_t mid = (low + high) / 2;
+                if (lengths[mid] < distance)
+                {
+                    low = mid;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+
+            const T span = lengths[high] - lengths[low];
+            const T fraction =
+                span > T(0) ? (distance - lengths[low]) / span : T(0);
+            return (T(low) + fraction) / T(Samples);
+        }
+
+        /**
+         * @brief Finds the curve parameter a fraction of the way along the
+         * curve by distance.
+         *
+         * @param fraction The fraction of the total length, from 0 to 1
+         * @return T The curve parameter, from 0 to 1
+         */
+        MVM_INLINE_NODISCARD T parameter_at_fraction(const T& fraction) const
+        {
+            return parameter_at_distance(fraction * total_length());
+        }
+    };
+}  // namespace move::math
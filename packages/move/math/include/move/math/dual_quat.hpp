@@ -0,0 +1,368 @@
+#pragma once
+#include <cmath>
+#include <type_traits>
+
+#include <rtm/quatd.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/mat4x4.hpp>
+#include <move/math/quat.hpp>
+#include <move/math/rtm/rtm_ext.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    namespace detail
+    {
+        // Dual quaternion kernels on raw RTM vectors, shared by dual_quat
+        // and the batched skinning code.
+
+        // 2 * d * conj(r), keeping only the vector part
+        template <typename rtm_vec4_t>
+        MVM_INLINE_NODISCARD rtm_vec4_t
+        dq_translation(const rtm_vec4_t& real, const rtm_vec4_t& dual)
+        {
+            using namespace rtm;
+            rtm_vec4_t t = vector_cross3(real, dual);
+            t = vector_mul_add(dual, vector_dup_w(real), t);
+            t = vector_neg_mul_sub(real, vector_dup_w(dual), t);
+            return vector_add(t, t);
+        }
+    }  // namespace detail
+
+    /**
+     * @brief A rigid transform stored as a unit dual quaternion: a rotation
+     * followed by a translation, in 8 components instead of a matrix's 16.
+     *
+     * Dual quaternions blend without the volume loss of blended matrices,
+     * which makes them well suited to skinning.  Composition follows the
+     * same order as `quat` and `mat4x4`: `a * b` applies `a` first.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct dual_quat
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using quat_t = quat<T>;
+        using mat4x4_t = mat4x4<T>;
+        using vec3_t = vec3<T, acceleration>;
+        using rtm_quat_t = typename quat_t::rtm_quat_t;
+        using rtm_vec4_t = typename quat_t::rtm_vec4_t;
+        using rtm_mat3x4_t = typename mat4x4_t::rtm_mat3x4_t;
+        using component_type = T;
+
+    private:
+        rtm_quat_t _real;
+        rtm_quat_t _dual;
+
+        // Constructors
+    public:
+        MVM_INLINE dual_quat() :
+            _real(rtm::quat_identity()),
+            _dual(rtm::quat_set(T(0), T(0), T(0), T(0)))
+        {
+        }
+
+        /**
+         * @brief Creates a dual quaternion that rotates and then translates.
+         *
+         * @param rotation The rotation.  Must be normalized.
+         * @param translation The translation applied after the rotation
+         */
+        MVM_INLINE dual_quat(const quat_t& rotation,
+                             const vec3_t& translation) :
+            _real(rotation.to_rtm()),
+            _dual(make_dual(rotation.to_rtm(), translation.to_rtm()))
+        {
+        }
+
+        MVM_INLINE dual_quat(const dual_quat& other) :
+            _real(other._real), _dual(other._dual)
+        {
+        }
+
+        MVM_INLINE dual_quat& operator=(const dual_quat& other)
+        {
+            _real = other._real;
+            _dual = other._dual;
+            return *this;
+        }
+
+        MVM_INLINE_NODISCARD static dual_quat from_parts(const quat_t& real,
+                                                         const quat_t& dual)
+        {
+            dual_quat result;
+            result._real = real.to_rtm();
+            result._dual = dual.to_rtm();
+            return result;
+        }
+
+        // Arithmetic operations
+    public:
+        MVM_INLINE_NODISCARD dual_quat operator*(const dual_quat& other) const
+        {
+            using namespace rtm;
+            dual_quat result;
+            result._real = quat_mul(_real, other._real);
+            result._dual = vector_to_quat(
+                vector_add(quat_to_vector(quat_mul(_dual, other._real)),
+                           quat_to_vector(quat_mul(_real, other._dual))));
+            return result;
+        }
+
+        MVM_INLINE_NODISCARD vec3_t transform_point(const vec3_t& point) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t real = quat_to_vector(_real);
+            const rtm_vec4_t dual = quat_to_vector(_dual);
+            return vec3_t::from_rtm(
+                vector_add(detail::quat_rotate(real, point.to_rtm()),
+                           detail::dq_translation(real, dual)));
+        }
+
+        MVM_INLINE_NODISCARD vec3_t transform_vector(const vec3_t& vector) const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(detail::quat_rotate(quat_to_vector(_real),
+                                                        vector.to_rtm()));
+        }
+
+        // Stream overload operators
+    public:
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(
+            std::basic_ostream<CharT, Traits>& os, const dual_quat& dq)
+        {
+#if defined(MVM_HAS_MOVE_CORE)
+            os << move::meta::type_name<dual_quat>() << "(";
+#else
+            os << "dual_quat(";
+#endif
+            os << dq.get_real() << ", " << dq.get_dual() << ")";
+            return os;
+        }
+
+        // Comparison operators
+    public:
+        MVM_INLINE_NODISCARD bool operator==(const dual_quat& other) const
+        {
+            return rtm::quat_near_equal(_real, other._real) &&
+                   rtm::quat_near_equal(_dual, other._dual);
+        }
+
+        MVM_INLINE_NODISCARD bool operator!=(const dual_quat& other) const
+        {
+            return !(*this == other);
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD quat_t get_real() const
+        {
+            return quat_t::from_rtm(_real);
+        }
+
+        MVM_INLINE_NODISCARD quat_t get_dual() const
+        {
+            return quat_t::from_rtm(_dual);
+        }
+
+        MVM_INLINE_NODISCARD quat_t get_rotation() const
+        {
+            return quat_t::from_rtm(_real);
+        }
+
+        MVM_INLINE_NODISCARD vec3_t get_translation() const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(detail::dq_translation(
+                quat_to_vector(_real), quat_to_vector(_dual)));
+        }
+
+        // Serialization
+    public:
+        template <typename Archive>
+        MVM_INLINE void serialize(Archive& archive)
+        {
+            T data[8];
+            if constexpr (Archive::is_loading::value)
+            {
+                archive(data);
+                _real = rtm::quat_load(data);
+                _dual = rtm::quat_load(data + 4);
+            }
+            else
+            {
+                rtm::quat_store(_real, data);
+                rtm::quat_store(_dual, data + 4);
+                archive(data);
+            }
+        }
+
+        // Mathematical operations
+    public:
+        /**
+         * @brief Returns the inverse transform.  Only valid for normalized
+         * dual quaternions, for which it is simply the conjugate of both
+         * parts.
+         */
+        MVM_INLINE_NODISCARD dual_quat inverse() const
+        {
+            using namespace rtm;
+            dual_quat result;
+            result._real = quat_conjugate(_real);
+            result._dual = quat_conjugate(_dual);
+            return result;
+        }
+
+        /**
+         * @brief Rescales both parts so that the rotation is unit length.
+         * Required after blending, since a weighted sum of unit dual
+         * quaternions is not generally unit length.
+         */
+        MVM_INLINE_NODISCARD dual_quat normalized() const
+        {
+            dual_quat result = *this;
+            return result.normalize();
+        }
+
+        MVM_INLINE dual_quat& normalize()
+        {
+            using namespace rtm;
+            const T inv_length = T(1) / T(quat_length(_real));
+            _real =
+                vector_to_quat(vector_mul(quat_to_vector(_real), inv_length));
+            _dual =
+                vector_to_quat(vector_mul(quat_to_vector(_dual), inv_length));
+            return *this;
+        }
+
+        // Conversions
+    public:
+        /**
+         * @brief Converts to a row-major affine matrix.  Equivalent to
+         * `mat4x4::trs` with a unit scale.
+         */
+        MVM_INLINE_NODISCARD mat4x4_t to_mat4x4() const
+        {
+            return rtm::ext::transform_4x4(get_translation().to_rtm(), _real,
+                                           rtm::vector_set(T(1)));
+        }
+
+        /**
+         * @brief Converts to RTM's affine 3x4 matrix type.
+         */
+        MVM_INLINE_NODISCARD rtm_mat3x4_t to_mat3x4() const
+        {
+            return rtm::ext::transform_3x4(get_translation().to_rtm(), _real,
+                                           rtm::vector_set(T(1)));
+        }
+
+        /**
+         * @brief Extracts the rigid part of a rotation and translation matrix.
+         * The upper 3x3 must be orthonormal; scale and shear are not
+         * representable by a dual quaternion.
+         *
+         * @param mat The matrix to convert
+         * @return dual_quat The equivalent dual quaternion
+         */
+        MVM_INLINE_NODISCARD static dual_quat from_mat4x4(const mat4x4_t& mat)
+        {
+            return from_axes(mat.to_rtm());
+        }
+
+        /**
+         * @brief Extracts the rigid part of an RTM affine 3x4 matrix.  See
+         * from_mat4x4.
+         */
+        MVM_INLINE_NODISCARD static dual_quat from_mat3x4(
+            const rtm_mat3x4_t& mat)
+        {
+            return from_axes(mat);
+        }
+
+        // Statics
+    public:
+        MVM_INLINE_NODISCARD static dual_quat identity()
+        {
+            return dual_quat();
+        }
+
+        /**
+         * @brief Linearly blends two dual quaternions and renormalizes,
+         * taking the shortest path between the rotations.
+         *
+         * @param a The start transform
+         * @param b The end transform
+         * @param t The blend factor
+         * @return dual_quat The blended transform
+         */
+        MVM_INLINE_NODISCARD static dual_quat lerp(const dual_quat& a,
+                                                   const dual_quat& b,
+                                                   const T& t)
+        {
+            using namespace rtm;
+            const rtm_vec4_t a_real = quat_to_vector(a._real);
+            const rtm_vec4_t b_real = quat_to_vector(b._real);
+            const T sign = T(vector_dot(a_real, b_real)) < T(0) ? T(-1) : T(1);
+            const T wa = T(1) - t;
+            const T wb = t * sign;
+
+            dual_quat result;
+            result._real = vector_to_quat(
+                vector_mul_add(b_real, wb, vector_mul(a_real, wa)));
+            result._dual = vector_to_quat(
+                vector_mul_add(quat_to_vector(b._dual), wb,
+                               vector_mul(quat_to_vector(a._dual), wa)));
+            return result.normalize();
+        }
+
+    private:
+        // d = 0.5 * t * r, in Hamilton order.  RTM's quat_mul takes its
+        // operands in the opposite order.
+        MVM_INLINE_NODISCARD static rtm_quat_t make_dual(
+            const rtm_quat_t& real, const rtm_vec4_t& translation)
+        {
+            using namespace rtm;
+            const rtm_quat_t pure = vector_to_quat(vector_set_w(
+                vector_mul(translation, T(0.5)), T(0)));
+            return quat_mul(real, pure);
+        }
+
+        template <typename Matrix>
+        MVM_INLINE_NODISCARD static dual_quat from_axes(const Matrix& mat)
+        {
+            using namespace rtm;
+            const rtm_quat_t rotation =
+                quat_from_matrix(matrix_set(matrix_get_axis(mat, axis4::x),
+                                            matrix_get_axis(mat, axis4::y),
+                                            matrix_get_axis(mat, axis4::z)));
+            dual_quat result;
+            result._real = rotation;
+            result._dual =
+                make_dual(rotation, matrix_get_axis(mat, axis4::w));
+            return result;
+        }
+    };
+
+    using dual_quatf = dual_quat<float>;
+    using dual_quatd = dual_quat<double>;
+
+    template <typename T>
+    MVM_INLINE_NODISCARD bool approx_equal(
+        const dual_quat<T>& a,
+        const dual_quat<T>& b,
+        const T& epsilon = std::numeric_limits<T>::epsilon())
+    {
+        return approx_equal(a.get_real(), b.get_real(), epsilon) &&
+               approx_equal(a.get_dual(), b.get_dual(), epsilon);
+    }
+}  // namespace move::math
@@ -0,0 +1,1150 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/transform_qvv.hpp>
+#include <move/math/vec3.hpp>
+#include <move/math/vec4.hpp>
+
+// Convex collision through support mappings.  A shape takes part by
+// providing
+//
+//     vec3_t support(const vec3_t& direction) const;
+//
+// which returns its point farthest along `direction`.  sphere, aabb and
+// capsule provide one, and convex_point_set and transformed_shape below
+// cover hulls and posed shapes.  Every query is a template over both
+// shapes, so the support calls inline with no virtual dispatch.
+//
+// A shape that is a smaller core grown by a margin may also provide
+//
+//     vec3_t core_support(const vec3_t& direction) const;
+//     T margin() const;
+//
+// and is then measured on its core with the margin added back, as sphere
+// and capsule do.
+
+namespace move::math
+{
+    namespace detail
+    {
+        template <typename T>
+        struct gjk_solver;
+    }
+
+    /**
+     * @brief The simplex GJK ended on, kept between frames to warm start
+     * the next query between the same pair of shapes.
+     *
+     * It stores the search direction behind each vertex rather than the
+     * vertex, so after the shapes move the same directions rebuild a
+     * simplex that is usually within an iteration or two of the answer.
+     * An empty simplex starts from scratch.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct gjk_simplex
+    {
+    public:
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+
+    private:
+        template <typename>
+        friend struct detail::gjk_solver;
+
+        rtm_vec4_t _directions[4];
+        uint32_t _count = 0;
+
+        // Queries
+    public:
+        MVM_INLINE_NODISCARD uint32_t size() const
+        {
+            return _count;
+        }
+
+        MVM_INLINE_NODISCARD bool empty() const
+        {
+            return _count == 0;
+        }
+
+        // Modifiers
+    public:
+        MVM_INLINE void reset()
+        {
+            _count = 0;
+        }
+    };
+
+    /**
+     * @brief The closest points between two convex shapes.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct gjk_result
+    {
+        using vec3_t = vec3<T, Acceleration::RTM>;
+
+        // The closest point of the first shape
+        vec3_t point_a = vec3_t(0, 0, 0);
+        // The closest point of the second shape
+        vec3_t point_b = vec3_t(0, 0, 0);
+        // The distance between them, zero when the shapes overlap
+        T distance = T(0);
+        // The support calls made, counting both shapes as one
+        uint32_t iterations = 0;
+        // The shapes touch or overlap, so the points are meaningless
+        bool intersecting = false;
+    };
+
+    /**
+     * @brief The contact between two convex shapes, separated or not.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct convex_contact
+    {
+        using vec3_t = vec3<T, Acceleration::RTM>;
+
+        // The point of the first shape nearest the second, or deepest
+        // inside it
+        vec3_t point_a = vec3_t(0, 0, 0);
+        // The point of the second shape nearest the first, or deepest
+        // inside it
+        vec3_t point_b = vec3_t(0, 0, 0);
+        // The unit direction from the first shape toward the second.
+        // Moving the second shape by `-distance * normal` brings them to
+        // touching.
+        vec3_t normal = vec3_t(0, 1, 0);
+        // The separation, negative by the penetration depth on overlap
+        T distance = T(0);
+        // GJK and EPA iterations together
+        uint32_t iterations = 0;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        struct gjk_solver
+        {
+            using v4 = typename simd_rtm::detail::v4<T>::type;
+
+            constexpr static T epsilon = std::numeric_limits<T>::epsilon();
+            // GJK stops once the distance is known to this relative
+            // accuracy
+            constexpr static T relative_tolerance =
+                std::is_same_v<T, float> ? T(1e-5) : T(1e-10);
+            constexpr static uint32_t max_iterations = 64;
+
+            // Vertices of the Minkowski difference a - b, with the support
+            // points and search direction that produced each one
+            v4 w[4];
+            v4 a[4];
+            v4 b[4];
+            v4 d[4];
+            T lambda[4];
+            uint32_t count = 0;
+            // The largest squared vertex length seen, which scales the
+            // tolerances to the shapes
+            T scale_sq = T(0);
+
+            template <typename ShapeA, typename ShapeB>
+            MVM_INLINE void push(const ShapeA& shape_a,
+                                 const ShapeB& shape_b,
+                                 const v4& direction)
+            {
+                using namespace rtm;
+                using vec3_t = vec3<T, Acceleration::RTM>;
+                a[count] =
+                    shape_a.support(vec3_t::from_rtm(direction)).to_rtm();
+                b[count] =
+                    shape_b.support(vec3_t::from_rtm(vector_neg(direction)))
+                        .to_rtm();
+                w[count] = vector_sub(a[count], b[count]);
+                d[count] = direction;
+                scale_sq =
+                    math::max(scale_sq, T(vector_dot3(w[count], w[count])));
+                ++count;
+            }
+
+            MVM_INLINE_NODISCARD v4 closest() const
+            {
+                using namespace rtm;
+                v4 result = vector_mul(w[0], lambda[0]);
+                for (uint32_t i = 1; i < count; ++i)
+                {
+                    result = vector_mul_add(w[i], lambda[i], result);
+                }
+                return result;
+            }
+
+            MVM_INLINE void witnesses(v4& point_a, v4& point_b) const
+            {
+                using namespace rtm;
+                point_a = vector_mul(a[0], lambda[0]);
+                point_b = vector_mul(b[0], lambda[0]);
+                for (uint32_t i = 1; i < count; ++i)
+                {
+                    point_a = vector_mul_add(a[i], lambda[i], point_a);
+                    point_b = vector_mul_add(b[i], lambda[i], point_b);
+                }
+            }
+
+            // Keeps the vertices with a nonzero weight, in order
+            MVM_INLINE void keep(const uint32_t mask, const T (&weights)[4])
+            {
+                uint32_t next = 0;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    if ((mask >> i) & 1)
+                    {
+                        w[next] = w[i];
+                        a[next] = a[i];
+                        b[next] = b[i];
+                        d[next] = d[i];
+                        lambda[next] = weights[i];
+                        ++next;
+                    }
+                }
+                count = next;
+            }
+
+            // The point of segment w[i]-w[j] closest to the origin, as the
+            // vertices it depends on and their weights
+            MVM_INLINE uint32_t segment(const uint32_t i,
+                                        const uint32_t j,
+                                        T (&weights)[4]) const
+            {
+                using namespace rtm;
+                const v4 ij = vector_sub(w[j], w[i]);
+                const T length_sq = T(vector_dot3(ij, ij));
+                const T t = -T(vector_dot3(w[i], ij));
+                if (t <= T(0) || length_sq <= scale_sq * epsilon * epsilon)
+                {
+                    weights[i] = T(1);
+                    return 1u << i;
+                }
+                if (t >= length_sq)
+                {
+                    weights[j] = T(1);
+                    return 1u << j;
+                }
+                weights[j] = t / length_sq;
+                weights[i] = T(1) - weights[j];
+                return (1u << i) | (1u << j);
+            }
+
+            // The point of triangle w[i] w[j] w[k] closest to the origin,
+            // after Ericson's Real-Time Collision Detection 5.1.5
+            MVM_INLINE uint32_t triangle(const uint32_t i,
+                                         const uint32_t j,
+                                         const uint32_t k,
+                                         T (&weights)[4]) const
+            {
+                using namespace rtm;
+                const v4 ab = vector_sub(w[j], w[i]);
+                const v4 ac = vector_sub(w[k], w[i]);
+                const v4 n = vector_cross3(ab, ac);
+                const T ab_sq = T(vector_dot3(ab, ab));
+                const T ac_sq = T(vector_dot3(ac, ac));
+                if (T(vector_dot3(n, n)) <=
+                    epsilon * epsilon * ab_sq * ac_sq)
+                {
+                    return best_edge(i, j, k, weights);
+                }
+
+                const T d1 = -T(vector_dot3(ab, w[i]));
+                const T d2 = -T(vector_dot3(ac, w[i]));
+                if (d1 <= T(0) && d2 <= T(0))
+                {
+                    weights[i] = T(1);
+                    return 1u << i;
+                }
+                const T d3 = -T(vector_dot3(ab, w[j]));
+                const T d4 = -T(vector_dot3(ac, w[j]));
+                if (d3 >= T(0) && d4 <= d3)
+                {
+                    weights[j] = T(1);
+                    return 1u << j;
+                }
+                const T vc = d1 * d4 - d3 * d2;
+                if (vc <= T(0) && d1 >= T(0) && d3 <= T(0))
+                {
+                    weights[j] = d1 / (d1 - d3);
+                    weights[i] = T(1) - weights[j];
+                    return (1u << i) | (1u << j);
+                }
+                const T d5 = -T(vector_dot3(ab, w[k]));
+                const T d6 = -T(vector_dot3(ac, w[k]));
+                if (d6 >= T(0) && d5 <= d6)
+                {
+                    weights[k] = T(1);
+                    return 1u << k;
+                }
+                const T vb = d5 * d2 - d1 * d6;
+                if (vb <= T(0) && d2 >= T(0) && d6 <= T(0))
+                {
+                    weights[k] = d2 / (d2 - d6);
+                    weights[i] = T(1) - weights[k];
+                    return (1u << i) | (1u << k);
+                }
+                const T va = d3 * d6 - d5 * d4;
+                if (va <= T(0) && d4 - d3 >= T(0) && d5 - d6 >= T(0))
+                {
+                    weights[k] = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                    weights[j] = T(1) - weights[k];
+                    return (1u << j) | (1u << k);
+                }
+                const T sum = va + vb + vc;
+                if (sum <= T(0))
+                {
+                    return best_edge(i, j, k, weights);
+                }
+                weights[j] = vb / sum;
+                weights[k] = vc / sum;
+                weights[i] = T(1) - weights[j] - weights[k];
+                return (1u << i) | (1u << j) | (1u << k);
+            }
+
+            // The nearest of a flat triangle's edges
+            MVM_INLINE uint32_t best_edge(const uint32_t i,
+                                          const uint32_t j,
+                                          const uint32_t k,
+                                          T (&weights)[4]) const
+            {
+                const uint32_t edges[3][2] = {{i, j}, {j, k}, {i, k}};
+                uint32_t best_mask = 0;
+                T best = std::numeric_limits<T>::infinity();
+                for (const auto& edge : edges)
+                {
+                    T candidate[4] = {};
+                    const uint32_t mask = segment(edge[0], edge[1], candidate);
+                    const T distance_sq = length_sq(mask, candidate);
+                    if (distance_sq < best)
+                    {
+                        best = distance_sq;
+                        best_mask = mask;
+                        for (uint32_t v = 0; v < 4; ++v)
+                        {
+                            weights[v] = candidate[v];
+                        }
+                    }
+                }
+                return best_mask;
+            }
+
+            // Zero when the origin is inside the tetrahedron
+            MVM_INLINE uint32_t tetrahedron(T (&weights)[4]) const
+            {
+                using namespace rtm;
+                constexpr uint32_t faces[4][4] = {
+                    {0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 3, 1}, {1, 2, 3, 0}};
+
+                uint32_t best_mask = 0;
+                T best = std::numeric_limits<T>::infinity();
+                for (const auto& face : faces)
+                {
+                    const v4 origin = w[face[0]];
+                    const v4 n =
+                        vector_cross3(vector_sub(w[face[1]], origin),
+                                      vector_sub(w[face[2]], origin));
+                    const T side_origin = -T(vector_dot3(n, origin));
+                    const T side_opposite =
+                        T(vector_dot3(n, vector_sub(w[face[3]], origin)));
+                    // A flat tetrahedron separates nothing, so every face
+                    // is a candidate
+                    const bool flat =
+                        side_opposite * side_opposite <=
+                        epsilon * T(vector_dot3(n, n)) * scale_sq;
+                    if (!flat && side_origin * side_opposite >= T(0))
+                    {
+                        continue;
+                    }
+
+                    T candidate[4] = {};
+                    const uint32_t mask =
+                        triangle(face[0], face[1], face[2], candidate);
+                    const T distance_sq = length_sq(mask, candidate);
+                    if (distance_sq < best)
+                    {
+                        best = distance_sq;
+                        best_mask = mask;
+                        for (uint32_t v = 0; v < 4; ++v)
+                        {
+                            weights[v] = candidate[v];
+                        }
+                    }
+                }
+                return best_mask;
+            }
+
+            MVM_INLINE_NODISCARD T length_sq(const uint32_t mask,
+                                             const T (&weights)[4]) const
+            {
+                using namespace rtm;
+                v4 p = vector_zero();
+                for (uint32_t i = 0; i < 4; ++i)
+                {
+                    if ((mask >> i) & 1)
+                    {
+                        p = vector_mul_add(w[i], weights[i], p);
+                    }
+                }
+                return T(vector_dot3(p, p));
+            }
+
+            /**
+             * Reduces the simplex to the vertices supporting its point
+             * closest to the origin.  Returns false when a tetrahedron
+             * contains the origin, leaving all four vertices.
+             */
+            MVM_INLINE bool solve()
+            {
+                T weights[4] = {};
+                uint32_t mask = 0;
+                switch (count)
+                {
+                case 1:
+                    weights[0] = T(1);
+                    mask = 1;
+                    break;
+                case 2:
+                    mask = segment(0, 1, weights);
+                    break;
+                case 3:
+                    mask = triangle(0, 1, 2, weights);
+                    break;
+                default:
+                    mask = tetrahedron(weights);
+                    if (mask == 0)
+                    {
+                        return false;
+                    }
+                    break;
+                }
+                keep(mask, weights);
+                return true;
+            }
+
+            MVM_INLINE_NODISCARD bool contains(const v4& point) const
+            {
+                using namespace rtm;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const v4 offset = vector_sub(w[i], point);
+                    if (T(vector_dot3(offset, offset)) <=
+                        epsilon * epsilon * scale_sq)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            template <typename ShapeA, typename ShapeB>
+            MVM_INLINE void warm_start(const ShapeA& shape_a,
+                                       const ShapeB& shape_b,
+                                       const gjk_simplex<T>& simplex)
+            {
+                using namespace rtm;
+                for (uint32_t i = 0; i < simplex._count; ++i)
+                {
+                    push(shape_a, shape_b, simplex._directions[i]);
+                }
+                if (count == 0)
+                {
+                    push(shape_a, shape_b, vector_set(T(1), T(0), T(0), T(0)));
+                }
+                if (!solve())
+                {
+                    lambda[0] = lambda[1] = lambda[2] = lambda[3] = T(0.25);
+                }
+            }
+
+            MVM_INLINE void store(gjk_simplex<T>& simplex) const
+            {
+                for (uint32_t i = 0; i < 4 && i < count; ++i)
+                {
+                    simplex._directions[i] = d[i];
+                }
+                simplex._count = count;
+            }
+
+            // Runs GJK from the current simplex.  Returns true when the
+            // shapes touch or overlap.
+            template <typename ShapeA, typename ShapeB>
+            MVM_INLINE bool run(const ShapeA& shape_a,
+                                const ShapeB& shape_b,
+                                uint32_t& iterations)
+            {
+                using namespace rtm;
+                if (count == 4)
+                {
+                    return true;
+                }
+
+                v4 v = closest();
+                T distance_sq = T(vector_dot3(v, v));
+                while (iterations < max_iterations)
+                {
+                    if (distance_sq <= T(100) * epsilon * epsilon * scale_sq)
+                    {
+                        return true;
+                    }
+
+                    const v4 direction = vector_neg(v);
+                    ++iterations;
+                    push(shape_a, shape_b, direction);
+                    const v4 vertex = w[count - 1];
+
+                    // No vertex further toward the origin means v is
+                    // already as close as the shapes get
+                    const T gap = distance_sq - T(vector_dot3(v, vertex));
+                    --count;
+                    if (gap <= relative_tolerance * distance_sq ||
+                        contains(vertex))
+                    {
+                        return false;
+                    }
+                    ++count;
+
+                    gjk_solver previous = *this;
+                    if (!solve())
+                    {
+                        return true;
+                    }
+                    v = closest();
+                    const T next_sq = T(vector_dot3(v, v));
+                    if (next_sq >= distance_sq)
+                    {
+                        // Rounding stalled the descent, so keep the last
+                        // simplex that made progress
+                        *this = previous;
+                        --count;
+                        return false;
+                    }
+                    distance_sq = next_sq;
+                }
+                return false;
+            }
+        };
+
+        template <typename T>
+        struct epa_polytope
+        {
+            using v4 = typename simd_rtm::detail::v4<T>::type;
+
+            constexpr static T epsilon = std::numeric_limits<T>::epsilon();
+            constexpr static T relative_tolerance =
+                std::is_same_v<T, float> ? T(1e-4) : T(1e-8);
+            constexpr static uint32_t max_iterations = 48;
+            constexpr static uint32_t max_vertices = max_iterations + 4;
+            // A closed polytope with V vertices has 2V - 4 faces
+            constexpr static uint32_t max_faces = 2 * max_vertices;
+
+            struct face
+            {
+                v4 normal;
+                T distance;
+                uint32_t v[3];
+            };
+
+            v4 w[max_vertices];
+            v4 a[max_vertices];
+            v4 b[max_vertices];
+            face faces[max_faces];
+            uint32_t edges[3 * max_faces][2];
+            uint32_t vertex_count = 0;
+            uint32_t face_count = 0;
+
+            MVM_INLINE void add_face(const uint32_t i,
+                                     const uint32_t j,
+                                     const uint32_t k)
+            {
+                using namespace rtm;
+                face& f = faces[face_count++];
+                f.v[0] = i;
+                f.v[1] = j;
+                f.v[2] = k;
+                const v4 n = vector_cross3(vector_sub(w[j], w[i]),
+                                           vector_sub(w[k], w[i]));
+                const T length_sq = T(vector_dot3(n, n));
+                if (length_sq > std::numeric_limits<T>::min())
+                {
+                    f.normal = vector_mul(n, T(1) / math::sqrt(length_sq));
+                    f.distance = T(vector_dot3(f.normal, w[i]));
+                }
+                else
+                {
+                    // A sliver can't be the closest face, but it still
+                    // closes the polytope
+                    f.normal = vector_zero();
+                    f.distance = std::numeric_limits<T>::infinity();
+                }
+            }
+
+            MVM_INLINE void add_edge(uint32_t& count,
+                                     const uint32_t i,
+                                     const uint32_t j)
+            {
+                // An edge shared by two removed faces is interior to the
+                // hole, so its reverse cancels it
+                for (uint32_t e = 0; e < count; ++e)
+                {
+                    if (edges[e][0] == j && edges[e][1] == i)
+                    {
+                        edges[e][0] = edges[count - 1][0];
+                        edges[e][1] = edges[count - 1][1];
+                        --count;
+                        return;
+                    }
+                }
+                edges[count][0] = i;
+                edges[count][1] = j;
+                ++count;
+            }
+
+            template <typename ShapeA, typename ShapeB>
+            MVM_INLINE uint32_t push(const ShapeA& shape_a,
+                                     const ShapeB& shape_b,
+                                     const v4& direction)
+            {
+                using namespace rtm;
+                using vec3_t = vec3<T, Acceleration::RTM>;
+                a[vertex_count] =
+                    shape_a.support(vec3_t::from_rtm(direction)).to_rtm();
+                b[vertex_count] =
+                    shape_b.support(vec3_t::from_rtm(vector_neg(direction)))
+                        .to_rtm();
+                w[vertex_count] = vector_sub(a[vertex_count], b[vertex_count]);
+                return vertex_count++;
+            }
+
+            MVM_INLINE_NODISCARD static v4 normalized(const v4& v)
+            {
+                using namespace rtm;
+                const T length_sq = T(vector_dot3(v, v));
+                return length_sq > std::numeric_limits<T>::min()
+                           ? vector_mul(v, T(1) / math::sqrt(length_sq))
+                           : v;
+            }
+
+            MVM_INLINE_NODISCARD T line_distance_sq(const v4& p,
+                                                    const v4& q,
+                                                    const v4& r) const
+            {
+                using namespace rtm;
+                const v4 n = vector_cross3(vector_sub(q, p), vector_sub(r, p));
+                const v4 pq = vector_sub(q, p);
+                const T length_sq = T(vector_dot3(pq, pq));
+                return length_sq > std::numeric_limits<T>::min()
+                           ? T(vector_dot3(n, n)) / length_sq
+                           : T(0);
+            }
+
+            /**
+             * Builds the starting tetrahedron from GJK's final simplex.
+             * Touching shapes end GJK with fewer than four vertices, so
+             * the simplex is grown along directions away from the ones
+             * it spans.  Returns false when the difference is flat, as for
+             * two crossing segments, and has no depth to measure; `normal`
+             * then receives a direction across the flat part if it has
+             * one.
+             */
+            template <typename ShapeA, typename ShapeB>
+            MVM_INLINE bool start(const ShapeA& shape_a,
+                                  const ShapeB& shape_b,
+                                  const gjk_solver<T>& simplex,
+                                  v4& normal)
+            {
+                using namespace rtm;
+                for (uint32_t i = 0; i < simplex.count; ++i)
+                {
+                    w[i] = simplex.w[i];
+                    a[i] = simplex.a[i];
+                    b[i] = simplex.b[i];
+                }
+                vertex_count = simplex.count;
+                const T tiny = epsilon * simplex.scale_sq;
+
+                const v4 axes[3] = {vector_set(T(1), T(0), T(0), T(0)),
+                                    vector_set(T(0), T(1), T(0), T(0)),
+                                    vector_set(T(0), T(0), T(1), T(0))};
+                if (vertex_count == 1)
+                {
+                    for (uint32_t i = 0; i < 6 && vertex_count == 1; ++i)
+                    {
+                        push(shape_a, shape_b,
+                             i < 3 ? axes[i] : vector_neg(axes[i - 3]));
+                        const v4 offset = vector_sub(w[1], w[0]);
+                        if (T(vector_dot3(offset, offset)) <= tiny)
+                        {
+                            --vertex_count;
+                        }
+                    }
+                }
+                if (vertex_count == 2)
+                {
+                    // Search around the segment, starting from the axis
+                    // least aligned with it
+                    const v4 along = vector_sub(w[1], w[0]);
+                    const v4 abs_along = vector_abs(along);
+                    const T x = vector_get_x(abs_along);
+                    const T y = vector_get_y(abs_along);
+                    const T z = vector_get_z(abs_along);
+                    const v4 axis = x <= y && x <= z ? axes[0]
+                                    : y <= z         ? axes[1]
+                                                     : axes[2];
+                    const v4 side = normalized(vector_cross3(along, axis));
+                    const v4 other = normalized(vector_cross3(along, side));
+                    normal = side;
+                    for (uint32_t i = 0; i < 6 && vertex_count == 2; ++i)
+                    {
+                        // Six steps of sixty degrees
+                        constexpr T c[6] = {T(1),   T(0.5), T(-0.5),
+                                            T(-1),  T(-0.5), T(0.5)};
+                        constexpr T s[6] = {T(0),
+                                            T(0.8660254037844386),
+                                            T(0.8660254037844386),
+                                            T(0),
+                                            T(-0.8660254037844386),
+                                            T(-0.8660254037844386)};
+                        push(shape_a, shape_b,
+                             vector_add(vector_mul(side, c[i]),
+                                        vector_mul(other, s[i])));
+                        if (line_distance_sq(w[0], w[1], w[2]) <= tiny)
+                        {
+                            --vertex_count;
+                        }
+                    }
+                }
+                if (vertex_count == 3)
+                {
+                    const v4 n = normalized(vector_cross3(
+                        vector_sub(w[1], w[0]), vector_sub(w[2], w[0])));
+                    normal = n;
+                    for (uint32_t i = 0; i < 2 && vertex_count == 3; ++i)
+                    {
+                        push(shape_a, shape_b, i == 0 ? n : vector_neg(n));
+                        const T height =
+                            T(vector_dot3(n, vector_sub(w[3], w[0])));
+                        if (height * height <=
+                            tiny * T(vector_dot3(n, n)))
+                        {
+                            --vertex_count;
+                        }
+                    }
+                }
+                if (vertex_count < 4)
+                {
+                    return false;
+                }
+
+                // Wind every face outward
+                const v4 n = vector_cross3(vector_sub(w[1], w[0]),
+                                           vector_sub(w[2], w[0]));
+                if (T(vector_dot3(n, vector_sub(w[3], w[0]))) > T(0))
+                {
+                    const v4 t = w[1];
+                    w[1] = w[2];
+                    w[2] = t;
+                    const v4 ta = a[1];
+                    a[1] = a[2];
+                    a[2] = ta;
+                    const v4 tb = b[1];
+                    b[1] = b[2];
+                    b[2] = tb;
+                }
+                face_count = 0;
+                add_face(0, 1, 2);
+                add_face(0, 3, 1);
+                add_face(0, 2, 3);
+                add_face(1, 3, 2);
+                return true;
+            }
+
+            MVM_INLINE_NODISCARD uint32_t closest_face() const
+            {
+                uint32_t best = 0;
+                for (uint32_t f = 1; f < face_count; ++f)
+                {
+                    if (faces[f].distance < faces[best].distance)
+                    {
+                        best = f;
+                    }
+                }
+                return best;
+            }
+
+            // Expands the polytope until its closest face is on the
+            // boundary of the difference, and returns that face
+            template <typename ShapeA, typename ShapeB>
+            MVM_INLINE face expand(const ShapeA& shape_a,
+                                   const ShapeB& shape_b,
+                                   const T& scale_sq,
+                                   uint32_t& iterations)
+            {
+                using namespace rtm;
+                const T floor = epsilon * math::sqrt(scale_sq);
+                face best = faces[closest_face()];
+                for (uint32_t step = 0; step < max_iterations; ++step)
+                {
+                    if (vertex_count == max_vertices)
+                    {
+                        break;
+                    }
+
+                    ++iterations;
+                    const uint32_t vertex = push(shape_a, shape_b, best.normal);
+                    const T gap =
+                        T(vector_dot3(best.normal, w[vertex])) - best.distance;
+                    if (gap <= math::max(relative_tolerance * best.distance,
+                                         floor))
+                    {
+                        break;
+                    }
+
+                    // Cut out every face the new vertex sees, which
+                    // includes the closest one, and cap the hole with a
+                    // fan to it
+                    uint32_t edge_count = 0;
+                    for (uint32_t i = 0; i < face_count;)
+                    {
+                        const face& f = faces[i];
+                        if (T(vector_dot3(f.normal,
+                                          vector_sub(w[vertex], w[f.v[0]]))) >
+                            T(0))
+                        {
+                            add_edge(edge_count, f.v[0], f.v[1]);
+                            add_edge(edge_count, f.v[1], f.v[2]);
+                            add_edge(edge_count, f.v[2], f.v[0]);
+                            faces[i] = faces[--face_count];
+                            continue;
+                        }
+                        ++i;
+                    }
+                    if (face_count + edge_count > max_faces)
+                    {
+                        break;
+                    }
+                    for (uint32_t e = 0; e < edge_count; ++e)
+                    {
+                        add_face(edges[e][0], edges[e][1], vertex);
+                    }
+                    best = faces[closest_face()];
+                }
+                return best;
+            }
+        };
+
+        // The shape GJK runs on, the core of shapes that are a core grown
+        // by a margin and otherwise the shape itself
+        template <typename Shape>
+        struct core_shape
+        {
+            using vec3_t = typename Shape::vec3_t;
+
+            const Shape& shape;
+
+            MVM_INLINE_NODISCARD vec3_t support(const vec3_t& direction) const
+            {
+                if constexpr (requires { shape.core_support(direction); })
+                {
+                    return shape.core_support(direction);
+                }
+                else
+                {
+                    return shape.support(direction);
+                }
+            }
+        };
+
+        template <typename T, typename Shape>
+        MVM_INLINE_NODISCARD T margin_of(const Shape& shape)
+        {
+            if constexpr (requires { shape.margin(); })
+            {
+                return T(shape.margin());
+            }
+            else
+            {
+                return T(0);
+            }
+        }
+    }  // namespace detail
+
+    /**
+     * @brief The distance between two convex shapes by GJK, after van den
+     * Bergen's Collision Detection in Interactive 3D Environments.
+     *
+     * @param shape_a The first shape, with a support mapping
+     * @param shape_b The second shape, with a support mapping
+     * @param simplex Warm starts the search when it holds the simplex of a
+     * previous query between the same shapes, and receives this query's
+     * final simplex
+     * @return gjk_result<T> The closest points, or `intersecting` when the
+     * shapes touch or overlap
+     */
+    template <typename T, typename ShapeA, typename ShapeB>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE gjk_result<T> gjk_distance(const ShapeA& shape_a,
+                                          const ShapeB& shape_b,
+                                          gjk_simplex<T>& simplex)
+    {
+        using namespace rtm;
+        using vec3_t = vec3<T, Acceleration::RTM>;
+        using v4 = typename detail::gjk_solver<T>::v4;
+        const detail::core_shape<ShapeA> core_a{shape_a};
+        const detail::core_shape<ShapeB> core_b{shape_b};
+        const T margin_a = detail::margin_of<T>(shape_a);
+        const T margin_b = detail::margin_of<T>(shape_b);
+
+        detail::gjk_solver<T> solver;
+        solver.warm_start(core_a, core_b, simplex);
+        gjk_result<T> result;
+        result.iterations = solver.count;
+        result.intersecting = solver.run(core_a, core_b, result.iterations);
+        solver.store(simplex);
+        if (result.intersecting)
+        {
+            return result;
+        }
+
+        v4 point_a;
+        v4 point_b;
+        solver.witnesses(point_a, point_b);
+        const v4 offset = vector_sub(point_b, point_a);
+        const T distance = T(vector_length3(offset));
+        if (distance <= margin_a + margin_b)
+        {
+            result.intersecting = true;
+            return result;
+        }
+
+        const v4 normal = vector_mul(offset, T(1) / distance);
+        result.point_a = vec3_t::from_rtm(vector_mul_add(normal, margin_a,
+                                                         point_a));
+        result.point_b = vec3_t::from_rtm(vector_neg_mul_sub(normal, margin_b,
+                                                             point_b));
+        result.distance = distance - margin_a - margin_b;
+        return result;
+    }
+
+    /**
+     * @brief The signed distance and contact between two convex shapes.
+     * Separated shapes are measured by GJK alone, and overlapping ones
+     * continue into EPA for the penetration depth and normal.
+     *
+     * Shapes that are a core grown by a margin, such as spheres and
+     * capsules, are measured on their cores and the margins added after,
+     * which is exact for them and keeps EPA off curved surfaces whenever
+     * the cores stay apart.
+     *
+     * @param shape_a The first shape, with a support mapping
+     * @param shape_b The second shape, with a support mapping
+     * @param simplex As for gjk_distance, carries the simplex between
+     * frames
+     * @return convex_contact<T> The contact, with a negative distance when
+     * the shapes overlap
+     */
+    template <typename T, typename ShapeA, typename ShapeB>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE convex_contact<T> collide_convex(const ShapeA& shape_a,
+                                                const ShapeB& shape_b,
+                                                gjk_simplex<T>& simplex)
+    {
+        using namespace rtm;
+        using vec3_t = vec3<T, Acceleration::RTM>;
+        using v4 = typename detail::gjk_solver<T>::v4;
+        const detail::core_shape<ShapeA> core_a{shape_a};
+        const detail::core_shape<ShapeB> core_b{shape_b};
+        const T margin_a = detail::margin_of<T>(shape_a);
+        const T margin_b = detail::margin_of<T>(shape_b);
+
+        detail::gjk_solver<T> solver;
+        solver.warm_start(core_a, core_b, simplex);
+        convex_contact<T> result;
+        result.iterations = solver.count;
+        const bool intersecting =
+            solver.run(core_a, core_b, result.iterations);
+        solver.store(simplex);
+
+        // The cores' contact, with depth positive when they overlap
+        v4 point_a;
+        v4 point_b;
+        v4 normal = vector_set(T(0), T(1), T(0), T(0));
+        T depth = T(0);
+        detail::epa_polytope<T> polytope;
+        if (!intersecting)
+        {
+            solver.witnesses(point_a, point_b);
+            const v4 offset = vector_sub(point_b, point_a);
+            const T distance = T(vector_length3(offset));
+            normal = vector_mul(offset, T(1) / distance);
+            depth = -distance;
+        }
+        else if (!polytope.start(core_a, core_b, solver, normal))
+        {
+            // A flat difference only touches, so the cores have no depth
+            solver.witnesses(point_a, point_b);
+        }
+        else
+        {
+            const auto face = polytope.expand(core_a, core_b, solver.scale_sq,
+                                              result.iterations);
+
+            // Barycentric coordinates of the origin's projection onto the
+            // face carry over to the support points of each shape
+            const v4 p = vector_mul(face.normal, face.distance);
+            const v4 w0 = polytope.w[face.v[0]];
+            const v4 w1 = polytope.w[face.v[1]];
+            const v4 w2 = polytope.w[face.v[2]];
+            const T area = T(vector_dot3(
+                face.normal,
+                vector_cross3(vector_sub(w1, w0), vector_sub(w2, w0))));
+            T u = T(1) / T(3);
+            T v = T(1) / T(3);
+            if (math::abs(area) > std::numeric_limits<T>::min())
+            {
+                u = T(vector_dot3(face.normal,
+                                  vector_cross3(vector_sub(w1, p),
+                                                vector_sub(w2, p)))) /
+                    area;
+                v = T(vector_dot3(face.normal,
+                                  vector_cross3(vector_sub(w2, p),
+                                                vector_sub(w0, p)))) /
+                    area;
+            }
+            const T t = T(1) - u - v;
+            point_a = vector_mul_add(
+                polytope.a[face.v[2]], t,
+                vector_mul_add(polytope.a[face.v[1]], v,
+                               vector_mul(polytope.a[face.v[0]], u)));
+            point_b = vector_mul_add(
+                polytope.b[face.v[2]], t,
+                vector_mul_add(polytope.b[face.v[1]], v,
+                               vector_mul(polytope.b[face.v[0]], u)));
+            normal = face.normal;
+            depth = face.distance;
+        }
+
+        result.point_a =
+            vec3_t::from_rtm(vector_mul_add(normal, margin_a, point_a));
+        result.point_b =
+            vec3_t::from_rtm(vector_neg_mul_sub(normal, margin_b, point_b));
+        result.normal = vec3_t::from_rtm(normal);
+        result.distance = -depth - margin_a - margin_b;
+        return result;
+    }
+
+    /**
+     * @brief A convex hull given by its vertices, supported by a linear
+     * scan.  It only views the points, which must outlive it.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct convex_point_set
+    {
+    public:
+        using vec3_t = vec3<T, Acceleration::RTM>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+
+    private:
+        const vec3_t* _points = nullptr;
+        size_t _count = 0;
+
+        // Constructors
+    public:
+        MVM_INLINE convex_point_set() = default;
+
+        MVM_INLINE convex_point_set(const vec3_t* points, const size_t count) :
+            _points(points), _count(count)
+        {
+        }
+
+        // Queries
+    public:
+        MVM_INLINE_NODISCARD size_t size() const
+        {
+            return _count;
+        }
+
+        MVM_INLINE_NODISCARD vec3_t support(const vec3_t& direction) const
+        {
+            using namespace rtm;
+            MVM_ASSERT_PRECONDITION(_count > 0);
+            const rtm_vec4_t d = direction.to_rtm();
+            size_t best = 0;
+            T best_dot = T(vector_dot3(_points[0].to_rtm(), d));
+            for (size_t i = 1; i < _count; ++i)
+            {
+                const T dot = T(vector_dot3(_points[i].to_rtm(), d));
+                if (dot > best_dot)
+                {
+                    best_dot = dot;
+                    best = i;
+                }
+            }
+            return _points[best];
+        }
+    };
+
+    /**
+     * @brief A shape placed by a transform, so local-space shapes such as
+     * hull vertices can be posed without copying them.  The direction is
+     * taken into local space, where the shape answers, and the result
+     * back out.  Non-uniform scale is allowed.
+     */
+    template <typename Shape>
+    struct transformed_shape
+    {
+    public:
+        using component_type = typename Shape::vec3_t::component_type;
+        using vec3_t = typename Shape::vec3_t;
+        using transform_t = transform_qvv<component_type>;
+
+    private:
+        Shape _shape;
+        transform_t _transform;
+
+        // Constructors
+    public:
+        MVM_INLINE transformed_shape(const Shape& shape,
+                                     const transform_t& transform) :
+            _shape(shape), _transform(transform)
+        {
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD const Shape& shape() const
+        {
+            return _shape;
+        }
+
+        MVM_INLINE_NODISCARD const transform_t& transform() const
+        {
+            return _transform;
+        }
+
+        // Queries
+    public:
+        MVM_INLINE_NODISCARD vec3_t support(const vec3_t& direction) const
+        {
+            using namespace rtm;
+            // The transpose of rotate-then-scale is unrotate-then-scale
+            const auto data = _transform.to_rtm();
+            const vec3_t local = vec3_t::from_rtm(vector_mul(
+                quat_mul_vector3(direction.to_rtm(),
+                                 quat_conjugate(data.rotation)),
+                data.scale));
+            return _transform.transform_point(_shape.support(local));
+        }
+    };
+}  // namespace move::math
@@ -32,3 +32,55 @@
 
 #define MVM_INLINE MVM_FORCE_INLINE
 #define MVM_INLINE_NODISCARD MVM_NODISCARD MVM_FORCE_INLINE
+
+// Promises that a pointer parameter is the only way its data is reached,
+// which lets loops over several arrays vectorize without run-time overlap
+// checks
+#if defined(MVM_IS_MSVC) || defined(MVM_IS_GCC) || defined(MVM_IS_CLANG)
+#define MVM_RESTRICT __restrict
+#else
+#define MVM_RESTRICT
+#endif
+
+// Hint that the cache line containing `addr` will be read soon.  Purely a
+// performance hint; compiles to nothing where unsupported.
+#if defined(MVM_IS_GCC) || defined(MVM_IS_CLANG)
+#define MVM_PREFETCH(addr) __builtin_prefetch(addr)
+#elif defined(MVM_IS_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define MVM_PREFETCH(addr) \
+    _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#else
+#define MVM_PREFETCH(addr) ((void)(addr))
+#endif
+
+// Whether the target has BMI2's bit deposit and extract instructions, used
+// for Morton codes.  Only set when the compiler already targets them (e.g.
+// -mbmi2 or -march=haswell, or /arch:AVX2 on MSVC), as they are microcoded
+// and slow on AMD before Zen 3.  Define MVM_USE_BMI2 to 0 to opt out.
+#if !defined(MVM_USE_BMI2)
+#if defined(__BMI2__) || (defined(MVM_IS_MSVC) && defined(__AVX2__))
+#define MVM_USE_BMI2 1
+#else
+#define MVM_USE_BMI2 0
+#endif
+#endif
+
+// Precondition checks for fast paths that trust the caller, such as
+// mat4x4::inverse_affine.  They can be costly, so they are tied to assert
+// and on by default only in debug builds.  Define MVM_VALIDATE_PRECONDITIONS
+// to 0 to turn them off in a debug build.
+#if !defined(MVM_VALIDATE_PRECONDITIONS)
+#if defined(NDEBUG)
+#define MVM_VALIDATE_PRECONDITIONS 0
+#else
+#define MVM_VALIDATE_PRECONDITIONS 1
+#endif
+#endif
+
+#if MVM_VALIDATE_PRECONDITIONS
+#include <cassert>
+#define MVM_ASSERT_PRECONDITION(condition) assert(condition)
+#else
+#define MVM_ASSERT_PRECONDITION(condition) ((void)0)
+#endif
@@ -267,6 +267,29 @@ namespace move::math
 
         // Statics
     public:
+        /**
+         * @brief Returns `a * s + b` computed row by row with fused
+         * multiply-adds.
+         *
+         * @param a The matrix to scale
+         * @param s The scale factor
+         * @param b The matrix to add
+         * @return mat3x3 The result
+         */
+        MVM_INLINE_NODISCARD static mat3x3 mul_add(const mat3x3& a,
+                                                   const T& s,
+                                                   const mat3x3& b)
+        {
+            using namespace rtm;
+            return mat3x3(rtm::matrix_set(
+                vector_mul_add(matrix_get_axis(a._value, axis3::x), s,
+                               matrix_get_axis(b._value, axis3::x)),
+                vector_mul_add(matrix_get_axis(a._value, axis3::y), s,
+                               matrix_get_axis(b._value, axis3::y)),
+                vector_mul_add(matrix_get_axis(a._value, axis3::z), s,
+                               matrix_get_axis(b._value, axis3::z))));
+        }
+
         MVM_INLINE_NODISCARD static mat3x3 identity()
         {
             return mat3x3(rtm::matrix_identity());
@@ -393,16 +416,22 @@ namespace move::math
         };
 
     public:
-        inline storage_mat3x3() :
-            _11(1),
-            _12(0),
-            _13(0),
-            _21(0),
-            _22(1),
-            _23(0),
-            _31(0),
-            _32(0),
-            _33(1)
+        // Constructors only ever activate `data`, which keeps the type usable
+        // in constant expressions.
+        constexpr storage_mat3x3() : data{1, 0, 0, 0, 1, 0, 0, 0, 1}
+        {
+        }
+
+        constexpr storage_mat3x3(const T& m11,
+                                 const T& m12,
+                                 const T& m13,
+                                 const T& m21,
+                                 const T& m22,
+                                 const T& m23,
+                                 const T& m31,
+                                 const T& m32,
+                                 const T& m33) :
+            data{m11, m12, m13, m21, m22, m23, m31, m32, m33}
         {
         }
 
@@ -411,7 +440,7 @@ namespace move::math
             mat.store_array(data);
         }
 
-        inline storage_mat3x3(const storage_mat3x3& rhs)
+        constexpr storage_mat3x3(const storage_mat3x3& rhs) : data{}
         {
             for (uint8_t i = 0; i < 9; i++)
             {
@@ -419,7 +448,7 @@ namespace move::math
             }
         }
 
-        inline storage_mat3x3& operator=(const storage_mat3x3& rhs)
+        constexpr storage_mat3x3& operator=(const storage_mat3x3& rhs)
         {
             for (uint8_t i = 0; i < 9; i++)
             {
@@ -434,6 +463,29 @@ namespace move::math
             return *this;
         }
 
+    public:
+        constexpr bool operator==(const storage_mat3x3& rhs) const
+        {
+            for (uint8_t i = 0; i < 9; i++)
+            {
+                if (data[i] != rhs.data[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        constexpr bool operator!=(const storage_mat3x3& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        constexpr static storage_mat3x3 identity()
+        {
+            return storage_mat3x3();
+        }
+
     public:
         template <typename Archive>
         inline void serialize(Archive& archive)
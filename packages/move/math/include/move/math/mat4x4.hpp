@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <type_traits>
 
 #include <rtm/impl/matrix_affine_common.h>
@@ -27,6 +28,21 @@ namespace move::math
         using m4x4 = std::conditional_t<std::is_same_v<T, float>, m4x4f, m4x4d>;
     }  // namespace simd_rtm::detail
 
+    /**
+     * @brief The outcome of taking a matrix apart with `mat4x4::decompose`.
+     */
+    enum class DecomposeStatus
+    {
+        // The matrix is an exact translation, rotation and scale
+        Success,
+        // The basis is skewed.  The rotation and scale are the closest fit,
+        // and rebuilding with `trs` will not reproduce the matrix.
+        Sheared,
+        // An axis has collapsed to zero length.  The rotation is undefined
+        // and set to identity.
+        Singular
+    };
+
     // mat4 always uses RTM under the hood
     template <typename T, typename wrapper_type = simd_rtm::detail::m4x4<T>>
         requires std::is_floating_point_v<T>
@@ -150,16 +166,32 @@ namespace move::math
         MVM_INLINE_NODISCARD fast_vec3_t
         transform_point(const fast_vec3_t& rhs) const
         {
-            rtm_vec4_t mul = rtm::vector_set_w(rhs.to_rtm(), component_type(1));
-            rtm_vec4_t res = rtm::matrix_mul_vector(mul, _value);
+            // x * X + y * Y + z * Z + W, folded into a chain of fused
+            // multiply-adds.  The implicit w = 1 avoids a multiply entirely.
+            using namespace rtm;
+            const rtm_vec4_t v = rhs.to_rtm();
+            rtm_vec4_t res = matrix_get_axis(_value, axis4::w);
+            res = vector_mul_add(vector_dup_x(v),
+                                 matrix_get_axis(_value, axis4::x), res);
+            res = vector_mul_add(vector_dup_y(v),
+                                 matrix_get_axis(_value, axis4::y), res);
+            res = vector_mul_add(vector_dup_z(v),
+                                 matrix_get_axis(_value, axis4::z), res);
             return fast_vec3_t::from_rtm(res);
         }
 
         MVM_INLINE_NODISCARD fast_vec3_t
         transform_vector(const fast_vec3_t& rhs) const
         {
-            rtm_vec4_t mul = rtm::vector_set_w(rhs.to_rtm(), component_type(0));
-            rtm_vec4_t res = rtm::matrix_mul_vector(mul, _value);
+            // Same as transform_point, but the w axis never contributes
+            using namespace rtm;
+            const rtm_vec4_t v = rhs.to_rtm();
+            rtm_vec4_t res =
+                vector_mul(vector_dup_x(v), matrix_get_axis(_value, axis4::x));
+            res = vector_mul_add(vector_dup_y(v),
+                                 matrix_get_axis(_value, axis4::y), res);
+            res = vector_mul_add(vector_dup_z(v),
+                                 matrix_get_axis(_value, axis4::z), res);
             return fast_vec3_t::from_rtm(res);
         }
 
@@ -264,6 +296,287 @@ namespace move::math
             return res;
         }
 
+        /**
+         * @brief Splits an affine matrix into the translation, rotation and
+         * scale that `trs` would build it from.
+         *
+         * The fast path measures each row and checks that the rows are
+         * perpendicular.  A mirrored basis is reported as a negative x
+         * scale, since the sign cannot be attributed to a particular axis.
+         * A sheared basis falls back to decompose_qr, which reports it.
+         *
+         * @param translation Receives the translation
+         * @param rotation Receives the rotation
+         * @param scale Receives the per-axis scale
+         * @param tolerance Axes shorter than this are treated as collapsed
+         * @param shear_tolerance The largest cosine between two rows that
+         * still counts as perpendicular
+         * @return DecomposeStatus Success, Sheared or Singular
+         */
+        MVM_INLINE DecomposeStatus decompose(
+            fast_vec3_t& translation,
+            quat_t& rotation,
+            fast_vec3_t& scale,
+            const T& tolerance = T(1e-6),
+            const T& shear_tolerance = T(1e-4)) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t x = matrix_get_axis(_value, axis4::x);
+            const rtm_vec4_t y = matrix_get_axis(_value, axis4::y);
+            const rtm_vec4_t z = matrix_get_axis(_value, axis4::z);
+            translation =
+                fast_vec3_t::from_rtm(matrix_get_axis(_value, axis4::w));
+
+            T sx = T(vector_length3(x));
+            const T sy = T(vector_length3(y));
+            const T sz = T(vector_length3(z));
+            if (sx <= tolerance || sy <= tolerance || sz <= tolerance)
+            {
+                rotation = quat_t::identity();
+                scale = fast_vec3_t(sx, sy, sz);
+                return DecomposeStatus::Singular;
+            }
+
+            // Skewed rows would hand quat_from_matrix a basis that is not a
+            // rotation, so leave those to the QR variant
+            const rtm_vec4_t nx = vector_mul(x, T(1) / sx);
+            const rtm_vec4_t ny = vector_mul(y, T(1) / sy);
+            const rtm_vec4_t nz = vector_mul(z, T(1) / sz);
+            if (math::abs(T(vector_dot3(nx, ny))) > shear_tolerance ||
+                math::abs(T(vector_dot3(nx, nz))) > shear_tolerance ||
+                math::abs(T(vector_dot3(ny, nz))) > shear_tolerance)
+            {
+                return decompose_qr(translation, rotation, scale,
+                                    shear_tolerance);
+            }
+
+            if (T(vector_dot3(vector_cross3(x, y), z)) < T(0))
+            {
+                sx = -sx;
+            }
+
+            rotation = quat_t::from_rtm(quat_from_matrix(
+                matrix_set(vector_mul(nx, math::sign(sx)), ny, nz)));
+            scale = fast_vec3_t(sx, sy, sz);
+            return DecomposeStatus::Success;
+        }
+
+        /**
+         * @brief Splits an affine matrix into translation, rotation and
+         * scale using a QR (Gram-Schmidt) factorization of the basis, which
+         * also detects shear.
+         *
+         * The rows are orthogonalized in x, y, z order, so the rotation
+         * keeps the x axis exactly and the shear is absorbed by y and z.  A
+         * mirrored basis is reported as a negative x scale.
+         *
+         * @param translation Receives the translation
+         * @param rotation Receives the rotation
+         * @param scale Receives the per-axis scale
+         * @param tolerance Axes shorter than this are treated as collapsed,
+         * and shear larger than this relative to the axis is reported
+         * @return DecomposeStatus Success, Sheared or Singular
+         */
+        MVM_INLINE DecomposeStatus decompose_qr(fast_vec3_t& translation,
+                                                quat_t& rotation,
+                                                fast_vec3_t& scale,
+                                                const T& tolerance = T(1e-4))
+            const
+        {
+            using namespace rtm;
+            const rtm_vec4_t x = matrix_get_axis(_value, axis4::x);
+            const rtm_vec4_t y = matrix_get_axis(_value, axis4::y);
+            const rtm_vec4_t z = matrix_get_axis(_value, axis4::z);
+            translation =
+                fast_vec3_t::from_rtm(matrix_get_axis(_value, axis4::w));
+            rotation = quat_t::identity();
+
+            T sx = T(vector_length3(x));
+            if (sx <= tolerance)
+            {
+                scale = fast_vec3_t(sx, T(vector_length3(y)),
+                                    T(vector_length3(z)));
+                return DecomposeStatus::Singular;
+            }
+            rtm_vec4_t nx = vector_mul(x, T(1) / sx);
+
+            // Remove the part of y along x
+            const T shear_xy = T(vector_dot3(nx, y));
+            const rtm_vec4_t oy = vector_neg_mul_sub(nx, shear_xy, y);
+            const T sy = T(vector_length3(oy));
+            if (sy <= tolerance)
+            {
+                scale = fast_vec3_t(sx, sy, T(vector_length3(z)));
+                return DecomposeStatus::Singular;
+            }
+            const rtm_vec4_t ny = vector_mul(oy, T(1) / sy);
+
+            // Remove the parts of z along x and y
+            const T shear_xz = T(vector_dot3(nx, z));
+            const T shear_yz = T(vector_dot3(ny, z));
+            rtm_vec4_t oz = vector_neg_mul_sub(nx, shear_xz, z);
+            oz = vector_neg_mul_sub(ny, shear_yz, oz);
+            const T sz = T(vector_length3(oz));
+            if (sz <= tolerance)
+            {
+                scale = fast_vec3_t(sx, sy, sz);
+                return DecomposeStatus::Singular;
+            }
+            const rtm_vec4_t nz = vector_mul(oz, T(1) / sz);
+
+            if (T(vector_dot3(vector_cross3(nx, ny), nz)) < T(0))
+            {
+                sx = -sx;
+                nx = vector_neg(nx);
+            }
+
+            rotation =
+                quat_t::from_rtm(quat_from_matrix(matrix_set(nx, ny, nz)));
+            scale = fast_vec3_t(sx, sy, sz);
+
+            const bool sheared = math::abs(shear_xy) > tolerance * sy ||
+                                 math::abs(shear_xz) > tolerance * sz ||
+                                 math::abs(shear_yz) > tolerance * sz;
+            return sheared ? DecomposeStatus::Sheared
+                           : DecomposeStatus::Success;
+        }
+
+        /**
+         * @brief Checks that the last column is (0, 0, 0, 1), so the matrix
+         * is a linear transform followed by a translation.
+         *
+         * @param tolerance The largest allowed deviation per element
+         * @return bool True if the matrix is affine
+         */
+        MVM_INLINE_NODISCARD bool is_affine(const T& tolerance = T(1e-6)) const
+        {
+            using namespace rtm;
+            return math::abs(T(vector_get_w(_value.x_axis))) <= tolerance &&
+                   math::abs(T(vector_get_w(_value.y_axis))) <= tolerance &&
+                   math::abs(T(vector_get_w(_value.z_axis))) <= tolerance &&
+                   math::abs(T(vector_get_w(_value.w_axis)) - T(1)) <=
+                       tolerance;
+        }
+
+        /**
+         * @brief Checks that the matrix is affine and its upper 3x3 rows
+         * are unit length and mutually perpendicular, i.e. it is only a
+         * rotation (possibly mirrored) and a translation.
+         *
+         * @param tolerance The largest allowed error in each dot product
+         * @return bool True if the matrix is orthonormal
+         */
+        MVM_INLINE_NODISCARD bool is_orthonormal(
+            const T& tolerance = T(1e-4)) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t x = matrix_get_axis(_value, axis4::x);
+            const rtm_vec4_t y = matrix_get_axis(_value, axis4::y);
+            const rtm_vec4_t z = matrix_get_axis(_value, axis4::z);
+            return is_affine(tolerance) &&
+                   math::abs(T(vector_dot3(x, x)) - T(1)) <= tolerance &&
+                   math::abs(T(vector_dot3(y, y)) - T(1)) <= tolerance &&
+                   math::abs(T(vector_dot3(z, z)) - T(1)) <= tolerance &&
+                   math::abs(T(vector_dot3(x, y))) <= tolerance &&
+                   math::abs(T(vector_dot3(x, z))) <= tolerance &&
+                   math::abs(T(vector_dot3(y, z))) <= tolerance;
+        }
+
+        /**
+         * @brief Inverts an affine matrix by inverting its upper 3x3 and
+         * transforming the negated translation, which is much cheaper than
+         * the general 4x4 inverse.
+         *
+         * The last column must be (0, 0, 0, 1).  This is checked with an
+         * assertion when MVM_VALIDATE_PRECONDITIONS is enabled.
+         *
+         * @return mat4x4 The inverse matrix
+         */
+        MVM_INLINE_NODISCARD mat4x4 inverse_affine() const
+        {
+            MVM_ASSERT_PRECONDITION(is_affine());
+            using namespace rtm;
+            const rtm_vec4_t x = matrix_get_axis(_value, axis4::x);
+            const rtm_vec4_t y = matrix_get_axis(_value, axis4::y);
+            const rtm_vec4_t z = matrix_get_axis(_value, axis4::z);
+
+            // The cofactor rows.  The inverse is their transpose over the
+            // determinant.
+            const rtm_vec4_t cx = vector_cross3(y, z);
+            const rtm_vec4_t cy = vector_cross3(z, x);
+            const rtm_vec4_t cz = vector_cross3(x, y);
+            const T inv_det = T(1) / T(vector_dot3(x, cx));
+
+            return from_inverse_basis(vector_mul(cx, inv_det),
+                                      vector_mul(cy, inv_det),
+                                      vector_mul(cz, inv_det));
+        }
+
+        /**
+         * @brief Inverts a rotation and translation matrix by transposing
+         * the rotation.  Cheaper still than inverse_affine, but wrong if the
+         * matrix contains any scale or shear.
+         *
+         * The matrix must be affine with orthonormal rows.  This is checked
+         * with an assertion when MVM_VALIDATE_PRECONDITIONS is enabled.
+         *
+         * @return mat4x4 The inverse matrix
+         */
+        MVM_INLINE_NODISCARD mat4x4 inverse_orthonormal() const
+        {
+            MVM_ASSERT_PRECONDITION(is_orthonormal());
+            using namespace rtm;
+            return from_inverse_basis(matrix_get_axis(_value, axis4::x),
+                                      matrix_get_axis(_value, axis4::y),
+                                      matrix_get_axis(_value, axis4::z));
+        }
+
+        /**
+         * @brief Computes the inverse transpose of the upper 3x3, with a zero
+         * translation.  This is the matrix that keeps normals perpendicular
+         * to surfaces under non-uniform scale; use it with transform_vector
+         * and renormalize the result.
+         *
+         * @return mat4x4 The normal matrix
+         */
+        MVM_INLINE_NODISCARD mat4x4 inverse_transpose_3x3() const
+        {
+            using namespace rtm;
+            const rtm_vec4_t x = matrix_get_axis(_value, axis4::x);
+            const rtm_vec4_t y = matrix_get_axis(_value, axis4::y);
+            const rtm_vec4_t z = matrix_get_axis(_value, axis4::z);
+            const rtm_vec4_t cx = vector_cross3(y, z);
+            const rtm_vec4_t cy = vector_cross3(z, x);
+            const rtm_vec4_t cz = vector_cross3(x, y);
+            const T inv_det = T(1) / T(vector_dot3(x, cx));
+
+            return rtm_t{vector_set_w(vector_mul(cx, inv_det), T(0)),
+                         vector_set_w(vector_mul(cy, inv_det), T(0)),
+                         vector_set_w(vector_mul(cz, inv_det), T(0)),
+                         vector_set(T(0), T(0), T(0), T(1))};
+        }
+
+    private:
+        // Builds the inverse of this matrix from the transpose of the inverse
+        // basis, given as rows.  The new translation is the old one pushed
+        // back through the inverse basis and negated.
+        MVM_INLINE_NODISCARD mat4x4 from_inverse_basis(
+            const rtm_vec4_t& tx,
+            const rtm_vec4_t& ty,
+            const rtm_vec4_t& tz) const
+        {
+            using namespace rtm;
+            const rtm_t basis = matrix_transpose(
+                rtm_t{tx, ty, tz, vector_set(T(0), T(0), T(0), T(1))});
+            const rtm_vec4_t t = matrix_get_axis(_value, axis4::w);
+
+            rtm_vec4_t w = vector_mul(basis.x_axis, vector_dup_x(t));
+            w = vector_mul_add(basis.y_axis, vector_dup_y(t), w);
+            w = vector_mul_add(basis.z_axis, vector_dup_z(t), w);
+            return rtm_t{basis.x_axis, basis.y_axis, basis.z_axis,
+                         vector_set_w(vector_neg(w), T(1))};
+        }
+
         // Mutators
     public:
         MVM_INLINE mat4x4& fill(const T& val)
@@ -284,8 +597,231 @@ namespace move::math
             return *this;
         }
 
+        // Bulk operations
+    public:
+        /**
+         * @brief Computes `out[i] = a[i] * b[i]` for `count` matrices, e.g.
+         * bind-inverse times world transform when building a skinning
+         * palette.
+         *
+         * The loop is unrolled four-wide.  Every input is read in order,
+         * which the hardware prefetcher already follows, so no software
+         * prefetch is issued.  `out` may be the same array as `a` or `b`,
+         * but must not partially overlap either.
+         *
+         * @param a The left-hand matrices
+         * @param b The right-hand matrices
+         * @param out The destination matrices
+         * @param count The number of matrices
+         */
+        static void multiply_arrays(const mat4x4* a,
+                                    const mat4x4* b,
+                                    mat4x4* out,
+                                    size_t count)
+        {
+            multiply_range(a, 1, b, 1, out, 0, count);
+        }
+
+        /**
+         * @brief Computes `out[i] = a * b[i]` for `count` matrices.
+         *
+         * @param a The left-hand matrix shared by every product
+         * @param b The right-hand matrices
+         * @param out The destination matrices
+         * @param count The number of matrices
+         */
+        static void multiply_arrays(const mat4x4& a,
+                                    const mat4x4* b,
+                                    mat4x4* out,
+                                    size_t count)
+        {
+            multiply_range(&a, 0, b, 1, out, 0, count);
+        }
+
+        /**
+         * @brief Computes `out[i] = a[i] * b` for `count` matrices.
+         *
+         * @param a The left-hand matrices
+         * @param b The right-hand matrix shared by every product
+         * @param out The destination matrices
+         * @param count The number of matrices
+         */
+        static void multiply_arrays(const mat4x4* a,
+                                    const mat4x4& b,
+                                    mat4x4* out,
+                                    size_t count)
+        {
+            multiply_range(a, 1, &b, 0, out, 0, count);
+        }
+
+        /**
+         * @brief Chunked variant of multiply_arrays for use with a job system.
+         *
+         * `parallel_for(chunk_count, job)` must invoke `job(chunk_index)`
+         * exactly once for each index in `[0, chunk_count)`, from any thread,
+         * and return once all of them have completed.  Each chunk covers
+         * `chunk_size` matrices.  Chunks only avoid writing to the same
+         * cache line when `out` is aligned to a cache line and
+         * `chunk_size * sizeof(mat4x4)` is a multiple of the line size.
+         *
+         * @param a The left-hand matrices
+         * @param b The right-hand matrices
+         * @param out The destination matrices
+         * @param count The number of matrices
+         * @param parallel_for The dispatcher that runs the chunks
+         * @param chunk_size The number of matrices per chunk
+         */
+        template <typename ParallelFor>
+        static void multiply_arrays(const mat4x4* a,
+                                    const mat4x4* b,
+                                    mat4x4* out,
+                                    size_t count,
+                                    ParallelFor&& parallel_for,
+                                    size_t chunk_size = 1024)
+        {
+            multiply_chunked(a, 1, b, 1, out, count, parallel_for, chunk_size);
+        }
+
+        /**
+         * @brief Chunked variant of the `a * b[i]` broadcast.  See the array
+         * overload for the requirements on `parallel_for`.
+         */
+        template <typename ParallelFor>
+        static void multiply_arrays(const mat4x4& a,
+                                    const mat4x4* b,
+                                    mat4x4* out,
+                                    size_t count,
+                                    ParallelFor&& parallel_for,
+                                    size_t chunk_size = 1024)
+        {
+            multiply_chunked(&a, 0, b, 1, out, count, parallel_for,
+                             chunk_size);
+        }
+
+        /**
+         * @brief Chunked variant of the `a[i] * b` broadcast.  See the array
+         * overload for the requirements on `parallel_for`.
+         */
+        template <typename ParallelFor>
+        static void multiply_arrays(const mat4x4* a,
+                                    const mat4x4& b,
+                                    mat4x4* out,
+                                    size_t count,
+                                    ParallelFor&& parallel_for,
+                                    size_t chunk_size = 1024)
+        {
+            multiply_chunked(a, 1, &b, 0, out, count, parallel_for,
+                             chunk_size);
+        }
+
+    private:
+        // A stride of zero broadcasts a single matrix across the range
+        static void multiply_range(const mat4x4* a,
+                                   size_t a_stride,
+                                   const mat4x4* b,
+                                   size_t b_stride,
+                                   mat4x4* out,
+                                   size_t begin,
+                                   size_t end)
+        {
+            // Step by pointer and count the blocks up front; an index times
+            // a stride that may be zero defeats GCC's loop bounds analysis
+            const mat4x4* next_a = a + begin * a_stride;
+            const mat4x4* next_b = b + begin * b_stride;
+            mat4x4* next_out = out + begin;
+            const size_t count = end - begin;
+
+            for (size_t block = 0; block < count / 4; ++block)
+            {
+                // Compute all four before storing so `out` may alias an input
+                const rtm_t r0 = rtm::matrix_mul(next_a[0]._value,
+                                                 next_b[0]._value);
+                const rtm_t r1 = rtm::matrix_mul(next_a[a_stride]._value,
+                                                 next_b[b_stride]._value);
+                const rtm_t r2 = rtm::matrix_mul(next_a[2 * a_stride]._value,
+                                                 next_b[2 * b_stride]._value);
+                const rtm_t r3 = rtm::matrix_mul(next_a[3 * a_stride]._value,
+                                                 next_b[3 * b_stride]._value);
+                next_out[0]._value = r0;
+                next_out[1]._value = r1;
+                next_out[2]._value = r2;
+                next_out[3]._value = r3;
+                next_a += 4 * a_stride;
+                next_b += 4 * b_stride;
+                next_out += 4;
+            }
+
+            for (size_t tail = 0; tail < count % 4; ++tail)
+            {
+                next_out[tail]._value =
+                    rtm::matrix_mul(next_a->_value, next_b->_value);
+                next_a += a_stride;
+                next_b += b_stride;
+            }
+        }
+
+        template <typename ParallelFor>
+        static void multiply_chunked(const mat4x4* a,
+                                     size_t a_stride,
+                                     const mat4x4* b,
+                                     size_t b_stride,
+                                     mat4x4* out,
+                                     size_t count,
+                                     ParallelFor& parallel_for,
+                                     size_t chunk_size)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            chunk_size = chunk_size == 0 ? count : chunk_size;
+            const size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+            if (chunk_count == 1)
+            {
+                multiply_range(a, a_stride, b, b_stride, out, 0, count);
+                return;
+            }
+
+            parallel_for(chunk_count,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             multiply_range(a, a_stride, b, b_stride, out,
+                                            begin, end);
+                         });
+        }
+
         // Statics
     public:
+        /**
+         * @brief Returns `a * s + b` computed row by row with fused
+         * multiply-adds.  Useful for accumulating weighted matrices, such as
+         * a skinning palette.
+         *
+         * @param a The matrix to scale
+         * @param s The scale factor
+         * @param b The matrix to add
+         * @return mat4x4 The result
+         */
+        MVM_INLINE_NODISCARD static mat4x4 mul_add(const mat4x4& a,
+                                                   const T& s,
+                                                   const mat4x4& b)
+        {
+            using namespace rtm;
+            return mat4x4(rtm::matrix_set(
+                vector_mul_add(matrix_get_axis(a._value, axis4::x), s,
+                               matrix_get_axis(b._value, axis4::x)),
+                vector_mul_add(matrix_get_axis(a._value, axis4::y), s,
+                               matrix_get_axis(b._value, axis4::y)),
+                vector_mul_add(matrix_get_axis(a._value, axis4::z), s,
+                               matrix_get_axis(b._value, axis4::z)),
+                vector_mul_add(matrix_get_axis(a._value, axis4::w), s,
+                               matrix_get_axis(b._value, axis4::w))));
+        }
+
         MVM_INLINE_NODISCARD static mat4x4 identity()
         {
             return mat4x4(rtm::matrix_identity());
@@ -506,7 +1042,31 @@ namespace move::math
         using mat4x4_t = mat4x4<T>;
 
     public:
-        inline storage_mat4x4() : storage_mat4x4(mat4x4_t::identity())
+        // Constructors only ever activate `data`, which keeps the type usable
+        // in constant expressions.
+        constexpr storage_mat4x4() :
+            data{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}
+        {
+        }
+
+        constexpr storage_mat4x4(const T& m11,
+                                 const T& m12,
+                                 const T& m13,
+                                 const T& m14,
+                                 const T& m21,
+                                 const T& m22,
+                                 const T& m23,
+                                 const T& m24,
+                                 const T& m31,
+                                 const T& m32,
+                                 const T& m33,
+                                 const T& m34,
+                                 const T& m41,
+                                 const T& m42,
+                                 const T& m43,
+                                 const T& m44) :
+            data{m11, m12, m13, m14, m21, m22, m23, m24,
+                 m31, m32, m33, m34, m41, m42, m43, m44}
         {
         }
 
@@ -515,9 +1075,7 @@ namespace move::math
             mat.store_array(data);
         }
 
-        // inline storage_mat4x4
-
-        inline storage_mat4x4(const storage_mat4x4& rhs)
+        constexpr storage_mat4x4(const storage_mat4x4& rhs) : data{}
         {
             for (uint8_t i = 0; i < 16; i++)
             {
@@ -526,7 +1084,7 @@ namespace move::math
         }
 
     public:
-        inline storage_mat4x4& operator=(const storage_mat4x4& rhs)
+        constexpr storage_mat4x4& operator=(const storage_mat4x4& rhs)
         {
             for (uint8_t i = 0; i < 16; i++)
             {
@@ -541,6 +1099,44 @@ namespace move::math
             return *this;
         }
 
+        constexpr bool operator==(const storage_mat4x4& rhs) const
+        {
+            for (uint8_t i = 0; i < 16; i++)
+            {
+                if (data[i] != rhs.data[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        constexpr bool operator!=(const storage_mat4x4& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        constexpr static storage_mat4x4 identity()
+        {
+            return storage_mat4x4();
+        }
+
+        constexpr static storage_mat4x4 translation(const T& x,
+                                                    const T& y,
+                                                    const T& z)
+        {
+            return storage_mat4x4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, x, y, z,
+                                  1);
+        }
+
+        constexpr static storage_mat4x4 scale(const T& x,
+                                              const T& y,
+                                              const T& z)
+        {
+            return storage_mat4x4(x, 0, 0, 0, 0, y, 0, 0, 0, 0, z, 0, 0, 0, 0,
+                                  1);
+        }
+
     public:
         template <typename Archive>
         inline void serialize(Archive& archive)
@@ -0,0 +1,654 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <rtm/matrix3x3d.h>
+#include <rtm/matrix3x3f.h>
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/aabb.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/mat3x3.hpp>
+#include <move/math/mat4x4.hpp>
+#include <move/math/plane.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    namespace detail
+    {
+        /**
+         * @brief Diagonalizes a symmetric 3x3 matrix with cyclic Jacobi
+         * rotations.
+         *
+         * @param a The matrix.  Left holding the eigenvalues on its
+         * diagonal.
+         * @param v Receives the eigenvectors as columns, column k belonging
+         * to the eigenvalue left in `a[k][k]`
+         */
+        template <typename T>
+        MVM_INLINE void jacobi_eigenvectors(T (&a)[3][3], T (&v)[3][3])
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    v[i][j] = T(i == j);
+                }
+            }
+
+            constexpr int pairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+            for (int sweep = 0; sweep < 16; ++sweep)
+            {
+                const T off =
+                    a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+                const T diagonal =
+                    a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+                if (off <= std::numeric_limits<T>::epsilon() *
+                               std::numeric_limits<T>::epsilon() * diagonal)
+                {
+                    break;
+                }
+
+                for (const auto& pair : pairs)
+                {
+                    const int p = pair[0];
+                    const int q = pair[1];
+                    if (a[p][q] == T(0))
+                    {
+                        continue;
+                    }
+                    // The rotation that zeroes a[p][q], taking the smaller
+                    // angle for stability
+                    const T theta = (a[q][q] - a[p][p]) / (T(2) * a[p][q]);
+                    const T t = (theta < T(0) ? T(-1) : T(1)) /
+                                (math::abs(theta) +
+                                 math::sqrt(theta * theta + T(1)));
+                    const T c = T(1) / math::sqrt(t * t + T(1));
+                    const T s = t * c;
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        const T akp = a[k][p];
+                        const T akq = a[k][q];
+                        a[k][p] = c * akp - s * akq;
+                        a[k][q] = s * akp + c * akq;
+                    }
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        const T apk = a[p][k];
+                        const T aqk = a[q][k];
+                        a[p][k] = c * apk - s * aqk;
+                        a[q][k] = s * apk + c * aqk;
+                    }
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        const T vkp = v[k][p];
+                        const T vkq = v[k][q];
+                        v[k][p] = c * vkp - s * vkq;
+                        v[k][q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+    }  // namespace detail
+
+    /**
+     * @brief An oriented bounding box stored as its center, its orientation
+     * and its half extents.
+     *
+     * The rows of the orientation matrix are the box's unit local X, Y and
+     * Z axes in world space, so `local * axes` turns a local offset into a
+     * world one, matching `vec3 * mat3x3`.  The rows must be orthonormal;
+     * every constructor and factory here keeps them so.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct obb
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using mat3x3_t = mat3x3<T>;
+        using mat4x4_t = mat4x4<T>;
+        using aabb_t = aabb<T>;
+        using plane_t = plane<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using rtm_mat3x3_t = typename mat3x3_t::rtm_mat3x3_t;
+        using component_type = T;
+
+    private:
+        rtm_vec4_t _center;
+        rtm_vec4_t _extents;
+        mat3x3_t _axes;
+
+        // Constructors
+    public:
+        // A box of zero size at the origin, aligned with the world axes
+        MVM_INLINE obb() :
+            _center(rtm::vector_zero()), _extents(rtm::vector_zero()), _axes()
+        {
+        }
+
+        /**
+         * @brief Creates a box from its center, orientation and half
+         * extents.
+         *
+         * @param center The center of the box
+         * @param axes The box's local axes as rows.  Must be orthonormal.
+         * @param extents Half the size of the box along each local axis
+         */
+        MVM_INLINE obb(const vec3_t& center,
+                       const mat3x3_t& axes,
+                       const vec3_t& extents) :
+            _center(center.to_rtm()), _extents(extents.to_rtm()), _axes(axes)
+        {
+        }
+
+        MVM_INLINE obb(const obb& other) :
+            _center(other._center), _extents(other._extents),
+            _axes(other._axes)
+        {
+        }
+
+        MVM_INLINE obb& operator=(const obb& other)
+        {
+            _center = other._center;
+            _extents = other._extents;
+            _axes = other._axes;
+            return *this;
+        }
+
+        // The box covering an axis-aligned box.  Zero size if it is empty.
+        MVM_INLINE_NODISCARD static obb from_aabb(const aabb_t& box)
+        {
+            if (box.is_empty())
+            {
+                return obb();
+            }
+            return obb(box.center(), mat3x3_t::identity(), box.extents());
+        }
+
+        /**
+         * @brief Fits a box around a set of points.
+         *
+         * The box is aligned with the principal axes of the points'
+         * covariance, found with Jacobi rotations.  PCA is thrown off by
+         * uneven sampling, e.g. a dense cluster in one corner of a mesh,
+         * so the axis-aligned box is kept instead whenever it is smaller.
+         *
+         * @param points The points to enclose
+         * @param count The number of points.  The box is zero size at the
+         * origin if this is zero.
+         */
+        MVM_INLINE_NODISCARD static obb from_points(
+            const vec3<T, Acceleration::Scalar>* points,
+            size_t count)
+        {
+            using namespace rtm;
+            if (count == 0)
+            {
+                return obb();
+            }
+
+            // The mean and the axis-aligned bounds
+            rtm_vec4_t sum = vector_zero();
+            rtm_vec4_t min = vector_set(std::numeric_limits<T>::infinity());
+            rtm_vec4_t max = vector_set(-std::numeric_limits<T>::infinity());
+            for (size_t i = 0; i < count; ++i)
+            {
+                const rtm_vec4_t p = vector_load3(points[i].to_array());
+                sum = vector_add(sum, p);
+                min = vector_min(min, p);
+                max = vector_max(max, p);
+            }
+            const obb aligned = from_aabb(aabb_t::from_rtm(min, max));
+            const rtm_vec4_t mean = vector_mul(sum, T(1) / T(count));
+
+            // The covariance about the mean
+            const T mx = vector_get_x(mean);
+            const T my = vector_get_y(mean);
+            const T mz = vector_get_z(mean);
+            T xx = T(0);
+            T yy = T(0);
+            T zz = T(0);
+            T xy = T(0);
+            T xz = T(0);
+            T yz = T(0);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const T* p = points[i].to_array();
+                const T x = p[0] - mx;
+                const T y = p[1] - my;
+                const T z = p[2] - mz;
+                xx += x * x;
+                yy += y * y;
+                zz += z * z;
+                xy += x * y;
+                xz += x * z;
+                yz += y * z;
+            }
+            T covariance[3][3] = {{xx, xy, xz}, {xy, yy, yz}, {xz, yz, zz}};
+            T vectors[3][3];
+            detail::jacobi_eigenvectors(covariance, vectors);
+
+            // Re-orthonormalize so rounding cannot skew the axes
+            const rtm_vec4_t e0 =
+                vector_set(vectors[0][0], vectors[1][0], vectors[2][0], T(0));
+            const rtm_vec4_t e1 =
+                vector_set(vectors[0][1], vectors[1][1], vectors[2][1], T(0));
+            const rtm_vec4_t u0 =
+                vector_mul(e0, T(1) / T(vector_length3(e0)));
+            const rtm_vec4_t v1 =
+                vector_neg_mul_sub(u0, T(vector_dot3(e1, u0)), e1);
+            const rtm_vec4_t u1 =
+                vector_mul(v1, T(1) / T(vector_length3(v1)));
+            const rtm_mat3x3_t axes =
+                matrix_set(u0, u1, vector_cross3(u0, u1));
+
+            // The bounds of the points along those axes
+            const rtm_mat3x3_t to_local = matrix_transpose(axes);
+            rtm_vec4_t lo = vector_set(std::numeric_limits<T>::infinity());
+            rtm_vec4_t hi = vector_set(-std::numeric_limits<T>::infinity());
+            for (size_t i = 0; i < count; ++i)
+            {
+                const rtm_vec4_t p = matrix_mul_vector3(
+                    vector_load3(points[i].to_array()), to_local);
+                lo = vector_min(lo, p);
+                hi = vector_max(hi, p);
+            }
+            obb fitted;
+            fitted._axes = mat3x3_t::from_rtm(axes);
+            fitted._center = vector_set_w(
+                matrix_mul_vector3(vector_mul(vector_add(lo, hi), T(0.5)),
+                                   axes),
+                T(0));
+            fitted._extents =
+                vector_set_w(vector_mul(vector_sub(hi, lo), T(0.5)), T(0));
+            return fitted.volume() < aligned.volume() ? fitted : aligned;
+        }
+
+        // Stream overload operators
+    public:
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(
+            std::basic_ostream<CharT, Traits>& os, const obb& box)
+        {
+#if defined(MVM_HAS_MOVE_CORE)
+            os << move::meta::type_name<obb>() << "(";
+#else
+            os << "obb(";
+#endif
+            os << box.get_center() << ", " << box.get_axes() << ", "
+               << box.get_extents() << ")";
+            return os;
+        }
+
+        // Comparison operators
+    public:
+        MVM_INLINE_NODISCARD bool operator==(const obb& other) const
+        {
+            return rtm::vector_all_near_equal3(_center, other._center) &&
+                   rtm::vector_all_near_equal3(_extents, other._extents) &&
+                   _axes == other._axes;
+        }
+
+        MVM_INLINE_NODISCARD bool operator!=(const obb& other) const
+        {
+            return !(*this == other);
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD vec3_t get_center() const
+        {
+            return vec3_t::from_rtm(_center);
+        }
+
+        MVM_INLINE_NODISCARD const mat3x3_t& get_axes() const
+        {
+            return _axes;
+        }
+
+        // One of the box's local axes, 0 to 2
+        MVM_INLINE_NODISCARD vec3_t get_axis(size_t index) const
+        {
+            return vec3_t::from_rtm(
+                rtm::matrix_get_axis(_axes.to_rtm(), rtm::axis3(index)));
+        }
+
+        // Half the size along each local axis
+        MVM_INLINE_NODISCARD vec3_t get_extents() const
+        {
+            return vec3_t::from_rtm(_extents);
+        }
+
+        MVM_INLINE_NODISCARD rtm_vec4_t center_rtm() const
+        {
+            return _center;
+        }
+
+        MVM_INLINE_NODISCARD rtm_vec4_t extents_rtm() const
+        {
+            return _extents;
+        }
+
+        // Geometric queries
+    public:
+        MVM_INLINE_NODISCARD T volume() const
+        {
+            using namespace rtm;
+            return T(8) * T(vector_get_x(_extents)) *
+                   T(vector_get_y(_extents)) * T(vector_get_z(_extents));
+        }
+
+        // A world-space point in the box's frame, relative to its center
+        MVM_INLINE_NODISCARD vec3_t local_point(const vec3_t& point) const
+        {
+            return local_direction(
+                vec3_t::from_rtm(rtm::vector_sub(point.to_rtm(), _center)));
+        }
+
+        // A world-space direction in the box's frame
+        MVM_INLINE_NODISCARD vec3_t local_direction(
+            const vec3_t& direction) const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(matrix_mul_vector3(
+                direction.to_rtm(), matrix_transpose(_axes.to_rtm())));
+        }
+
+        MVM_INLINE_NODISCARD bool contains(const vec3_t& point) const
+        {
+            using namespace rtm;
+            return vector_all_less_equal3(
+                vector_abs(local_point(point).to_rtm()), _extents);
+        }
+
+        // The point of the box closest to `point`
+        MVM_INLINE_NODISCARD vec3_t closest_point(const vec3_t& point) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t local = local_point(point).to_rtm();
+            const rtm_vec4_t clamped =
+                vector_min(vector_max(local, vector_neg(_extents)), _extents);
+            return vec3_t::from_rtm(vector_add(
+                matrix_mul_vector3(clamped, _axes.to_rtm()), _center));
+        }
+
+        MVM_INLINE_NODISCARD T distance_squared(const vec3_t& point) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t local = local_point(point).to_rtm();
+            const rtm_vec4_t outside =
+                vector_max(vector_sub(vector_abs(local), _extents),
+                           vector_zero());
+            return T(vector_dot3(outside, outside));
+        }
+
+        /**
+         * @brief The corner farthest along `direction`, the box's support
+         * mapping for gjk_distance.
+         */
+        MVM_INLINE_NODISCARD vec3_t support(const vec3_t& direction) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t signed_extents = vector_select(
+                vector_less_than(local_direction(direction).to_rtm(),
+                                 vector_zero()),
+                vector_neg(_extents), _extents);
+            return vec3_t::from_rtm(vector_add(
+                matrix_mul_vector3(signed_extents, _axes.to_rtm()), _center));
+        }
+
+        /**
+         * @brief Half the length of the box's shadow on a direction, the
+         * radius the separating axis tests compare against.
+         *
+         * @param direction The direction to project onto.  Distances come
+         * out in units of its length.
+         */
+        MVM_INLINE_NODISCARD T projected_radius(const vec3_t& direction) const
+        {
+            using namespace rtm;
+            return T(vector_dot3(
+                vector_abs(local_direction(direction).to_rtm()), _extents));
+        }
+
+        // The smallest axis-aligned box enclosing this one
+        MVM_INLINE_NODISCARD aabb_t to_aabb() const
+        {
+            using namespace rtm;
+            const rtm_mat3x3_t m = _axes.to_rtm();
+            const rtm_mat3x3_t absolute =
+                matrix_set(vector_abs(matrix_get_axis(m, axis3::x)),
+                           vector_abs(matrix_get_axis(m, axis3::y)),
+                           vector_abs(matrix_get_axis(m, axis3::z)));
+            const rtm_vec4_t half = matrix_mul_vector3(_extents, absolute);
+            return aabb_t::from_rtm(vector_sub(_center, half),
+                                    vector_add(_center, half));
+        }
+
+        // True if the plane passes through the box.  The plane must be
+        // normalized.
+        MVM_INLINE_NODISCARD bool intersects(const plane_t& p) const
+        {
+            return math::abs(p.signed_distance(get_center())) <=
+                   projected_radius(p.get_normal());
+        }
+
+        /**
+         * @brief Conservative frustum test: false only if the box lies
+         * entirely behind one of the planes.  Boxes near a frustum corner
+         * can pass without touching it, as with any plane-by-plane cull.
+         *
+         * @param planes The bounding planes, normalized and facing inward
+         * @param count The number of planes, 6 for a view frustum
+         * @return bool True if the box may be inside
+         */
+        MVM_INLINE_NODISCARD bool intersects_frustum(const plane_t* planes,
+                                                     size_t count = 6) const
+        {
+            using namespace rtm;
+            const rtm_mat3x3_t to_local = matrix_transpose(_axes.to_rtm());
+            for (size_t i = 0; i < count; ++i)
+            {
+                const rtm_vec4_t n = planes[i].to_rtm();
+                const T radius = T(vector_dot3(
+                    vector_abs(matrix_mul_vector3(n, to_local)), _extents));
+                if (planes[i].signed_distance(get_center()) < -radius)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Separating axis test against another box (Gottschalk, Lin
+         * and Manocha).  Tries the 3 face normals of each box, then the 9
+         * cross products of their edges, stopping at the first axis that
+         * separates them.  The face tests of each box run as one vector
+         * comparison.
+         *
+         * @param other The box to test
+         * @return bool True if the boxes overlap or touch
+         */
+        MVM_INLINE_NODISCARD bool intersects(const obb& other) const
+        {
+            using namespace rtm;
+            const rtm_mat3x3_t a = _axes.to_rtm();
+            const rtm_mat3x3_t b = other._axes.to_rtm();
+
+            // The other box's axes in this box's frame, r[i][j] = ai . bj.
+            // The epsilon stops near parallel edges, whose cross products
+            // are close to zero, from claiming a separation.
+            const rtm_mat3x3_t rotation =
+                matrix_mul(a, matrix_transpose(b));
+            const rtm_vec4_t slack =
+                vector_set(T(16) * std::numeric_limits<T>::epsilon());
+            const rtm_mat3x3_t absolute = matrix_set(
+                vector_add(vector_abs(matrix_get_axis(rotation, axis3::x)),
+                           slack),
+                vector_add(vector_abs(matrix_get_axis(rotation, axis3::y)),
+                           slack),
+                vector_add(vector_abs(matrix_get_axis(rotation, axis3::z)),
+                           slack));
+            const rtm_vec4_t offset = matrix_mul_vector3(
+                vector_sub(other._center, _center), matrix_transpose(a));
+
+            // This box's faces
+            if (vector_any_greater_than3(
+                    vector_abs(offset),
+                    vector_add(_extents,
+                               matrix_mul_vector3(
+                                   other._extents,
+                                   matrix_transpose(absolute)))))
+            {
+                return false;
+            }
+
+            // The other box's faces
+            if (vector_any_greater_than3(
+                    vector_abs(matrix_mul_vector3(offset, rotation)),
+                    vector_add(other._extents,
+                               matrix_mul_vector3(_extents, absolute))))
+            {
+                return false;
+            }
+
+            // The edge pairs, ai x bj
+            T r[3][4];
+            T abs_r[3][4];
+            T t[4];
+            T ea[4];
+            T eb[4];
+            vector_store(matrix_get_axis(rotation, axis3::x), r[0]);
+            vector_store(matrix_get_axis(rotation, axis3::y), r[1]);
+            vector_store(matrix_get_axis(rotation, axis3::z), r[2]);
+            vector_store(matrix_get_axis(absolute, axis3::x), abs_r[0]);
+            vector_store(matrix_get_axis(absolute, axis3::y), abs_r[1]);
+            vector_store(matrix_get_axis(absolute, axis3::z), abs_r[2]);
+            vector_store(offset, t);
+            vector_store(_extents, ea);
+            vector_store(other._extents, eb);
+            for (int i = 0; i < 3; ++i)
+            {
+                const int i1 = (i + 1) % 3;
+                const int i2 = (i + 2) % 3;
+                for (int j = 0; j < 3; ++j)
+                {
+                    const int j1 = (j + 1) % 3;
+                    const int j2 = (j + 2) % 3;
+                    const T ra = ea[i1] * abs_r[i2][j] + ea[i2] * abs_r[i1][j];
+                    const T rb = eb[j1] * abs_r[i][j2] + eb[j2] * abs_r[i][j1];
+                    if (math::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) >
+                        ra + rb)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Transforms the box by an affine matrix.  Rotation,
+         * translation and uniform scale map it exactly.  Non-uniform scale
+         * off the box's axes would skew it, so the result is then the box
+         * along the orthonormalized transformed axes that encloses the
+         * skewed one.
+         *
+         * The matrix must be affine and invertible.  Being affine is
+         * checked with an assertion when MVM_VALIDATE_PRECONDITIONS is
+         * enabled.
+         *
+         * @param mat The transform to apply
+         * @return obb The transformed box
+         */
+        MVM_INLINE_NODISCARD obb transformed(const mat4x4_t& mat) const
+        {
+            MVM_ASSERT_PRECONDITION(mat.is_affine());
+            using namespace rtm;
+            const rtm_mat3x3_t m = _axes.to_rtm();
+            const rtm_vec4_t d0 =
+                mat.transform_vector(
+                       vec3_t::from_rtm(matrix_get_axis(m, axis3::x)))
+                    .to_rtm();
+            const rtm_vec4_t d1 =
+                mat.transform_vector(
+                       vec3_t::from_rtm(matrix_get_axis(m, axis3::y)))
+                    .to_rtm();
+            const rtm_vec4_t d2 =
+                mat.transform_vector(
+                       vec3_t::from_rtm(matrix_get_axis(m, axis3::z)))
+                    .to_rtm();
+
+            // Gram-Schmidt, keeping the handedness of the original axes
+            const rtm_vec4_t u0 =
+                vector_mul(d0, T(1) / T(vector_length3(d0)));
+            const rtm_vec4_t v1 =
+                vector_neg_mul_sub(u0, T(vector_dot3(d1, u0)), d1);
+            const rtm_vec4_t u1 =
+                vector_mul(v1, T(1) / T(vector_length3(v1)));
+            const rtm_mat3x3_t axes =
+                matrix_set(u0, u1, vector_cross3(u0, u1));
+
+            // Each new extent is the shadow of the scaled old half axes
+            const rtm_mat3x3_t to_local = matrix_transpose(axes);
+            const rtm_mat3x3_t shadows =
+                matrix_set(vector_abs(matrix_mul_vector3(d0, to_local)),
+                           vector_abs(matrix_mul_vector3(d1, to_local)),
+                           vector_abs(matrix_mul_vector3(d2, to_local)));
+            obb result;
+            result._center =
+                vector_set_w(mat.transform_point(get_center()).to_rtm(),
+                             T(0));
+            result._axes = mat3x3_t::from_rtm(axes);
+            result._extents =
+                vector_set_w(matrix_mul_vector3(_extents, shadows), T(0));
+            return result;
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE obb& set_center(const vec3_t& center)
+        {
+            _center = center.to_rtm();
+            return *this;
+        }
+
+        MVM_INLINE obb& set_extents(const vec3_t& extents)
+        {
+            _extents = extents.to_rtm();
+            return *this;
+        }
+
+        MVM_INLINE obb& transform(const mat4x4_t& mat)
+        {
+            *this = transformed(mat);
+            return *this;
+        }
+    };
+
+    using obbf = obb<float>;
+    using obbd = obb<double>;
+
+    template <typename T>
+    MVM_INLINE_NODISCARD bool approx_equal(
+        const obb<T>& a,
+        const obb<T>& b,
+        const T& epsilon = std::numeric_limits<T>::epsilon())
+    {
+        return rtm::vector_all_near_equal3(a.center_rtm(), b.center_rtm(),
+                                           epsilon) &&
+               rtm::vector_all_near_equal3(a.extents_rtm(), b.extents_rtm(),
+                                           epsilon) &&
+               approx_equal(a.get_axes(), b.get_axes(), epsilon);
+    }
+}  // namespace move::math
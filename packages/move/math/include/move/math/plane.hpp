@@ -0,0 +1,391 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/mat4x4.hpp>
+#include <move/math/vec3.hpp>
+#include <move/math/vec4.hpp>
+
+namespace move::math
+{
+    /**
+     * @brief A plane stored as a vec4 `(n, d)`, holding the points `p`
+     * where `dot(n, p) + d == 0`.
+     *
+     * With a unit normal, `dot(plane, (p, 1))` is the signed distance from
+     * the plane to `p`, positive on the side the normal points to.  Most
+     * queries assume the plane is normalized; the factories produce
+     * normalized planes.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct plane
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using vec4_t = vec4<T, acceleration>;
+        using mat4x4_t = mat4x4<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using component_type = T;
+
+    private:
+        rtm_vec4_t _value;
+
+        // Constructors
+    public:
+        // The ground plane, facing +Y
+        MVM_INLINE plane() : _value(rtm::vector_set(T(0), T(1), T(0), T(0)))
+        {
+        }
+
+        /**
+         * @brief Creates a plane from its normal and offset.
+         *
+         * @param normal The plane normal.  Should be normalized.
+         * @param offset The `d` in `dot(n, p) + d == 0`, i.e. the negated
+         * distance from the origin along the normal
+         */
+        MVM_INLINE plane(const vec3_t& normal, const T& offset) :
+            _value(rtm::vector_set_w(normal.to_rtm(), offset))
+        {
+        }
+
+        MVM_INLINE explicit plane(const vec4_t& coefficients) :
+            _value(coefficients.to_rtm())
+        {
+        }
+
+        MVM_INLINE plane(const plane& other) : _value(other._value)
+        {
+        }
+
+        MVM_INLINE plane& operator=(const plane& other)
+        {
+            _value = other._value;
+            return *this;
+        }
+
+        MVM_INLINE_NODISCARD static plane from_rtm(const rtm_vec4_t& value)
+        {
+            plane result;
+            result._value = value;
+            return result;
+        }
+
+        /**
+         * @brief Creates the plane through a point with the given normal.
+         *
+         * @param point Any point on the plane
+         * @param normal The plane normal.  Normalized by this function.
+         */
+        MVM_INLINE_NODISCARD static plane from_point_normal(
+            const vec3_t& point,
+            const vec3_t& normal)
+        {
+            const vec3_t n = normal.normalized();
+            return plane(n, -vec3_t::dot(n, point));
+        }
+
+        /**
+         * @brief Creates the plane through three points.  The normal is
+         * `cross(b - a, c - a)`, normalized.
+         *
+         * @return plane The plane, or a zero normal if the points are
+         * collinear
+         */
+        MVM_INLINE_NODISCARD static plane from_points(const vec3_t& a,
+                                                      const vec3_t& b,
+                                                      const vec3_t& c)
+        {
+            using namespace rtm;
+            const rtm_vec4_t pa = a.to_rtm();
+            const rtm_vec4_t n = vector_cross3(vector_sub(b.to_rtm(), pa),
+                                               vector_sub(c.to_rtm(), pa));
+            const T length = T(vector_length3(n));
+            if (length <= std::numeric_limits<T>::epsilon())
+            {
+                return from_rtm(vector_zero());
+            }
+            const rtm_vec4_t unit = vector_mul(n, T(1) / length);
+            return from_rtm(vector_set_w(unit, -T(vector_dot3(unit, pa))));
+        }
+
+        // Stream overload operators
+    public:
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(
+            std::basic_ostream<CharT, Traits>& os, const plane& p)
+        {
+#if defined(MVM_HAS_MOVE_CORE)
+            os << move::meta::type_name<plane>() << "(";
+#else
+            os << "plane(";
+#endif
+            os << p.get_normal() << ", " << p.get_offset() << ")";
+            return os;
+        }
+
+        // Comparison operators
+    public:
+        MVM_INLINE_NODISCARD bool operator==(const plane& other) const
+        {
+            return rtm::vector_all_near_equal(_value, other._value);
+        }
+
+        MVM_INLINE_NODISCARD bool operator!=(const plane& other) const
+        {
+            return !(*this == other);
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD vec3_t get_normal() const
+        {
+            return vec3_t::from_rtm(_value);
+        }
+
+        MVM_INLINE_NODISCARD T get_offset() const
+        {
+            return rtm::vector_get_w(_value);
+        }
+
+        MVM_INLINE_NODISCARD vec4_t to_vec4() const
+        {
+            return vec4_t::from_rtm(_value);
+        }
+
+        MVM_INLINE_NODISCARD rtm_vec4_t to_rtm() const
+        {
+            return _value;
+        }
+
+        // Geometric queries
+    public:
+        /**
+         * @brief Returns the plane scaled so its normal is unit length.
+         * The set of points it describes does not change.
+         */
+        MVM_INLINE_NODISCARD plane normalized() const
+        {
+            using namespace rtm;
+            return from_rtm(
+                vector_mul(_value, T(1) / T(vector_length3(_value))));
+        }
+
+        // The same plane facing the other way
+        MVM_INLINE_NODISCARD plane flipped() const
+        {
+            return from_rtm(rtm::vector_neg(_value));
+        }
+
+        /**
+         * @brief The signed distance from the plane to a point, positive in
+         * front of the plane.  Only a true distance if the plane is
+         * normalized.
+         */
+        MVM_INLINE_NODISCARD T signed_distance(const vec3_t& point) const
+        {
+            return T(rtm::vector_dot(_value, point.to_rtm()));
+        }
+
+        // The point on the plane closest to `point`
+        MVM_INLINE_NODISCARD vec3_t project_point(const vec3_t& point) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t p = point.to_rtm();
+            return vec3_t::from_rtm(
+                vector_neg_mul_sub(_value, T(vector_dot(_value, p)), p));
+        }
+
+        /**
+         * @brief Transforms the plane by an affine matrix.  The normal is
+         * carried by the inverse transpose, so the plane stays attached to
+         * the points it contained under any scale or shear.  The result is
+         * renormalized.
+         *
+         * The matrix must be affine.  This is checked with an assertion
+         * when MVM_VALIDATE_PRECONDITIONS is enabled.
+         *
+         * @param mat The transform applied to the points of the plane
+         * @return plane The transformed plane
+         */
+        MVM_INLINE_NODISCARD plane transformed(const mat4x4_t& mat) const
+        {
+            MVM_ASSERT_PRECONDITION(mat.is_affine());
+            using namespace rtm;
+            const rtm_vec4_t n =
+                mat.inverse_transpose_3x3()
+                    .transform_vector(get_normal())
+                    .to_rtm();
+            const rtm_vec4_t t = matrix_get_axis(mat.to_rtm(), axis4::w);
+            const T offset = get_offset() - T(vector_dot3(n, t));
+            const T scale = T(1) / T(vector_length3(n));
+            return from_rtm(vector_mul(vector_set_w(n, offset), scale));
+        }
+
+        /**
+         * @brief Intersects the segment from `a` to `b` with the plane.
+         *
+         * @param a The start of the segment
+         * @param b The end of the segment
+         * @param t Receives the intersection as a fraction of the way from
+         * `a` to `b`.  Only written on a hit.
+         * @return bool True if the segment crosses or touches the plane
+         */
+        MVM_INLINE bool intersect_segment(const vec3_t& a,
+                                          const vec3_t& b,
+                                          T& t) const
+        {
+            const T da = signed_distance(a);
+            const T db = signed_distance(b);
+            if ((da > T(0) && db > T(0)) || (da < T(0) && db < T(0)) ||
+                da == db)
+            {
+                return false;
+            }
+            t = da / (da - db);
+            return true;
+        }
+
+        /**
+         * @brief Intersects this plane with another, giving the line they
+         * share.
+         *
+         * @param other The other plane
+         * @param point Receives the point on the line closest to the origin
+         * @param direction Receives the unnormalized line direction,
+         * `cross(n0, n1)`
+         * @return bool False if the planes are parallel
+         */
+        MVM_INLINE bool intersect_plane(const plane& other,
+                                        vec3_t& point,
+                                        vec3_t& direction) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t d = vector_cross3(_value, other._value);
+            const T denom = T(vector_dot3(d, d));
+            if (denom <= std::numeric_limits<T>::epsilon())
+            {
+                return false;
+            }
+
+            // (d1 * n0 - d0 * n1) x d / |d|^2
+            const rtm_vec4_t offsets =
+                vector_sub(vector_mul(_value, other.get_offset()),
+                           vector_mul(other._value, get_offset()));
+            point = vec3_t::from_rtm(
+                vector_mul(vector_cross3(offsets, d), T(1) / denom));
+            direction = vec3_t::from_rtm(d);
+            return true;
+        }
+
+        /**
+         * @brief Finds the point shared by three planes, e.g. a frustum
+         * corner.
+         *
+         * @param out Receives the point
+         * @return bool False if any two of the planes are parallel
+         */
+        MVM_INLINE static bool intersect_planes(const plane& a,
+                                                const plane& b,
+                                                const plane& c,
+                                                vec3_t& out)
+        {
+            using namespace rtm;
+            const rtm_vec4_t bc = vector_cross3(b._value, c._value);
+            const T denom = T(vector_dot3(a._value, bc));
+            if (math::abs(denom) <= std::numeric_limits<T>::epsilon())
+            {
+                return false;
+            }
+
+            // -(da (nb x nc) + db (nc x na) + dc (na x nb)) / denom
+            rtm_vec4_t sum = vector_mul(bc, a.get_offset());
+            sum = vector_mul_add(vector_cross3(c._value, a._value),
+                                 b.get_offset(), sum);
+            sum = vector_mul_add(vector_cross3(a._value, b._value),
+                                 c.get_offset(), sum);
+            out = vec3_t::from_rtm(vector_mul(sum, T(-1) / denom));
+            return true;
+        }
+
+        // Bulk operations
+    public:
+        /**
+         * @brief Computes the signed distance from the plane to each point
+         * of an array.
+         *
+         * @param points The points to measure
+         * @param out Receives one distance per point
+         * @param count The number of points
+         */
+        MVM_INLINE void signed_distances(
+            const vec3<T, Acceleration::Scalar>* points,
+            T* out,
+            size_t count) const
+        {
+            using namespace rtm;
+            const T d = vector_get_w(_value);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const rtm_vec4_t p = vector_load3(points[i].to_array());
+                out[i] = T(vector_dot3(_value, p)) + d;
+            }
+        }
+
+        /**
+         * @brief Structure-of-arrays variant of signed_distances.  Each
+         * distance is a dot product of three separate arrays with the
+         * normal, which GCC vectorizes at -O3 with no extra flags.
+         *
+         * @param points The points to measure
+         * @param out Receives one distance per point
+         * @param count The number of points
+         */
+        MVM_INLINE void signed_distances(soa_vec3<const T> points,
+                                         T* out,
+                                         size_t count) const
+        {
+            using namespace rtm;
+            const T nx = vector_get_x(_value);
+            const T ny = vector_get_y(_value);
+            const T nz = vector_get_z(_value);
+            const T d = vector_get_w(_value);
+            for (size_t i = 0; i < count; ++i)
+            {
+                out[i] = points.x[i] * nx + points.y[i] * ny +
+                         points.z[i] * nz + d;
+            }
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE plane& normalize()
+        {
+            *this = normalized();
+            return *this;
+        }
+    };
+
+    using planef = plane<float>;
+    using planed = plane<double>;
+
+    template <typename T>
+    MVM_INLINE_NODISCARD bool approx_equal(
+        const plane<T>& a,
+        const plane<T>& b,
+        const T& epsilon = std::numeric_limits<T>::epsilon())
+    {
+        return rtm::vector_all_near_equal(a.to_rtm(), b.to_rtm(), epsilon);
+    }
+}  // namespace move::math
@@ -0,0 +1,198 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/quat.hpp>
+
+namespace move::math
+{
+    /**
+     * @brief A view over a rotation keyframe track, interpolated with
+     * squad.  The track does not own its arrays.
+     *
+     * Build one by aligning the keys with `quat::align_hemispheres` and
+     * computing the controls with `quat::squad_controls`.  Times outside
+     * the track clamp to the first or last key.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct quat_track
+    {
+    public:
+        using quat_t = quat<T>;
+        using component_type = T;
+
+        // Key times, strictly increasing
+        const T* times;
+        // Key rotations, hemisphere aligned
+        const quat_t* keys;
+        // Squad controls, one per key
+        const quat_t* controls;
+        size_t count;
+
+        // Lookup
+    public:
+        /**
+         * @brief Finds the segment containing a time by binary search.
+         *
+         * @param time The time to look up.  Must be within the track.
+         * @return size_t The index of the key that starts the segment
+         */
+        MVM_INLINE_NODISCARD size_t find_segment(const T& time) const
+        {
+            const size_t upper =
+                size_t(std::upper_bound(times, times + count, time) - times);
+            return upper == 0 ? 0 : std::min(upper - 1, count - 2);
+        }
+
+        /**
+         * @brief Finds the segment containing a time, starting from the
+         * segment found last time.  Playback usually advances by at most a
+         * key or two per frame, so this rarely needs the binary search.
+         *
+         * @param time The time to look up.  Must be within the track.
+         * @param cursor The previous segment, updated to the new one
+         * @return size_t The index of the key that starts the segment
+         */
+        MVM_INLINE_NODISCARD size_t find_segment(const T& time,
+                                                 size_t& cursor) const
+        {
+            constexpr size_t max_steps = 4;
+            if (cursor + 1 < count && times[cursor] <= time)
+            {
+                size_t i = cursor;
+                while (i + 2 < count && times[i + 1] <= time &&
+                       i < cursor + max_steps)
+                {
+                    ++i;
+                }
+                if (i + 2 >= count || time < times[i + 1])
+                {
+                    cursor = i;
+                    return i;
+                }
+            }
+            cursor = find_segment(time);
+            return cursor;
+        }
+
+        // Evaluation
+    public:
+        MVM_INLINE_NODISCARD quat_t evaluate(const T& time) const
+        {
+            if (const quat_t* key = clamped_key(time))
+            {
+                return *key;
+            }
+            return evaluate_segment(find_segment(time), time);
+        }
+
+        /**
+         * @brief Evaluates the track, reusing and updating a cursor from
+         * the previous evaluation.  Start the cursor at zero.
+         */
+        MVM_INLINE_NODISCARD quat_t evaluate(const T& time,
+                                             size_t& cursor) const
+        {
+            if (const quat_t* key = clamped_key(time))
+            {
+                return *key;
+            }
+            return evaluate_segment(find_segment(time, cursor), time);
+        }
+
+        // Bulk operations
+    public:
+        /**
+         * @brief Evaluates many tracks at the same time, such as every bone
+         * of a skeleton.
+         *
+         * @param tracks The tracks to evaluate
+         * @param track_count The number of tracks
+         * @param time The time to evaluate at
+         * @param out Receives one rotation per track
+         * @param cursors One cursor per track, carried between calls.  May
+         * be null, in which case every lookup is a binary search.
+         */
+        MVM_INLINE static void sample(const quat_track* tracks,
+                                      size_t track_count,
+                                      const T& time,
+                                      quat_t* out,
+                                      size_t* cursors = nullptr)
+        {
+            sample_impl(tracks, track_count, &time, 0, out, cursors);
+        }
+
+        /**
+         * @brief Evaluates many tracks, each at its own time, such as the
+         * same bone across many characters playing out of step.
+         *
+         * @param tracks The tracks to evaluate
+         * @param track_count The number of tracks
+         * @param times The time to evaluate each track at
+         * @param out Receives one rotation per track
+         * @param cursors One cursor per track, carried between calls.  May
+         * be null, in which case every lookup is a binary search.
+         */
+        MVM_INLINE static void sample(const quat_track* tracks,
+                                      size_t track_count,
+                                      const T* times,
+                                      quat_t* out,
+                                      size_t* cursors = nullptr)
+        {
+            sample_impl(tracks, track_count, times, 1, out, cursors);
+        }
+
+    private:
+        // The first or last key when the time is outside the track, else
+        // null
+        MVM_INLINE_NODISCARD const quat_t* clamped_key(const T& time) const
+        {
+            if (count < 2 || time <= times[0])
+            {
+                return count == 0 ? &identity_key() : keys;
+            }
+            if (time >= times[count - 1])
+            {
+                return keys + count - 1;
+            }
+            return nullptr;
+        }
+
+        MVM_INLINE_NODISCARD quat_t evaluate_segment(size_t i,
+                                                     const T& time) const
+        {
+            const T t = (time - times[i]) / (times[i + 1] - times[i]);
+            return quat_t::squad(keys[i], keys[i + 1], controls[i],
+                                 controls[i + 1], t);
+        }
+
+        MVM_INLINE_NODISCARD static const quat_t& identity_key()
+        {
+            static const quat_t identity = quat_t::identity();
+            return identity;
+        }
+
+        // A time stride of zero evaluates every track at the same time
+        static void sample_impl(const quat_track* tracks,
+                                size_t track_count,
+                                const T* times,
+                                size_t time_stride,
+                                quat_t* out,
+                                size_t* cursors)
+        {
+            for (size_t i = 0; i < track_count; ++i)
+            {
+                const T time = times[i * time_stride];
+                out[i] = cursors ? tracks[i].evaluate(time, cursors[i])
+                                 : tracks[i].evaluate(time);
+            }
+        }
+    };
+
+    using quat_trackf = quat_track<float>;
+    using quat_trackd = quat_track<double>;
+}  // namespace move::math
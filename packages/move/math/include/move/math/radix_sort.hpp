@@ -0,0 +1,182 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+
+namespace move::math
+{
+    // Bits sorted per radix sort pass
+    constexpr uint32_t radix_sort_digit_bits = 11;
+
+    /**
+     * @brief Stable least significant digit radix sort of `values` by
+     * `keys`, e.g. object indices by Morton code.
+     *
+     * `parallel_for(chunk_count, job)` must invoke `job(chunk_index)`
+     * exactly once for each index in `[0, chunk_count)`, from any thread,
+     * and return once all of them have completed.  Each pass counts digits
+     * per chunk of `chunk_size` elements, offsets the counts in digit then
+     * chunk order, and scatters each chunk on its own, so no pass needs
+     * atomics and the result does not depend on the dispatcher or the
+     * chunk size.  Passes whose digit is the same for every key are
+     * skipped, so keys that use only some of their bits cost less.
+     *
+     * @param keys The keys.  Receives them sorted.
+     * @param values The values.  Receives them in key order.
+     * @param scratch_keys Scratch for `count` keys
+     * @param scratch_values Scratch for `count` values
+     * @param count The number of elements
+     * @param parallel_for The dispatcher that runs the chunks
+     * @param chunk_size The number of elements per chunk
+     * @param key_bits Only the low `key_bits` bits of the keys are sorted
+     */
+    template <typename Key, typename Value, typename ParallelFor>
+        requires std::is_unsigned_v<Key> &&
+                 std::is_trivially_copyable_v<Value> &&
+                 std::is_invocable_v<ParallelFor&, size_t, void (*)(size_t)>
+    void radix_sort_by_key(Key* keys,
+                           Value* values,
+                           Key* scratch_keys,
+                           Value* scratch_values,
+                           size_t count,
+                           ParallelFor&& parallel_for,
+                           size_t chunk_size = 65536,
+                           uint32_t key_bits = sizeof(Key) * 8)
+    {
+        constexpr size_t radix = size_t(1) << radix_sort_digit_bits;
+        if (count < 2)
+        {
+            return;
+        }
+
+        chunk_size = chunk_size == 0 ? count : chunk_size;
+        const size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+        key_bits = math::min<uint32_t>(key_bits, sizeof(Key) * 8);
+
+        // Row c holds chunk c's digit counts, then its first slot per digit
+        std::vector<size_t> offsets(chunk_count * radix);
+        size_t* offset = offsets.data();
+        Key* from_keys = keys;
+        Value* from_values = values;
+        Key* to_keys = scratch_keys;
+        Value* to_values = scratch_values;
+
+        for (uint32_t shift = 0; shift < key_bits;
+             shift += radix_sort_digit_bits)
+        {
+            // The last digit may be narrower
+            const uint32_t width =
+                math::min(key_bits - shift, radix_sort_digit_bits);
+            const Key digit_mask = Key((size_t(1) << width) - 1);
+            parallel_for(chunk_count,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             size_t* row = offset + chunk_index * radix;
+                             std::fill(row, row + radix, size_t(0));
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 ++row[(from_keys[i] >> shift) & digit_mask];
+                             }
+                         });
+
+            size_t total = 0;
+            bool uniform = false;
+            for (size_t digit = 0; digit < radix && !uniform; ++digit)
+            {
+                size_t digit_count = 0;
+                for (size_t c = 0; c < chunk_count; ++c)
+                {
+                    const size_t n = offsets[c * radix + digit];
+                    offsets[c * radix + digit] = total;
+                    total += n;
+                    digit_count += n;
+                }
+                uniform = digit_count == count;
+            }
+            if (uniform)
+            {
+                continue;
+            }
+
+            parallel_for(chunk_count,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             // A local copy, which the stores below
+                             // cannot alias
+                             size_t slots[radix];
+                             std::copy(offset + chunk_index * radix,
+                                       offset + (chunk_index + 1) * radix,
+                                       slots);
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 const Key key = from_keys[i];
+                                 const size_t slot =
+                                     slots[(key >> shift) & digit_mask]++;
+                                 to_keys[slot] = key;
+                                 to_values[slot] = from_values[i];
+                             }
+                         });
+            std::swap(from_keys, to_keys);
+            std::swap(from_values, to_values);
+        }
+
+        if (from_keys != keys)
+        {
+            parallel_for(chunk_count,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             std::copy(from_keys + begin, from_keys + end,
+                                       keys + begin);
+                             std::copy(from_values + begin,
+                                       from_values + end, values + begin);
+                         });
+        }
+    }
+
+    /**
+     * @brief Single threaded radix_sort_by_key.
+     *
+     * @param keys The keys.  Receives them sorted.
+     * @param values The values.  Receives them in key order.
+     * @param scratch_keys Scratch for `count` keys
+     * @param scratch_values Scratch for `count` values
+     * @param count The number of elements
+     * @param key_bits Only the low `key_bits` bits of the keys are sorted
+     */
+    template <typename Key, typename Value>
+        requires std::is_unsigned_v<Key> &&
+                 std::is_trivially_copyable_v<Value>
+    void radix_sort_by_key(Key* keys,
+                           Value* values,
+                           Key* scratch_keys,
+                           Value* scratch_values,
+                           size_t count,
+                           uint32_t key_bits = sizeof(Key) * 8)
+    {
+        radix_sort_by_key(
+            keys, values, scratch_keys, scratch_values, count,
+            [](size_t chunk_count, auto&& job)
+            {
+                for (size_t i = 0; i < chunk_count; ++i)
+                {
+                    job(i);
+                }
+            },
+            count, key_bits);
+    }
+}  // namespace move::math
@@ -0,0 +1,760 @@
+#pragma once
+#include <cstddef>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/aabb.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/obb.hpp>
+#include <move/math/plane.hpp>
+#include <move/math/sphere.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    namespace detail
+    {
+        // The component of (x, y, z) picked by an axis index.  It masks
+        // the bit patterns rather than branching or selecting, because GCC
+        // threads repeated tests of the same axis into branches that keep
+        // the packet triangle loop from vectorizing.
+        template <typename T>
+        MVM_INLINE_NODISCARD T select_axis(uint32_t axis,
+                                           const T& x,
+                                           const T& y,
+                                           const T& z)
+        {
+            using bits_t =
+                std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            const bits_t pick_x = bits_t(0) - bits_t(axis == 0);
+            const bits_t pick_y = bits_t(0) - bits_t(axis == 1);
+            const bits_t pick_z = bits_t(0) - bits_t(axis == 2);
+            return std::bit_cast<T>((std::bit_cast<bits_t>(x) & pick_x) |
+                                    (std::bit_cast<bits_t>(y) & pick_y) |
+                                    (std::bit_cast<bits_t>(z) & pick_z));
+        }
+
+        // Narrows [enter, exit] to the slab whose faces the ray crosses at
+        // `t0` and `t1`.  A ray parallel to the slab that starts on one of
+        // its faces gives 0 * inf = NaN there; every comparison with it is
+        // false, so the slab leaves the range alone and the face counts as
+        // part of the box.
+        template <typename T>
+        MVM_INLINE void clip_slab(const T& t0, const T& t1, T& enter, T& exit)
+        {
+            enter = (t0 > enter) & (t1 > enter) ? math::min(t0, t1) : enter;
+            exit = (t0 < exit) & (t1 < exit) ? math::max(t0, t1) : exit;
+        }
+
+        // The edge functions of the watertight test: the triangle, relative
+        // to the ray origin, is sheared so the ray runs down +Z, and U, V
+        // and W are twice the signed areas opposite a, b and c
+        template <typename T, typename U>
+        MVM_INLINE void woop_edges(const T* a,
+                                   const T* b,
+                                   const T* c,
+                                   uint32_t kx,
+                                   uint32_t ky,
+                                   uint32_t kz,
+                                   const U& shear_x,
+                                   const U& shear_y,
+                                   U& edge_u,
+                                   U& edge_v,
+                                   U& edge_w)
+        {
+            const U ax = U(a[kx]) - shear_x * U(a[kz]);
+            const U ay = U(a[ky]) - shear_y * U(a[kz]);
+            const U bx = U(b[kx]) - shear_x * U(b[kz]);
+            const U by = U(b[ky]) - shear_y * U(b[kz]);
+            const U cx = U(c[kx]) - shear_x * U(c[kz]);
+            const U cy = U(c[ky]) - shear_y * U(c[kz]);
+            edge_u = cx * by - cy * bx;
+            edge_v = ax * cy - ay * cx;
+            edge_w = bx * ay - by * ax;
+        }
+    }  // namespace detail
+
+    template <typename T, size_t Width>
+        requires std::is_floating_point_v<T> && (Width == 4 || Width == 8)
+    struct ray_packet;
+
+    /**
+     * @brief A ray with a parametric range `[t_min, t_max]`, carrying the
+     * per-ray constants its intersection tests need: the inverse direction
+     * for slab tests, the direction sign bits for ordering traversal, and
+     * the axis permutation and shear of the watertight triangle test.
+     *
+     * The direction does not need to be normalized; every `t` is in units
+     * of its length.  Closest-hit searches shrink `t_max` to each hit as
+     * they go, so later tests reject anything further away.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct ray
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using aabb_t = aabb<T>;
+        using obb_t = obb<T>;
+        using sphere_t = sphere<T>;
+        using plane_t = plane<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using component_type = T;
+
+    private:
+        rtm_vec4_t _origin;
+        rtm_vec4_t _direction;
+        rtm_vec4_t _inv_direction;
+        T _t_min;
+        T _t_max;
+        T _shear_x;
+        T _shear_y;
+        T _shear_z;
+        uint32_t _kx;
+        uint32_t _ky;
+        uint32_t _kz;
+        uint32_t _sign;
+
+        // Constructors
+    public:
+        // A ray from the origin along +Z
+        MVM_INLINE ray() : ray(vec3_t(0, 0, 0), vec3_t(0, 0, 1))
+        {
+        }
+
+        /**
+         * @brief Creates a ray and precomputes its intersection constants.
+         *
+         * @param origin The start of the ray
+         * @param direction The direction.  Must not be zero.
+         * @param t_min The nearest distance a hit may be at
+         * @param t_max The furthest distance a hit may be at
+         */
+        MVM_INLINE ray(const vec3_t& origin,
+                       const vec3_t& direction,
+                       const T& t_min = T(0),
+                       const T& t_max = std::numeric_limits<T>::infinity()) :
+            _t_min(t_min), _t_max(t_max)
+        {
+            using namespace rtm;
+            _origin = vector_set_w(origin.to_rtm(), T(0));
+            _direction = vector_set_w(direction.to_rtm(), T(0));
+            _inv_direction = vector_reciprocal(_direction);
+
+            T d[4];
+            vector_store(_direction, d);
+            _sign = (d[0] < T(0) ? 1u : 0u) | (d[1] < T(0) ? 2u : 0u) |
+                    (d[2] < T(0) ? 4u : 0u);
+
+            // Shear along the dominant axis.  Swapping the other two when it
+            // points backwards keeps the winding of the edge functions.
+            const T ax = math::abs(d[0]);
+            const T ay = math::abs(d[1]);
+            const T az = math::abs(d[2]);
+            _kz = ax > ay ? (ax > az ? 0 : 2) : (ay > az ? 1 : 2);
+            _kx = (_kz + 1) % 3;
+            _ky = (_kx + 1) % 3;
+            if (d[_kz] < T(0))
+            {
+                const uint32_t swap = _kx;
+                _kx = _ky;
+                _ky = swap;
+            }
+            _shear_x = d[_kx] / d[_kz];
+            _shear_y = d[_ky] / d[_kz];
+            _shear_z = T(1) / d[_kz];
+        }
+
+        // Stream overload operators
+    public:
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(
+            std::basic_ostream<CharT, Traits>& os, const ray& r)
+        {
+#if defined(MVM_HAS_MOVE_CORE)
+            os << move::meta::type_name<ray>() << "(";
+#else
+            os << "ray(";
+#endif
+            os << r.get_origin() << ", " << r.get_direction() << ", "
+               << r.get_t_min() << ", " << r.get_t_max() << ")";
+            return os;
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD vec3_t get_origin() const
+        {
+            return vec3_t::from_rtm(_origin);
+        }
+
+        MVM_INLINE_NODISCARD vec3_t get_direction() const
+        {
+            return vec3_t::from_rtm(_direction);
+        }
+
+        MVM_INLINE_NODISCARD vec3_t get_inv_direction() const
+        {
+            return vec3_t::from_rtm(_inv_direction);
+        }
+
+        MVM_INLINE_NODISCARD T get_t_min() const
+        {
+            return _t_min;
+        }
+
+        MVM_INLINE_NODISCARD T get_t_max() const
+        {
+            return _t_max;
+        }
+
+        /**
+         * @brief The direction sign bits: bit 0, 1 or 2 is set when the x,
+         * y or z direction is negative.  Traversal uses these to visit the
+         * nearer child of a split first.
+         */
+        MVM_INLINE_NODISCARD uint32_t get_sign() const
+        {
+            return _sign;
+        }
+
+        MVM_INLINE_NODISCARD vec3_t point_at(const T& t) const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(vector_mul_add(_direction, t, _origin));
+        }
+
+        // Intersection
+    public:
+        /**
+         * @brief Watertight ray-triangle test (Woop, Benthin and Wald).  The
+         * triangle is sheared into the ray's space and tested with edge
+         * functions, so rays through a shared edge or vertex hit exactly
+         * one of the triangles meeting there, unlike Moller-Trumbore.  Both
+         * sides of the triangle are hit.
+         *
+         * @param a The first vertex
+         * @param b The second vertex
+         * @param c The third vertex
+         * @param t Receives the hit distance.  Only written on a hit.
+         * @param u Receives the barycentric weight of `b`
+         * @param v Receives the barycentric weight of `c`
+         * @return bool True if the triangle is hit within the ray's range
+         */
+        MVM_INLINE bool intersect_triangle(const vec3_t& a,
+                                           const vec3_t& b,
+                                           const vec3_t& c,
+                                           T& t,
+                                           T& u,
+                                           T& v) const
+        {
+            using namespace rtm;
+            T pa[4];
+            T pb[4];
+            T pc[4];
+            vector_store(vector_sub(a.to_rtm(), _origin), pa);
+            vector_store(vector_sub(b.to_rtm(), _origin), pb);
+            vector_store(vector_sub(c.to_rtm(), _origin), pc);
+
+            T edge_u;
+            T edge_v;
+            T edge_w;
+            detail::woop_edges(pa, pb, pc, _kx, _ky, _kz, _shear_x, _shear_y,
+                               edge_u, edge_v, edge_w);
+
+            // Rays exactly on an edge give a zero edge function in float,
+            // which double resolves consistently on both sides
+            if constexpr (std::is_same_v<T, float>)
+            {
+                if (edge_u == T(0) || edge_v == T(0) || edge_w == T(0))
+                {
+                    double du;
+                    double dv;
+                    double dw;
+                    detail::woop_edges(pa, pb, pc, _kx, _ky, _kz,
+                                       double(_shear_x), double(_shear_y), du,
+                                       dv, dw);
+                    edge_u = T(du);
+                    edge_v = T(dv);
+                    edge_w = T(dw);
+                }
+            }
+
+            if ((edge_u < T(0) || edge_v < T(0) || edge_w < T(0)) &&
+                (edge_u > T(0) || edge_v > T(0) || edge_w > T(0)))
+            {
+                return false;
+            }
+            const T det = edge_u + edge_v + edge_w;
+            if (det == T(0))
+            {
+                return false;
+            }
+
+            const T scaled_t = _shear_z * (edge_u * pa[_kz] + edge_v * pb[_kz] +
+                                           edge_w * pc[_kz]);
+            const T inv_det = T(1) / det;
+            const T hit_t = scaled_t * inv_det;
+            if (!(hit_t >= _t_min && hit_t <= _t_max))
+            {
+                return false;
+            }
+            t = hit_t;
+            u = edge_v * inv_det;
+            v = edge_w * inv_det;
+            return true;
+        }
+
+        /**
+         * @brief Slab test against a box.
+         *
+         * @param box The box to test
+         * @param t_near Receives the distance the ray enters the box,
+         * clamped to the ray's range.  Only written on a hit.
+         * @param t_far Receives the distance the ray leaves the box
+         * @return bool True if the ray overlaps the box within its range
+         */
+        MVM_INLINE bool intersect_aabb(const aabb_t& box,
+                                       T& t_near,
+                                       T& t_far) const
+        {
+            using namespace rtm;
+            T t0[4];
+            T t1[4];
+            vector_store(
+                vector_mul(vector_sub(box.min_rtm(), _origin), _inv_direction),
+                t0);
+            vector_store(
+                vector_mul(vector_sub(box.max_rtm(), _origin), _inv_direction),
+                t1);
+
+            T enter = _t_min;
+            T exit = _t_max;
+            detail::clip_slab(t0[0], t1[0], enter, exit);
+            detail::clip_slab(t0[1], t1[1], enter, exit);
+            detail::clip_slab(t0[2], t1[2], enter, exit);
+            if (!(enter <= exit))
+            {
+                return false;
+            }
+            t_near = enter;
+            t_far = exit;
+            return true;
+        }
+
+        /**
+         * @brief Slab test against an oriented box, done on the ray moved
+         * into the box's frame.
+         *
+         * @param box The box to test
+         * @param t_near Receives the distance the ray enters the box,
+         * clamped to the ray's range.  Only written on a hit.
+         * @param t_far Receives the distance the ray leaves the box
+         * @return bool True if the ray overlaps the box within its range
+         */
+        MVM_INLINE bool intersect_obb(const obb_t& box,
+                                      T& t_near,
+                                      T& t_far) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t origin =
+                box.local_point(vec3_t::from_rtm(_origin)).to_rtm();
+            const rtm_vec4_t inv_direction = vector_reciprocal(vector_set_w(
+                box.local_direction(vec3_t::from_rtm(_direction)).to_rtm(),
+                T(1)));
+            const rtm_vec4_t extents = box.extents_rtm();
+            T t0[4];
+            T t1[4];
+            vector_store(vector_mul(vector_sub(vector_neg(extents), origin),
+                                    inv_direction),
+                         t0);
+            vector_store(
+                vector_mul(vector_sub(extents, origin), inv_direction), t1);
+
+            T enter = _t_min;
+            T exit = _t_max;
+            detail::clip_slab(t0[0], t1[0], enter, exit);
+            detail::clip_slab(t0[1], t1[1], enter, exit);
+            detail::clip_slab(t0[2], t1[2], enter, exit);
+            if (!(enter <= exit))
+            {
+                return false;
+            }
+            t_near = enter;
+            t_far = exit;
+            return true;
+        }
+
+        /**
+         * @brief Intersects the ray with a solid sphere, returning the
+         * nearest crossing of its surface within the ray's range.  A ray
+         * starting inside the sphere hits its far side.
+         *
+         * @param s The sphere to test
+         * @param t Receives the hit distance.  Only written on a hit.
+         * @return bool True if the sphere is hit
+         */
+        MVM_INLINE bool intersect_sphere(const sphere_t& s, T& t) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t oc = vector_sub(_origin, s.to_rtm());
+            const T a = T(vector_dot3(_direction, _direction));
+            const T half_b = T(vector_dot3(oc, _direction));
+            const T radius = s.get_radius();
+            const T c = T(vector_dot3(oc, oc)) - radius * radius;
+            const T discriminant = half_b * half_b - a * c;
+            if (discriminant < T(0))
+            {
+                return false;
+            }
+
+            const T root = math::sqrt(discriminant);
+            T hit_t = (-half_b - root) / a;
+            if (hit_t < _t_min || hit_t > _t_max)
+            {
+                hit_t = (-half_b + root) / a;
+                if (hit_t < _t_min || hit_t > _t_max)
+                {
+                    return false;
+                }
+            }
+            t = hit_t;
+            return true;
+        }
+
+        /**
+         * @brief Intersects the ray with a plane, from either side.
+         *
+         * @param p The plane to test
+         * @param t Receives the hit distance.  Only written on a hit.
+         * @return bool False if the ray is parallel to the plane or the hit
+         * is outside its range
+         */
+        MVM_INLINE bool intersect_plane(const plane_t& p, T& t) const
+        {
+            using namespace rtm;
+            const T denom = T(vector_dot3(p.to_rtm(), _direction));
+            if (denom == T(0))
+            {
+                return false;
+            }
+            const T hit_t = -p.signed_distance(get_origin()) / denom;
+            if (!(hit_t >= _t_min && hit_t <= _t_max))
+            {
+                return false;
+            }
+            t = hit_t;
+            return true;
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE ray& set_range(const T& t_min, const T& t_max)
+        {
+            _t_min = t_min;
+            _t_max = t_max;
+            return *this;
+        }
+
+        MVM_INLINE ray& set_t_max(const T& t_max)
+        {
+            _t_max = t_max;
+            return *this;
+        }
+
+        template <typename U, size_t Width>
+            requires std::is_floating_point_v<U> &&
+                     (Width == 4 || Width == 8)
+        friend struct ray_packet;
+    };
+
+    /**
+     * @brief A packet of 4 or 8 rays in structure-of-arrays form, tested
+     * together against one primitive.
+     *
+     * Every test runs the same branch-free arithmetic on each lane.  GCC
+     * vectorizes the loops across the packet at -O3 once AVX2 is enabled,
+     * which building the mask with per-lane shifts needs; the sphere test
+     * also needs -fno-math-errno for its square root.  Tests return a
+     * bitmask with bit `i` set when lane `i` hits.  The output arrays are
+     * written for every lane, but only hold meaningful values for lanes
+     * in the mask.
+     */
+    template <typename T, size_t Width>
+        requires std::is_floating_point_v<T> && (Width == 4 || Width == 8)
+    struct alignas(Width * sizeof(T)) ray_packet
+    {
+    public:
+        using ray_t = ray<T>;
+        using vec3_t = typename ray_t::vec3_t;
+        using aabb_t = aabb<T>;
+        using sphere_t = sphere<T>;
+        using plane_t = plane<T>;
+        using component_type = T;
+
+        constexpr static size_t width = Width;
+
+        T origin_x[Width];
+        T origin_y[Width];
+        T origin_z[Width];
+        T direction_x[Width];
+        T direction_y[Width];
+        T direction_z[Width];
+        T inv_direction_x[Width];
+        T inv_direction_y[Width];
+        T inv_direction_z[Width];
+        T t_min[Width];
+        T t_max[Width];
+        T shear_x[Width];
+        T shear_y[Width];
+        T shear_z[Width];
+        uint32_t kx[Width];
+        uint32_t ky[Width];
+        uint32_t kz[Width];
+
+        // Constructors
+    public:
+        /**
+         * @brief Gathers up to `Width` rays into a packet.  Lanes past
+         * `count` get an empty range, so they never hit.
+         *
+         * @param rays The rays to gather
+         * @param count The number of rays, at most Width
+         */
+        MVM_INLINE_NODISCARD static ray_packet load(const ray_t* rays,
+                                                    size_t count)
+        {
+            using namespace rtm;
+            ray_packet packet;
+            for (size_t i = 0; i < Width; ++i)
+            {
+                const ray_t& r = rays[i < count ? i : 0];
+                packet.origin_x[i] = vector_get_x(r._origin);
+                packet.origin_y[i] = vector_get_y(r._origin);
+                packet.origin_z[i] = vector_get_z(r._origin);
+                packet.direction_x[i] = vector_get_x(r._direction);
+                packet.direction_y[i] = vector_get_y(r._direction);
+                packet.direction_z[i] = vector_get_z(r._direction);
+                packet.inv_direction_x[i] = vector_get_x(r._inv_direction);
+                packet.inv_direction_y[i] = vector_get_y(r._inv_direction);
+                packet.inv_direction_z[i] = vector_get_z(r._inv_direction);
+                packet.t_min[i] = i < count ? r._t_min : T(1);
+                packet.t_max[i] = i < count ? r._t_max : T(0);
+                packet.shear_x[i] = r._shear_x;
+                packet.shear_y[i] = r._shear_y;
+                packet.shear_z[i] = r._shear_z;
+                packet.kx[i] = r._kx;
+                packet.ky[i] = r._ky;
+                packet.kz[i] = r._kz;
+            }
+            return packet;
+        }
+
+        // Intersection
+    public:
+        /**
+         * @brief Packet variant of ray::intersect_triangle, using the same
+         * watertight test.  It skips the double precision fallback for
+         * rays exactly on an edge, which the single ray test makes.
+         *
+         * @param t Receives the hit distance of each lane
+         * @param u Receives the barycentric weight of `b` for each lane
+         * @param v Receives the barycentric weight of `c` for each lane
+         * @return uint32_t The mask of lanes that hit
+         */
+        MVM_INLINE uint32_t intersect_triangle(const vec3_t& a,
+                                               const vec3_t& b,
+                                               const vec3_t& c,
+                                               T* t,
+                                               T* u,
+                                               T* v) const
+        {
+            const T ax = a.get_x();
+            const T ay = a.get_y();
+            const T az = a.get_z();
+            const T bx = b.get_x();
+            const T by = b.get_y();
+            const T bz = b.get_z();
+            const T cx = c.get_x();
+            const T cy = c.get_y();
+            const T cz = c.get_z();
+
+            uint32_t mask = 0;
+            for (size_t i = 0; i < Width; ++i)
+            {
+                const T pa[3] = {ax - origin_x[i], ay - origin_y[i],
+                                 az - origin_z[i]};
+                const T pb[3] = {bx - origin_x[i], by - origin_y[i],
+                                 bz - origin_z[i]};
+                const T pc[3] = {cx - origin_x[i], cy - origin_y[i],
+                                 cz - origin_z[i]};
+                const T pa_z =
+                    detail::select_axis(kz[i], pa[0], pa[1], pa[2]);
+                const T pb_z =
+                    detail::select_axis(kz[i], pb[0], pb[1], pb[2]);
+                const T pc_z =
+                    detail::select_axis(kz[i], pc[0], pc[1], pc[2]);
+                const T sax = detail::select_axis(kx[i], pa[0], pa[1], pa[2]) -
+                              shear_x[i] * pa_z;
+                const T say = detail::select_axis(ky[i], pa[0], pa[1], pa[2]) -
+                              shear_y[i] * pa_z;
+                const T sbx = detail::select_axis(kx[i], pb[0], pb[1], pb[2]) -
+                              shear_x[i] * pb_z;
+                const T sby = detail::select_axis(ky[i], pb[0], pb[1], pb[2]) -
+                              shear_y[i] * pb_z;
+                const T scx = detail::select_axis(kx[i], pc[0], pc[1], pc[2]) -
+                              shear_x[i] * pc_z;
+                const T scy = detail::select_axis(ky[i], pc[0], pc[1], pc[2]) -
+                              shear_y[i] * pc_z;
+
+                const T edge_u = scx * sby - scy * sbx;
+                const T edge_v = sax * scy - say * scx;
+                const T edge_w = sbx * say - sby * sax;
+                const T det = edge_u + edge_v + edge_w;
+                const T inv_det = T(1) / det;
+                const T scaled_t =
+                    edge_u * pa_z + edge_v * pb_z + edge_w * pc_z;
+                const T hit_t = shear_z[i] * scaled_t * inv_det;
+
+                const bool negative =
+                    (edge_u < T(0)) | (edge_v < T(0)) | (edge_w < T(0));
+                const bool positive =
+                    (edge_u > T(0)) | (edge_v > T(0)) | (edge_w > T(0));
+                const bool hit = !(negative & positive) & (det != T(0)) &
+                                 (hit_t >= t_min[i]) & (hit_t <= t_max[i]);
+                t[i] = hit_t;
+                u[i] = edge_v * inv_det;
+                v[i] = edge_w * inv_det;
+                mask |= uint32_t(hit) << i;
+            }
+            return mask;
+        }
+
+        /**
+         * @brief Packet variant of ray::intersect_aabb.
+         *
+         * @param t_near Receives the entry distance of each lane
+         * @return uint32_t The mask of lanes that hit
+         */
+        MVM_INLINE uint32_t intersect_aabb(const aabb_t& box, T* t_near) const
+        {
+            const vec3_t lo = box.get_min();
+            const vec3_t hi = box.get_max();
+            const T min_x = lo.get_x();
+            const T min_y = lo.get_y();
+            const T min_z = lo.get_z();
+            const T max_x = hi.get_x();
+            const T max_y = hi.get_y();
+            const T max_z = hi.get_z();
+
+            uint32_t mask = 0;
+            for (size_t i = 0; i < Width; ++i)
+            {
+                const T x0 = (min_x - origin_x[i]) * inv_direction_x[i];
+                const T x1 = (max_x - origin_x[i]) * inv_direction_x[i];
+                const T y0 = (min_y - origin_y[i]) * inv_direction_y[i];
+                const T y1 = (max_y - origin_y[i]) * inv_direction_y[i];
+                const T z0 = (min_z - origin_z[i]) * inv_direction_z[i];
+                const T z1 = (max_z - origin_z[i]) * inv_direction_z[i];
+                T enter = t_min[i];
+                T exit = t_max[i];
+                detail::clip_slab(x0, x1, enter, exit);
+                detail::clip_slab(y0, y1, enter, exit);
+                detail::clip_slab(z0, z1, enter, exit);
+                t_near[i] = enter;
+                mask |= uint32_t(enter <= exit) << i;
+            }
+            return mask;
+        }
+
+        /**
+         * @brief Packet variant of ray::intersect_sphere.
+         *
+         * @param t Receives the hit distance of each lane
+         * @return uint32_t The mask of lanes that hit
+         */
+        MVM_INLINE uint32_t intersect_sphere(const sphere_t& s, T* t) const
+        {
+            const vec3_t center = s.get_center();
+            const T cx = center.get_x();
+            const T cy = center.get_y();
+            const T cz = center.get_z();
+            const T radius_sq = s.get_radius() * s.get_radius();
+
+            uint32_t mask = 0;
+            for (size_t i = 0; i < Width; ++i)
+            {
+                const T ox = origin_x[i] - cx;
+                const T oy = origin_y[i] - cy;
+                const T oz = origin_z[i] - cz;
+                const T dx = direction_x[i];
+                const T dy = direction_y[i];
+                const T dz = direction_z[i];
+                const T a = dx * dx + dy * dy + dz * dz;
+                const T half_b = ox * dx + oy * dy + oz * dz;
+                const T c = ox * ox + oy * oy + oz * oz - radius_sq;
+                const T discriminant = half_b * half_b - a * c;
+                const T root = math::sqrt(discriminant);
+                const T inv_a = T(1) / a;
+                const T t0 = (-half_b - root) * inv_a;
+                // The far root when the near one is out of range, chosen by
+                // sign so the select guards no arithmetic
+                const T side = t0 >= t_min[i] ? T(-1) : T(1);
+                const T hit_t = (-half_b + side * root) * inv_a;
+                t[i] = hit_t;
+                mask |= uint32_t((discriminant >= T(0)) & (hit_t >= t_min[i]) &
+                                 (hit_t <= t_max[i]))
+                        << i;
+            }
+            return mask;
+        }
+
+        /**
+         * @brief Packet variant of ray::intersect_plane.
+         *
+         * @param t Receives the hit distance of each lane
+         * @return uint32_t The mask of lanes that hit
+         */
+        MVM_INLINE uint32_t intersect_plane(const plane_t& p, T* t) const
+        {
+            const vec3_t normal = p.get_normal();
+            const T nx = normal.get_x();
+            const T ny = normal.get_y();
+            const T nz = normal.get_z();
+            const T offset = p.get_offset();
+
+            uint32_t mask = 0;
+            for (size_t i = 0; i < Width; ++i)
+            {
+                const T denom = nx * direction_x[i] + ny * direction_y[i] +
+                                nz * direction_z[i];
+                const T distance = nx * origin_x[i] + ny * origin_y[i] +
+                                   nz * origin_z[i] + offset;
+                const T hit_t = -distance / denom;
+                t[i] = hit_t;
+                mask |= uint32_t((denom != T(0)) & (hit_t >= t_min[i]) &
+                                 (hit_t <= t_max[i]))
+                        << i;
+            }
+            return mask;
+        }
+    };
+
+    using rayf = ray<float>;
+    using rayd = ray<double>;
+
+    template <typename T>
+    using ray_packet4 = ray_packet<T, 4>;
+    template <typename T>
+    using ray_packet8 = ray_packet<T, 8>;
+}  // namespace move::math
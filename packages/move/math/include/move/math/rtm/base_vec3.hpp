@@ -461,9 +461,7 @@ namespace move::math::simd_rtm
 
             auto dot_incnrm = dot(inc, nrm);
             auto dot2 = dot_incnrm + dot_incnrm;
-            auto mul = nrm * dot2;
-            auto res = inc - mul;
-            return res;
+            return neg_mul_sub(nrm, dot2, inc);
         }
 
         /**
@@ -552,6 +550,103 @@ namespace move::math::simd_rtm
                                                    rtm::vector_set(T(1)))));
         }
 
+        /**
+         * @brief Returns `v1 * v2 + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec3 mul_add(const base_vec3& v1,
+                                                      const base_vec3& v2,
+                                                      const base_vec3& v3) noexcept
+        {
+            return base_vec3(
+                rtm::vector_mul_add(v1._value, v2._value, v3._value));
+        }
+
+        /**
+         * @brief Returns `v1 * s + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec3 mul_add(const base_vec3& v1,
+                                                      const T& s,
+                                                      const base_vec3& v3) noexcept
+        {
+            return base_vec3(rtm::vector_mul_add(v1._value, s, v3._value));
+        }
+
+        /**
+         * @brief Returns `v1 * v2 - v3` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec3 mul_sub(const base_vec3& v1,
+                                                      const base_vec3& v2,
+                                                      const base_vec3& v3) noexcept
+        {
+            return base_vec3(rtm::vector_neg(
+                rtm::vector_neg_mul_sub(v1._value, v2._value, v3._value)));
+        }
+
+        /**
+         * @brief Returns `v1 * s - v3` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec3 mul_sub(const base_vec3& v1,
+                                                      const T& s,
+                                                      const base_vec3& v3) noexcept
+        {
+            return base_vec3(rtm::vector_neg(
+                rtm::vector_neg_mul_sub(v1._value, s, v3._value)));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * v2` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec3 neg_mul_sub(const base_vec3& v1,
+                                                          const base_vec3& v2,
+                                                          const base_vec3& v3) noexcept
+        {
+            return base_vec3(
+                rtm::vector_neg_mul_sub(v1._value, v2._value, v3._value));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * s` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec3 neg_mul_sub(const base_vec3& v1,
+                                                          const T& s,
+                                                          const base_vec3& v3) noexcept
+        {
+            return base_vec3(
+                rtm::vector_neg_mul_sub(v1._value, s, v3._value));
+        }
+
         /**
          * @brief Returns a vector containing the minimum x, y, z, and w
          * components of the two vectors.
@@ -815,8 +910,7 @@ namespace move::math::simd_rtm
             // Project v onto the plane by subtracting the component parallel to the normal
             // projection = v - (v · n) * n
             auto dot_vn = dot(v, plane_normal);
-            auto parallel_component = plane_normal * dot_vn;
-            return v - parallel_component;
+            return neg_mul_sub(plane_normal, dot_vn, v);
         }
     };
 
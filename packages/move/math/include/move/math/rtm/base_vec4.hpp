@@ -524,8 +524,7 @@ namespace move::math::simd_rtm
 
             auto dot = vector_dot(inc, nrm);
             auto dot2 = vector_add(dot, dot);
-            auto mul = vector_mul(nrm, dot2);
-            auto res = vector_sub(inc, mul);
+            auto res = vector_neg_mul_sub(nrm, dot2, inc);
             return res;
         }
 
@@ -615,6 +614,103 @@ namespace move::math::simd_rtm
             return base_vec4(rtm::vector_lerp(v1._value, v2._value, clamped));
         }
 
+        /**
+         * @brief Returns `v1 * v2 + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec4 mul_add(const base_vec4& v1,
+                                                      const base_vec4& v2,
+                                                      const base_vec4& v3) noexcept
+        {
+            return base_vec4(
+                rtm::vector_mul_add(v1._value, v2._value, v3._value));
+        }
+
+        /**
+         * @brief Returns `v1 * s + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec4 mul_add(const base_vec4& v1,
+                                                      const T& s,
+                                                      const base_vec4& v3) noexcept
+        {
+            return base_vec4(rtm::vector_mul_add(v1._value, s, v3._value));
+        }
+
+        /**
+         * @brief Returns `v1 * v2 - v3` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec4 mul_sub(const base_vec4& v1,
+                                                      const base_vec4& v2,
+                                                      const base_vec4& v3) noexcept
+        {
+            return base_vec4(rtm::vector_neg(
+                rtm::vector_neg_mul_sub(v1._value, v2._value, v3._value)));
+        }
+
+        /**
+         * @brief Returns `v1 * s - v3` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec4 mul_sub(const base_vec4& v1,
+                                                      const T& s,
+                                                      const base_vec4& v3) noexcept
+        {
+            return base_vec4(rtm::vector_neg(
+                rtm::vector_neg_mul_sub(v1._value, s, v3._value)));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * v2` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec4 neg_mul_sub(const base_vec4& v1,
+                                                          const base_vec4& v2,
+                                                          const base_vec4& v3) noexcept
+        {
+            return base_vec4(
+                rtm::vector_neg_mul_sub(v1._value, v2._value, v3._value));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * s` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD static base_vec4 neg_mul_sub(const base_vec4& v1,
+                                                          const T& s,
+                                                          const base_vec4& v3) noexcept
+        {
+            return base_vec4(
+                rtm::vector_neg_mul_sub(v1._value, s, v3._value));
+        }
+
         /**
          * @brief Returns a vector containing the minimum x, y, z, and w
          * components of the two vectors.
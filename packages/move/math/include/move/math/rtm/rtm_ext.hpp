@@ -601,17 +601,18 @@ namespace rtm::ext
         qw = move::math::clamp(qw, value_t(-1), value_t(1));
         
         // If quaternion is close to identity, return zero
-        if (abs(qw) >= value_t(1) - epsilon)
+        if (move::math::abs(qw) >= value_t(1) - epsilon)
         {
             return quat_set(value_t(0), value_t(0), value_t(0), value_t(0));
         }
         
-        // Calculate theta = acos(|qw|)
-        value_t theta = acos(abs(qw));
+        // Calculate theta = acos(qw).  Taking |qw| here would drop the sign
+        // of w and break exp(ln(q)) == q for q.w < 0.
+        value_t theta = acos(qw);
         value_t sin_theta = sin(theta);
         
         // If sin(theta) is too small, return zero to avoid division by zero
-        if (abs(sin_theta) < epsilon)
+        if (move::math::abs(sin_theta) < epsilon)
         {
             return quat_set(value_t(0), value_t(0), value_t(0), value_t(0));
         }
@@ -644,17 +645,18 @@ namespace rtm::ext
         qw = move::math::clamp(qw, value_t(-1), value_t(1));
         
         // If quaternion is close to identity, return zero
-        if (abs(qw) >= value_t(1) - epsilon)
+        if (move::math::abs(qw) >= value_t(1) - epsilon)
         {
             return quat_set(value_t(0), value_t(0), value_t(0), value_t(0));
         }
         
-        // Calculate theta = acos(|qw|)
-        value_t theta = acos(abs(qw));
+        // Calculate theta = acos(qw).  Taking |qw| here would drop the sign
+        // of w and break exp(ln(q)) == q for q.w < 0.
+        value_t theta = acos(qw);
         value_t sin_theta = sin(theta);
         
         // If sin(theta) is too small, return zero to avoid division by zero
-        if (abs(sin_theta) < epsilon)
+        if (move::math::abs(sin_theta) < epsilon)
         {
             return quat_set(value_t(0), value_t(0), value_t(0), value_t(0));
         }
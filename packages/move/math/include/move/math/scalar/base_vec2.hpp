@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstring>
 #include <iosfwd>
+#include <type_traits>
 
 #include <move/math/common.hpp>
 #include <move/math/macros.hpp>
@@ -36,19 +37,20 @@ namespace move::math::scalar
 
         // Constructors
     public:
-        MVM_INLINE base_vec2() : x(0), y(0)
+        MVM_INLINE constexpr base_vec2() : x(0), y(0)
         {
         }
 
-        MVM_INLINE base_vec2(const T& x, const T& y) : x(x), y(y)
+        MVM_INLINE constexpr base_vec2(const T& x, const T& y) : x(x), y(y)
         {
         }
 
-        MVM_INLINE base_vec2(const base_vec2& other) : x(other.x), y(other.y)
+        MVM_INLINE constexpr base_vec2(const base_vec2& other) :
+            x(other.x), y(other.y)
         {
         }
 
-        MVM_INLINE base_vec2& operator=(const base_vec2& other)
+        MVM_INLINE constexpr base_vec2& operator=(const base_vec2& other)
         {
             x = other.x;
             y = other.y;
@@ -87,101 +89,109 @@ namespace move::math::scalar
 
         // Arithmetic operators
     public:
-        MVM_INLINE_NODISCARD base_vec2 operator+(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator+(
+            const base_vec2& other) const
         {
             return base_vec2(x + other.x, y + other.y);
         }
 
-        MVM_INLINE_NODISCARD base_vec2 operator-(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator-(
+            const base_vec2& other) const
         {
             return base_vec2(x - other.x, y - other.y);
         }
 
-        MVM_INLINE_NODISCARD base_vec2 operator*(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator*(
+            const base_vec2& other) const
         {
             return base_vec2(x * other.x, y * other.y);
         }
 
-        MVM_INLINE_NODISCARD base_vec2 operator/(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator/(
+            const base_vec2& other) const
         {
             return base_vec2(x / other.x, y / other.y);
         }
 
-        MVM_INLINE_NODISCARD base_vec2 operator+(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator+(
+            const T& scalar) const
         {
             return base_vec2(x + scalar, y + scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec2 operator-(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator-(
+            const T& scalar) const
         {
             return base_vec2(x - scalar, y - scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec2 operator*(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator*(
+            const T& scalar) const
         {
             return base_vec2(x * scalar, y * scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec2 operator/(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator/(
+            const T& scalar) const
         {
             return base_vec2(x / scalar, y / scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec2 operator-() const
+        MVM_INLINE_NODISCARD constexpr base_vec2 operator-() const
         {
             return base_vec2(-x, -y);
         }
 
-        MVM_INLINE base_vec2& operator+=(const base_vec2& other)
+        MVM_INLINE constexpr base_vec2& operator+=(const base_vec2& other)
         {
             x += other.x;
             y += other.y;
             return *this;
         }
 
-        MVM_INLINE base_vec2& operator-=(const base_vec2& other)
+        MVM_INLINE constexpr base_vec2& operator-=(const base_vec2& other)
         {
             x -= other.x;
             y -= other.y;
             return *this;
         }
 
-        MVM_INLINE base_vec2& operator*=(const base_vec2& other)
+        MVM_INLINE constexpr base_vec2& operator*=(const base_vec2& other)
         {
             x *= other.x;
             y *= other.y;
             return *this;
         }
 
-        MVM_INLINE base_vec2& operator/=(const base_vec2& other)
+        MVM_INLINE constexpr base_vec2& operator/=(const base_vec2& other)
         {
             x /= other.x;
             y /= other.y;
             return *this;
         }
 
-        MVM_INLINE base_vec2& operator+=(const T& scalar)
+        MVM_INLINE constexpr base_vec2& operator+=(const T& scalar)
         {
             x += scalar;
             y += scalar;
             return *this;
         }
 
-        MVM_INLINE base_vec2& operator-=(const T& scalar)
+        MVM_INLINE constexpr base_vec2& operator-=(const T& scalar)
         {
             x -= scalar;
             y -= scalar;
             return *this;
         }
 
-        MVM_INLINE base_vec2& operator*=(const T& scalar)
+        MVM_INLINE constexpr base_vec2& operator*=(const T& scalar)
         {
             x *= scalar;
             y *= scalar;
             return *this;
         }
 
-        MVM_INLINE base_vec2& operator/=(const T& scalar)
+        MVM_INLINE constexpr base_vec2& operator/=(const T& scalar)
         {
             x /= scalar;
             y /= scalar;
@@ -206,67 +216,100 @@ namespace move::math::scalar
         // Comparison operators. These are component-wise checks and are not a
         // total ordering.
     public:
-        MVM_INLINE_NODISCARD bool operator<(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator<(
+            const base_vec2& other) const
         {
             return x < other.x && y < other.y;
         }
 
-        MVM_INLINE_NODISCARD bool operator>(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator>(
+            const base_vec2& other) const
         {
             return x > other.x && y > other.y;
         }
 
-        MVM_INLINE_NODISCARD bool operator<=(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator<=(
+            const base_vec2& other) const
         {
             return x <= other.x && y <= other.y;
         }
 
-        MVM_INLINE_NODISCARD bool operator>=(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator>=(
+            const base_vec2& other) const
         {
             return x >= other.x && y >= other.y;
         }
 
-        MVM_INLINE_NODISCARD bool operator==(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator==(
+            const base_vec2& other) const
         {
             return x == other.x && y == other.y;
         }
 
-        MVM_INLINE_NODISCARD bool operator!=(const base_vec2& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator!=(
+            const base_vec2& other) const
         {
             return x != other.x || y != other.y;
         }
 
         // Element access
     public:
-        MVM_INLINE_NODISCARD T& operator[](const size_t& index)
+        MVM_INLINE_NODISCARD constexpr T& operator[](const size_t& index)
         {
             assert(index < element_count);
+            if (std::is_constant_evaluated())
+            {
+                // Only the named fields are active during constant evaluation
+                switch (index)
+                {
+                    case 0:
+                        return x;
+                    case 1:
+                        return y;
+                    default:
+                        return y;
+                }
+            }
             return data[index];
         }
 
-        MVM_INLINE_NODISCARD const T& operator[](const size_t& index) const
+        MVM_INLINE_NODISCARD constexpr const T& operator[](
+            const size_t& index) const
         {
             assert(index < element_count);
+            if (std::is_constant_evaluated())
+            {
+                // Only the named fields are active during constant evaluation
+                switch (index)
+                {
+                    case 0:
+                        return x;
+                    case 1:
+                        return y;
+                    default:
+                        return y;
+                }
+            }
             return data[index];
         }
 
-        MVM_INLINE_NODISCARD T get_x() const
+        MVM_INLINE_NODISCARD constexpr T get_x() const
         {
             return x;
         }
 
-        MVM_INLINE_NODISCARD T get_y() const
+        MVM_INLINE_NODISCARD constexpr T get_y() const
         {
             return y;
         }
 
-        MVM_INLINE base_vec2& set_x(const T& x)
+        MVM_INLINE constexpr base_vec2& set_x(const T& x)
         {
             this->x = x;
             return *this;
         }
 
-        MVM_INLINE base_vec2& set_y(const T& y)
+        MVM_INLINE constexpr base_vec2& set_y(const T& y)
         {
             this->y = y;
             return *this;
@@ -299,7 +342,7 @@ namespace move::math::scalar
             return sqrt<T>(length_squared());
         }
 
-        MVM_INLINE_NODISCARD T length_squared() const
+        MVM_INLINE_NODISCARD constexpr T length_squared() const
         {
             return x * x + y * y;
         }
@@ -314,19 +357,123 @@ namespace move::math::scalar
             return *this / length();
         }
 
-        MVM_INLINE_NODISCARD T aspect_ratio() const
+        MVM_INLINE_NODISCARD constexpr T aspect_ratio() const
         {
             return x / y;
         }
 
         // Static functions
     public:
-        MVM_INLINE_NODISCARD static T dot(const base_vec2& lhs,
-                                          const base_vec2& rhs)
+        MVM_INLINE_NODISCARD constexpr static T dot(const base_vec2& lhs,
+                                                    const base_vec2& rhs)
         {
             return lhs.x * rhs.x + lhs.y * rhs.y;
         }
 
+        /**
+         * @brief Returns `v1 * v2 + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec2 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec2 mul_add(
+            const base_vec2& v1,
+            const base_vec2& v2,
+            const base_vec2& v3) noexcept
+        {
+            return base_vec2(math::mul_add(v1.x, v2.x, v3.x),
+                             math::mul_add(v1.y, v2.y, v3.y));
+        }
+
+        /**
+         * @brief Returns `v1 * s + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec2 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec2 mul_add(
+            const base_vec2& v1,
+            const T& s,
+            const base_vec2& v3) noexcept
+        {
+            return base_vec2(math::mul_add(v1.x, s, v3.x),
+                             math::mul_add(v1.y, s, v3.y));
+        }
+
+        /**
+         * @brief Returns `v1 * v2 - v3` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec2 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec2 mul_sub(
+            const base_vec2& v1,
+            const base_vec2& v2,
+            const base_vec2& v3) noexcept
+        {
+            return base_vec2(math::mul_sub(v1.x, v2.x, v3.x),
+                             math::mul_sub(v1.y, v2.y, v3.y));
+        }
+
+        /**
+         * @brief Returns `v1 * s - v3` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec2 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec2 mul_sub(
+            const base_vec2& v1,
+            const T& s,
+            const base_vec2& v3) noexcept
+        {
+            return base_vec2(math::mul_sub(v1.x, s, v3.x),
+                             math::mul_sub(v1.y, s, v3.y));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * v2` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec2 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec2 neg_mul_sub(
+            const base_vec2& v1,
+            const base_vec2& v2,
+            const base_vec2& v3) noexcept
+        {
+            return base_vec2(math::neg_mul_sub(v1.x, v2.x, v3.x),
+                             math::neg_mul_sub(v1.y, v2.y, v3.y));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * s` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec2 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec2 neg_mul_sub(
+            const base_vec2& v1,
+            const T& s,
+            const base_vec2& v3) noexcept
+        {
+            return base_vec2(math::neg_mul_sub(v1.x, s, v3.x),
+                             math::neg_mul_sub(v1.y, s, v3.y));
+        }
+
         // Mutators
     public:
         MVM_INLINE base_vec2& normalize()
@@ -335,21 +482,21 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec2& fill(const T& value)
+        MVM_INLINE constexpr base_vec2& fill(const T& value)
         {
             set_x(value);
             set_y(value);
             return *this;
         }
 
-        MVM_INLINE base_vec2& set(const T& x, const T& y)
+        MVM_INLINE constexpr base_vec2& set(const T& x, const T& y)
         {
             set_x(x);
             set_y(y);
             return *this;
         }
 
-        MVM_INLINE base_vec2& set_zero()
+        MVM_INLINE constexpr base_vec2& set_zero()
         {
             return fill(0);
         }
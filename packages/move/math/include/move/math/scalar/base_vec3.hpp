@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cstddef>
 #include <iosfwd>
+#include <type_traits>
 
 #include <move/math/common.hpp>
 #include <move/math/macros.hpp>
@@ -35,21 +36,21 @@ namespace move::math::scalar
 
         // Constructors
     public:
-        MVM_INLINE base_vec3() : x(0), y(0), z(0)
+        MVM_INLINE constexpr base_vec3() : x(0), y(0), z(0)
         {
         }
 
-        MVM_INLINE base_vec3(const T& x, const T& y, const T& z) :
+        MVM_INLINE constexpr base_vec3(const T& x, const T& y, const T& z) :
             x(x), y(y), z(z)
         {
         }
 
-        MVM_INLINE base_vec3(const base_vec3& other) :
+        MVM_INLINE constexpr base_vec3(const base_vec3& other) :
             x(other.x), y(other.y), z(other.z)
         {
         }
 
-        MVM_INLINE base_vec3& operator=(const base_vec3& other)
+        MVM_INLINE constexpr base_vec3& operator=(const base_vec3& other)
         {
             x = other.x;
             y = other.y;
@@ -89,52 +90,60 @@ namespace move::math::scalar
 
         // Arithmetic operators
     public:
-        MVM_INLINE_NODISCARD base_vec3 operator+(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator+(
+            const base_vec3& other) const
         {
             return base_vec3(x + other.x, y + other.y, z + other.z);
         }
 
-        MVM_INLINE_NODISCARD base_vec3 operator-(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator-(
+            const base_vec3& other) const
         {
             return base_vec3(x - other.x, y - other.y, z - other.z);
         }
 
-        MVM_INLINE_NODISCARD base_vec3 operator*(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator*(
+            const base_vec3& other) const
         {
             return base_vec3(x * other.x, y * other.y, z * other.z);
         }
 
-        MVM_INLINE_NODISCARD base_vec3 operator/(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator/(
+            const base_vec3& other) const
         {
             return base_vec3(x / other.x, y / other.y, z / other.z);
         }
 
-        MVM_INLINE_NODISCARD base_vec3 operator+(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator+(
+            const T& scalar) const
         {
             return base_vec3(x + scalar, y + scalar, z + scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec3 operator-(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator-(
+            const T& scalar) const
         {
             return base_vec3(x - scalar, y - scalar, z - scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec3 operator*(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator*(
+            const T& scalar) const
         {
             return base_vec3(x * scalar, y * scalar, z * scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec3 operator/(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator/(
+            const T& scalar) const
         {
             return base_vec3(x / scalar, y / scalar, z / scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec3 operator-() const
+        MVM_INLINE_NODISCARD constexpr base_vec3 operator-() const
         {
             return base_vec3(-x, -y, -z);
         }
 
-        MVM_INLINE base_vec3& operator+=(const base_vec3& other)
+        MVM_INLINE constexpr base_vec3& operator+=(const base_vec3& other)
         {
             x += other.x;
             y += other.y;
@@ -142,7 +151,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& operator-=(const base_vec3& other)
+        MVM_INLINE constexpr base_vec3& operator-=(const base_vec3& other)
         {
             x -= other.x;
             y -= other.y;
@@ -150,7 +159,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& operator*=(const base_vec3& other)
+        MVM_INLINE constexpr base_vec3& operator*=(const base_vec3& other)
         {
             x *= other.x;
             y *= other.y;
@@ -158,7 +167,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& operator/=(const base_vec3& other)
+        MVM_INLINE constexpr base_vec3& operator/=(const base_vec3& other)
         {
             x /= other.x;
             y /= other.y;
@@ -166,7 +175,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& operator+=(const T& scalar)
+        MVM_INLINE constexpr base_vec3& operator+=(const T& scalar)
         {
             x += scalar;
             y += scalar;
@@ -174,7 +183,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& operator-=(const T& scalar)
+        MVM_INLINE constexpr base_vec3& operator-=(const T& scalar)
         {
             x -= scalar;
             y -= scalar;
@@ -182,7 +191,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& operator*=(const T& scalar)
+        MVM_INLINE constexpr base_vec3& operator*=(const T& scalar)
         {
             x *= scalar;
             y *= scalar;
@@ -190,7 +199,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& operator/=(const T& scalar)
+        MVM_INLINE constexpr base_vec3& operator/=(const T& scalar)
         {
             x /= scalar;
             y /= scalar;
@@ -216,76 +225,113 @@ namespace move::math::scalar
         // Comparison operators. These are component-wise checks and are not a
         // total ordering.
     public:
-        MVM_INLINE_NODISCARD bool operator<(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator<(
+            const base_vec3& other) const
         {
             return x < other.x && y < other.y && z < other.z;
         }
 
-        MVM_INLINE_NODISCARD bool operator>(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator>(
+            const base_vec3& other) const
         {
             return x > other.x && y > other.y && z > other.z;
         }
 
-        MVM_INLINE_NODISCARD bool operator<=(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator<=(
+            const base_vec3& other) const
         {
             return x <= other.x && y <= other.y && z <= other.z;
         }
 
-        MVM_INLINE_NODISCARD bool operator>=(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator>=(
+            const base_vec3& other) const
         {
             return x >= other.x && y >= other.y && z >= other.z;
         }
 
-        MVM_INLINE_NODISCARD bool operator==(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator==(
+            const base_vec3& other) const
         {
             return x == other.x && y == other.y && z == other.z;
         }
 
-        MVM_INLINE_NODISCARD bool operator!=(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator!=(
+            const base_vec3& other) const
         {
             return x != other.x || y != other.y || z != other.z;
         }
 
         // Element access
     public:
-        MVM_INLINE_NODISCARD T& operator[](const std::size_t index)
+        MVM_INLINE_NODISCARD constexpr T& operator[](const std::size_t index)
         {
             assert(index < element_count);
+            if (std::is_constant_evaluated())
+            {
+                // Only the named fields are active during constant evaluation
+                switch (index)
+                {
+                    case 0:
+                        return x;
+                    case 1:
+                        return y;
+                    case 2:
+                        return z;
+                    default:
+                        return z;
+                }
+            }
             return data[index];
         }
 
-        MVM_INLINE_NODISCARD const T& operator[](const std::size_t index) const
+        MVM_INLINE_NODISCARD constexpr const T& operator[](
+            const std::size_t index) const
         {
             assert(index < element_count);
+            if (std::is_constant_evaluated())
+            {
+                // Only the named fields are active during constant evaluation
+                switch (index)
+                {
+                    case 0:
+                        return x;
+                    case 1:
+                        return y;
+                    case 2:
+                        return z;
+                    default:
+                        return z;
+                }
+            }
             return data[index];
         }
 
-        MVM_INLINE_NODISCARD T get_x() const
+        MVM_INLINE_NODISCARD constexpr T get_x() const
         {
             return x;
         }
 
-        MVM_INLINE_NODISCARD T get_y() const
+        MVM_INLINE_NODISCARD constexpr T get_y() const
         {
             return y;
         }
 
-        MVM_INLINE_NODISCARD T get_z() const
+        MVM_INLINE_NODISCARD constexpr T get_z() const
         {
             return z;
         }
 
-        MVM_INLINE void set_x(const T& value)
+        MVM_INLINE constexpr void set_x(const T& value)
         {
             x = value;
         }
 
-        MVM_INLINE void set_y(const T& value)
+        MVM_INLINE constexpr void set_y(const T& value)
         {
             y = value;
         }
 
-        MVM_INLINE void set_z(const T& value)
+        MVM_INLINE constexpr void set_z(const T& value)
         {
             z = value;
         }
@@ -306,7 +352,7 @@ namespace move::math::scalar
             return math::sqrt(length_squared());
         }
 
-        MVM_INLINE_NODISCARD T length_squared() const
+        MVM_INLINE_NODISCARD constexpr T length_squared() const
         {
             return x * x + y * y + z * z;
         }
@@ -326,7 +372,8 @@ namespace move::math::scalar
             return (*this - other).length();
         }
 
-        MVM_INLINE_NODISCARD T distance_squared(const base_vec3& other) const
+        MVM_INLINE_NODISCARD constexpr T distance_squared(
+            const base_vec3& other) const
         {
             return (*this - other).length_squared();
         }
@@ -339,13 +386,13 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& fill(const T& val)
+        MVM_INLINE constexpr base_vec3& fill(const T& val)
         {
             x = y = z = val;
             return *this;
         }
 
-        MVM_INLINE base_vec3& set(const T& x, const T& y, const T& z)
+        MVM_INLINE constexpr base_vec3& set(const T& x, const T& y, const T& z)
         {
             this->x = x;
             this->y = y;
@@ -353,7 +400,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec3& set_zero()
+        MVM_INLINE constexpr base_vec3& set_zero()
         {
             return fill(0);
         }
@@ -368,8 +415,8 @@ namespace move::math::scalar
          * @param v2 The second vector
          * @return T The dot product
          */
-        MVM_INLINE_NODISCARD static T dot(const base_vec3& v1,
-                                          const base_vec3& v2) noexcept
+        MVM_INLINE_NODISCARD constexpr static T dot(
+            const base_vec3& v1, const base_vec3& v2) noexcept
         {
             return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
         }
@@ -382,7 +429,7 @@ namespace move::math::scalar
          * @param v2 The second vector
          * @return base_vec3 The cross product
          */
-        MVM_INLINE_NODISCARD static base_vec3 cross(
+        MVM_INLINE_NODISCARD constexpr static base_vec3 cross(
             const base_vec3& v1, const base_vec3& v2) noexcept
         {
             return {T(v1.y * v2.z - v1.z * v2.y), T(v1.z * v2.x - v1.x * v2.z),
@@ -408,7 +455,7 @@ namespace move::math::scalar
          * @param p1 The first point
          * @param p2 The second point
          */
-        MVM_INLINE_NODISCARD static T distance_between_points_squared(
+        MVM_INLINE_NODISCARD constexpr static T distance_between_points_squared(
             const base_vec3& p1, const base_vec3& p2) noexcept
         {
             return (p1 - p2).length_squared();
@@ -448,7 +495,7 @@ namespace move::math::scalar
          * @param incident The incident vector
          * @param normal The normal vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 reflect(
+        MVM_INLINE_NODISCARD constexpr static base_vec3 reflect(
             const base_vec3& incident, const base_vec3& normal) noexcept
         {
             // Based on XMVector3Reflect
@@ -457,9 +504,7 @@ namespace move::math::scalar
 
             auto dot_incnrm = dot(inc, nrm);
             auto dot2 = dot_incnrm + dot_incnrm;
-            auto mul = nrm * dot2;
-            auto res = inc - mul;
-            return res;
+            return neg_mul_sub(nrm, dot2, inc);
         }
 
         /**
@@ -486,7 +531,7 @@ namespace move::math::scalar
          * @param t The interpolation value
          * @return base_vec3 The result of the interpolation
          */
-        MVM_INLINE_NODISCARD static base_vec3 lerp_unclamped(
+        MVM_INLINE_NODISCARD constexpr static base_vec3 lerp_unclamped(
             const base_vec3& v1, const base_vec3& v2, T t) noexcept
         {
             // Compute the clamp once
@@ -505,7 +550,7 @@ namespace move::math::scalar
          * @param t The interpolation values
          * @return base_vec3 The result of the interpolation
          */
-        MVM_INLINE_NODISCARD static base_vec3 lerp_unclamped(
+        MVM_INLINE_NODISCARD constexpr static base_vec3 lerp_unclamped(
             const base_vec3& v1,
             const base_vec3& v2,
             const base_vec3& t) noexcept
@@ -525,9 +570,8 @@ namespace move::math::scalar
          * @param t The interpolation value
          * @return base_vec3 The result of the interpolation
          */
-        MVM_INLINE_NODISCARD static base_vec3 lerp(const base_vec3& v1,
-                                                   const base_vec3& v2,
-                                                   T t) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 lerp(
+            const base_vec3& v1, const base_vec3& v2, T t) noexcept
         {
             return base_vec3(math::lerp(v1.x, v2.x, t),
                              math::lerp(v1.y, v2.y, t),
@@ -544,15 +588,120 @@ namespace move::math::scalar
          * @param t The interpolation values
          * @return base_vec3 The result of the interpolation
          */
-        MVM_INLINE_NODISCARD static base_vec3 lerp(const base_vec3& v1,
-                                                   const base_vec3& v2,
-                                                   const base_vec3& t) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 lerp(
+            const base_vec3& v1,
+            const base_vec3& v2,
+            const base_vec3& t) noexcept
         {
             return base_vec3(math::lerp(v1.x, v2.x, t.x),
                              math::lerp(v1.y, v2.y, t.y),
                              math::lerp(v1.z, v2.z, t.z));
         }
 
+        /**
+         * @brief Returns `v1 * v2 + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec3 mul_add(
+            const base_vec3& v1,
+            const base_vec3& v2,
+            const base_vec3& v3) noexcept
+        {
+            return base_vec3(math::mul_add(v1.x, v2.x, v3.x),
+                             math::mul_add(v1.y, v2.y, v3.y),
+                             math::mul_add(v1.z, v2.z, v3.z));
+        }
+
+        /**
+         * @brief Returns `v1 * s + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec3 mul_add(
+            const base_vec3& v1, const T& s, const base_vec3& v3) noexcept
+        {
+            return base_vec3(math::mul_add(v1.x, s, v3.x),
+                             math::mul_add(v1.y, s, v3.y),
+                             math::mul_add(v1.z, s, v3.z));
+        }
+
+        /**
+         * @brief Returns `v1 * v2 - v3` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec3 mul_sub(
+            const base_vec3& v1,
+            const base_vec3& v2,
+            const base_vec3& v3) noexcept
+        {
+            return base_vec3(math::mul_sub(v1.x, v2.x, v3.x),
+                             math::mul_sub(v1.y, v2.y, v3.y),
+                             math::mul_sub(v1.z, v2.z, v3.z));
+        }
+
+        /**
+         * @brief Returns `v1 * s - v3` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec3 mul_sub(
+            const base_vec3& v1, const T& s, const base_vec3& v3) noexcept
+        {
+            return base_vec3(math::mul_sub(v1.x, s, v3.x),
+                             math::mul_sub(v1.y, s, v3.y),
+                             math::mul_sub(v1.z, s, v3.z));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * v2` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec3 neg_mul_sub(
+            const base_vec3& v1,
+            const base_vec3& v2,
+            const base_vec3& v3) noexcept
+        {
+            return base_vec3(math::neg_mul_sub(v1.x, v2.x, v3.x),
+                             math::neg_mul_sub(v1.y, v2.y, v3.y),
+                             math::neg_mul_sub(v1.z, v2.z, v3.z));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * s` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec3 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec3 neg_mul_sub(
+            const base_vec3& v1, const T& s, const base_vec3& v3) noexcept
+        {
+            return base_vec3(math::neg_mul_sub(v1.x, s, v3.x),
+                             math::neg_mul_sub(v1.y, s, v3.y),
+                             math::neg_mul_sub(v1.z, s, v3.z));
+        }
+
         /**
          * @brief Returns a vector containing the minimum x, y, z, and w
          * components of the two vectors.
@@ -561,8 +710,8 @@ namespace move::math::scalar
          * @param v2 The second vector
          * @return base_vec3 The minimum vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 min(const base_vec3& v1,
-                                                  const base_vec3& v2) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 min(
+            const base_vec3& v1, const base_vec3& v2) noexcept
         {
             return base_vec3(math::min(v1.x, v2.x), math::min(v1.y, v2.y),
                              math::min(v1.z, v2.z));
@@ -576,8 +725,8 @@ namespace move::math::scalar
          * @param v2 The second vector
          * @return base_vec3 The maximum vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 max(const base_vec3& v1,
-                                                  const base_vec3& v2) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 max(
+            const base_vec3& v1, const base_vec3& v2) noexcept
         {
             return base_vec3(math::max(v1.x, v2.x), math::max(v1.y, v2.y),
                              math::max(v1.z, v2.z));
@@ -592,7 +741,7 @@ namespace move::math::scalar
          * @param max The maximum vector
          * @return base_vec3 The clamped vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 clamp(
+        MVM_INLINE_NODISCARD constexpr static base_vec3 clamp(
             const base_vec3& v,
             const base_vec3& min,
             const base_vec3& max) noexcept
@@ -611,9 +760,8 @@ namespace move::math::scalar
          * @param max The maximum scalar
          * @return base_vec3 The clamped vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 clamp(const base_vec3& v,
-                                                    const T& min,
-                                                    const T& max) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 clamp(
+            const base_vec3& v, const T& min, const T& max) noexcept
         {
             return base_vec3(math::clamp(v.x, min, max),
                              math::clamp(v.y, min, max),
@@ -629,7 +777,7 @@ namespace move::math::scalar
          * @param value The value to fill the vector with
          * @return base_vec3 The filled vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 filled(T value) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 filled(T value) noexcept
         {
             return base_vec3(value, value, value);
         }
@@ -639,7 +787,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The infinity vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 infinity() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 infinity() noexcept
         {
             return filled(std::numeric_limits<T>::infinity());
         }
@@ -650,7 +798,8 @@ namespace move::math::scalar
          *
          * @return base_vec3 The negative infinity vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 negative_infinity() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3
+        negative_infinity() noexcept
         {
             return filled(-std::numeric_limits<T>::infinity());
         }
@@ -660,7 +809,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The NaN vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 nan() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 nan() noexcept
         {
             return filled(std::numeric_limits<T>::quiet_NaN());
         }
@@ -670,7 +819,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The zero vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 zero() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 zero() noexcept
         {
             return filled(0);
         }
@@ -680,7 +829,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The one vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 one() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 one() noexcept
         {
             return filled(1);
         }
@@ -691,7 +840,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The x axis vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 x_axis() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 x_axis() noexcept
         {
             return base_vec3(1, 0, 0);
         }
@@ -702,7 +851,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The y axis vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 y_axis() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 y_axis() noexcept
         {
             return base_vec3(0, 1, 0);
         }
@@ -713,7 +862,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The z axis vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 z_axis() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 z_axis() noexcept
         {
             return base_vec3(0, 0, 1);
         }
@@ -724,7 +873,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The left vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 left() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 left() noexcept
         {
             return -x_axis();
         }
@@ -735,7 +884,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The right vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 right() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 right() noexcept
         {
             return x_axis();
         }
@@ -746,7 +895,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The down vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 down() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 down() noexcept
         {
             return -y_axis();
         }
@@ -757,7 +906,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The up vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 up() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 up() noexcept
         {
             return y_axis();
         }
@@ -768,7 +917,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The back vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 backward() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 backward() noexcept
         {
             return -z_axis();
         }
@@ -779,7 +928,7 @@ namespace move::math::scalar
          *
          * @return base_vec3 The forward vector
          */
-        MVM_INLINE_NODISCARD static base_vec3 forward() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 forward() noexcept
         {
             return z_axis();
         }
@@ -790,7 +939,8 @@ namespace move::math::scalar
          * @param v The input vector
          * @return base_vec3 The vector with absolute values
          */
-        MVM_INLINE_NODISCARD static base_vec3 abs(const base_vec3& v) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 abs(
+            const base_vec3& v) noexcept
         {
             return base_vec3(math::abs(v.x), math::abs(v.y), math::abs(v.z));
         }
@@ -801,7 +951,8 @@ namespace move::math::scalar
          * @param v The input vector
          * @return base_vec3 The vector with component signs (-1, 0, or 1)
          */
-        MVM_INLINE_NODISCARD static base_vec3 sign(const base_vec3& v) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec3 sign(
+            const base_vec3& v) noexcept
         {
             return base_vec3(math::sign(v.x), math::sign(v.y), math::sign(v.z));
         }
@@ -813,14 +964,13 @@ namespace move::math::scalar
          * @param plane_normal The normal vector of the plane (should be normalized)
          * @return base_vec3 The projection of v onto the plane
          */
-        MVM_INLINE_NODISCARD static base_vec3 project_onto_plane(
+        MVM_INLINE_NODISCARD constexpr static base_vec3 project_onto_plane(
             const base_vec3& v, const base_vec3& plane_normal) noexcept
         {
             // Project v onto the plane by subtracting the component parallel to the normal
             // projection = v - (v · n) * n
             auto dot_vn = dot(v, plane_normal);
-            auto parallel_component = plane_normal * dot_vn;
-            return v - parallel_component;
+            return neg_mul_sub(plane_normal, dot_vn, v);
         }
     };
 }  // namespace move::math::scalar
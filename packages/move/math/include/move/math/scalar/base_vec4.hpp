@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cstddef>
 #include <iosfwd>
+#include <type_traits>
 
 #include <move/math/common.hpp>
 #include <move/math/macros.hpp>
@@ -35,21 +36,24 @@ namespace move::math::scalar
 
         // Constructors
     public:
-        MVM_INLINE base_vec4() : x(0), y(0), z(0), w(0)
+        MVM_INLINE constexpr base_vec4() : x(0), y(0), z(0), w(0)
         {
         }
 
-        MVM_INLINE base_vec4(const T& x, const T& y, const T& z, const T& w) :
+        MVM_INLINE constexpr base_vec4(const T& x,
+                                       const T& y,
+                                       const T& z,
+                                       const T& w) :
             x(x), y(y), z(z), w(w)
         {
         }
 
-        MVM_INLINE base_vec4(const base_vec4& other) :
+        MVM_INLINE constexpr base_vec4(const base_vec4& other) :
             x(other.x), y(other.y), z(other.z), w(other.w)
         {
         }
 
-        MVM_INLINE base_vec4& operator=(const base_vec4& other)
+        MVM_INLINE constexpr base_vec4& operator=(const base_vec4& other)
         {
             x = other.x;
             y = other.y;
@@ -90,56 +94,64 @@ namespace move::math::scalar
 
         // Arithmetic operators
     public:
-        MVM_INLINE_NODISCARD base_vec4 operator+(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator+(
+            const base_vec4& other) const
         {
             return base_vec4(x + other.x, y + other.y, z + other.z,
                              w + other.w);
         }
 
-        MVM_INLINE_NODISCARD base_vec4 operator-(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator-(
+            const base_vec4& other) const
         {
             return base_vec4(x - other.x, y - other.y, z - other.z,
                              w - other.w);
         }
 
-        MVM_INLINE_NODISCARD base_vec4 operator*(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator*(
+            const base_vec4& other) const
         {
             return base_vec4(x * other.x, y * other.y, z * other.z,
                              w * other.w);
         }
 
-        MVM_INLINE_NODISCARD base_vec4 operator/(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator/(
+            const base_vec4& other) const
         {
             return base_vec4(x / other.x, y / other.y, z / other.z,
                              w / other.w);
         }
 
-        MVM_INLINE_NODISCARD base_vec4 operator+(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator+(
+            const T& scalar) const
         {
             return base_vec4(x + scalar, y + scalar, z + scalar, w + scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec4 operator-(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator-(
+            const T& scalar) const
         {
             return base_vec4(x - scalar, y - scalar, z - scalar, w - scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec4 operator*(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator*(
+            const T& scalar) const
         {
             return base_vec4(x * scalar, y * scalar, z * scalar, w * scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec4 operator/(const T& scalar) const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator/(
+            const T& scalar) const
         {
             return base_vec4(x / scalar, y / scalar, z / scalar, w / scalar);
         }
 
-        MVM_INLINE_NODISCARD base_vec4 operator-() const
+        MVM_INLINE_NODISCARD constexpr base_vec4 operator-() const
         {
             return base_vec4(-x, -y, -z, -w);
         }
 
-        MVM_INLINE base_vec4& operator+=(const base_vec4& other)
+        MVM_INLINE constexpr base_vec4& operator+=(const base_vec4& other)
         {
             x += other.x;
             y += other.y;
@@ -148,7 +160,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& operator-=(const base_vec4& other)
+        MVM_INLINE constexpr base_vec4& operator-=(const base_vec4& other)
         {
             x -= other.x;
             y -= other.y;
@@ -157,7 +169,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& operator*=(const base_vec4& other)
+        MVM_INLINE constexpr base_vec4& operator*=(const base_vec4& other)
         {
             x *= other.x;
             y *= other.y;
@@ -166,7 +178,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& operator/=(const base_vec4& other)
+        MVM_INLINE constexpr base_vec4& operator/=(const base_vec4& other)
         {
             x /= other.x;
             y /= other.y;
@@ -175,7 +187,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& operator+=(const T& scalar)
+        MVM_INLINE constexpr base_vec4& operator+=(const T& scalar)
         {
             x += scalar;
             y += scalar;
@@ -184,7 +196,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& operator-=(const T& scalar)
+        MVM_INLINE constexpr base_vec4& operator-=(const T& scalar)
         {
             x -= scalar;
             y -= scalar;
@@ -193,7 +205,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& operator*=(const T& scalar)
+        MVM_INLINE constexpr base_vec4& operator*=(const T& scalar)
         {
             x *= scalar;
             y *= scalar;
@@ -202,7 +214,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& operator/=(const T& scalar)
+        MVM_INLINE constexpr base_vec4& operator/=(const T& scalar)
         {
             x /= scalar;
             y /= scalar;
@@ -230,86 +242,127 @@ namespace move::math::scalar
         // Comparison operators. These are component-wise checks and are not a
         // total ordering.
     public:
-        MVM_INLINE_NODISCARD bool operator<(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator<(
+            const base_vec4& other) const
         {
             return x < other.x && y < other.y && z < other.z && w < other.w;
         }
 
-        MVM_INLINE_NODISCARD bool operator>(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator>(
+            const base_vec4& other) const
         {
             return x > other.x && y > other.y && z > other.z && w > other.w;
         }
 
-        MVM_INLINE_NODISCARD bool operator<=(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator<=(
+            const base_vec4& other) const
         {
             return x <= other.x && y <= other.y && z <= other.z && w <= other.w;
         }
 
-        MVM_INLINE_NODISCARD bool operator>=(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator>=(
+            const base_vec4& other) const
         {
             return x >= other.x && y >= other.y && z >= other.z && w >= other.w;
         }
 
-        MVM_INLINE_NODISCARD bool operator==(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator==(
+            const base_vec4& other) const
         {
             return x == other.x && y == other.y && z == other.z && w == other.w;
         }
 
-        MVM_INLINE_NODISCARD bool operator!=(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr bool operator!=(
+            const base_vec4& other) const
         {
             return x != other.x || y != other.y || z != other.z || w != other.w;
         }
 
         // Element access
     public:
-        MVM_INLINE_NODISCARD T& operator[](const std::size_t index)
+        MVM_INLINE_NODISCARD constexpr T& operator[](const std::size_t index)
         {
             assert(index < element_count);
+            if (std::is_constant_evaluated())
+            {
+                // Only the named fields are active during constant evaluation
+                switch (index)
+                {
+                    case 0:
+                        return x;
+                    case 1:
+                        return y;
+                    case 2:
+                        return z;
+                    case 3:
+                        return w;
+                    default:
+                        return w;
+                }
+            }
             return data[index];
         }
 
-        MVM_INLINE_NODISCARD const T& operator[](const std::size_t index) const
+        MVM_INLINE_NODISCARD constexpr const T& operator[](
+            const std::size_t index) const
         {
             assert(index < element_count);
+            if (std::is_constant_evaluated())
+            {
+                // Only the named fields are active during constant evaluation
+                switch (index)
+                {
+                    case 0:
+                        return x;
+                    case 1:
+                        return y;
+                    case 2:
+                        return z;
+                    case 3:
+                        return w;
+                    default:
+                        return w;
+                }
+            }
             return data[index];
         }
 
-        MVM_INLINE_NODISCARD T get_x() const
+        MVM_INLINE_NODISCARD constexpr T get_x() const
         {
             return x;
         }
 
-        MVM_INLINE_NODISCARD T get_y() const
+        MVM_INLINE_NODISCARD constexpr T get_y() const
         {
             return y;
         }
 
-        MVM_INLINE_NODISCARD T get_z() const
+        MVM_INLINE_NODISCARD constexpr T get_z() const
         {
             return z;
         }
 
-        MVM_INLINE_NODISCARD T get_w() const
+        MVM_INLINE_NODISCARD constexpr T get_w() const
         {
             return w;
         }
 
-        MVM_INLINE void set_x(const T& value)
+        MVM_INLINE constexpr void set_x(const T& value)
         {
             x = value;
         }
 
-        MVM_INLINE void set_y(const T& value)
+        MVM_INLINE constexpr void set_y(const T& value)
         {
             y = value;
         }
 
-        MVM_INLINE void set_z(const T& value)
+        MVM_INLINE constexpr void set_z(const T& value)
         {
             z = value;
         }
 
-        MVM_INLINE void set_w(const T& value)
+        MVM_INLINE constexpr void set_w(const T& value)
         {
             w = value;
         }
@@ -330,7 +383,7 @@ namespace move::math::scalar
             return math::sqrt(length_squared());
         }
 
-        MVM_INLINE_NODISCARD T length_squared() const
+        MVM_INLINE_NODISCARD constexpr T length_squared() const
         {
             return x * x + y * y + z * z + w * w;
         }
@@ -350,7 +403,8 @@ namespace move::math::scalar
             return (*this - other).length();
         }
 
-        MVM_INLINE_NODISCARD T distance_squared(const base_vec4& other) const
+        MVM_INLINE_NODISCARD constexpr T distance_squared(
+            const base_vec4& other) const
         {
             return (*this - other).length_squared();
         }
@@ -363,16 +417,16 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& fill(const T& val)
+        MVM_INLINE constexpr base_vec4& fill(const T& val)
         {
             x = y = z = w = val;
             return *this;
         }
 
-        MVM_INLINE base_vec4& set(const T& x,
-                                  const T& y,
-                                  const T& z,
-                                  const T& w)
+        MVM_INLINE constexpr base_vec4& set(const T& x,
+                                            const T& y,
+                                            const T& z,
+                                            const T& w)
         {
             this->x = x;
             this->y = y;
@@ -381,7 +435,7 @@ namespace move::math::scalar
             return *this;
         }
 
-        MVM_INLINE base_vec4& set_zero()
+        MVM_INLINE constexpr base_vec4& set_zero()
         {
             return fill(0);
         }
@@ -396,8 +450,8 @@ namespace move::math::scalar
          * @param v2 The second vector
          * @return T The dot product
          */
-        MVM_INLINE_NODISCARD static T dot(const base_vec4& v1,
-                                          const base_vec4& v2) noexcept
+        MVM_INLINE_NODISCARD constexpr static T dot(
+            const base_vec4& v1, const base_vec4& v2) noexcept
         {
             return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
         }
@@ -411,7 +465,7 @@ namespace move::math::scalar
          * @param v3 The third vector
          * @return base_vec4 The cross product
          */
-        MVM_INLINE_NODISCARD static base_vec4 cross(
+        MVM_INLINE_NODISCARD constexpr static base_vec4 cross(
             const base_vec4& v1,
             const base_vec4& v2,
             const base_vec4& v3) noexcept
@@ -491,7 +545,7 @@ namespace move::math::scalar
          * @param p1 The first point
          * @param p2 The second point
          */
-        MVM_INLINE_NODISCARD static T distance_between_points_squared(
+        MVM_INLINE_NODISCARD constexpr static T distance_between_points_squared(
             const base_vec4& p1, const base_vec4& p2) noexcept
         {
             return (p1 - p2).length_squared();
@@ -531,13 +585,12 @@ namespace move::math::scalar
          * @param incident The incident vector
          * @param normal The normal vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 reflect(
+        MVM_INLINE_NODISCARD constexpr static base_vec4 reflect(
             const base_vec4& incident, const base_vec4& normal) noexcept
         {
             auto dot = base_vec4::dot(incident, normal);
             auto dot2 = dot + dot;
-            auto mul = normal * dot2;
-            return incident - mul;
+            return neg_mul_sub(normal, dot2, incident);
         }
 
         /**
@@ -564,7 +617,7 @@ namespace move::math::scalar
          * @param t The interpolation value
          * @return base_vec4 The result of the interpolation
          */
-        MVM_INLINE_NODISCARD static base_vec4 lerp_unclamped(
+        MVM_INLINE_NODISCARD constexpr static base_vec4 lerp_unclamped(
             const base_vec4& v1, const base_vec4& v2, T t) noexcept
         {
             // Compute the clamp once
@@ -584,7 +637,7 @@ namespace move::math::scalar
          * @param t The interpolation values
          * @return base_vec4 The result of the interpolation
          */
-        MVM_INLINE_NODISCARD static base_vec4 lerp_unclamped(
+        MVM_INLINE_NODISCARD constexpr static base_vec4 lerp_unclamped(
             const base_vec4& v1,
             const base_vec4& v2,
             const base_vec4& t) noexcept
@@ -605,9 +658,8 @@ namespace move::math::scalar
          * @param t The interpolation value
          * @return base_vec4 The result of the interpolation
          */
-        MVM_INLINE_NODISCARD static base_vec4 lerp(const base_vec4& v1,
-                                                   const base_vec4& v2,
-                                                   T t) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 lerp(
+            const base_vec4& v1, const base_vec4& v2, T t) noexcept
         {
             return base_vec4(math::lerp(v1.x, v2.x, t),
                              math::lerp(v1.y, v2.y, t),
@@ -625,15 +677,126 @@ namespace move::math::scalar
          * @param t The interpolation values
          * @return base_vec4 The result of the interpolation
          */
-        MVM_INLINE_NODISCARD static base_vec4 lerp(const base_vec4& v1,
-                                                   const base_vec4& v2,
-                                                   const base_vec4& t) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 lerp(
+            const base_vec4& v1,
+            const base_vec4& v2,
+            const base_vec4& t) noexcept
         {
             return base_vec4(
                 math::lerp(v1.x, v2.x, t.x), math::lerp(v1.y, v2.y, t.y),
                 math::lerp(v1.z, v2.z, t.z), math::lerp(v1.w, v2.w, t.w));
         }
 
+        /**
+         * @brief Returns `v1 * v2 + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec4 mul_add(
+            const base_vec4& v1,
+            const base_vec4& v2,
+            const base_vec4& v3) noexcept
+        {
+            return base_vec4(math::mul_add(v1.x, v2.x, v3.x),
+                             math::mul_add(v1.y, v2.y, v3.y),
+                             math::mul_add(v1.z, v2.z, v3.z),
+                             math::mul_add(v1.w, v2.w, v3.w));
+        }
+
+        /**
+         * @brief Returns `v1 * s + v3` component-wise, fused into a single
+         * rounding where the target supports it.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec4 mul_add(
+            const base_vec4& v1, const T& s, const base_vec4& v3) noexcept
+        {
+            return base_vec4(math::mul_add(v1.x, s, v3.x),
+                             math::mul_add(v1.y, s, v3.y),
+                             math::mul_add(v1.z, s, v3.z),
+                             math::mul_add(v1.w, s, v3.w));
+        }
+
+        /**
+         * @brief Returns `v1 * v2 - v3` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec4 mul_sub(
+            const base_vec4& v1,
+            const base_vec4& v2,
+            const base_vec4& v3) noexcept
+        {
+            return base_vec4(math::mul_sub(v1.x, v2.x, v3.x),
+                             math::mul_sub(v1.y, v2.y, v3.y),
+                             math::mul_sub(v1.z, v2.z, v3.z),
+                             math::mul_sub(v1.w, v2.w, v3.w));
+        }
+
+        /**
+         * @brief Returns `v1 * s - v3` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec4 mul_sub(
+            const base_vec4& v1, const T& s, const base_vec4& v3) noexcept
+        {
+            return base_vec4(math::mul_sub(v1.x, s, v3.x),
+                             math::mul_sub(v1.y, s, v3.y),
+                             math::mul_sub(v1.z, s, v3.z),
+                             math::mul_sub(v1.w, s, v3.w));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * v2` component-wise.
+         *
+         * @param v1 The first factor
+         * @param v2 The second factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec4 neg_mul_sub(
+            const base_vec4& v1,
+            const base_vec4& v2,
+            const base_vec4& v3) noexcept
+        {
+            return base_vec4(math::neg_mul_sub(v1.x, v2.x, v3.x),
+                             math::neg_mul_sub(v1.y, v2.y, v3.y),
+                             math::neg_mul_sub(v1.z, v2.z, v3.z),
+                             math::neg_mul_sub(v1.w, v2.w, v3.w));
+        }
+
+        /**
+         * @brief Returns `v3 - v1 * s` component-wise.
+         *
+         * @param v1 The vector factor
+         * @param s The scalar factor
+         * @param v3 The addend
+         * @return base_vec4 The result
+         */
+        MVM_INLINE_NODISCARD constexpr static base_vec4 neg_mul_sub(
+            const base_vec4& v1, const T& s, const base_vec4& v3) noexcept
+        {
+            return base_vec4(math::neg_mul_sub(v1.x, s, v3.x),
+                             math::neg_mul_sub(v1.y, s, v3.y),
+                             math::neg_mul_sub(v1.z, s, v3.z),
+                             math::neg_mul_sub(v1.w, s, v3.w));
+        }
+
         /**
          * @brief Returns a vector containing the minimum x, y, z, and w
          * components of the two vectors.
@@ -642,8 +805,8 @@ namespace move::math::scalar
          * @param v2 The second vector
          * @return base_vec4 The minimum vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 min(const base_vec4& v1,
-                                                  const base_vec4& v2) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 min(
+            const base_vec4& v1, const base_vec4& v2) noexcept
         {
             return base_vec4(math::min(v1.x, v2.x), math::min(v1.y, v2.y),
                              math::min(v1.z, v2.z), math::min(v1.w, v2.w));
@@ -657,8 +820,8 @@ namespace move::math::scalar
          * @param v2 The second vector
          * @return base_vec4 The maximum vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 max(const base_vec4& v1,
-                                                  const base_vec4& v2) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 max(
+            const base_vec4& v1, const base_vec4& v2) noexcept
         {
             return base_vec4(math::max(v1.x, v2.x), math::max(v1.y, v2.y),
                              math::max(v1.z, v2.z), math::max(v1.w, v2.w));
@@ -673,7 +836,7 @@ namespace move::math::scalar
          * @param max The maximum vector
          * @return base_vec4 The clamped vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 clamp(
+        MVM_INLINE_NODISCARD constexpr static base_vec4 clamp(
             const base_vec4& v,
             const base_vec4& min,
             const base_vec4& max) noexcept
@@ -692,9 +855,8 @@ namespace move::math::scalar
          * @param max The maximum scalar
          * @return base_vec4 The clamped vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 clamp(const base_vec4& v,
-                                                    const T& min,
-                                                    const T& max) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 clamp(
+            const base_vec4& v, const T& min, const T& max) noexcept
         {
             return base_vec4(
                 math::clamp(v.x, min, max), math::clamp(v.y, min, max),
@@ -710,7 +872,7 @@ namespace move::math::scalar
          * @param value The value to fill the vector with
          * @return base_vec4 The filled vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 filled(T value) noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 filled(T value) noexcept
         {
             return base_vec4(value, value, value, value);
         }
@@ -720,7 +882,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The infinity vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 infinity() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 infinity() noexcept
         {
             return filled(std::numeric_limits<T>::infinity());
         }
@@ -731,7 +893,8 @@ namespace move::math::scalar
          *
          * @return base_vec4 The negative infinity vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 negative_infinity() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4
+        negative_infinity() noexcept
         {
             return filled(-std::numeric_limits<T>::infinity());
         }
@@ -741,7 +904,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The NaN vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 nan() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 nan() noexcept
         {
             return filled(std::numeric_limits<T>::quiet_NaN());
         }
@@ -751,7 +914,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The zero vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 zero() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 zero() noexcept
         {
             return filled(0);
         }
@@ -761,7 +924,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The one vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 one() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 one() noexcept
         {
             return filled(1);
         }
@@ -772,7 +935,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The x axis vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 x_axis() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 x_axis() noexcept
         {
             return base_vec4(1, 0, 0);
         }
@@ -783,7 +946,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The y axis vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 y_axis() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 y_axis() noexcept
         {
             return base_vec4(0, 1, 0);
         }
@@ -794,7 +957,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The z axis vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 z_axis() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 z_axis() noexcept
         {
             return base_vec4(0, 0, 1);
         }
@@ -805,7 +968,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The w axis vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 w_axis() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 w_axis() noexcept
         {
             return base_vec4(0, 0, 0, 1);
         }
@@ -816,7 +979,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The left vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 left() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 left() noexcept
         {
             return -x_axis();
         }
@@ -827,7 +990,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The right vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 right() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 right() noexcept
         {
             return x_axis();
         }
@@ -838,7 +1001,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The down vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 down() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 down() noexcept
         {
             return -y_axis();
         }
@@ -849,7 +1012,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The up vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 up() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 up() noexcept
         {
             return y_axis();
         }
@@ -860,7 +1023,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The back vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 backward() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 backward() noexcept
         {
             return -z_axis();
         }
@@ -871,7 +1034,7 @@ namespace move::math::scalar
          *
          * @return base_vec4 The forward vector
          */
-        MVM_INLINE_NODISCARD static base_vec4 forward() noexcept
+        MVM_INLINE_NODISCARD constexpr static base_vec4 forward() noexcept
         {
             return z_axis();
         }
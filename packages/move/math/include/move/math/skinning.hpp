@@ -0,0 +1,448 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <move/math/common.hpp>
+#include <move/math/dual_quat.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/mat4x4.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    /**
+     * @brief The bones that influence a single vertex, and how much each one
+     * contributes.  Weights are expected to sum to one; unused slots should
+     * have a weight of zero and may reference any valid bone.
+     *
+     * @tparam T The weight type
+     * @tparam BoneCount The number of influences per vertex, 4 or 8
+     */
+    template <typename T, size_t BoneCount>
+        requires std::is_floating_point_v<T> &&
+                 (BoneCount == 4 || BoneCount == 8)
+    struct bone_influences
+    {
+        constexpr static size_t bone_count = BoneCount;
+
+        uint16_t bones[BoneCount];
+        T weights[BoneCount];
+    };
+
+    template <typename T>
+    using bone_influences4 = bone_influences<T, 4>;
+
+    template <typename T>
+    using bone_influences8 = bone_influences<T, 8>;
+
+    namespace detail
+    {
+        template <typename T>
+        struct skin_matrix
+        {
+            using rtm_vec4_t = typename mat4x4<T>::rtm_vec4_t;
+
+            rtm_vec4_t x_axis;
+            rtm_vec4_t y_axis;
+            rtm_vec4_t z_axis;
+            rtm_vec4_t w_axis;
+        };
+
+        // Weighted sum of the influencing palette matrices, accumulated a row
+        // at a time with fused multiply-adds.
+        template <typename T, size_t BoneCount>
+        MVM_INLINE_NODISCARD skin_matrix<T> blend_palette(
+            const mat4x4<T>* palette,
+            const bone_influences<T, BoneCount>& influences)
+        {
+            using namespace rtm;
+
+            const auto first = palette[influences.bones[0]].to_rtm();
+            const T first_weight = influences.weights[0];
+            skin_matrix<T> result{
+                vector_mul(matrix_get_axis(first, axis4::x), first_weight),
+                vector_mul(matrix_get_axis(first, axis4::y), first_weight),
+                vector_mul(matrix_get_axis(first, axis4::z), first_weight),
+                vector_mul(matrix_get_axis(first, axis4::w), first_weight)};
+
+            for (size_t i = 1; i < BoneCount; ++i)
+            {
+                const T weight = influences.weights[i];
+
+                // Most vertices use far fewer bones than there are slots
+                if (weight == T(0))
+                {
+                    continue;
+                }
+
+                const auto bone = palette[influences.bones[i]].to_rtm();
+                result.x_axis = vector_mul_add(matrix_get_axis(bone, axis4::x),
+                                               weight, result.x_axis);
+                result.y_axis = vector_mul_add(matrix_get_axis(bone, axis4::y),
+                                               weight, result.y_axis);
+                result.z_axis = vector_mul_add(matrix_get_axis(bone, axis4::z),
+                                               weight, result.z_axis);
+                result.w_axis = vector_mul_add(matrix_get_axis(bone, axis4::w),
+                                               weight, result.w_axis);
+            }
+            return result;
+        }
+
+        template <typename T, typename rtm_vec4_t>
+        MVM_INLINE_NODISCARD rtm_vec4_t skin_point(const skin_matrix<T>& m,
+                                                   const rtm_vec4_t& point)
+        {
+            using namespace rtm;
+            rtm_vec4_t res = m.w_axis;
+            res = vector_mul_add(vector_dup_x(point), m.x_axis, res);
+            res = vector_mul_add(vector_dup_y(point), m.y_axis, res);
+            res = vector_mul_add(vector_dup_z(point), m.z_axis, res);
+            return res;
+        }
+
+        // Uses the upper 3x3 of the blended matrix, which is exact for rigid
+        // and uniformly scaled bones.  The result is renormalized since
+        // blending shortens it.
+        template <typename T, typename rtm_vec4_t>
+        MVM_INLINE_NODISCARD rtm_vec4_t skin_normal(const skin_matrix<T>& m,
+                                                    const rtm_vec4_t& normal)
+        {
+            using namespace rtm;
+            rtm_vec4_t res = vector_mul(vector_dup_x(normal), m.x_axis);
+            res = vector_mul_add(vector_dup_y(normal), m.y_axis, res);
+            res = vector_mul_add(vector_dup_z(normal), m.z_axis, res);
+            return vector_normalize3(res);
+        }
+
+        template <typename T>
+        struct blended_dual_quat
+        {
+            using rtm_vec4_t = typename dual_quat<T>::rtm_vec4_t;
+
+            rtm_vec4_t real;
+            rtm_vec4_t dual;
+        };
+
+        // Weighted sum of the influencing dual quaternions.  Each one is
+        // flipped onto the same hemisphere as the first so that blending
+        // always takes the short way around, then the sum is renormalized.
+        template <typename T, size_t BoneCount>
+        MVM_INLINE_NODISCARD blended_dual_quat<T> blend_dual_quats(
+            const dual_quat<T>* palette,
+            const bone_influences<T, BoneCount>& influences)
+        {
+            using namespace rtm;
+
+            const dual_quat<T>& first = palette[influences.bones[0]];
+            const auto pivot = quat_to_vector(first.get_real().to_rtm());
+            const T first_weight = influences.weights[0];
+            blended_dual_quat<T> result{
+                vector_mul(pivot, first_weight),
+                vector_mul(quat_to_vector(first.get_dual().to_rtm()),
+                           first_weight)};
+
+            for (size_t i = 1; i < BoneCount; ++i)
+            {
+                T weight = influences.weights[i];
+                if (weight == T(0))
+                {
+                    continue;
+                }
+
+                const dual_quat<T>& bone = palette[influences.bones[i]];
+                const auto real = quat_to_vector(bone.get_real().to_rtm());
+                const auto dual = quat_to_vector(bone.get_dual().to_rtm());
+                if (T(vector_dot(real, pivot)) < T(0))
+                {
+                    weight = -weight;
+                }
+                result.real = vector_mul_add(real, weight, result.real);
+                result.dual = vector_mul_add(dual, weight, result.dual);
+            }
+
+            const T inv_length = T(vector_length_reciprocal(result.real));
+            result.real = vector_mul(result.real, inv_length);
+            result.dual = vector_mul(result.dual, inv_length);
+            return result;
+        }
+
+        template <typename T, typename rtm_vec4_t>
+        MVM_INLINE_NODISCARD rtm_vec4_t
+        skin_point(const blended_dual_quat<T>& dq, const rtm_vec4_t& point)
+        {
+            return rtm::vector_add(quat_rotate(dq.real, point),
+                                   dq_translation(dq.real, dq.dual));
+        }
+
+        // The blended rotation is orthonormal, so no renormalization needed
+        template <typename T, typename rtm_vec4_t>
+        MVM_INLINE_NODISCARD rtm_vec4_t
+        skin_normal(const blended_dual_quat<T>& dq, const rtm_vec4_t& normal)
+        {
+            return quat_rotate(dq.real, normal);
+        }
+    }  // namespace detail
+
+    /**
+     * @brief Linear blend skinning of vertex positions.
+     *
+     * Each output position is the input position transformed by the
+     * weighted sum of its influencing palette matrices.  The palette is
+     * usually `inverse_bind[i] * world[i]`, which `mat4x4::multiply_arrays`
+     * builds in bulk.  Outputs may be the same arrays as the inputs.
+     *
+     * @param palette The skinning matrices, indexed by bone
+     * @param influences The bone influences of each vertex
+     * @param positions The bind-pose positions
+     * @param out_positions The skinned positions
+     * @param count The number of vertices
+     */
+    template <typename T, size_t BoneCount>
+    void skin_linear(const mat4x4<T>* palette,
+                     const bone_influences<T, BoneCount>* influences,
+                     const vec3<T, Acceleration::Scalar>* positions,
+                     vec3<T, Acceleration::Scalar>* out_positions,
+                     size_t count)
+    {
+        using namespace rtm;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto m = detail::blend_palette(palette, influences[i]);
+            vector_store3(
+                detail::skin_point(m, vector_load3(positions[i].to_array())),
+                out_positions[i].to_array());
+        }
+    }
+
+    /**
+     * @brief Linear blend skinning of vertex positions and normals.  The
+     * blended matrix is built once per vertex and shared by both.
+     *
+     * @param palette The skinning matrices, indexed by bone
+     * @param influences The bone influences of each vertex
+     * @param positions The bind-pose positions
+     * @param normals The bind-pose normals
+     * @param out_positions The skinned positions
+     * @param out_normals The skinned, normalized normals
+     * @param count The number of vertices
+     */
+    template <typename T, size_t BoneCount>
+    void skin_linear(const mat4x4<T>* palette,
+                     const bone_influences<T, BoneCount>* influences,
+                     const vec3<T, Acceleration::Scalar>* positions,
+                     const vec3<T, Acceleration::Scalar>* normals,
+                     vec3<T, Acceleration::Scalar>* out_positions,
+                     vec3<T, Acceleration::Scalar>* out_normals,
+                     size_t count)
+    {
+        using namespace rtm;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto m = detail::blend_palette(palette, influences[i]);
+            const auto position = vector_load3(positions[i].to_array());
+            const auto normal = vector_load3(normals[i].to_array());
+            vector_store3(detail::skin_point(m, position),
+                          out_positions[i].to_array());
+            vector_store3(detail::skin_normal(m, normal),
+                          out_normals[i].to_array());
+        }
+    }
+
+    /**
+     * @brief Structure-of-arrays variant of position skinning, for vertex
+     * streams that keep each component in its own array.
+     *
+     * @param palette The skinning matrices, indexed by bone
+     * @param influences The bone influences of each vertex
+     * @param positions The bind-pose positions
+     * @param out_positions The skinned positions
+     * @param count The number of vertices
+     */
+    template <typename T, size_t BoneCount>
+    void skin_linear(const mat4x4<T>* palette,
+                     const bone_influences<T, BoneCount>* influences,
+                     soa_vec3<const T> positions,
+                     soa_vec3<T> out_positions,
+                     size_t count)
+    {
+        using namespace rtm;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto m = detail::blend_palette(palette, influences[i]);
+            const auto skinned = detail::skin_point(
+                m, vector_set(positions.x[i], positions.y[i], positions.z[i]));
+            out_positions.x[i] = vector_get_x(skinned);
+            out_positions.y[i] = vector_get_y(skinned);
+            out_positions.z[i] = vector_get_z(skinned);
+        }
+    }
+
+    /**
+     * @brief Structure-of-arrays variant of position and normal skinning.
+     *
+     * @param palette The skinning matrices, indexed by bone
+     * @param influences The bone influences of each vertex
+     * @param positions The bind-pose positions
+     * @param normals The bind-pose normals
+     * @param out_positions The skinned positions
+     * @param out_normals The skinned, normalized normals
+     * @param count The number of vertices
+     */
+    template <typename T, size_t BoneCount>
+    void skin_linear(const mat4x4<T>* palette,
+                     const bone_influences<T, BoneCount>* influences,
+                     soa_vec3<const T> positions,
+                     soa_vec3<const T> normals,
+                     soa_vec3<T> out_positions,
+                     soa_vec3<T> out_normals,
+                     size_t count)
+    {
+        using namespace rtm;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto m = detail::blend_palette(palette, influences[i]);
+            const auto position = detail::skin_point(
+                m, vector_set(positions.x[i], positions.y[i], positions.z[i]));
+            const auto normal = detail::skin_normal(
+                m, vector_set(normals.x[i], normals.y[i], normals.z[i]));
+            out_positions.x[i] = vector_get_x(position);
+            out_positions.y[i] = vector_get_y(position);
+            out_positions.z[i] = vector_get_z(position);
+            out_normals.x[i] = vector_get_x(normal);
+            out_normals.y[i] = vector_get_y(normal);
+            out_normals.z[i] = vector_get_z(normal);
+        }
+    }
+
+    /**
+     * @brief Dual quaternion skinning of vertex positions.
+     *
+     * Unlike skin_linear, blending rigid bones stays rigid, so twisting
+     * joints keep their volume instead of collapsing.  The palette is half
+     * the size of a matrix palette.  Outputs may be the same arrays as the
+     * inputs.
+     *
+     * @param palette The normalized skinning transforms, indexed by bone
+     * @param influences The bone influences of each vertex
+     * @param positions The bind-pose positions
+     * @param out_positions The skinned positions
+     * @param count The number of vertices
+     */
+    template <typename T, size_t BoneCount>
+    void skin_dual_quat(const dual_quat<T>* palette,
+                        const bone_influences<T, BoneCount>* influences,
+                        const vec3<T, Acceleration::Scalar>* positions,
+                        vec3<T, Acceleration::Scalar>* out_positions,
+                        size_t count)
+    {
+        using namespace rtm;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto dq = detail::blend_dual_quats(palette, influences[i]);
+            vector_store3(
+                detail::skin_point(dq, vector_load3(positions[i].to_array())),
+                out_positions[i].to_array());
+        }
+    }
+
+    /**
+     * @brief Dual quaternion skinning of vertex positions and normals.
+     *
+     * @param palette The normalized skinning transforms, indexed by bone
+     * @param influences The bone influences of each vertex
+     * @param positions The bind-pose positions
+     * @param normals The bind-pose normals
+     * @param out_positions The skinned positions
+     * @param out_normals The skinned normals
+     * @param count The number of vertices
+     */
+    template <typename T, size_t BoneCount>
+    void skin_dual_quat(const dual_quat<T>* palette,
+                        const bone_influences<T, BoneCount>* influences,
+                        const vec3<T, Acceleration::Scalar>* positions,
+                        const vec3<T, Acceleration::Scalar>* normals,
+                        vec3<T, Acceleration::Scalar>* out_positions,
+                        vec3<T, Acceleration::Scalar>* out_normals,
+                        size_t count)
+    {
+        using namespace rtm;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto dq = detail::blend_dual_quats(palette, influences[i]);
+            const auto position = vector_load3(positions[i].to_array());
+            const auto normal = vector_load3(normals[i].to_array());
+            vector_store3(detail::skin_point(dq, position),
+                          out_positions[i].to_array());
+            vector_store3(detail::skin_normal(dq, normal),
+                          out_normals[i].to_array());
+        }
+    }
+
+    /**
+     * @brief Structure-of-arrays variant of dual quaternion position
+     * skinning.
+     *
+     * @param palette The normalized skinning transforms, indexed by bone
+     * @param influences The bone influences of each vertex
+     * @param positions The bind-pose positions
+     * @param out_positions The skinned positions
+     * @param count The number of vertices
+     */
+    template <typename T, size_t BoneCount>
+    void skin_dual_quat(const dual_quat<T>* palette,
+                        const bone_influences<T, BoneCount>* influences,
+                        soa_vec3<const T> positions,
+                        soa_vec3<T> out_positions,
+                        size_t count)
+    {
+        using namespace rtm;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto dq = detail::blend_dual_quats(palette, influences[i]);
+            const auto skinned = detail::skin_point(
+                dq, vector_set(positions.x[i], positions.y[i], positions.z[i]));
+            out_positions.x[i] = vector_get_x(skinned);
+            out_positions.y[i] = vector_get_y(skinned);
+            out_positions.z[i] = vector_get_z(skinned);
+        }
+    }
+
+    /**
+     * @brief Structure-of-arrays variant of dual quaternion position and
+     * normal skinning.
+     *
+     * @param palette The normalized skinning transforms, indexed by bone
+     * @param influences The bone influences of each vertex
+     * @param positions The bind-pose positions
+     * @param normals The bind-pose normals
+     * @param out_positions The skinned positions
+     * @param out_normals The skinned normals
+     * @param count The number of vertices
+     */
+    template <typename T, size_t BoneCount>
+    void skin_dual_quat(const dual_quat<T>* palette,
+                        const bone_influences<T, BoneCount>* influences,
+                        soa_vec3<const T> positions,
+                        soa_vec3<const T> normals,
+                        soa_vec3<T> out_positions,
+                        soa_vec3<T> out_normals,
+                        size_t count)
+    {
+        using namespace rtm;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto dq = detail::blend_dual_quats(palette, influences[i]);
+            const auto position = detail::skin_point(
+                dq, vector_set(positions.x[i], positions.y[i], positions.z[i]));
+            const auto normal = detail::skin_normal(
+                dq, vector_set(normals.x[i], normals.y[i], normals.z[i]));
+            out_positions.x[i] = vector_get_x(position);
+            out_positions.y[i] = vector_get_y(position);
+            out_positions.z[i] = vector_get_z(position);
+            out_normals.x[i] = vector_get_x(normal);
+            out_normals.y[i] = vector_get_y(normal);
+            out_normals.z[i] = vector_get_z(normal);
+        }
+    }
+}  // namespace move::math
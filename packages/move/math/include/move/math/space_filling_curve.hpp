@@ -0,0 +1,540 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <move/math/aabb.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/vec2.hpp>
+#include <move/math/vec3.hpp>
+
+#if MVM_USE_BMI2
+#include <immintrin.h>
+#endif
+
+namespace move::math
+{
+    // Bits per axis of a 2D code, which fills 64 bits
+    constexpr uint32_t curve2_axis_bits = 32;
+    // Bits per axis of a 3D code, which fills the low 63 bits
+    constexpr uint32_t curve3_axis_bits = 21;
+
+    namespace detail
+    {
+        constexpr uint64_t morton2_mask = 0x5555555555555555ull;
+        constexpr uint64_t morton3_mask = 0x1249249249249249ull;
+
+        // Moves bit i of `value` to bit 2i
+        MVM_INLINE_NODISCARD uint64_t spread_bits2(uint32_t value)
+        {
+#if MVM_USE_BMI2
+            return _pdep_u64(value, morton2_mask);
+#else
+            uint64_t x = value;
+            x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+            x = (x | (x << 8)) & 0x00ff00ff00ff00ffull;
+            x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0full;
+            x = (x | (x << 2)) & 0x3333333333333333ull;
+            x = (x | (x << 1)) & morton2_mask;
+            return x;
+#endif
+        }
+
+        // Gathers bits 0, 2, 4... of `value` into the low 32 bits
+        MVM_INLINE_NODISCARD uint32_t compact_bits2(uint64_t value)
+        {
+#if MVM_USE_BMI2
+            return uint32_t(_pext_u64(value, morton2_mask));
+#else
+            uint64_t x = value & morton2_mask;
+            x = (x | (x >> 1)) & 0x3333333333333333ull;
+            x = (x | (x >> 2)) & 0x0f0f0f0f0f0f0f0full;
+            x = (x | (x >> 4)) & 0x00ff00ff00ff00ffull;
+            x = (x | (x >> 8)) & 0x0000ffff0000ffffull;
+            x = (x | (x >> 16)) & 0x00000000ffffffffull;
+            return uint32_t(x);
+#endif
+        }
+
+        // Moves bit i of the low 21 bits of `value` to bit 3i
+        MVM_INLINE_NODISCARD uint64_t spread_bits3(uint32_t value)
+        {
+#if MVM_USE_BMI2
+            return _pdep_u64(value, morton3_mask);
+#else
+            uint64_t x = value & 0x1fffffu;
+            x = (x | (x << 32)) & 0x001f00000000ffffull;
+            x = (x | (x << 16)) & 0x001f0000ff0000ffull;
+            x = (x | (x << 8)) & 0x100f00f00f00f00full;
+            x = (x | (x << 4)) & 0x10c30c30c30c30c3ull;
+            x = (x | (x << 2)) & morton3_mask;
+            return x;
+#endif
+        }
+
+        // Gathers bits 0, 3, 6... of `value` into the low 21 bits
+        MVM_INLINE_NODISCARD uint32_t compact_bits3(uint64_t value)
+        {
+#if MVM_USE_BMI2
+            return uint32_t(_pext_u64(value, morton3_mask));
+#else
+            uint64_t x = value & morton3_mask;
+            x = (x | (x >> 2)) & 0x10c30c30c30c30c3ull;
+            x = (x | (x >> 4)) & 0x100f00f00f00f00full;
+            x = (x | (x >> 8)) & 0x001f0000ff0000ffull;
+            x = (x | (x >> 16)) & 0x001f00000000ffffull;
+            x = (x | (x >> 32)) & 0x00000000001fffffull;
+            return uint32_t(x);
+#endif
+        }
+
+        // Hilbert curves as state machines, one level per step: a state is
+        // an orientation of the curve within a cell, and maps the octant (or
+        // quadrant) holding the next coordinate bits to how far along the
+        // curve it is and the orientation inside it.  Each entry packs the
+        // output digit above the next state, in the low 5 bits.  Encoding
+        // reads octants and outputs curve digits, and decoding the reverse.
+        // The tables were generated from Skilling's transform ("Programming
+        // the Hilbert curve", 2004) for 32 and 21 bits per axis.
+        constexpr uint8_t hilbert2_encode[4][4] = {
+            {1, 98, 32, 64},
+            {0, 33, 99, 65},
+            {66, 96, 34, 3},
+            {67, 35, 97, 2},
+        };
+        constexpr uint8_t hilbert2_decode[4][4] = {
+            {1, 64, 96, 34},
+            {0, 33, 97, 67},
+            {99, 66, 2, 32},
+            {98, 35, 3, 65},
+        };
+        constexpr uint8_t hilbert3_encode[24][8] = {
+            {1, 230, 99, 132, 34, 197, 64, 160},
+            {16, 117, 42, 65, 242, 130, 200, 161},
+            {4, 115, 244, 129, 32, 66, 204, 162},
+            {203, 234, 163, 145, 39, 8, 67, 96},
+            {10, 48, 113, 68, 232, 210, 128, 164},
+            {143, 227, 102, 13, 165, 192, 69, 44},
+            {137, 235, 166, 202, 101, 7, 70, 40},
+            {71, 118, 167, 136, 35, 17, 205, 247},
+            {135, 114, 168, 72, 245, 9, 193, 38},
+            {73, 49, 169, 215, 111, 3, 134, 237},
+            {2, 229, 33, 198, 107, 144, 74, 170},
+            {195, 224, 45, 12, 171, 142, 75, 106},
+            {141, 116, 243, 15, 172, 76, 194, 37},
+            {77, 119, 43, 14, 173, 140, 199, 246},
+            {211, 47, 226, 5, 174, 78, 139, 112},
+            {79, 46, 105, 11, 175, 214, 133, 231},
+            {0, 36, 236, 212, 110, 80, 138, 176},
+            {213, 41, 177, 81, 225, 6, 131, 100},
+            {150, 178, 104, 82, 241, 196, 23, 52},
+            {206, 179, 240, 149, 54, 83, 18, 98},
+            {151, 180, 238, 208, 108, 84, 22, 50},
+            {209, 181, 55, 85, 228, 147, 20, 97},
+            {86, 182, 103, 146, 51, 207, 21, 233},
+            {87, 183, 53, 201, 109, 148, 19, 239},
+        };
+        constexpr uint8_t hilbert3_decode[24][8] = {
+            {1, 130, 192, 67, 100, 224, 165, 38},
+            {16, 74, 97, 53, 162, 225, 200, 146},
+            {4, 128, 162, 51, 97, 226, 204, 84},
+            {168, 135, 195, 224, 113, 67, 11, 42},
+            {10, 48, 100, 81, 192, 228, 178, 136},
+            {109, 236, 197, 70, 15, 133, 160, 35},
+            {167, 232, 198, 133, 9, 70, 106, 43},
+            {177, 131, 7, 54, 104, 71, 205, 247},
+            {169, 230, 104, 50, 7, 72, 193, 149},
+            {163, 49, 9, 143, 198, 73, 119, 237},
+            {2, 65, 202, 139, 176, 234, 102, 37},
+            {108, 77, 203, 234, 174, 139, 3, 32},
+            {111, 229, 172, 52, 13, 140, 194, 83},
+            {110, 75, 13, 55, 172, 141, 199, 246},
+            {101, 47, 174, 240, 203, 142, 19, 66},
+            {107, 46, 15, 73, 197, 143, 182, 231},
+            {0, 36, 176, 142, 202, 240, 116, 76},
+            {166, 41, 113, 228, 195, 81, 21, 129},
+            {215, 244, 114, 72, 22, 50, 164, 145},
+            {210, 150, 179, 226, 117, 51, 14, 80},
+            {214, 242, 180, 140, 23, 52, 112, 78},
+            {212, 87, 117, 225, 179, 53, 17, 132},
+            {213, 147, 22, 71, 114, 54, 175, 233},
+            {211, 85, 23, 141, 180, 55, 105, 239},
+        };
+
+        template <size_t States, size_t Digits>
+        MVM_INLINE_NODISCARD uint64_t hilbert_walk(
+            uint64_t digits,
+            uint32_t levels,
+            const uint8_t (&table)[States][Digits])
+        {
+            constexpr uint32_t digit_bits = Digits == 4 ? 2 : 3;
+            uint64_t result = 0;
+            uint32_t state = 0;
+            for (uint32_t level = levels; level-- > 0;)
+            {
+                const uint8_t entry =
+                    table[state][(digits >> (level * digit_bits)) &
+                                 (Digits - 1)];
+                result = (result << digit_bits) | (entry >> 5);
+                state = entry & 31u;
+            }
+            return result;
+        }
+
+        // The type grid positions are computed in: T when it holds every
+        // cell index exactly, otherwise double, as for floats on the 2^32
+        // grid, whose top cell would round up out of range
+        template <typename T, uint32_t Bits>
+        using quantize_t =
+            std::conditional_t<(Bits < std::numeric_limits<T>::digits),
+                               T,
+                               double>;
+
+        // Scales `value` from [min, min + extent] to [0, 2^Bits - 1]
+        template <uint32_t Bits = curve3_axis_bits, typename T>
+        MVM_INLINE_NODISCARD uint32_t
+        quantize_axis(const T& value,
+                      const T& min,
+                      const quantize_t<T, Bits>& scale)
+        {
+            using wide_t = quantize_t<T, Bits>;
+            constexpr wide_t top = wide_t((uint64_t(1) << Bits) - 1);
+            return uint32_t(math::clamp(
+                (wide_t(value) - wide_t(min)) * scale, wide_t(0), top));
+        }
+
+        template <uint32_t Bits = curve3_axis_bits, typename T>
+        MVM_INLINE_NODISCARD quantize_t<T, Bits> quantize_scale(
+            const T& extent)
+        {
+            using wide_t = quantize_t<T, Bits>;
+            constexpr wide_t top = wide_t((uint64_t(1) << Bits) - 1);
+            return extent > T(0) ? top / wide_t(extent) : wide_t(0);
+        }
+    }  // namespace detail
+
+    // Morton (Z-order) codes
+    /**
+     * @brief Interleaves two coordinates, x in the lowest bit.
+     *
+     * @param x The x coordinate
+     * @param y The y coordinate
+     * @return uint64_t The Morton code
+     */
+    MVM_INLINE_NODISCARD uint64_t morton_encode(uint32_t x, uint32_t y)
+    {
+        return detail::spread_bits2(x) | (detail::spread_bits2(y) << 1);
+    }
+
+    /**
+     * @brief Interleaves three coordinates, x in the lowest bit.  Only the
+     * low 21 bits of each are kept.
+     *
+     * @param x The x coordinate
+     * @param y The y coordinate
+     * @param z The z coordinate
+     * @return uint64_t The Morton code, in the low 63 bits
+     */
+    MVM_INLINE_NODISCARD uint64_t morton_encode(uint32_t x,
+                                                uint32_t y,
+                                                uint32_t z)
+    {
+        return detail::spread_bits3(x) | (detail::spread_bits3(y) << 1) |
+               (detail::spread_bits3(z) << 2);
+    }
+
+    MVM_INLINE_NODISCARD uint64_t morton_encode(const storage_uint2& cell)
+    {
+        return morton_encode(cell.get_x(), cell.get_y());
+    }
+
+    MVM_INLINE_NODISCARD uint64_t morton_encode(const storage_uint3& cell)
+    {
+        return morton_encode(cell.get_x(), cell.get_y(), cell.get_z());
+    }
+
+    // Signed coordinates are offset by half the range, so codes still sort
+    // in coordinate order.  Each must fit in [-2^31, 2^31).
+    MVM_INLINE_NODISCARD uint64_t morton_encode(const storage_int2& cell)
+    {
+        constexpr uint32_t offset = 1u << 31;
+        return morton_encode(uint32_t(cell.get_x()) ^ offset,
+                             uint32_t(cell.get_y()) ^ offset);
+    }
+
+    // Each coordinate must fit in [-2^20, 2^20)
+    MVM_INLINE_NODISCARD uint64_t morton_encode(const storage_int3& cell)
+    {
+        constexpr uint32_t offset = 1u << (curve3_axis_bits - 1);
+        return morton_encode(uint32_t(cell.get_x()) + offset,
+                             uint32_t(cell.get_y()) + offset,
+                             uint32_t(cell.get_z()) + offset);
+    }
+
+    MVM_INLINE_NODISCARD storage_uint2 morton_decode2(uint64_t code)
+    {
+        return storage_uint2(detail::compact_bits2(code),
+                             detail::compact_bits2(code >> 1));
+    }
+
+    MVM_INLINE_NODISCARD storage_uint3 morton_decode3(uint64_t code)
+    {
+        return storage_uint3(detail::compact_bits3(code),
+                             detail::compact_bits3(code >> 1),
+                             detail::compact_bits3(code >> 2));
+    }
+
+    // Hilbert codes
+    /**
+     * @brief The distance along a 2D Hilbert curve through the 2^32 by 2^32
+     * grid.  Cells with consecutive codes always share an edge, which makes
+     * for better locality than Morton order at a higher encoding cost.
+     *
+     * @param x The x coordinate
+     * @param y The y coordinate
+     * @return uint64_t The Hilbert code
+     */
+    MVM_INLINE_NODISCARD uint64_t hilbert_encode(uint32_t x, uint32_t y)
+    {
+        return detail::hilbert_walk(morton_encode(x, y), curve2_axis_bits,
+                                    detail::hilbert2_encode);
+    }
+
+    /**
+     * @brief The distance along a 3D Hilbert curve through the 2^21 cubed
+     * grid.  Cells with consecutive codes always share a face.  Only the
+     * low 21 bits of each coordinate are kept.
+     *
+     * @param x The x coordinate
+     * @param y The y coordinate
+     * @param z The z coordinate
+     * @return uint64_t The Hilbert code, in the low 63 bits
+     */
+    MVM_INLINE_NODISCARD uint64_t hilbert_encode(uint32_t x,
+                                                 uint32_t y,
+                                                 uint32_t z)
+    {
+        return detail::hilbert_walk(morton_encode(x, y, z), curve3_axis_bits,
+                                    detail::hilbert3_encode);
+    }
+
+    MVM_INLINE_NODISCARD uint64_t hilbert_encode(const storage_uint2& cell)
+    {
+        return hilbert_encode(cell.get_x(), cell.get_y());
+    }
+
+    MVM_INLINE_NODISCARD uint64_t hilbert_encode(const storage_uint3& cell)
+    {
+        return hilbert_encode(cell.get_x(), cell.get_y(), cell.get_z());
+    }
+
+    // Offset as for morton_encode
+    MVM_INLINE_NODISCARD uint64_t hilbert_encode(const storage_int2& cell)
+    {
+        constexpr uint32_t offset = 1u << 31;
+        return hilbert_encode(uint32_t(cell.get_x()) ^ offset,
+                              uint32_t(cell.get_y()) ^ offset);
+    }
+
+    MVM_INLINE_NODISCARD uint64_t hilbert_encode(const storage_int3& cell)
+    {
+        constexpr uint32_t offset = 1u << (curve3_axis_bits - 1);
+        return hilbert_encode(uint32_t(cell.get_x()) + offset,
+                              uint32_t(cell.get_y()) + offset,
+                              uint32_t(cell.get_z()) + offset);
+    }
+
+    MVM_INLINE_NODISCARD storage_uint2 hilbert_decode2(uint64_t code)
+    {
+        return morton_decode2(detail::hilbert_walk(code, curve2_axis_bits,
+                                                   detail::hilbert2_decode));
+    }
+
+    MVM_INLINE_NODISCARD storage_uint3 hilbert_decode3(uint64_t code)
+    {
+        return morton_decode3(detail::hilbert_walk(code, curve3_axis_bits,
+                                                   detail::hilbert3_decode));
+    }
+
+    // Quantized points
+    /**
+     * @brief Snaps a 2D point to the 2^32 squared grid spanning
+     * [`min`, `max`].  Points outside are clamped to its edge, and a flat
+     * axis maps to zero.
+     *
+     * @param point The point to quantize.  Must be finite.
+     * @param min The lowest corner of the grid
+     * @param max The highest corner of the grid
+     * @return storage_uint2 The grid cell
+     */
+    template <typename T, Acceleration Accel>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD storage_uint2
+    quantize_to_curve(const vec2<T, Accel>& point,
+                      const vec2<T, Accel>& min,
+                      const vec2<T, Accel>& max)
+    {
+        return storage_uint2(
+            detail::quantize_axis<curve2_axis_bits>(
+                point.get_x(), min.get_x(),
+                detail::quantize_scale<curve2_axis_bits>(max.get_x() -
+                                                         min.get_x())),
+            detail::quantize_axis<curve2_axis_bits>(
+                point.get_y(), min.get_y(),
+                detail::quantize_scale<curve2_axis_bits>(max.get_y() -
+                                                         min.get_y())));
+    }
+
+    template <typename T, Acceleration Accel>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD uint64_t morton_encode(const vec2<T, Accel>& point,
+                                                const vec2<T, Accel>& min,
+                                                const vec2<T, Accel>& max)
+    {
+        return morton_encode(quantize_to_curve(point, min, max));
+    }
+
+    template <typename T, Acceleration Accel>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD uint64_t hilbert_encode(const vec2<T, Accel>& point,
+                                                 const vec2<T, Accel>& min,
+                                                 const vec2<T, Accel>& max)
+    {
+        return hilbert_encode(quantize_to_curve(point, min, max));
+    }
+
+    /**
+     * @brief Snaps a point to the 2^21 cubed grid spanning `bounds`.
+     * Points outside the bounds are clamped to its edge, and a flat axis
+     * maps to zero.
+     *
+     * @param point The point to quantize.  Must be finite.
+     * @param bounds The box the grid spans
+     * @return storage_uint3 The grid cell
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD storage_uint3
+    quantize_to_curve(const vec3<T, Acceleration::RTM>& point,
+                      const aabb<T>& bounds)
+    {
+        const auto min = bounds.get_min();
+        const auto size = bounds.size();
+        return storage_uint3(
+            detail::quantize_axis(point.get_x(), min.get_x(),
+                                  detail::quantize_scale(size.get_x())),
+            detail::quantize_axis(point.get_y(), min.get_y(),
+                                  detail::quantize_scale(size.get_y())),
+            detail::quantize_axis(point.get_z(), min.get_z(),
+                                  detail::quantize_scale(size.get_z())));
+    }
+
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD uint64_t
+    morton_encode(const vec3<T, Acceleration::RTM>& point,
+                  const aabb<T>& bounds)
+    {
+        return morton_encode(quantize_to_curve(point, bounds));
+    }
+
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    MVM_INLINE_NODISCARD uint64_t
+    hilbert_encode(const vec3<T, Acceleration::RTM>& point,
+                   const aabb<T>& bounds)
+    {
+        return hilbert_encode(quantize_to_curve(point, bounds));
+    }
+
+    // Batches
+    /**
+     * @brief Computes the Morton code of each cell of an array.
+     *
+     * @param cells The cells to encode
+     * @param out_codes Receives one code per cell
+     * @param count The number of cells
+     */
+    MVM_INLINE void morton_codes(const storage_uint3* cells,
+                                 uint64_t* out_codes,
+                                 size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out_codes[i] = morton_encode(cells[i]);
+        }
+    }
+
+    MVM_INLINE void hilbert_codes(const storage_uint3* cells,
+                                  uint64_t* out_codes,
+                                  size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out_codes[i] = hilbert_encode(cells[i]);
+        }
+    }
+
+    /**
+     * @brief Quantizes each point of an array to the grid spanning
+     * `bounds`, as quantize_to_curve does, and computes its Morton code.
+     * Sorting by the codes orders the points along the curve, e.g. before
+     * building a bounding volume hierarchy over them.
+     *
+     * @param points The points to encode
+     * @param bounds The box the grid spans, usually the points' bounds
+     * @param out_codes Receives one code per point
+     * @param count The number of points
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    void morton_codes(const vec3<T, Acceleration::Scalar>* points,
+                      const aabb<T>& bounds,
+                      uint64_t* out_codes,
+                      size_t count)
+    {
+        const auto min = bounds.get_min();
+        const auto size = bounds.size();
+        const T min_x = min.get_x();
+        const T min_y = min.get_y();
+        const T min_z = min.get_z();
+        const T scale_x = detail::quantize_scale(size.get_x());
+        const T scale_y = detail::quantize_scale(size.get_y());
+        const T scale_z = detail::quantize_scale(size.get_z());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto& p = points[i];
+            out_codes[i] = morton_encode(
+                detail::quantize_axis(p.get_x(), min_x, scale_x),
+                detail::quantize_axis(p.get_y(), min_y, scale_y),
+                detail::quantize_axis(p.get_z(), min_z, scale_z));
+        }
+    }
+
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    void hilbert_codes(const vec3<T, Acceleration::Scalar>* points,
+                       const aabb<T>& bounds,
+                       uint64_t* out_codes,
+                       size_t count)
+    {
+        const auto min = bounds.get_min();
+        const auto size = bounds.size();
+        const T min_x = min.get_x();
+        const T min_y = min.get_y();
+        const T min_z = min.get_z();
+        const T scale_x = detail::quantize_scale(size.get_x());
+        const T scale_y = detail::quantize_scale(size.get_y());
+        const T scale_z = detail::quantize_scale(size.get_z());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto& p = points[i];
+            out_codes[i] = hilbert_encode(
+                detail::quantize_axis(p.get_x(), min_x, scale_x),
+                detail::quantize_axis(p.get_y(), min_y, scale_y),
+                detail::quantize_axis(p.get_z(), min_z, scale_z));
+        }
+    }
+}  // namespace move::math
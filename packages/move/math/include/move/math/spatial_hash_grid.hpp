@@ -0,0 +1,674 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/aabb.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/ray.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    /**
+     * @brief A uniform grid over a set of points, for broadphase radius,
+     * box and ray queries.
+     *
+     * Cells are hashed by their integer coordinates into a power of two
+     * bucket table at least twice the point count, and `build` counting
+     * sorts the points by bucket into flat arrays: a query reads one range
+     * of `_cell_start` per cell and then the sorted positions beside it,
+     * with no per-cell allocation or pointer chasing.  Each sorted entry
+     * keeps its cell coordinates, so cells that share a bucket are told
+     * apart and no point is reported twice.
+     *
+     * Rebuilding every frame is the intended use.  The arrays are kept
+     * between builds, so a grid of a steady size stops allocating.  Cell
+     * coordinates must fit in 32 bits.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct spatial_hash_grid
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using storage_vec3_t = vec3<T, Acceleration::Scalar>;
+        using cell_t = storage_int3;
+        using aabb_t = aabb<T>;
+        using ray_t = ray<T>;
+        using component_type = T;
+
+        // The smallest bucket table `build` makes
+        constexpr static uint32_t min_bucket_count = 16;
+
+    private:
+        T _cell_size;
+        T _inv_cell_size;
+        uint32_t _bucket_mask = 0;
+        aabb_t _bounds;
+
+        // _cell_start[b] to _cell_start[b + 1] is bucket b's range of the
+        // arrays below, which are sorted by bucket and then by index
+        std::vector<uint32_t> _cell_start;
+        std::vector<uint32_t> _indices;
+        std::vector<T> _x;
+        std::vector<T> _y;
+        std::vector<T> _z;
+        std::vector<int32_t> _cx;
+        std::vector<int32_t> _cy;
+        std::vector<int32_t> _cz;
+
+        // Build scratch, kept to avoid reallocating every frame
+        std::vector<uint32_t> _keys;
+        std::vector<uint32_t> _cursor;
+        std::vector<uint32_t> _scratch_indices;
+        std::vector<uint32_t> _scratch_keys;
+
+        // Constructors
+    public:
+        /**
+         * @brief Creates an empty grid.
+         *
+         * @param cell_size The edge length of a cell.  Must be positive.
+         * Around the typical query radius works well.
+         */
+        explicit spatial_hash_grid(const T& cell_size = T(1)) :
+            _cell_size(cell_size), _inv_cell_size(T(1) / cell_size)
+        {
+            MVM_ASSERT_PRECONDITION(cell_size > T(0));
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD T get_cell_size() const
+        {
+            return _cell_size;
+        }
+
+        MVM_INLINE_NODISCARD size_t size() const
+        {
+            return _indices.size();
+        }
+
+        MVM_INLINE_NODISCARD bool empty() const
+        {
+            return _indices.empty();
+        }
+
+        MVM_INLINE_NODISCARD size_t bucket_count() const
+        {
+            return _cell_start.empty() ? 0 : _cell_start.size() - 1;
+        }
+
+        // The bounds of the points of the last build
+        MVM_INLINE_NODISCARD const aabb_t& bounds() const
+        {
+            return _bounds;
+        }
+
+        MVM_INLINE_NODISCARD cell_t cell_of(const vec3_t& point) const
+        {
+            return cell_t(cell_coordinate(point.get_x()),
+                          cell_coordinate(point.get_y()),
+                          cell_coordinate(point.get_z()));
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE void clear()
+        {
+            _bucket_mask = 0;
+            _bounds = aabb_t();
+            _cell_start.clear();
+            _indices.clear();
+            _x.clear();
+            _y.clear();
+            _z.clear();
+            _cx.clear();
+            _cy.clear();
+            _cz.clear();
+        }
+
+        /**
+         * @brief Replaces the contents of the grid with `points`.  Queries
+         * report a point by its index in this array.
+         *
+         * Large grids take the chunked build below, run in line.
+         *
+         * @param points The points to insert
+         * @param count The number of points
+         */
+        void build(const storage_vec3_t* points, size_t count)
+        {
+            build(points, count,
+                  [](size_t chunk_count, auto&& job)
+                  {
+                      for (size_t i = 0; i < chunk_count; ++i)
+                      {
+                          job(i);
+                      }
+                  });
+        }
+
+        /**
+         * @brief Chunked variant of build for use with a job system, for
+         * grids of hundreds of thousands of points or more.
+         *
+         * `parallel_for(chunk_count, job)` must invoke `job(chunk_index)`
+         * exactly once for each index in `[0, chunk_count)`, from any thread,
+         * and return once all of them have completed.  The build runs three
+         * such passes.  The first two split the points, `chunk_size` at a
+         * time, into partitions of `chunk_size` buckets, and the last sorts
+         * each partition on its own, so every chunk's counters stay in
+         * cache and no pass needs atomics.  The result does not depend on
+         * the dispatcher or the chunk size.
+         *
+         * @param points The points to insert
+         * @param count The number of points
+         * @param parallel_for The dispatcher that runs the chunks
+         * @param chunk_size The number of points, and of buckets, per chunk
+         */
+        template <typename ParallelFor>
+        void build(const storage_vec3_t* points,
+                   size_t count,
+                   ParallelFor&& parallel_for,
+                   size_t chunk_size = 16384)
+        {
+            chunk_size = chunk_size == 0 ? count : chunk_size;
+            if (count <= chunk_size)
+            {
+                counting_sort(points, count);
+                return;
+            }
+
+            prepare(count);
+            _scratch_indices.resize(count);
+            _scratch_keys.resize(count);
+
+            const size_t buckets = _cursor.size();
+            const size_t point_chunks = (count + chunk_size - 1) / chunk_size;
+            const size_t partitions = (buckets + chunk_size - 1) / chunk_size;
+            std::vector<aabb_t> chunk_bounds(point_chunks);
+            // Row c holds point chunk c's count, then its first slot, in
+            // each partition
+            std::vector<uint32_t> offsets(point_chunks * partitions);
+            std::vector<uint32_t> partition_start(partitions + 1);
+
+            uint32_t* keys = _keys.data();
+            uint32_t* scratch_indices = _scratch_indices.data();
+            uint32_t* scratch_keys = _scratch_keys.data();
+            uint32_t* cursor = _cursor.data();
+            uint32_t* starts = _cell_start.data();
+            uint32_t* indices = _indices.data();
+            aabb_t* bounds = chunk_bounds.data();
+            uint32_t* offset = offsets.data();
+            const uint32_t* partition_begin = partition_start.data();
+
+            parallel_for(point_chunks,
+                         [=, this](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             uint32_t* row = offset + chunk_index * partitions;
+                             aabb_t local;
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 const uint32_t key = bucket_of(points[i]);
+                                 keys[i] = key;
+                                 ++row[key / chunk_size];
+                                 local.expand(vec3_t(points[i].get_x(),
+                                                     points[i].get_y(),
+                                                     points[i].get_z()));
+                             }
+                             bounds[chunk_index] = local;
+                         });
+
+            // Partition major, so each partition is contiguous and holds
+            // its points in index order
+            uint32_t total = 0;
+            for (size_t p = 0; p < partitions; ++p)
+            {
+                partition_start[p] = total;
+                for (size_t c = 0; c < point_chunks; ++c)
+                {
+                    const uint32_t n = offsets[c * partitions + p];
+                    offsets[c * partitions + p] = total;
+                    total += n;
+                }
+            }
+            partition_start[partitions] = total;
+            starts[buckets] = total;
+
+            parallel_for(point_chunks,
+                         [=](size_t chunk_index)
+                         {
+                             const size_t begin = chunk_index * chunk_size;
+                             const size_t end =
+                                 math::min(begin + chunk_size, count);
+                             uint32_t* row = offset + chunk_index * partitions;
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 const uint32_t slot =
+                                     row[keys[i] / chunk_size]++;
+                                 scratch_indices[slot] = uint32_t(i);
+                                 scratch_keys[slot] = keys[i];
+                             }
+                         });
+
+            // A counting sort within each partition, which owns its range
+            // of buckets and of the sorted arrays
+            parallel_for(
+                partitions,
+                [=, this](size_t partition)
+                {
+                    const size_t first = partition * chunk_size;
+                    const size_t last = math::min(first + chunk_size, buckets);
+                    const uint32_t begin = partition_begin[partition];
+                    const uint32_t end = partition_begin[partition + 1];
+                    std::fill(cursor + first, cursor + last, 0u);
+                    for (uint32_t k = begin; k < end; ++k)
+                    {
+                        ++cursor[scratch_keys[k]];
+                    }
+
+                    uint32_t sum = begin;
+                    for (size_t b = first; b < last; ++b)
+                    {
+                        const uint32_t n = cursor[b];
+                        starts[b] = sum;
+                        cursor[b] = sum;
+                        sum += n;
+                    }
+                    for (uint32_t k = begin; k < end; ++k)
+                    {
+                        indices[cursor[scratch_keys[k]]++] = scratch_indices[k];
+                    }
+                    gather(points, begin, end);
+                });
+
+            for (size_t c = 0; c < point_chunks; ++c)
+            {
+                _bounds.expand(chunk_bounds[c]);
+            }
+        }
+
+        // Queries
+    public:
+        /**
+         * @brief Calls `callback(index)` for each point within `radius` of
+         * `center`.
+         *
+         * @param center The center of the query sphere
+         * @param radius The radius of the query sphere
+         * @param callback Invoked with the index of each point inside
+         */
+        template <typename Callback>
+        void query_radius(const vec3_t& center,
+                          const T& radius,
+                          Callback&& callback) const
+        {
+            const T cx = center.get_x();
+            const T cy = center.get_y();
+            const T cz = center.get_z();
+            const T radius_squared = radius * radius;
+            const vec3_t extent(radius, radius, radius);
+            for_each_candidate(
+                aabb_t(vec3_t(center - extent), vec3_t(center + extent)),
+                [&](size_t k)
+                {
+                    const T dx = _x[k] - cx;
+                    const T dy = _y[k] - cy;
+                    const T dz = _z[k] - cz;
+                    if (dx * dx + dy * dy + dz * dz <= radius_squared)
+                    {
+                        callback(_indices[k]);
+                    }
+                });
+        }
+
+        /**
+         * @brief Calls `callback(index)` for each point inside `box`,
+         * including its faces.
+         *
+         * @param box The query box
+         * @param callback Invoked with the index of each point inside
+         */
+        template <typename Callback>
+        void query_aabb(const aabb_t& box, Callback&& callback) const
+        {
+            const vec3_t lo = box.get_min();
+            const vec3_t hi = box.get_max();
+            const T min_x = lo.get_x();
+            const T min_y = lo.get_y();
+            const T min_z = lo.get_z();
+            const T max_x = hi.get_x();
+            const T max_y = hi.get_y();
+            const T max_z = hi.get_z();
+            for_each_candidate(box,
+                               [&](size_t k)
+                               {
+                                   if (_x[k] >= min_x && _x[k] <= max_x &&
+                                       _y[k] >= min_y && _y[k] <= max_y &&
+                                       _z[k] >= min_z && _z[k] <= max_z)
+                                   {
+                                       callback(_indices[k]);
+                                   }
+                               });
+        }
+
+        /**
+         * @brief Walks the cells `r` passes through within its range, front
+         * to back, calling `callback(index, t_exit)` for each point in
+         * them.  `t_exit` is where the ray leaves the point's cell, so a
+         * nearest hit search can stop once its best hit is closer than
+         * that.  Points within one cell come in index order.
+         *
+         * Only the cells the ray touches are visited, so anything stored
+         * by its center must fit within half a cell of it to be found.
+         *
+         * @param r The ray to walk
+         * @param callback Returns false to stop the walk
+         * @return bool False if the callback stopped the walk
+         */
+        template <typename Callback>
+        bool walk_ray(const ray_t& r, Callback&& callback) const
+        {
+            if (empty())
+            {
+                return true;
+            }
+
+            // Clip to the cells that hold points
+            const cell_t lo = cell_of(_bounds.get_min());
+            const cell_t hi = cell_of(_bounds.get_max());
+            const aabb_t cells(vec3_t(T(lo.get_x()) * _cell_size,
+                                      T(lo.get_y()) * _cell_size,
+                                      T(lo.get_z()) * _cell_size),
+                               vec3_t(T(hi.get_x() + 1) * _cell_size,
+                                      T(hi.get_y() + 1) * _cell_size,
+                                      T(hi.get_z() + 1) * _cell_size));
+            T t_near;
+            T t_far;
+            if (!r.intersect_aabb(cells, t_near, t_far))
+            {
+                return true;
+            }
+
+            const vec3_t origin = r.get_origin();
+            const vec3_t direction = r.get_direction();
+            const T o[3] = {origin.get_x(), origin.get_y(), origin.get_z()};
+            const T d[3] = {direction.get_x(), direction.get_y(),
+                            direction.get_z()};
+            const int32_t low[3] = {lo.get_x(), lo.get_y(), lo.get_z()};
+            const int32_t high[3] = {hi.get_x(), hi.get_y(), hi.get_z()};
+
+            // Amanatides and Woo: the distance to the next boundary on
+            // each axis, and the distance between boundaries
+            int32_t cell[3];
+            int32_t step[3];
+            T t_next[3];
+            T t_delta[3];
+            constexpr T infinity = std::numeric_limits<T>::infinity();
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const T entry = o[axis] + d[axis] * t_near;
+                cell[axis] = math::clamp(cell_coordinate(entry), low[axis],
+                                         high[axis]);
+                if (d[axis] > T(0))
+                {
+                    step[axis] = 1;
+                    t_next[axis] =
+                        (T(cell[axis] + 1) * _cell_size - o[axis]) / d[axis];
+                    t_delta[axis] = _cell_size / d[axis];
+                }
+                else if (d[axis] < T(0))
+                {
+                    step[axis] = -1;
+                    t_next[axis] =
+                        (T(cell[axis]) * _cell_size - o[axis]) / d[axis];
+                    t_delta[axis] = -_cell_size / d[axis];
+                }
+                else
+                {
+                    step[axis] = 0;
+                    t_next[axis] = infinity;
+                    t_delta[axis] = infinity;
+                }
+            }
+
+            for (;;)
+            {
+                const int axis =
+                    t_next[0] < t_next[1] ? (t_next[0] < t_next[2] ? 0 : 2)
+                                          : (t_next[1] < t_next[2] ? 1 : 2);
+                const T t_exit = math::min(t_next[axis], t_far);
+
+                const uint32_t key = bucket_of(cell[0], cell[1], cell[2]);
+                for (uint32_t k = _cell_start[key]; k < _cell_start[key + 1];
+                     ++k)
+                {
+                    if (_cx[k] == cell[0] && _cy[k] == cell[1] &&
+                        _cz[k] == cell[2] && !callback(_indices[k], t_exit))
+                    {
+                        return false;
+                    }
+                }
+
+                if (t_next[axis] > t_far)
+                {
+                    return true;
+                }
+                cell[axis] += step[axis];
+                if (cell[axis] < low[axis] || cell[axis] > high[axis])
+                {
+                    return true;
+                }
+                t_next[axis] += t_delta[axis];
+            }
+        }
+
+        /**
+         * @brief Calls `callback(index)` for each point in one cell.
+         *
+         * @param cell The cell coordinates, as from `cell_of`
+         * @param callback Invoked with the index of each point in the cell
+         */
+        template <typename Callback>
+        void for_each_in_cell(const cell_t& cell, Callback&& callback) const
+        {
+            if (empty())
+            {
+                return;
+            }
+
+            const int32_t x = cell.get_x();
+            const int32_t y = cell.get_y();
+            const int32_t z = cell.get_z();
+            const uint32_t key = bucket_of(x, y, z);
+            for (uint32_t k = _cell_start[key]; k < _cell_start[key + 1]; ++k)
+            {
+                if (_cx[k] == x && _cy[k] == y && _cz[k] == z)
+                {
+                    callback(_indices[k]);
+                }
+            }
+        }
+
+    private:
+        MVM_INLINE_NODISCARD int32_t cell_coordinate(const T& value) const
+        {
+            // Truncate and step down for negatives, which unlike std::floor
+            // needs no library call without SSE4.1
+            const T scaled = value * _inv_cell_size;
+            const int32_t truncated = int32_t(scaled);
+            return truncated - (scaled < T(truncated) ? 1 : 0);
+        }
+
+        MVM_INLINE_NODISCARD uint32_t bucket_of(int32_t x,
+                                                int32_t y,
+                                                int32_t z) const
+        {
+            // Teschner et al.'s primes, then murmur3's finalizer so
+            // neighbouring cells land far apart in the table
+            uint32_t h = (uint32_t(x) * 73856093u) ^
+                         (uint32_t(y) * 19349663u) ^
+                         (uint32_t(z) * 83492791u);
+            h ^= h >> 16;
+            h *= 0x85ebca6bu;
+            h ^= h >> 13;
+            h *= 0xc2b2ae35u;
+            h ^= h >> 16;
+            return h & _bucket_mask;
+        }
+
+        MVM_INLINE_NODISCARD uint32_t
+        bucket_of(const storage_vec3_t& point) const
+        {
+            return bucket_of(cell_coordinate(point.get_x()),
+                             cell_coordinate(point.get_y()),
+                             cell_coordinate(point.get_z()));
+        }
+
+        void prepare(size_t count)
+        {
+            // Keeps the doubled bucket count within 32 bits
+            MVM_ASSERT_PRECONDITION(count <= (size_t(1) << 30));
+            uint32_t buckets = min_bucket_count;
+            while (buckets < 2 * count)
+            {
+                buckets <<= 1;
+            }
+
+            _bucket_mask = buckets - 1;
+            _bounds = aabb_t();
+            _cell_start.resize(size_t(buckets) + 1);
+            _cursor.resize(buckets);
+            _keys.resize(count);
+            _indices.resize(count);
+            _x.resize(count);
+            _y.resize(count);
+            _z.resize(count);
+            _cx.resize(count);
+            _cy.resize(count);
+            _cz.resize(count);
+        }
+
+        // A single pass counting sort, for grids small enough that the
+        // whole bucket table stays in cache
+        void counting_sort(const storage_vec3_t* points, size_t count)
+        {
+            prepare(count);
+            if (count == 0)
+            {
+                return;
+            }
+
+            uint32_t* counts = _cursor.data();
+            std::fill(_cursor.begin(), _cursor.end(), 0u);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint32_t key = bucket_of(points[i]);
+                _keys[i] = key;
+                ++counts[key];
+                _bounds.expand(vec3_t(points[i].get_x(), points[i].get_y(),
+                                      points[i].get_z()));
+            }
+
+            uint32_t sum = 0;
+            for (size_t b = 0; b < _cursor.size(); ++b)
+            {
+                _cell_start[b] = sum;
+                sum += counts[b];
+                counts[b] = _cell_start[b];
+            }
+            _cell_start.back() = sum;
+
+            // Scattering in index order leaves each bucket sorted
+            for (size_t i = 0; i < count; ++i)
+            {
+                _indices[_cursor[_keys[i]]++] = uint32_t(i);
+            }
+            gather(points, 0, count);
+        }
+
+        // Fills sorted positions [begin, end) from `_indices`
+        void gather(const storage_vec3_t* points, size_t begin, size_t end)
+        {
+            for (size_t k = begin; k < end; ++k)
+            {
+                const storage_vec3_t& p = points[_indices[k]];
+                _x[k] = p.get_x();
+                _y[k] = p.get_y();
+                _z[k] = p.get_z();
+                _cx[k] = cell_coordinate(p.get_x());
+                _cy[k] = cell_coordinate(p.get_y());
+                _cz[k] = cell_coordinate(p.get_z());
+            }
+        }
+
+        // Calls `visit(k)` for each sorted position in a cell `box`
+        // overlaps.  The caller tests the position itself.
+        template <typename Visit>
+        void for_each_candidate(const aabb_t& box, Visit&& visit) const
+        {
+            if (empty() || !box.intersects(_bounds))
+            {
+                return;
+            }
+
+            const aabb_t clipped = aabb_t::from_rtm(
+                rtm::vector_max(box.min_rtm(), _bounds.min_rtm()),
+                rtm::vector_min(box.max_rtm(), _bounds.max_rtm()));
+            const cell_t lo = cell_of(clipped.get_min());
+            const cell_t hi = cell_of(clipped.get_max());
+            const uint64_t cell_count =
+                uint64_t(hi.get_x() - lo.get_x() + 1) *
+                uint64_t(hi.get_y() - lo.get_y() + 1) *
+                uint64_t(hi.get_z() - lo.get_z() + 1);
+
+            // A query wider than the points themselves is cheaper as a scan
+            if (cell_count >= _indices.size())
+            {
+                for (size_t k = 0; k < _indices.size(); ++k)
+                {
+                    visit(k);
+                }
+                return;
+            }
+
+            for (int32_t z = lo.get_z(); z <= hi.get_z(); ++z)
+            {
+                for (int32_t y = lo.get_y(); y <= hi.get_y(); ++y)
+                {
+                    for (int32_t x = lo.get_x(); x <= hi.get_x(); ++x)
+                    {
+                        const uint32_t key = bucket_of(x, y, z);
+                        for (uint32_t k = _cell_start[key];
+                             k < _cell_start[key + 1]; ++k)
+                        {
+                            if (_cx[k] == x && _cy[k] == y && _cz[k] == z)
+                            {
+                                visit(k);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    using spatial_hash_gridf = spatial_hash_grid<float>;
+    using spatial_hash_gridd = spatial_hash_grid<double>;
+}  // namespace move::math
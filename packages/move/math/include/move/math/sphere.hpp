@@ -0,0 +1,379 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/mat4x4.hpp>
+#include <move/math/plane.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    /**
+     * @brief A sphere stored as a single vector, the center in xyz and the
+     * radius in w.  Queries treat it as a solid ball, so points inside have
+     * a negative signed distance.
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct sphere
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+        using vec3_t = vec3<T, acceleration>;
+        using plane_t = plane<T>;
+        using mat4x4_t = mat4x4<T>;
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using component_type = T;
+
+    private:
+        rtm_vec4_t _value;
+
+        // Constructors
+    public:
+        // A zero radius sphere at the origin
+        MVM_INLINE sphere() : _value(rtm::vector_zero())
+        {
+        }
+
+        MVM_INLINE sphere(const vec3_t& center, const T& radius) :
+            _value(rtm::vector_set_w(center.to_rtm(), radius))
+        {
+        }
+
+        MVM_INLINE sphere(const sphere& other) : _value(other._value)
+        {
+        }
+
+        MVM_INLINE sphere& operator=(const sphere& other)
+        {
+            _value = other._value;
+            return *this;
+        }
+
+        MVM_INLINE_NODISCARD static sphere from_rtm(const rtm_vec4_t& value)
+        {
+            sphere result;
+            result._value = value;
+            return result;
+        }
+
+        /**
+         * @brief Creates a sphere enclosing a set of points.  The center is
+         * the middle of their bounding box, which is fast and within a few
+         * percent of the smallest sphere for typical meshes, but not
+         * minimal.
+         *
+         * @param points The points to enclose
+         * @param count The number of points.  A sphere of zero radius at the
+         * origin is returned if this is zero.
+         */
+        MVM_INLINE_NODISCARD static sphere from_points(
+            const vec3<T, Acceleration::Scalar>* points,
+            size_t count)
+        {
+            using namespace rtm;
+            if (count == 0)
+            {
+                return sphere();
+            }
+
+            rtm_vec4_t min = vector_load3(points[0].to_array());
+            rtm_vec4_t max = min;
+            for (size_t i = 1; i < count; ++i)
+            {
+                const rtm_vec4_t p = vector_load3(points[i].to_array());
+                min = vector_min(min, p);
+                max = vector_max(max, p);
+            }
+
+            const rtm_vec4_t center = vector_mul(vector_add(min, max), T(0.5));
+            T radius_sq = T(0);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const rtm_vec4_t offset =
+                    vector_sub(vector_load3(points[i].to_array()), center);
+                radius_sq =
+                    math::max(radius_sq, T(vector_dot3(offset, offset)));
+            }
+            return from_rtm(vector_set_w(center, math::sqrt(radius_sq)));
+        }
+
+        /**
+         * @brief Creates the smallest sphere enclosing two spheres.
+         */
+        MVM_INLINE_NODISCARD static sphere merged(const sphere& a,
+                                                  const sphere& b)
+        {
+            using namespace rtm;
+            const rtm_vec4_t offset = vector_sub(b._value, a._value);
+            const T distance = T(vector_length3(offset));
+            const T ra = a.get_radius();
+            const T rb = b.get_radius();
+            if (distance + rb <= ra)
+            {
+                return a;
+            }
+            if (distance + ra <= rb)
+            {
+                return b;
+            }
+
+            // The new center lies on the line between the centers, moved
+            // from `a` toward `b` by the growth in radius
+            const T radius = (distance + ra + rb) * T(0.5);
+            const rtm_vec4_t center = vector_mul_add(
+                offset, (radius - ra) / distance, a._value);
+            return from_rtm(vector_set_w(center, radius));
+        }
+
+        // Stream overload operators
+    public:
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(
+            std::basic_ostream<CharT, Traits>& os, const sphere& s)
+        {
+#if defined(MVM_HAS_MOVE_CORE)
+            os << move::meta::type_name<sphere>() << "(";
+#else
+            os << "sphere(";
+#endif
+            os << s.get_center() << ", " << s.get_radius() << ")";
+            return os;
+        }
+
+        // Comparison operators
+    public:
+        MVM_INLINE_NODISCARD bool operator==(const sphere& other) const
+        {
+            return rtm::vector_all_near_equal(_value, other._value);
+        }
+
+        MVM_INLINE_NODISCARD bool operator!=(const sphere& other) const
+        {
+            return !(*this == other);
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD vec3_t get_center() const
+        {
+            return vec3_t::from_rtm(_value);
+        }
+
+        MVM_INLINE_NODISCARD T get_radius() const
+        {
+            return rtm::vector_get_w(_value);
+        }
+
+        MVM_INLINE_NODISCARD rtm_vec4_t to_rtm() const
+        {
+            return _value;
+        }
+
+        // Geometric queries
+    public:
+        // The distance from the surface, negative inside the sphere
+        MVM_INLINE_NODISCARD T signed_distance(const vec3_t& point) const
+        {
+            using namespace rtm;
+            return T(vector_length3(vector_sub(point.to_rtm(), _value))) -
+                   get_radius();
+        }
+
+        MVM_INLINE_NODISCARD bool contains(const vec3_t& point) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t offset = vector_sub(point.to_rtm(), _value);
+            const T radius = get_radius();
+            return T(vector_dot3(offset, offset)) <= radius * radius;
+        }
+
+        /**
+         * @brief The point of the solid sphere closest to `point`, which is
+         * `point` itself if it is inside.
+         */
+        MVM_INLINE_NODISCARD vec3_t closest_point(const vec3_t& point) const
+        {
+            return contains(point) ? point : project_point(point);
+        }
+
+        /**
+         * @brief Projects a point onto the surface of the sphere along the
+         * line from the center.
+         *
+         * @return vec3_t The projected point.  A point at the center has no
+         * direction, and is projected along +Y.
+         */
+        MVM_INLINE_NODISCARD vec3_t project_point(const vec3_t& point) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t offset = vector_sub(point.to_rtm(), _value);
+            const T length_sq = T(vector_dot3(offset, offset));
+            const rtm_vec4_t direction =
+                length_sq > std::numeric_limits<T>::epsilon()
+                    ? vector_mul(offset, T(1) / math::sqrt(length_sq))
+                    : vector_set(T(0), T(1), T(0), T(0));
+            return vec3_t::from_rtm(
+                vector_mul_add(direction, get_radius(), _value));
+        }
+
+        /**
+         * @brief The point of the sphere farthest along `direction`, its
+         * support mapping for gjk_distance.  A zero direction picks +Y.
+         */
+        MVM_INLINE_NODISCARD vec3_t support(const vec3_t& direction) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t d = direction.to_rtm();
+            const T length_sq = T(vector_dot3(d, d));
+            const rtm_vec4_t unit =
+                length_sq > std::numeric_limits<T>::min()
+                    ? vector_mul(d, T(1) / math::sqrt(length_sq))
+                    : vector_set(T(0), T(1), T(0), T(0));
+            return vec3_t::from_rtm(vector_mul_add(unit, get_radius(), _value));
+        }
+
+        /**
+         * @brief The sphere as its center grown by its radius, which lets
+         * gjk_distance work on the center alone and add the radius back.
+         */
+        MVM_INLINE_NODISCARD vec3_t core_support(const vec3_t&) const
+        {
+            return get_center();
+        }
+
+        MVM_INLINE_NODISCARD T margin() const
+        {
+            return get_radius();
+        }
+
+        MVM_INLINE_NODISCARD bool intersects(const sphere& other) const
+        {
+            using namespace rtm;
+            const rtm_vec4_t offset = vector_sub(other._value, _value);
+            const T radii = get_radius() + other.get_radius();
+            return T(vector_dot3(offset, offset)) <= radii * radii;
+        }
+
+        // True if the plane passes through the sphere.  The plane must be
+        // normalized.
+        MVM_INLINE_NODISCARD bool intersects(const plane_t& p) const
+        {
+            return math::abs(p.signed_distance(get_center())) <= get_radius();
+        }
+
+        /**
+         * @brief Transforms the sphere by an affine matrix.  Non-uniform
+         * scale would turn it into an ellipsoid, so the radius grows by the
+         * largest axis scale to keep the result enclosing it.
+         *
+         * @param mat The transform to apply
+         * @return sphere The transformed sphere
+         */
+        MVM_INLINE_NODISCARD sphere transformed(const mat4x4_t& mat) const
+        {
+            using namespace rtm;
+            const auto m = mat.to_rtm();
+            const T scale_sq = math::max(
+                T(vector_length_squared3(m.x_axis)),
+                math::max(T(vector_length_squared3(m.y_axis)),
+                          T(vector_length_squared3(m.z_axis))));
+            return sphere(mat.transform_point(get_center()),
+                          get_radius() * math::sqrt(scale_sq));
+        }
+
+        // Bulk operations
+    public:
+        /**
+         * @brief Computes the signed distance from the surface to each point
+         * of an array.
+         *
+         * @param points The points to measure
+         * @param out Receives one distance per point
+         * @param count The number of points
+         */
+        MVM_INLINE void signed_distances(
+            const vec3<T, Acceleration::Scalar>* points,
+            T* out,
+            size_t count) const
+        {
+            using namespace rtm;
+            const T radius = get_radius();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const rtm_vec4_t offset =
+                    vector_sub(vector_load3(points[i].to_array()), _value);
+                out[i] = T(vector_length3(offset)) - radius;
+            }
+        }
+
+        /**
+         * @brief Structure-of-arrays variant of signed_distances.  The
+         * square root may set errno, so GCC only vectorizes this loop at
+         * -O3 when built with -fno-math-errno (implied by -ffast-math);
+         * otherwise it runs one point at a time.
+         *
+         * @param points The points to measure
+         * @param out Receives one distance per point
+         * @param count The number of points
+         */
+        MVM_INLINE void signed_distances(soa_vec3<const T> points,
+                                         T* out,
+                                         size_t count) const
+        {
+            using namespace rtm;
+            const T cx = vector_get_x(_value);
+            const T cy = vector_get_y(_value);
+            const T cz = vector_get_z(_value);
+            const T radius = vector_get_w(_value);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const T x = points.x[i] - cx;
+                const T y = points.y[i] - cy;
+                const T z = points.z[i] - cz;
+                out[i] = math::sqrt(x * x + y * y + z * z) - radius;
+            }
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE sphere& set_center(const vec3_t& center)
+        {
+            _value = rtm::vector_set_w(center.to_rtm(), get_radius());
+            return *this;
+        }
+
+        MVM_INLINE sphere& set_radius(const T& radius)
+        {
+            _value = rtm::vector_set_w(_value, radius);
+            return *this;
+        }
+
+        MVM_INLINE sphere& transform(const mat4x4_t& mat)
+        {
+            *this = transformed(mat);
+            return *this;
+        }
+    };
+
+    using spheref = sphere<float>;
+    using sphered = sphere<double>;
+
+    template <typename T>
+    MVM_INLINE_NODISCARD bool approx_equal(
+        const sphere<T>& a,
+        const sphere<T>& b,
+        const T& epsilon = std::numeric_limits<T>::epsilon())
+    {
+        return rtm::vector_all_near_equal(a.to_rtm(), b.to_rtm(), epsilon);
+    }
+}  // namespace move::math
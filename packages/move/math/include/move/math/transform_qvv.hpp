@@ -0,0 +1,326 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+#include <rtm/qvvd.h>
+#include <rtm/qvvf.h>
+
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/mat4x4.hpp>
+#include <move/math/quat.hpp>
+#include <move/math/rtm/rtm_common.hpp>
+#include <move/math/vec3.hpp>
+
+namespace move::math
+{
+    namespace simd_rtm::detail
+    {
+        MVM_TYPE_WRAPPER(qvvf, rtm::qvvf)
+        MVM_TYPE_WRAPPER(qvvd, rtm::qvvd)
+
+        template <typename T>
+        using qvv = std::conditional_t<std::is_same_v<T, float>, qvvf, qvvd>;
+    }  // namespace simd_rtm::detail
+
+    /**
+     * @brief A transform stored as its scale, rotation and translation
+     * rather than as a matrix.
+     *
+     * Applies scale, then rotation, then translation, the same as
+     * `mat4x4::trs`.  Composing two transforms is a quaternion multiply plus
+     * a point transform, which is much cheaper than a 4x4 matrix multiply,
+     * so hierarchies should be composed as transform_qvv and only converted
+     * to a matrix at the end.  Composition follows `mat4x4`: `a * b` applies
+     * `a` first.
+     *
+     * Non-uniform scale under a rotated parent produces shear, which this
+     * type cannot represent.  In that case composition keeps the scale
+     * per-axis, as most engines do for "lossy" world scale.
+     */
+    template <typename T, typename wrapper_type = simd_rtm::detail::qvv<T>>
+        requires std::is_floating_point_v<T>
+    struct transform_qvv
+    {
+    public:
+        constexpr static auto acceleration = Acceleration::RTM;
+        constexpr static bool has_fields = false;
+        constexpr static bool has_pointer_semantics = false;
+
+    private:
+        using rtm_t = typename wrapper_type::type;
+        rtm_t _value;
+
+    public:
+        using rtm_vec4_t = typename simd_rtm::detail::v4<T>::type;
+        using rtm_qvv_t = rtm_t;
+        using vec3_t = vec3<T, acceleration>;
+        using quat_t = quat<T>;
+        using mat4x4_t = mat4x4<T>;
+        using component_type = T;
+
+        // Constructors
+    public:
+        MVM_INLINE transform_qvv() : _value(rtm::qvv_identity())
+        {
+        }
+
+        MVM_INLINE transform_qvv(const rtm_t& data) : _value(data)
+        {
+        }
+
+        MVM_INLINE transform_qvv(const vec3_t& translation,
+                                 const quat_t& rotation,
+                                 const vec3_t& scale) :
+            _value(rtm::qvv_set(
+                rotation.to_rtm(), translation.to_rtm(), scale.to_rtm()))
+        {
+        }
+
+        MVM_INLINE transform_qvv(const transform_qvv& other) :
+            _value(other._value)
+        {
+        }
+
+        MVM_INLINE transform_qvv& operator=(const transform_qvv& other)
+        {
+            _value = other._value;
+            return *this;
+        }
+
+        MVM_INLINE_NODISCARD rtm_t to_rtm() const
+        {
+            return _value;
+        }
+
+        MVM_INLINE_NODISCARD static transform_qvv from_rtm(const rtm_t& data)
+        {
+            return data;
+        }
+
+        // Arithmetic operations
+    public:
+        MVM_INLINE_NODISCARD transform_qvv operator*(
+            const transform_qvv& other) const
+        {
+            return rtm::qvv_mul(_value, other._value);
+        }
+
+        MVM_INLINE_NODISCARD vec3_t transform_point(const vec3_t& point) const
+        {
+            return vec3_t::from_rtm(
+                rtm::qvv_mul_point3(point.to_rtm(), _value));
+        }
+
+        MVM_INLINE_NODISCARD vec3_t transform_vector(const vec3_t& vector) const
+        {
+            using namespace rtm;
+            return vec3_t::from_rtm(quat_mul_vector3(
+                vector_mul(vector.to_rtm(), _value.scale), _value.rotation));
+        }
+
+        // Stream overload operators
+    public:
+        template <typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(
+            std::basic_ostream<CharT, Traits>& os, const transform_qvv& qvv)
+        {
+#if defined(MVM_HAS_MOVE_CORE)
+            os << move::meta::type_name<transform_qvv>() << "(";
+#else
+            os << "transform_qvv(";
+#endif
+            os << qvv.get_translation() << ", " << qvv.get_rotation() << ", "
+               << qvv.get_scale() << ")";
+            return os;
+        }
+
+        // Comparison operators
+    public:
+        MVM_INLINE_NODISCARD bool operator==(const transform_qvv& other) const
+        {
+            return get_translation() == other.get_translation() &&
+                   get_rotation() == other.get_rotation() &&
+                   get_scale() == other.get_scale();
+        }
+
+        MVM_INLINE_NODISCARD bool operator!=(const transform_qvv& other) const
+        {
+            return !(*this == other);
+        }
+
+        // Element access
+    public:
+        MVM_INLINE_NODISCARD vec3_t get_translation() const
+        {
+            return vec3_t::from_rtm(_value.translation);
+        }
+
+        MVM_INLINE_NODISCARD quat_t get_rotation() const
+        {
+            return quat_t::from_rtm(_value.rotation);
+        }
+
+        MVM_INLINE_NODISCARD vec3_t get_scale() const
+        {
+            return vec3_t::from_rtm(_value.scale);
+        }
+
+        MVM_INLINE transform_qvv& set_translation(const vec3_t& translation)
+        {
+            _value.translation = translation.to_rtm();
+            return *this;
+        }
+
+        MVM_INLINE transform_qvv& set_rotation(const quat_t& rotation)
+        {
+            _value.rotation = rotation.to_rtm();
+            return *this;
+        }
+
+        MVM_INLINE transform_qvv& set_scale(const vec3_t& scale)
+        {
+            _value.scale = scale.to_rtm();
+            return *this;
+        }
+
+        // Serialization
+    public:
+        template <typename Archive>
+        MVM_INLINE void serialize(Archive& archive)
+        {
+            // Translation, rotation, then scale
+            using namespace rtm;
+            T data[10];
+            if constexpr (Archive::is_loading::value)
+            {
+                archive(data);
+                _value = qvv_set(quat_load(data + 3), vector_load3(data),
+                                 vector_load3(data + 7));
+            }
+            else
+            {
+                vector_store3(_value.translation, data);
+                quat_store(_value.rotation, data + 3);
+                vector_store3(_value.scale, data + 7);
+                archive(data);
+            }
+        }
+
+        // Mathematical operations
+    public:
+        MVM_INLINE_NODISCARD transform_qvv inverse() const
+        {
+            return rtm::qvv_inverse(_value);
+        }
+
+        MVM_INLINE_NODISCARD transform_qvv normalized() const
+        {
+            return rtm::qvv_normalize(_value);
+        }
+
+        // Mutators
+    public:
+        MVM_INLINE transform_qvv& invert_in_place()
+        {
+            _value = rtm::qvv_inverse(_value);
+            return *this;
+        }
+
+        MVM_INLINE transform_qvv& normalize()
+        {
+            _value = rtm::qvv_normalize(_value);
+            return *this;
+        }
+
+        // Conversions
+    public:
+        /**
+         * @brief Converts to a row-major affine matrix.  Equivalent to
+         * `mat4x4::trs` with the same components.
+         */
+        MVM_INLINE_NODISCARD mat4x4_t to_mat4x4() const
+        {
+            return rtm::matrix_cast(rtm::matrix_from_qvv(_value));
+        }
+
+        // Statics
+    public:
+        MVM_INLINE_NODISCARD static transform_qvv identity()
+        {
+            return transform_qvv();
+        }
+
+        /**
+         * @brief Interpolates between two transforms.  Translation and scale
+         * are interpolated linearly and rotation along the shortest path.
+         *
+         * @param a The start transform
+         * @param b The end transform
+         * @param t The interpolation factor
+         * @return transform_qvv The interpolated transform
+         */
+        MVM_INLINE_NODISCARD static transform_qvv lerp(const transform_qvv& a,
+                                                       const transform_qvv& b,
+                                                       const T& t)
+        {
+            using namespace rtm;
+            return qvv_set(
+                quat_lerp(a._value.rotation, b._value.rotation, t),
+                vector_lerp(a._value.translation, b._value.translation, t),
+                vector_lerp(a._value.scale, b._value.scale, t));
+        }
+
+        /**
+         * @brief Computes the weighted blend of several transforms, as used
+         * when mixing animation poses.  Rotations are aligned to the first
+         * one before being summed so the blend takes the shortest path.
+         *
+         * @param transforms The transforms to blend
+         * @param weights The weight of each transform.  Should sum to one.
+         * @param count The number of transforms.  Must be at least one.
+         * @return transform_qvv The blended transform
+         */
+        MVM_INLINE_NODISCARD static transform_qvv blend(
+            const transform_qvv* transforms, const T* weights, size_t count)
+        {
+            using namespace rtm;
+            const rtm_t& first = transforms[0]._value;
+            const rtm_vec4_t pivot = quat_to_vector(first.rotation);
+            rtm_vec4_t rotation = vector_mul(pivot, weights[0]);
+            rtm_vec4_t translation = vector_mul(first.translation, weights[0]);
+            rtm_vec4_t scale = vector_mul(first.scale, weights[0]);
+
+            for (size_t i = 1; i < count; ++i)
+            {
+                const rtm_t& value = transforms[i]._value;
+                const T weight = weights[i];
+                const rtm_vec4_t q = quat_to_vector(value.rotation);
+                const T rotation_weight =
+                    T(vector_dot(q, pivot)) < T(0) ? -weight : weight;
+                rotation = vector_mul_add(q, rotation_weight, rotation);
+                translation =
+                    vector_mul_add(value.translation, weight, translation);
+                scale = vector_mul_add(value.scale, weight, scale);
+            }
+
+            return qvv_set(quat_normalize(vector_to_quat(rotation)),
+                           translation, scale);
+        }
+    };
+
+    using transform_qvvf = transform_qvv<float>;
+    using transform_qvvd = transform_qvv<double>;
+
+    template <typename T>
+    MVM_INLINE_NODISCARD bool approx_equal(
+        const transform_qvv<T>& a,
+        const transform_qvv<T>& b,
+        const T& epsilon = std::numeric_limits<T>::epsilon())
+    {
+        return approx_equal(a.get_translation(), b.get_translation(),
+                            epsilon) &&
+               approx_equal(a.get_rotation(), b.get_rotation(), epsilon) &&
+               approx_equal(a.get_scale(), b.get_scale(), epsilon);
+    }
+}  // namespace move::math
@@ -26,37 +26,38 @@ namespace move::math
 
         // Constructors
     public:
-        MVM_INLINE vec2() : base_t()
+        MVM_INLINE constexpr vec2() : base_t()
         {
         }
 
         template <typename ComponentT, Acceleration OtherAccel>
-        MVM_INLINE vec2(vec2<ComponentT, OtherAccel> other) :
+        MVM_INLINE constexpr vec2(vec2<ComponentT, OtherAccel> other) :
             base_t(other.get_x(), other.get_y())
         {
         }
 
         // implicit conversion from base_vec2_t
-        MVM_INLINE vec2(base_t other) : base_t(other.get_x(), other.get_y())
+        MVM_INLINE constexpr vec2(base_t other) :
+            base_t(other.get_x(), other.get_y())
         {
         }
 
         template <typename ComponentT, Acceleration OtherAccel>
         // implicit conversion from base_vec2_t
-        MVM_INLINE vec2(base_vec2_t<ComponentT, OtherAccel> other) :
+        MVM_INLINE constexpr vec2(base_vec2_t<ComponentT, OtherAccel> other) :
             base_t(other.get_x(), other.get_y())
         {
         }
 
-        MVM_INLINE vec2(const T& x, const T& y) : base_t(x, y)
+        MVM_INLINE constexpr vec2(const T& x, const T& y) : base_t(x, y)
         {
         }
 
-        MVM_INLINE vec2(const vec2& other) : base_t(other)
+        MVM_INLINE constexpr vec2(const vec2& other) : base_t(other)
         {
         }
 
-        MVM_INLINE vec2& operator=(const vec2& other)
+        MVM_INLINE constexpr vec2& operator=(const vec2& other)
         {
             base_t::operator=(other);
             return *this;
@@ -66,49 +67,49 @@ namespace move::math
     public:
         // Assignment operators
     public:
-        MVM_INLINE vec2& operator+=(const vec2& other)
+        MVM_INLINE constexpr vec2& operator+=(const vec2& other)
         {
             base_t::operator+=(other);
             return *this;
         }
 
-        MVM_INLINE vec2& operator-=(const vec2& other)
+        MVM_INLINE constexpr vec2& operator-=(const vec2& other)
         {
             base_t::operator-=(other);
             return *this;
         }
 
-        MVM_INLINE vec2& operator*=(const vec2& other)
+        MVM_INLINE constexpr vec2& operator*=(const vec2& other)
         {
             base_t::operator*=(other);
             return *this;
         }
 
-        MVM_INLINE vec2& operator/=(const vec2& other)
+        MVM_INLINE constexpr vec2& operator/=(const vec2& other)
         {
             base_t::operator/=(other);
             return *this;
         }
 
-        MVM_INLINE vec2& operator+=(const T& scalar)
+        MVM_INLINE constexpr vec2& operator+=(const T& scalar)
         {
             base_t::operator+=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec2& operator-=(const T& scalar)
+        MVM_INLINE constexpr vec2& operator-=(const T& scalar)
         {
             base_t::operator-=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec2& operator*=(const T& scalar)
+        MVM_INLINE constexpr vec2& operator*=(const T& scalar)
         {
             base_t::operator*=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec2& operator/=(const T& scalar)
+        MVM_INLINE constexpr vec2& operator/=(const T& scalar)
         {
             base_t::operator/=(scalar);
             return *this;
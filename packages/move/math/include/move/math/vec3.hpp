@@ -50,36 +50,36 @@ namespace move::math
 
         // Constructors
     public:
-        MVM_INLINE vec3() : base_t()
+        MVM_INLINE constexpr vec3() : base_t()
         {
         }
 
         template <typename ComponentT, Acceleration OtherAccel>
-        MVM_INLINE vec3(vec3<ComponentT, OtherAccel> other) :
+        MVM_INLINE constexpr vec3(vec3<ComponentT, OtherAccel> other) :
             base_t(other.get_x(), other.get_y(), other.get_z())
         {
         }
 
-        MVM_INLINE vec3(const scalar::base_vec3<T>& rhs) :
+        MVM_INLINE constexpr vec3(const scalar::base_vec3<T>& rhs) :
             base_t(rhs.x, rhs.y, rhs.z)
         {
         }
 
-        MVM_INLINE vec3(const simd_rtm::base_vec3<T>& rhs) :
+        MVM_INLINE constexpr vec3(const simd_rtm::base_vec3<T>& rhs) :
             base_t(rhs.get_x(), rhs.get_y(), rhs.get_z())
         {
         }
 
-        MVM_INLINE vec3(const T& x, const T& y = 0, const T& z = 0) :
+        MVM_INLINE constexpr vec3(const T& x, const T& y = 0, const T& z = 0) :
             base_t(x, y, z)
         {
         }
 
-        MVM_INLINE vec3(const vec3& other) : base_t(other)
+        MVM_INLINE constexpr vec3(const vec3& other) : base_t(other)
         {
         }
 
-        MVM_INLINE vec3& operator=(const vec3& other)
+        MVM_INLINE constexpr vec3& operator=(const vec3& other)
         {
             base_t::operator=(other);
             return *this;
@@ -88,7 +88,8 @@ namespace move::math
         // Vector length conversions
     public:
         template <typename OtherT, Acceleration OtherAccel>
-        MVM_INLINE vec3(const vec2<OtherT, OtherAccel>& vec, const T& z = 0) :
+        MVM_INLINE constexpr vec3(const vec2<OtherT, OtherAccel>& vec,
+                                  const T& z = 0) :
             base_t(vec.get_x(), vec.get_y(), z)
         {
         }
@@ -142,32 +143,32 @@ namespace move::math
         // Swizzles
     public:
         using vec2_t = vec2<T, Accel>;
-        MVM_INLINE_NODISCARD vec2_t xy() const
+        MVM_INLINE_NODISCARD constexpr vec2_t xy() const
         {
             return vec2_t(base_t::get_x(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec2_t xz() const
+        MVM_INLINE_NODISCARD constexpr vec2_t xz() const
         {
             return vec2_t(base_t::get_x(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec2_t yx() const
+        MVM_INLINE_NODISCARD constexpr vec2_t yx() const
         {
             return vec2_t(base_t::get_y(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec2_t yz() const
+        MVM_INLINE_NODISCARD constexpr vec2_t yz() const
         {
             return vec2_t(base_t::get_y(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec2_t zx() const
+        MVM_INLINE_NODISCARD constexpr vec2_t zx() const
         {
             return vec2_t(base_t::get_z(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec2_t zy() const
+        MVM_INLINE_NODISCARD constexpr vec2_t zy() const
         {
             return vec2_t(base_t::get_z(), base_t::get_y());
         }
@@ -203,49 +204,49 @@ namespace move::math
 
         // Assignment operators
     public:
-        MVM_INLINE vec3& operator+=(const vec3& other)
+        MVM_INLINE constexpr vec3& operator+=(const vec3& other)
         {
             base_t::operator+=(other);
             return *this;
         }
 
-        MVM_INLINE vec3& operator-=(const vec3& other)
+        MVM_INLINE constexpr vec3& operator-=(const vec3& other)
         {
             base_t::operator-=(other);
             return *this;
         }
 
-        MVM_INLINE vec3& operator*=(const vec3& other)
+        MVM_INLINE constexpr vec3& operator*=(const vec3& other)
         {
             base_t::operator*=(other);
             return *this;
         }
 
-        MVM_INLINE vec3& operator/=(const vec3& other)
+        MVM_INLINE constexpr vec3& operator/=(const vec3& other)
         {
             base_t::operator/=(other);
             return *this;
         }
 
-        MVM_INLINE vec3& operator+=(const T& scalar)
+        MVM_INLINE constexpr vec3& operator+=(const T& scalar)
         {
             base_t::operator+=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec3& operator-=(const T& scalar)
+        MVM_INLINE constexpr vec3& operator-=(const T& scalar)
         {
             base_t::operator-=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec3& operator*=(const T& scalar)
+        MVM_INLINE constexpr vec3& operator*=(const T& scalar)
         {
             base_t::operator*=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec3& operator/=(const T& scalar)
+        MVM_INLINE constexpr vec3& operator/=(const T& scalar)
         {
             base_t::operator/=(scalar);
             return *this;
@@ -337,6 +338,18 @@ namespace move::math
         }
     }
 
+    /**
+     * @brief A structure-of-arrays view over a set of 3D vectors.  Use
+     * `soa_vec3<const T>` for read-only inputs.
+     */
+    template <typename T>
+    struct soa_vec3
+    {
+        T* x;
+        T* y;
+        T* z;
+    };
+
     namespace traits
     {
         template <typename T, Acceleration Accel>
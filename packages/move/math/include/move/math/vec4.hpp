@@ -51,40 +51,40 @@ namespace move::math
 
         // Constructors
     public:
-        MVM_INLINE vec4() : base_t()
+        MVM_INLINE constexpr vec4() : base_t()
         {
         }
 
         template <typename ComponentT, Acceleration OtherAccel>
-        MVM_INLINE vec4(vec4<ComponentT, OtherAccel> other) :
+        MVM_INLINE constexpr vec4(vec4<ComponentT, OtherAccel> other) :
             base_t(other.get_x(), other.get_y(), other.get_z(), other.get_w())
         {
         }
 
         // implicit conversion from base_vec4_t
-        MVM_INLINE vec4(const scalar::base_vec4<T>& rhs) :
+        MVM_INLINE constexpr vec4(const scalar::base_vec4<T>& rhs) :
             base_t(rhs.x, rhs.y, rhs.z, rhs.w)
         {
         }
 
-        MVM_INLINE vec4(const simd_rtm::base_vec4<T>& rhs) :
+        MVM_INLINE constexpr vec4(const simd_rtm::base_vec4<T>& rhs) :
             base_t(rhs.get_x(), rhs.get_y(), rhs.get_z(), rhs.get_w())
         {
         }
 
-        MVM_INLINE vec4(const T& x,
-                        const T& y = 0,
-                        const T& z = 0,
-                        const T& w = 0) :
+        MVM_INLINE constexpr vec4(const T& x,
+                                  const T& y = 0,
+                                  const T& z = 0,
+                                  const T& w = 0) :
             base_t(x, y, z, w)
         {
         }
 
-        MVM_INLINE vec4(const vec4& other) : base_t(other)
+        MVM_INLINE constexpr vec4(const vec4& other) : base_t(other)
         {
         }
 
-        MVM_INLINE vec4& operator=(const vec4& other)
+        MVM_INLINE constexpr vec4& operator=(const vec4& other)
         {
             base_t::operator=(other);
             return *this;
@@ -93,15 +93,16 @@ namespace move::math
         // Vector length conversions
     public:
         template <typename OtherT, Acceleration OtherAccel>
-        MVM_INLINE vec4(const vec2<OtherT, OtherAccel>& vec,
-                        const T& z = 0,
-                        const T& w = 0) :
+        MVM_INLINE constexpr vec4(const vec2<OtherT, OtherAccel>& vec,
+                                  const T& z = 0,
+                                  const T& w = 0) :
             base_t(vec.get_x(), vec.get_y(), z, w)
         {
         }
 
         template <typename OtherT, Acceleration OtherAccel>
-        MVM_INLINE vec4(const vec3<OtherT, OtherAccel>& vec, const T& w = 0) :
+        MVM_INLINE constexpr vec4(const vec3<OtherT, OtherAccel>& vec,
+                                  const T& w = 0) :
             base_t(vec.get_x(), vec.get_y(), vec.get_z(), w)
         {
         }
@@ -141,184 +142,184 @@ namespace move::math
     public:
         // Vec2 swizzles
         using vec2_t = vec2<T, Accel>;
-        MVM_INLINE_NODISCARD vec2_t xy() const
+        MVM_INLINE_NODISCARD constexpr vec2_t xy() const
         {
             return vec2_t(base_t::get_x(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec2_t xz() const
+        MVM_INLINE_NODISCARD constexpr vec2_t xz() const
         {
             return vec2_t(base_t::get_x(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec2_t xw() const
+        MVM_INLINE_NODISCARD constexpr vec2_t xw() const
         {
             return vec2_t(base_t::get_x(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec2_t yx() const
+        MVM_INLINE_NODISCARD constexpr vec2_t yx() const
         {
             return vec2_t(base_t::get_y(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec2_t yz() const
+        MVM_INLINE_NODISCARD constexpr vec2_t yz() const
         {
             return vec2_t(base_t::get_y(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec2_t yw() const
+        MVM_INLINE_NODISCARD constexpr vec2_t yw() const
         {
             return vec2_t(base_t::get_y(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec2_t zx() const
+        MVM_INLINE_NODISCARD constexpr vec2_t zx() const
         {
             return vec2_t(base_t::get_z(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec2_t zy() const
+        MVM_INLINE_NODISCARD constexpr vec2_t zy() const
         {
             return vec2_t(base_t::get_z(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec2_t zw() const
+        MVM_INLINE_NODISCARD constexpr vec2_t zw() const
         {
             return vec2_t(base_t::get_z(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec2_t wx() const
+        MVM_INLINE_NODISCARD constexpr vec2_t wx() const
         {
             return vec2_t(base_t::get_w(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec2_t wy() const
+        MVM_INLINE_NODISCARD constexpr vec2_t wy() const
         {
             return vec2_t(base_t::get_w(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec2_t wz() const
+        MVM_INLINE_NODISCARD constexpr vec2_t wz() const
         {
             return vec2_t(base_t::get_w(), base_t::get_z());
         }
 
         // Vec3 swizzles
         using vec3_t = vec3<T, Accel>;
-        MVM_INLINE_NODISCARD vec3_t xyz() const
+        MVM_INLINE_NODISCARD constexpr vec3_t xyz() const
         {
             return vec3_t(base_t::get_x(), base_t::get_y(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec3_t xyw() const
+        MVM_INLINE_NODISCARD constexpr vec3_t xyw() const
         {
             return vec3_t(base_t::get_x(), base_t::get_y(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec3_t xzy() const
+        MVM_INLINE_NODISCARD constexpr vec3_t xzy() const
         {
             return vec3_t(base_t::get_x(), base_t::get_z(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec3_t xzw() const
+        MVM_INLINE_NODISCARD constexpr vec3_t xzw() const
         {
             return vec3_t(base_t::get_x(), base_t::get_z(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec3_t xwy() const
+        MVM_INLINE_NODISCARD constexpr vec3_t xwy() const
         {
             return vec3_t(base_t::get_x(), base_t::get_w(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec3_t xwz() const
+        MVM_INLINE_NODISCARD constexpr vec3_t xwz() const
         {
             return vec3_t(base_t::get_x(), base_t::get_w(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec3_t yxz() const
+        MVM_INLINE_NODISCARD constexpr vec3_t yxz() const
         {
             return vec3_t(base_t::get_y(), base_t::get_x(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec3_t yxw() const
+        MVM_INLINE_NODISCARD constexpr vec3_t yxw() const
         {
             return vec3_t(base_t::get_y(), base_t::get_x(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec3_t yzx() const
+        MVM_INLINE_NODISCARD constexpr vec3_t yzx() const
         {
             return vec3_t(base_t::get_y(), base_t::get_z(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec3_t yzw() const
+        MVM_INLINE_NODISCARD constexpr vec3_t yzw() const
         {
             return vec3_t(base_t::get_y(), base_t::get_z(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec3_t ywx() const
+        MVM_INLINE_NODISCARD constexpr vec3_t ywx() const
         {
             return vec3_t(base_t::get_y(), base_t::get_w(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec3_t ywz() const
+        MVM_INLINE_NODISCARD constexpr vec3_t ywz() const
         {
             return vec3_t(base_t::get_y(), base_t::get_w(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec3_t zxy() const
+        MVM_INLINE_NODISCARD constexpr vec3_t zxy() const
         {
             return vec3_t(base_t::get_z(), base_t::get_x(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec3_t zxw() const
+        MVM_INLINE_NODISCARD constexpr vec3_t zxw() const
         {
             return vec3_t(base_t::get_z(), base_t::get_x(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec3_t zyx() const
+        MVM_INLINE_NODISCARD constexpr vec3_t zyx() const
         {
             return vec3_t(base_t::get_z(), base_t::get_y(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec3_t zyw() const
+        MVM_INLINE_NODISCARD constexpr vec3_t zyw() const
         {
             return vec3_t(base_t::get_z(), base_t::get_y(), base_t::get_w());
         }
 
-        MVM_INLINE_NODISCARD vec3_t zwx() const
+        MVM_INLINE_NODISCARD constexpr vec3_t zwx() const
         {
             return vec3_t(base_t::get_z(), base_t::get_w(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec3_t zwy() const
+        MVM_INLINE_NODISCARD constexpr vec3_t zwy() const
         {
             return vec3_t(base_t::get_z(), base_t::get_w(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec3_t wxy() const
+        MVM_INLINE_NODISCARD constexpr vec3_t wxy() const
         {
             return vec3_t(base_t::get_w(), base_t::get_x(), base_t::get_y());
         }
 
-        MVM_INLINE_NODISCARD vec3_t wxz() const
+        MVM_INLINE_NODISCARD constexpr vec3_t wxz() const
         {
             return vec3_t(base_t::get_w(), base_t::get_x(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec3_t wyx() const
+        MVM_INLINE_NODISCARD constexpr vec3_t wyx() const
         {
             return vec3_t(base_t::get_w(), base_t::get_y(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec3_t wyz() const
+        MVM_INLINE_NODISCARD constexpr vec3_t wyz() const
         {
             return vec3_t(base_t::get_w(), base_t::get_y(), base_t::get_z());
         }
 
-        MVM_INLINE_NODISCARD vec3_t wzx() const
+        MVM_INLINE_NODISCARD constexpr vec3_t wzx() const
         {
             return vec3_t(base_t::get_w(), base_t::get_z(), base_t::get_x());
         }
 
-        MVM_INLINE_NODISCARD vec3_t wzy() const
+        MVM_INLINE_NODISCARD constexpr vec3_t wzy() const
         {
             return vec3_t(base_t::get_w(), base_t::get_z(), base_t::get_y());
         }
@@ -387,49 +388,49 @@ namespace move::math
 
         // Assignment operators
     public:
-        MVM_INLINE vec4& operator+=(const vec4& other)
+        MVM_INLINE constexpr vec4& operator+=(const vec4& other)
         {
             base_t::operator+=(other);
             return *this;
         }
 
-        MVM_INLINE vec4& operator-=(const vec4& other)
+        MVM_INLINE constexpr vec4& operator-=(const vec4& other)
         {
             base_t::operator-=(other);
             return *this;
         }
 
-        MVM_INLINE vec4& operator*=(const vec4& other)
+        MVM_INLINE constexpr vec4& operator*=(const vec4& other)
         {
             base_t::operator*=(other);
             return *this;
         }
 
-        MVM_INLINE vec4& operator/=(const vec4& other)
+        MVM_INLINE constexpr vec4& operator/=(const vec4& other)
         {
             base_t::operator/=(other);
             return *this;
         }
 
-        MVM_INLINE vec4& operator+=(const T& scalar)
+        MVM_INLINE constexpr vec4& operator+=(const T& scalar)
         {
             base_t::operator+=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec4& operator-=(const T& scalar)
+        MVM_INLINE constexpr vec4& operator-=(const T& scalar)
         {
             base_t::operator-=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec4& operator*=(const T& scalar)
+        MVM_INLINE constexpr vec4& operator*=(const T& scalar)
         {
             base_t::operator*=(scalar);
             return *this;
         }
 
-        MVM_INLINE vec4& operator/=(const T& scalar)
+        MVM_INLINE constexpr vec4& operator/=(const T& scalar)
         {
             base_t::operator/=(scalar);
             return *this;
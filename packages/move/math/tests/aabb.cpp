@@ -0,0 +1,142 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/aabb.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename aabb>
+inline void test_aabb()
+{
+    using component_type = aabb::component_type;
+    using vec3 = aabb::vec3_t;
+    using mat4 = aabb::mat4x4_t;
+    using scalar_vec3 =
+        move::math::vec3<component_type, move::math::Acceleration::Scalar>;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing aabb with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\taabb: " << move::meta::type_name<aabb>());
+
+    const aabb box(vec3(-1, 0, 2), vec3(3, 2, 4));
+
+    WHEN("A box is created")
+    {
+        THEN("Its center, extents and area follow from the corners")
+        {
+            REQUIRE(approx_equal(box.center(), vec3(1, 1, 3), epsilon));
+            REQUIRE(approx_equal(box.extents(), vec3(2, 1, 1), epsilon));
+            REQUIRE(approx_equal(box.size(), vec3(4, 2, 2), epsilon));
+            REQUIRE(box.surface_area() == Catch::Approx(2 * (8 + 4 + 8)));
+            REQUIRE(aabb::from_center_extents(vec3(1, 1, 3),
+                                              vec3(2, 1, 1)) == box);
+        }
+
+        THEN("A default box is empty and grows to whatever it is given")
+        {
+            aabb empty;
+            REQUIRE(empty.is_empty());
+            REQUIRE(empty.surface_area() == 0);
+            REQUIRE_FALSE(empty.contains(vec3(0, 0, 0)));
+            empty.expand(box);
+            REQUIRE(empty == box);
+        }
+    }
+
+    WHEN("A box is built from points")
+    {
+        const std::vector<scalar_vec3> points = {
+            scalar_vec3(1, 5, -2), scalar_vec3(-3, 0, 4), scalar_vec3(2, 2, 2)};
+        const aabb bounds = aabb::from_points(points.data(), points.size());
+
+        THEN("It is the tightest box around them")
+        {
+            REQUIRE(approx_equal(bounds.get_min(), vec3(-3, 0, -2), epsilon));
+            REQUIRE(approx_equal(bounds.get_max(), vec3(2, 5, 4), epsilon));
+            REQUIRE(aabb::from_points(points.data(), 0).is_empty());
+        }
+    }
+
+    WHEN("Points and boxes are tested against a box")
+    {
+        THEN("Containment includes the boundary")
+        {
+            REQUIRE(box.contains(vec3(3, 2, 4)));
+            REQUIRE(box.contains(vec3(0, 1, 3)));
+            REQUIRE_FALSE(box.contains(vec3(0, 3, 3)));
+            REQUIRE(box.contains(aabb(vec3(0, 0, 3), vec3(1, 1, 4))));
+            REQUIRE_FALSE(box.contains(aabb(vec3(0, 0, 3), vec3(1, 1, 5))));
+        }
+
+        THEN("Touching boxes intersect")
+        {
+            REQUIRE(box.intersects(aabb(vec3(3, 2, 4), vec3(5, 5, 5))));
+            REQUIRE(box.intersects(aabb(vec3(0, -1, 0), vec3(1, 5, 9))));
+            REQUIRE_FALSE(box.intersects(aabb(vec3(4, 0, 2), vec3(5, 2, 4))));
+        }
+
+        THEN("The closest point is clamped to the box")
+        {
+            REQUIRE(approx_equal(box.closest_point(vec3(5, 1, 0)),
+                                 vec3(3, 1, 2), epsilon));
+            REQUIRE(box.distance_squared(vec3(5, 1, 0)) == Catch::Approx(8));
+            REQUIRE(box.distance_squared(vec3(0, 1, 3)) == 0);
+        }
+    }
+
+    WHEN("A box is transformed")
+    {
+        const mat4 mat = mat4::scale(2, 1, component_type(0.5)) *
+                         mat4::rotation_y(component_type(0.6)) *
+                         mat4::translation(vec3(1, -2, 3));
+        const aabb moved = box.transformed(mat);
+
+        THEN("It is the tightest box around the transformed corners")
+        {
+            aabb corners;
+            for (int i = 0; i < 8; ++i)
+            {
+                const vec3 corner((i & 1) ? 3 : -1, (i & 2) ? 2 : 0,
+                                  (i & 4) ? 4 : 2);
+                corners.expand(mat.transform_point(corner));
+            }
+            REQUIRE(approx_equal(moved, corners, epsilon));
+        }
+    }
+
+    WHEN("A box is inflated")
+    {
+        aabb grown = box;
+        grown.inflate(component_type(0.5));
+
+        THEN("Every side moves out")
+        {
+            REQUIRE(approx_equal(grown.get_min(), vec3(-1.5, -0.5, 1.5),
+                                 epsilon));
+            REQUIRE(approx_equal(grown.get_max(), vec3(3.5, 2.5, 4.5),
+                                 epsilon));
+        }
+    }
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_aabb, move::math::aabb);
+
+SCENARIO("AABB full tests")
+{
+    test_aabb_multi<float, double>();
+}
@@ -0,0 +1,236 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/animation_clip.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename qvv>
+inline typename qvv::component_type clip_rotation_dot(const qvv& a,
+                                                      const qvv& b)
+{
+    return move::math::abs(a.get_rotation().dot(b.get_rotation()));
+}
+
+// Quantization may return -q for q, which is the same rotation
+template <typename qvv>
+inline bool clip_pose_near(const qvv& a,
+                           const qvv& b,
+                           typename qvv::component_type epsilon)
+{
+    using move::math::approx_equal;
+    using T = typename qvv::component_type;
+    return clip_rotation_dot(a, b) >= T(1) - epsilon &&
+           approx_equal(a.get_translation(), b.get_translation(), epsilon) &&
+           approx_equal(a.get_scale(), b.get_scale(), epsilon);
+}
+
+// A few bones swinging, walking forward and pulsing in scale
+template <typename clip>
+inline std::vector<typename clip::transform_t> make_clip_poses(
+    size_t track_count,
+    size_t frame_count)
+{
+    using T = typename clip::component_type;
+    using transform = typename clip::transform_t;
+    using quat = typename transform::quat_t;
+    using vec3 = typename transform::vec3_t;
+
+    std::vector<transform> poses;
+    poses.reserve(track_count * frame_count);
+    for (size_t frame = 0; frame < frame_count; ++frame)
+    {
+        const T phase = T(frame) / T(frame_count);
+        for (size_t track = 0; track < track_count; ++track)
+        {
+            const T angle = T(3) * phase + T(track) * T(0.7);
+            const quat rotation = quat::angle_axis(
+                vec3(T(1), T(track), T(2)).normalized(), angle);
+            const vec3 translation(T(track), phase * T(4), T(-1) * phase);
+            const vec3 scale = track == 0
+                                   ? vec3(1, 1, 1)
+                                   : vec3(T(1) + phase, T(1), T(2) - phase);
+            poses.emplace_back(translation, rotation, scale);
+        }
+    }
+    return poses;
+}
+
+template <typename clip>
+inline void test_animation_clip()
+{
+    using component_type = clip::component_type;
+    using transform = clip::transform_t;
+    static constexpr auto epsilon = component_type(0.001);
+
+    INFO("Testing animation_clip with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tclip: " << move::meta::type_name<clip>());
+
+    constexpr size_t track_count = 4;
+    constexpr size_t frame_count = 31;
+    const component_type sample_rate = 30;
+    const std::vector<transform> poses =
+        make_clip_poses<clip>(track_count, frame_count);
+    const clip animation(poses.data(), track_count, frame_count, sample_rate);
+    transform pose[track_count];
+
+    REQUIRE(animation.track_count() == track_count);
+    REQUIRE(animation.frame_count() == frame_count);
+    REQUIRE(animation.duration() == Catch::Approx(1));
+
+    WHEN("The clip is sampled on a frame")
+    {
+        const size_t frame = 12;
+        animation.sample(component_type(frame) / sample_rate, pose);
+
+        THEN("The original pose is recovered within quantization error")
+        {
+            for (size_t track = 0; track < track_count; ++track)
+            {
+                REQUIRE(clip_pose_near(
+                    pose[track], poses[frame * track_count + track], epsilon));
+            }
+        }
+    }
+
+    WHEN("The clip is sampled between frames")
+    {
+        const size_t frame = 20;
+        animation.sample((component_type(frame) + component_type(0.25)) /
+                             sample_rate,
+                         pose);
+
+        THEN("The neighbouring frames are interpolated")
+        {
+            for (size_t track = 0; track < track_count; ++track)
+            {
+                const transform expected = transform::lerp(
+                    poses[frame * track_count + track],
+                    poses[(frame + 1) * track_count + track],
+                    component_type(0.25));
+                REQUIRE(clip_pose_near(pose[track], expected, epsilon));
+            }
+        }
+    }
+
+    WHEN("The clip is sampled outside its duration")
+    {
+        transform after[track_count];
+        animation.sample(-1, pose);
+        animation.sample(100, after);
+
+        THEN("The time is clamped to the first and last frames")
+        {
+            for (size_t track = 0; track < track_count; ++track)
+            {
+                REQUIRE(clip_pose_near(pose[track], poses[track], epsilon));
+                REQUIRE(clip_pose_near(
+                    after[track],
+                    poses[(frame_count - 1) * track_count + track], epsilon));
+            }
+        }
+    }
+
+    WHEN("Rotations of every sign and axis are compressed")
+    {
+        using quat = transform::quat_t;
+        using vec3 = transform::vec3_t;
+        std::vector<transform> rotations;
+        for (int i = 0; i < 64; ++i)
+        {
+            const vec3 axis(component_type((i % 5) - 2),
+                            component_type((i % 3) - 1),
+                            component_type((i % 7) - 3) + component_type(0.5));
+            const quat rotation = quat::angle_axis(
+                axis.normalized(), component_type(i) * component_type(0.2));
+            rotations.emplace_back(vec3(0, 0, 0), rotation, vec3(1, 1, 1));
+        }
+        const clip single_frame(rotations.data(), rotations.size(), 1,
+                                sample_rate);
+        std::vector<transform> decoded(rotations.size());
+        single_frame.sample(0, decoded.data());
+
+        THEN("Each decodes to the same rotation")
+        {
+            for (size_t i = 0; i < rotations.size(); ++i)
+            {
+                REQUIRE(clip_pose_near(decoded[i], rotations[i], epsilon));
+                REQUIRE(decoded[i].get_rotation().length() ==
+                        Catch::Approx(1).epsilon(epsilon));
+            }
+        }
+    }
+
+    WHEN("The memory use is measured")
+    {
+        THEN("The keys take 18 bytes per track per frame")
+        {
+            REQUIRE(animation.memory_size() <
+                    animation.uncompressed_size() / 2);
+            REQUIRE(animation.memory_size() >=
+                    track_count * frame_count * 18);
+        }
+    }
+}
+
+template <typename clip>
+inline void benchmark_animation_clip()
+{
+    using component_type = clip::component_type;
+    using transform = clip::transform_t;
+    move::string_view typeName = move::meta::type_name<clip>();
+
+    // A typical humanoid skeleton and a one-second loop
+    constexpr size_t track_count = 64;
+    constexpr size_t frame_count = 31;
+    const std::vector<transform> poses =
+        make_clip_poses<clip>(track_count, frame_count);
+    const clip animation(poses.data(), track_count, frame_count, 30);
+    std::vector<transform> pose(track_count);
+
+    BENCHMARK(alloc_appended_name(typeName, ": Sample 64 bones"))
+    {
+        animation.sample(component_type(0.51), pose.data());
+        return pose.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Sample 64 bones (lerp)"))
+    {
+        for (size_t track = 0; track < track_count; ++track)
+        {
+            pose[track] = transform::lerp(poses[15 * track_count + track],
+                                          poses[16 * track_count + track],
+                                          component_type(0.3));
+        }
+        return pose.back();
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_animation_clip,
+                                     move::math::animation_clip);
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_animation_clip,
+                                     move::math::animation_clip);
+
+SCENARIO("Animation clip full tests")
+{
+    test_animation_clip_multi<float, double>();
+}
+
+// SCENARIO("Animation clip benchmarks")
+// {
+//     benchmark_animation_clip_multi<float, double>();
+// }
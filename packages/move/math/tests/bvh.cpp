@@ -0,0 +1,539 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/bvh.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+// Small boxes scattered through a cube of the given half size, a quarter of
+// them clumped near the middle
+template <typename tree>
+inline std::vector<typename tree::aabb_t> make_boxes(
+    size_t count, typename tree::component_type half_size, uint32_t seed)
+{
+    using component_type = tree::component_type;
+    using vec3 = tree::vec3_t;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return component_type(seed >> 8) / component_type(1 << 24);
+    };
+
+    std::vector<typename tree::aabb_t> boxes;
+    boxes.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const component_type clump = (i % 4 == 0) ? component_type(0.25)
+                                                  : component_type(1);
+        const vec3 center((next() * 2 - 1) * half_size * clump,
+                          (next() * 2 - 1) * half_size * clump,
+                          (next() * 2 - 1) * half_size * clump);
+        const vec3 extent(next() + component_type(0.05),
+                          next() + component_type(0.05),
+                          next() + component_type(0.05));
+        boxes.emplace_back(vec3(center - extent), vec3(center + extent));
+    }
+    return boxes;
+}
+
+// Checks the links and bounds of every node and that each primitive is in
+// exactly one leaf
+template <typename tree>
+inline void require_valid(const tree& t, size_t count)
+{
+    REQUIRE(t.size() == count);
+    REQUIRE(t.node_count() == 2 * count - 1);
+    REQUIRE(t.parent_of(0) == tree::invalid_index);
+
+    std::vector<uint32_t> seen(count, 0);
+    for (uint32_t i = 0; i < t.node_count(); ++i)
+    {
+        const auto& n = t.get_node(i);
+        REQUIRE(n.is_leaf() == (i + 1 >= count));
+        if (n.is_leaf())
+        {
+            REQUIRE(n.left < count);
+            REQUIRE(t.leaf_of(n.left) == i);
+            ++seen[n.left];
+            continue;
+        }
+
+        REQUIRE(t.parent_of(n.left) == i);
+        REQUIRE(t.parent_of(n.right) == i);
+        REQUIRE(n.bounds == tree::aabb_t::merged(t.get_node(n.left).bounds,
+                                                 t.get_node(n.right).bounds));
+    }
+    REQUIRE(std::all_of(seen.begin(), seen.end(),
+                        [](uint32_t s) { return s == 1; }));
+}
+
+// The deepest leaf's distance from the root
+template <typename tree>
+inline size_t tree_depth(const tree& t)
+{
+    size_t deepest = 0;
+    for (uint32_t i = uint32_t(t.size() - 1); i < t.node_count(); ++i)
+    {
+        size_t depth = 0;
+        for (uint32_t n = i; t.parent_of(n) != tree::invalid_index;
+             n = t.parent_of(n))
+        {
+            ++depth;
+        }
+        deepest = std::max(deepest, depth);
+    }
+    return deepest;
+}
+
+template <typename tree>
+inline typename tree::component_type reference_sah_cost(const tree& t)
+{
+    double area = 0;
+    for (uint32_t i = 0; i + 1 < t.size(); ++i)
+    {
+        area += t.get_node(i).bounds.surface_area();
+    }
+    return typename tree::component_type(
+        area / t.get_node(0).bounds.surface_area());
+}
+
+template <typename tree>
+inline void test_bvh()
+{
+    using component_type = tree::component_type;
+    using vec3 = tree::vec3_t;
+    using aabb = tree::aabb_t;
+    using ray = tree::ray_t;
+
+    INFO("Testing bvh with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\ttree: " << move::meta::type_name<tree>());
+
+    const auto boxes = make_boxes<tree>(3000, 20, 4242);
+
+    // Closest hit against the boxes themselves
+    const auto hit_box = [&boxes](const ray& r)
+    {
+        return [&boxes, &r](uint32_t primitive, component_type& t)
+        {
+            component_type t_near;
+            component_type t_far;
+            if (r.intersect_aabb(boxes[primitive], t_near, t_far) &&
+                t_near < t)
+            {
+                t = t_near;
+                return true;
+            }
+            return false;
+        };
+    };
+
+    WHEN("A tree is built over boxes")
+    {
+        THEN("Every box is in one leaf and every node bounds its children")
+        {
+            tree t;
+            REQUIRE(t.empty());
+            t.build(boxes.data(), boxes.size());
+            require_valid(t, boxes.size());
+
+            aabb all;
+            for (const auto& box : boxes)
+            {
+                all.expand(box);
+            }
+            REQUIRE(t.bounds() == all);
+        }
+
+        THEN("Building again replaces the tree")
+        {
+            tree t;
+            t.build(boxes.data(), boxes.size());
+            t.build(boxes.data(), 100);
+            require_valid(t, 100);
+            t.build(boxes.data(), 0);
+            REQUIRE(t.empty());
+            REQUIRE(t.bounds().is_empty());
+        }
+
+        THEN("Trees of one box and of identical boxes are valid")
+        {
+            tree t;
+            t.build(boxes.data(), 1);
+            REQUIRE(t.size() == 1);
+            REQUIRE(t.get_node(0).is_leaf());
+            REQUIRE(t.get_node(0).left == 0);
+            REQUIRE(t.bounds() == boxes[0]);
+
+            const std::vector<aabb> same(500, boxes[7]);
+            t.build(same.data(), same.size());
+            require_valid(t, same.size());
+            size_t found = 0;
+            t.query(boxes[7], [&](uint32_t) { ++found; });
+            REQUIRE(found == same.size());
+        }
+    }
+
+    WHEN("Boxes move and the tree is refit")
+    {
+        // Every seventh box moves, some of them far
+        std::vector<aabb> moved = boxes;
+        std::vector<uint64_t> dirty((boxes.size() + 63) / 64, 0);
+        size_t dirty_count = 0;
+        for (size_t i = 0; i < moved.size(); i += 7)
+        {
+            const component_type d = component_type(i % 5) - 2;
+            const vec3 offset(d, d * 2, (i % 3 == 0) ? component_type(30) : 0);
+            moved[i] = aabb(vec3(moved[i].get_min() + offset),
+                            vec3(moved[i].get_max() + offset));
+            dirty[i / 64] |= uint64_t(1) << (i % 64);
+            ++dirty_count;
+        }
+
+        THEN("Only the moved leaves and their ancestors are refit")
+        {
+            tree t;
+            t.build(boxes.data(), boxes.size());
+            REQUIRE(t.sah_cost() ==
+                    Catch::Approx(reference_sah_cost(t)).epsilon(1e-4));
+
+            const component_type cost = t.sah_cost();
+            const std::vector<uint64_t> none(dirty.size(), 0);
+            const auto unchanged = t.refit(boxes.data(), none.data());
+            REQUIRE(unchanged.nodes_touched == 0);
+            REQUIRE(unchanged.sah_delta() == 0);
+
+            const auto stats = t.refit(moved.data(), dirty.data());
+            require_valid(t, boxes.size());
+            REQUIRE(stats.rotations == 0);
+            REQUIRE(stats.nodes_touched > dirty_count);
+            REQUIRE(stats.nodes_touched < t.node_count());
+            REQUIRE(stats.sah_before == cost);
+            REQUIRE(stats.sah_after == t.sah_cost());
+            REQUIRE(stats.sah_delta() > 0);
+            REQUIRE(t.sah_cost() ==
+                    Catch::Approx(reference_sah_cost(t)).epsilon(1e-4));
+            for (uint32_t i = 0; i < boxes.size(); ++i)
+            {
+                REQUIRE(t.get_node(t.leaf_of(i)).bounds == moved[i]);
+            }
+
+            // Refitting everything gives the same bounds
+            tree full;
+            full.build(boxes.data(), boxes.size());
+            std::vector<uint64_t> every(dirty.size(), ~uint64_t(0));
+            every.back() = (boxes.size() % 64 == 0)
+                               ? ~uint64_t(0)
+                               : (uint64_t(1) << (boxes.size() % 64)) - 1;
+            full.refit(moved.data(), every.data());
+            for (uint32_t i = 0; i < t.node_count(); ++i)
+            {
+                REQUIRE(full.get_node(i).bounds == t.get_node(i).bounds);
+            }
+        }
+
+        THEN("Rotations lower the cost without deepening the tree")
+        {
+            tree plain;
+            plain.build(boxes.data(), boxes.size());
+            tree rotated;
+            rotated.build(boxes.data(), boxes.size());
+            const size_t depth = tree_depth(rotated);
+
+            plain.refit(moved.data(), dirty.data());
+            const auto stats =
+                rotated.refit(moved.data(), dirty.data(), true);
+            require_valid(rotated, boxes.size());
+            REQUIRE(stats.rotations > 0);
+            REQUIRE(stats.sah_after < plain.sah_cost());
+            REQUIRE(rotated.sah_cost() ==
+                    Catch::Approx(reference_sah_cost(rotated)).epsilon(1e-4));
+            REQUIRE(tree_depth(rotated) <= depth);
+
+            // Refitting again keeps improving or holds steady
+            const auto again =
+                rotated.refit(moved.data(), dirty.data(), true);
+            require_valid(rotated, boxes.size());
+            REQUIRE(again.sah_after <=
+                    again.sah_before * component_type(1.0001));
+            REQUIRE(tree_depth(rotated) <= depth);
+
+            for (int q = 0; q < 20; ++q)
+            {
+                const vec3 center(component_type(q * 3) - 30, 0, 0);
+                const aabb query(vec3(center - vec3(3, 3, 40)),
+                                 vec3(center + vec3(3, 3, 40)));
+                std::vector<uint32_t> found;
+                rotated.query(query, [&](uint32_t i) { found.push_back(i); });
+                std::vector<uint32_t> expected;
+                for (uint32_t i = 0; i < moved.size(); ++i)
+                {
+                    if (query.intersects(moved[i]))
+                    {
+                        expected.push_back(i);
+                    }
+                }
+                std::sort(found.begin(), found.end());
+                REQUIRE(found == expected);
+            }
+        }
+    }
+
+    WHEN("A tree is built in chunks")
+    {
+        THEN("The tree matches the single threaded build")
+        {
+            tree serial;
+            serial.build(boxes.data(), boxes.size());
+
+            size_t chunks_run = 0;
+            auto serial_for = [&](size_t chunk_count, auto&& job)
+            {
+                for (size_t i = chunk_count; i-- > 0;)
+                {
+                    job(i);
+                    ++chunks_run;
+                }
+            };
+            tree chunked;
+            chunked.build(boxes.data(), boxes.size(), serial_for, 256);
+            REQUIRE(chunks_run > 0);
+            require_valid(chunked, boxes.size());
+            for (uint32_t i = 0; i < serial.node_count(); ++i)
+            {
+                REQUIRE(chunked.get_node(i).left == serial.get_node(i).left);
+                REQUIRE(chunked.get_node(i).right ==
+                        serial.get_node(i).right);
+                REQUIRE(chunked.get_node(i).bounds ==
+                        serial.get_node(i).bounds);
+            }
+        }
+    }
+
+    WHEN("The tree is queried with boxes")
+    {
+        THEN("It finds exactly the overlapping boxes")
+        {
+            tree t;
+            t.build(boxes.data(), boxes.size());
+            for (int q = 0; q < 50; ++q)
+            {
+                const component_type s = component_type(q % 7);
+                const vec3 center(component_type(q) - 25, 0,
+                                  component_type(q % 5) * 3);
+                const aabb query(vec3(center - vec3(s, s + 1, s)),
+                                 vec3(center + vec3(s, s + 1, s)));
+
+                std::vector<uint32_t> found;
+                t.query(query, [&](uint32_t i) { found.push_back(i); });
+                std::vector<uint32_t> expected;
+                for (uint32_t i = 0; i < boxes.size(); ++i)
+                {
+                    if (query.intersects(boxes[i]))
+                    {
+                        expected.push_back(i);
+                    }
+                }
+                std::sort(found.begin(), found.end());
+                REQUIRE(found == expected);
+            }
+        }
+    }
+
+    WHEN("Rays are cast through the tree")
+    {
+        THEN("The nearest hit matches testing every box")
+        {
+            tree t;
+            t.build(boxes.data(), boxes.size());
+            for (int q = 0; q < 100; ++q)
+            {
+                const component_type a = component_type(q) / 27;
+                const ray r(vec3(-40, component_type(q % 10) - 5, 3),
+                            vec3(1, component_type(0.1) * (a - 2),
+                                 component_type(q % 3) - 1));
+
+                constexpr component_type miss =
+                    std::numeric_limits<component_type>::infinity();
+                component_type expected = miss;
+                for (const auto& box : boxes)
+                {
+                    component_type t_near;
+                    component_type t_far;
+                    if (r.intersect_aabb(box, t_near, t_far))
+                    {
+                        expected = std::min(expected, t_near);
+                    }
+                }
+
+                component_type t_hit = -1;
+                const uint32_t hit = t.raycast(r, hit_box(r), t_hit);
+                if (expected == miss)
+                {
+                    REQUIRE(hit == tree::invalid_index);
+                    REQUIRE(t_hit == -1);
+                    continue;
+                }
+                REQUIRE(hit != tree::invalid_index);
+                REQUIRE(t_hit == expected);
+                component_type t_near;
+                component_type t_far;
+                REQUIRE(r.intersect_aabb(boxes[hit], t_near, t_far));
+                REQUIRE(t_near == expected);
+            }
+        }
+
+        THEN("A ray that misses every box reports no hit")
+        {
+            tree t;
+            t.build(boxes.data(), boxes.size());
+            const ray r(vec3(-40, 100, 0), vec3(1, 0, 0));
+            size_t calls = 0;
+            component_type t_hit = 0;
+            REQUIRE(t.raycast(r,
+                              [&](uint32_t, component_type&)
+                              {
+                                  ++calls;
+                                  return false;
+                              },
+                              t_hit) == tree::invalid_index);
+            REQUIRE(calls == 0);
+        }
+    }
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_bvh, move::math::bvh);
+
+SCENARIO("BVH full tests")
+{
+    test_bvh_multi<float, double>();
+}
+
+template <typename tree>
+inline void benchmark_bvh()
+{
+    using component_type = tree::component_type;
+    using vec3 = tree::vec3_t;
+    using ray = tree::ray_t;
+
+    const auto typeName = move::meta::type_name<tree>();
+
+    // One chunk per thread at a time, handed out from a shared counter
+    auto thread_for = [](size_t chunk_count, auto&& job)
+    {
+        std::atomic<size_t> next = 0;
+        const auto worker = [&]()
+        {
+            for (size_t i = next++; i < chunk_count; i = next++)
+            {
+                job(i);
+            }
+        };
+        std::vector<std::thread> threads(
+            std::max(1u, std::thread::hardware_concurrency()) - 1);
+        for (auto& thread : threads)
+        {
+            thread = std::thread(worker);
+        }
+        worker();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    };
+
+    // The 10M tree takes about 1.5GB as float and 2.5GB as double
+    tree t;
+    const std::pair<size_t, const char*> sizes[] = {
+        {100000, "100k"}, {1000000, "1M"}, {10000000, "10M"}};
+    for (const auto& [count, label] : sizes)
+    {
+        const auto boxes = make_boxes<tree>(
+            count, component_type(count / 1000 + 20), uint32_t(count));
+        const auto name = [&](const char* what) {
+            return alloc_appended_name(alloc_appended_name(typeName, what),
+                                       label);
+        };
+
+        BENCHMARK(name(": build "))
+        {
+            t.build(boxes.data(), boxes.size());
+            return t.size();
+        };
+
+        BENCHMARK(name(": parallel build "))
+        {
+            t.build(boxes.data(), boxes.size(), thread_for);
+            return t.size();
+        };
+
+        BENCHMARK(name(": 4096 raycasts "))
+        {
+            size_t hits = 0;
+            for (size_t i = 0; i < 4096; ++i)
+            {
+                const ray r(vec3(0, 0, 0),
+                            vec3(component_type(i % 64) - 32,
+                                 component_type(i / 64) - 32, 7));
+                component_type t_hit;
+                hits += t.raycast(
+                            r,
+                            [&](uint32_t primitive, component_type& best)
+                            {
+                                component_type t_near;
+                                component_type t_far;
+                                if (r.intersect_aabb(boxes[primitive],
+                                                     t_near, t_far) &&
+                                    t_near < best)
+                                {
+                                    best = t_near;
+                                    return true;
+                                }
+                                return false;
+                            },
+                            t_hit) != tree::invalid_index;
+            }
+            return hits;
+        };
+
+        // Every hundredth box has moved
+        std::vector<uint64_t> dirty((count + 63) / 64, 0);
+        for (size_t i = 0; i < count; i += 100)
+        {
+            dirty[i / 64] |= uint64_t(1) << (i % 64);
+        }
+        BENCHMARK(name(": refit 1% of "))
+        {
+            return t.refit(boxes.data(), dirty.data()).nodes_touched;
+        };
+
+        BENCHMARK(name(": refit and rotate 1% of "))
+        {
+            return t.refit(boxes.data(), dirty.data(), true).nodes_touched;
+        };
+    }
+}
+
+// SCENARIO("BVH benchmarks", "[!benchmark]")
+// {
+//     benchmark_bvh<move::math::bvhf>();
+//     benchmark_bvh<move::math::bvhd>();
+// }
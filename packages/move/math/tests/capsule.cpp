@@ -0,0 +1,335 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/capsule.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename capsule>
+inline void test_capsule()
+{
+    using component_type = capsule::component_type;
+    using vec3 = capsule::vec3_t;
+    using plane = capsule::plane_t;
+    using sphere = capsule::sphere_t;
+    using aabb = capsule::aabb_t;
+    using hit = capsule::hit_t;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.001);
+
+    INFO("Testing capsule with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tcapsule: " << move::meta::type_name<capsule>());
+
+    // Spans y = 1 to y = 3
+    const capsule body = capsule::vertical(vec3(0, 2, 0), 0.5, 0.5);
+
+    WHEN("An upright capsule is created")
+    {
+        THEN("Its segment runs along the y axis")
+        {
+            REQUIRE(approx_equal(body.get_a(), vec3(0, 1.5, 0), epsilon));
+            REQUIRE(approx_equal(body.get_b(), vec3(0, 2.5, 0), epsilon));
+            REQUIRE(approx_equal(body.center(), vec3(0, 2, 0), epsilon));
+            REQUIRE(approx_equal(body.bounds(),
+                                 aabb(vec3(-0.5, 1, -0.5), vec3(0.5, 3, 0.5)),
+                                 epsilon));
+            REQUIRE(approx_equal(body.translated(vec3(1, 0, 0)).center(),
+                                 vec3(1, 2, 0), epsilon));
+        }
+    }
+
+    WHEN("A capsule is swept against a plane")
+    {
+        const plane ground;
+
+        THEN("It stops where its lowest point meets the plane")
+        {
+            hit h;
+            REQUIRE(body.sweep(ground, vec3(0, -4, 0), h));
+            REQUIRE(h.fraction == Catch::Approx(0.25).margin(epsilon));
+            REQUIRE_FALSE(h.started_penetrating);
+            REQUIRE(approx_equal(h.normal, vec3(0, 1, 0), epsilon));
+            REQUIRE(approx_equal(h.point, vec3(0, 0, 0), epsilon));
+        }
+
+        THEN("Moving along or away from it misses")
+        {
+            hit h;
+            REQUIRE_FALSE(body.sweep(ground, vec3(5, 0, 0), h));
+            REQUIRE_FALSE(body.sweep(ground, vec3(0, 3, 0), h));
+            REQUIRE_FALSE(body.sweep(ground, vec3(0, -0.5, 0), h));
+        }
+
+        THEN("An overlapping capsule reports it and can be pushed out")
+        {
+            const capsule sunk = body.translated(vec3(0, -1.25, 0));
+            hit h;
+            REQUIRE(sunk.sweep(ground, vec3(1, 0, 0), h));
+            REQUIRE(h.started_penetrating);
+            REQUIRE(h.fraction == 0);
+
+            vec3 push;
+            REQUIRE(sunk.penetration(ground, push));
+            REQUIRE(approx_equal(push, vec3(0, 0.25, 0), epsilon));
+            REQUIRE_FALSE(body.penetration(ground, push));
+        }
+    }
+
+    WHEN("A capsule is swept against a sphere")
+    {
+        const sphere ball(vec3(0, 2, 5), 1);
+
+        THEN("It stops when the segment is both radii from the center")
+        {
+            hit h;
+            REQUIRE(body.sweep(ball, vec3(0, 0, 10), h));
+            REQUIRE(h.fraction == Catch::Approx(0.35).margin(epsilon));
+            REQUIRE(approx_equal(h.normal, vec3(0, 0, -1), epsilon));
+            REQUIRE(approx_equal(h.point, vec3(0, 2, 4), epsilon));
+        }
+
+        THEN("Passing beside it misses")
+        {
+            hit h;
+            REQUIRE_FALSE(body.translated(vec3(1.6, 0, 0))
+                              .sweep(ball, vec3(0, 0, 10), h));
+            REQUIRE(body.translated(vec3(1.4, 0, 0))
+                        .sweep(ball, vec3(0, 0, 10), h));
+        }
+
+        THEN("An overlapping capsule is pushed away from the center")
+        {
+            vec3 push;
+            REQUIRE(body.translated(vec3(0, 0, 4))
+                        .penetration(ball, push));
+            REQUIRE(approx_equal(push, vec3(0, 0, -0.5), epsilon));
+        }
+    }
+
+    WHEN("A capsule is swept against a box")
+    {
+        const aabb box(vec3(-1, 0, 4), vec3(1, 4, 6));
+
+        THEN("It stops at the nearest face")
+        {
+            hit h;
+            REQUIRE(body.sweep(box, vec3(0, 0, 10), h));
+            REQUIRE(h.fraction == Catch::Approx(0.35).margin(epsilon));
+            REQUIRE(approx_equal(h.normal, vec3(0, 0, -1), epsilon));
+        }
+
+        THEN("The rounded sides clear an edge by the radius")
+        {
+            hit h;
+            REQUIRE_FALSE(body.translated(vec3(1.6, 0, 0))
+                              .sweep(box, vec3(0, 0, 10), h));
+            REQUIRE(body.translated(vec3(1.4, 0, 0))
+                        .sweep(box, vec3(0, 0, 10), h));
+            REQUIRE(h.normal.get_x() > 0);
+            REQUIRE(h.normal.get_z() < 0);
+        }
+
+        THEN("A capsule through the top is pushed out of it")
+        {
+            vec3 push;
+            REQUIRE(body.translated(vec3(0, 2.25, 5)).penetration(box, push));
+            REQUIRE(approx_equal(push, vec3(0, 0.75, 0), epsilon));
+        }
+    }
+
+    WHEN("A capsule is swept against a triangle")
+    {
+        const vec3 v0(-10, 0, -10);
+        const vec3 v1(0, 0, 10);
+        const vec3 v2(10, 0, -10);
+
+        THEN("Both faces stop it")
+        {
+            hit h;
+            REQUIRE(body.sweep_triangle(v0, v1, v2, vec3(0, -4, 0), h));
+            REQUIRE(h.fraction == Catch::Approx(0.25).margin(epsilon));
+            REQUIRE(approx_equal(h.normal, vec3(0, 1, 0), epsilon));
+
+            const capsule below = body.translated(vec3(0, -4, 0));
+            REQUIRE(below.sweep_triangle(v0, v1, v2, vec3(0, 4, 0), h));
+            REQUIRE(h.fraction == Catch::Approx(0.25).margin(epsilon));
+            REQUIRE(approx_equal(h.normal, vec3(0, -1, 0), epsilon));
+        }
+
+        THEN("Its edges are rounded by the radius")
+        {
+            hit h;
+            const capsule beyond = body.translated(vec3(0, -2, 11));
+            REQUIRE_FALSE(beyond.sweep_triangle(v0, v1, v2, vec3(20, 0, 0),
+                                                h));
+            REQUIRE(beyond.sweep_triangle(v0, v1, v2, vec3(0, 0, -2), h));
+            REQUIRE(h.fraction == Catch::Approx(0.25).margin(epsilon));
+            REQUIRE(approx_equal(h.point, v1, epsilon));
+        }
+
+        THEN("A capsule through the face is pushed out the deeper side")
+        {
+            vec3 push;
+            REQUIRE(body.translated(vec3(0, -1.8, 0))
+                        .penetration_triangle(v0, v1, v2, push));
+            REQUIRE(approx_equal(push, vec3(0, 0.8, 0), epsilon));
+        }
+    }
+
+    WHEN("Random sweeps are checked against sampled motion")
+    {
+        const aabb box(vec3(-1, -1, -1), vec3(1, 1, 1));
+        const vec3 v0(-1, -1, 0);
+        const vec3 v1(1, -0.5, 0.5);
+        const vec3 v2(0, 1.5, -0.5);
+        uint32_t seed = 12345;
+        const auto next = [&seed]() {
+            seed = seed * 1664525u + 1013904223u;
+            return component_type(seed >> 8) / component_type(1 << 24) *
+                       component_type(2) -
+                   component_type(1);
+        };
+
+        THEN("No sweep stops after the first sampled overlap")
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                const vec3 start(next() * 4, next() * 4, next() * 4);
+                const vec3 axis(next(), next(), next());
+                const capsule c(vec3(start - axis * component_type(0.5)),
+                                vec3(start + axis * component_type(0.5)),
+                                component_type(0.25));
+                const vec3 displacement = vec3(-start * component_type(2));
+
+                hit box_hit;
+                hit triangle_hit;
+                const bool hit_box = c.sweep(box, displacement, box_hit);
+                const bool hit_triangle = c.sweep_triangle(
+                    v0, v1, v2, displacement, triangle_hit);
+
+                vec3 push;
+                for (int step = 0; step <= 256; ++step)
+                {
+                    const component_type t = component_type(step) / 256;
+                    const capsule moved =
+                        c.translated(vec3(displacement * t));
+                    if (moved.penetration(box, push) &&
+                        push.length() > component_type(0.01))
+                    {
+                        REQUIRE(hit_box);
+                        REQUIRE(box_hit.fraction <= t + epsilon);
+                        break;
+                    }
+                }
+                for (int step = 0; step <= 256; ++step)
+                {
+                    const component_type t = component_type(step) / 256;
+                    const capsule moved =
+                        c.translated(vec3(displacement * t));
+                    if (moved.penetration_triangle(v0, v1, v2, push) &&
+                        push.length() > component_type(0.01))
+                    {
+                        REQUIRE(hit_triangle);
+                        REQUIRE(triangle_hit.fraction <= t + epsilon);
+                        break;
+                    }
+                }
+
+                if (hit_box && !box_hit.started_penetrating)
+                {
+                    const capsule moved =
+                        c.translated(vec3(displacement * box_hit.fraction));
+                    REQUIRE_FALSE((moved.penetration(box, push) &&
+                                   push.length() > epsilon));
+                }
+                if (hit_triangle && !triangle_hit.started_penetrating)
+                {
+                    const capsule moved = c.translated(
+                        vec3(displacement * triangle_hit.fraction));
+                    REQUIRE_FALSE(
+                        (moved.penetration_triangle(v0, v1, v2, push) &&
+                         push.length() > epsilon));
+                }
+            }
+        }
+    }
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_capsule, move::math::capsule);
+
+SCENARIO("Capsule full tests")
+{
+    test_capsule_multi<float, double>();
+}
+
+template <typename capsule>
+inline void benchmark_capsule()
+{
+    using component_type = capsule::component_type;
+    using vec3 = capsule::vec3_t;
+    using aabb = capsule::aabb_t;
+    using hit = capsule::hit_t;
+
+    const auto typeName = move::meta::type_name<capsule>();
+
+    std::vector<capsule> capsules;
+    std::vector<vec3> displacements;
+    for (int i = 0; i < 1024; ++i)
+    {
+        const component_type x = component_type(i % 32) - 16;
+        const component_type z = component_type(i / 32) - 16;
+        capsules.push_back(capsule::vertical(vec3(x, 2, z), 0.35, 0.55));
+        displacements.push_back(vec3(-x * component_type(0.1), -3,
+                                     -z * component_type(0.1)));
+    }
+
+    const aabb box(vec3(-4, -1, -4), vec3(4, 0.5, 4));
+    const vec3 v0(-20, 0, -20);
+    const vec3 v1(0, 1, 20);
+    const vec3 v2(20, 0, -20);
+
+    BENCHMARK(alloc_appended_name(typeName, ": box sweeps"))
+    {
+        uint32_t hits = 0;
+        hit h;
+        for (size_t i = 0; i < capsules.size(); ++i)
+        {
+            hits += capsules[i].sweep(box, displacements[i], h) ? 1 : 0;
+        }
+        return hits;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": triangle sweeps"))
+    {
+        uint32_t hits = 0;
+        hit h;
+        for (size_t i = 0; i < capsules.size(); ++i)
+        {
+            hits += capsules[i].sweep_triangle(v0, v1, v2, displacements[i], h)
+                        ? 1
+                        : 0;
+        }
+        return hits;
+    };
+}
+
+// SCENARIO("Capsule benchmarks", "[!benchmark]")
+// {
+//     benchmark_capsule<move::math::capsulef>();
+//     benchmark_capsule<move::math::capsuled>();
+// }
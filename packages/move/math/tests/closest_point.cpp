@@ -0,0 +1,480 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/closest_point.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename T>
+inline T length_sq(const move::math::vec3<T, move::math::Acceleration::RTM>& v)
+{
+    return v.get_x() * v.get_x() + v.get_y() * v.get_y() +
+           v.get_z() * v.get_z();
+}
+
+// The nearest of a grid of samples over the triangle to p, as a squared
+// distance
+template <typename T>
+inline T sampled_triangle_distance_sq(
+    const move::math::vec3<T, move::math::Acceleration::RTM>& p,
+    const move::math::vec3<T, move::math::Acceleration::RTM>& a,
+    const move::math::vec3<T, move::math::Acceleration::RTM>& b,
+    const move::math::vec3<T, move::math::Acceleration::RTM>& c)
+{
+    using vec3 = move::math::vec3<T, move::math::Acceleration::RTM>;
+    constexpr int steps = 60;
+    T best = std::numeric_limits<T>::infinity();
+    for (int i = 0; i <= steps; ++i)
+    {
+        for (int j = 0; i + j <= steps; ++j)
+        {
+            const T v = T(i) / steps;
+            const T w = T(j) / steps;
+            const vec3 q = vec3(a + vec3(b - a) * v + vec3(c - a) * w);
+            best = std::min(best, length_sq(vec3(p - q)));
+        }
+    }
+    return best;
+}
+
+template <typename T>
+inline void test_closest_point()
+{
+    using vec3 = move::math::vec3<T, move::math::Acceleration::RTM>;
+    using move::math::closest_point_on_segment;
+    using move::math::closest_point_on_triangle;
+    using move::math::closest_points_on_segments;
+    using move::math::segment_distance_sq;
+
+    INFO("Testing closest point queries with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<T>());
+
+    uint32_t seed = 1234;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return T(seed >> 8) / T(1 << 24) * T(4) - T(2);
+    };
+    const auto random_vec = [&next]() { return vec3(next(), next(), next()); };
+
+    const vec3 a(0, 0, 0);
+    const vec3 b(2, 0, 0);
+    const vec3 c(0, 2, 0);
+
+    WHEN("Points are projected onto a triangle")
+    {
+        THEN("Each Voronoi region gives its feature")
+        {
+            REQUIRE(closest_point_on_triangle(vec3(0.5, 0.5, 3), a, b, c) ==
+                    vec3(0.5, 0.5, 0));
+            REQUIRE(closest_point_on_triangle(vec3(-1, -1, 1), a, b, c) == a);
+            REQUIRE(closest_point_on_triangle(vec3(3, -1, 0), a, b, c) == b);
+            REQUIRE(closest_point_on_triangle(vec3(-1, 3, -2), a, b, c) == c);
+            REQUIRE(closest_point_on_triangle(vec3(1, -1, 0), a, b, c) ==
+                    vec3(1, 0, 0));
+            REQUIRE(closest_point_on_triangle(vec3(-1, 1, 0), a, b, c) ==
+                    vec3(0, 1, 0));
+            REQUIRE(closest_point_on_triangle(vec3(2, 2, 0), a, b, c) ==
+                    vec3(1, 1, 0));
+        }
+
+        THEN("Random points are no further than any point on the triangle")
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                const vec3 p = random_vec();
+                const vec3 v0 = random_vec();
+                const vec3 v1 = random_vec();
+                const vec3 v2 = random_vec();
+                const vec3 q = closest_point_on_triangle(p, v0, v1, v2);
+                const T sampled = sampled_triangle_distance_sq(p, v0, v1, v2);
+                REQUIRE(length_sq(vec3(p - q)) <= sampled + T(1e-4));
+                REQUIRE(length_sq(vec3(p - q)) >= sampled * T(0.9) - T(1e-3));
+            }
+        }
+
+        THEN("Triangles collapsed to a segment or a point are handled")
+        {
+            // Two equal vertices, where the regions give the wrong edge
+            const vec3 p(0.1, 1, 0.5);
+            const vec3 q = closest_point_on_triangle(p, a, a, c);
+            REQUIRE(q.get_x() == 0);
+            REQUIRE(q.get_y() == Catch::Approx(1));
+            REQUIRE(q.get_z() == 0);
+
+            // Collinear vertices
+            const vec3 on_line =
+                closest_point_on_triangle(vec3(1.5, 1, 0), a, vec3(1, 0, 0),
+                                          b);
+            REQUIRE(on_line == vec3(1.5, 0, 0));
+            const vec3 beyond =
+                closest_point_on_triangle(vec3(5, 1, 0), vec3(1, 0, 0), b, a);
+            REQUIRE(beyond == b);
+
+            // All three the same
+            REQUIRE(closest_point_on_triangle(p, c, c, c) == c);
+
+            // Nothing is NaN
+            for (int i = 0; i < 100; ++i)
+            {
+                const vec3 v = random_vec();
+                const vec3 r = closest_point_on_triangle(random_vec(), v,
+                                                         v, random_vec());
+                REQUIRE(r.get_x() == r.get_x());
+                REQUIRE(r.get_y() == r.get_y());
+                REQUIRE(r.get_z() == r.get_z());
+            }
+        }
+    }
+
+    WHEN("Segments are measured against each other")
+    {
+        THEN("Known configurations give their distances")
+        {
+            vec3 c1;
+            vec3 c2;
+            // Crossing
+            REQUIRE(closest_points_on_segments(vec3(-1, 0, 0), vec3(1, 0, 0),
+                                               vec3(0, -1, 1), vec3(0, 1, 1),
+                                               c1, c2) == 1);
+            REQUIRE(c1 == vec3(0, 0, 0));
+            REQUIRE(c2 == vec3(0, 0, 1));
+
+            // End to end
+            REQUIRE(segment_distance_sq(vec3(0, 0, 0), vec3(1, 0, 0),
+                                        vec3(3, 0, 0), vec3(4, 1, 0)) == 4);
+
+            // Parallel and overlapping
+            REQUIRE(closest_points_on_segments(vec3(0, 0, 0), vec3(2, 0, 0),
+                                               vec3(1, 1, 0), vec3(3, 1, 0),
+                                               c1, c2) == Catch::Approx(1));
+            REQUIRE(length_sq(vec3(c1 - c2)) == Catch::Approx(1));
+
+            // Parallel and apart along their line
+            REQUIRE(segment_distance_sq(vec3(0, 0, 0), vec3(1, 0, 0),
+                                        vec3(4, 0, 0), vec3(3, 0, 0)) == 4);
+        }
+
+        THEN("Segments of zero length are points")
+        {
+            vec3 c1;
+            vec3 c2;
+            REQUIRE(closest_points_on_segments(vec3(1, 1, 0), vec3(1, 1, 0),
+                                               vec3(0, 0, 0), vec3(2, 0, 0),
+                                               c1, c2) == 1);
+            REQUIRE(c2 == vec3(1, 0, 0));
+            REQUIRE(closest_points_on_segments(vec3(0, 0, 0), vec3(2, 0, 0),
+                                               vec3(3, 1, 0), vec3(3, 1, 0),
+                                               c1, c2) == 2);
+            REQUIRE(c1 == b);
+            REQUIRE(segment_distance_sq(a, a, c, c) == 4);
+            REQUIRE(closest_point_on_segment(c, b, b) == b);
+        }
+
+        THEN("Random segments are no further than sampled pairs")
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                const vec3 p1 = random_vec();
+                const vec3 q1 = random_vec();
+                const vec3 p2 = random_vec();
+                // Every fourth pair is nearly parallel
+                const vec3 q2 = (i % 4 == 0)
+                                    ? vec3(p2 + vec3(q1 - p1) * T(0.7) +
+                                           vec3(0, T(1e-5), 0))
+                                    : random_vec();
+                vec3 c1;
+                vec3 c2;
+                const T d = closest_points_on_segments(p1, q1, p2, q2, c1, c2);
+                REQUIRE(d == Catch::Approx(length_sq(vec3(c1 - c2))));
+                REQUIRE(length_sq(vec3(c1 - closest_point_on_segment(
+                                                  c1, p1, q1))) < T(1e-8));
+                REQUIRE(length_sq(vec3(c2 - closest_point_on_segment(
+                                                  c2, p2, q2))) < T(1e-8));
+
+                T sampled = std::numeric_limits<T>::infinity();
+                for (int s = 0; s <= 64; ++s)
+                {
+                    const vec3 x = vec3(p1 + vec3(q1 - p1) * (T(s) / 64));
+                    sampled = std::min(
+                        sampled,
+                        length_sq(vec3(x - closest_point_on_segment(x, p2,
+                                                                    q2))));
+                }
+                REQUIRE(d <= sampled + T(1e-4));
+            }
+        }
+    }
+
+    WHEN("Queries are run in packets")
+    {
+        THEN("Triangle packets match the single queries")
+        {
+            std::vector<vec3> vertices;
+            for (int i = 0; i < 8 * 3; ++i)
+            {
+                vertices.push_back(random_vec());
+            }
+            // Degenerate lanes: repeated vertices, collinear, a point
+            vertices[3 * 2 + 1] = vertices[3 * 2];
+            vertices[3 * 5 + 2] = vec3(
+                vertices[3 * 5] + vec3(vertices[3 * 5 + 1] - vertices[3 * 5]) *
+                                      T(2));
+            vertices[3 * 6 + 1] = vertices[3 * 6];
+            vertices[3 * 6 + 2] = vertices[3 * 6];
+
+            T px[8];
+            T py[8];
+            T pz[8];
+            for (int i = 0; i < 8; ++i)
+            {
+                px[i] = next();
+                py[i] = next();
+                pz[i] = next();
+            }
+
+            const auto check = [&](const auto& packet, size_t lanes,
+                                   bool shared_point)
+            {
+                T ox[8];
+                T oy[8];
+                T oz[8];
+                T d[8];
+                const vec3 shared(px[0], py[0], pz[0]);
+                if (shared_point)
+                {
+                    packet.closest_points(shared, {ox, oy, oz}, d);
+                }
+                else
+                {
+                    packet.closest_points({px, py, pz}, {ox, oy, oz}, d);
+                }
+                for (size_t i = 0; i < lanes; ++i)
+                {
+                    const vec3 p = shared_point ? shared
+                                                : vec3(px[i], py[i], pz[i]);
+                    const vec3 q = closest_point_on_triangle(
+                        p, vertices[3 * i], vertices[3 * i + 1],
+                        vertices[3 * i + 2]);
+                    REQUIRE(ox[i] == Catch::Approx(q.get_x()).margin(1e-5));
+                    REQUIRE(oy[i] == Catch::Approx(q.get_y()).margin(1e-5));
+                    REQUIRE(oz[i] == Catch::Approx(q.get_z()).margin(1e-5));
+                    REQUIRE(d[i] == Catch::Approx(length_sq(vec3(p - q)))
+                                        .margin(1e-5));
+                }
+            };
+
+            check(move::math::triangle_packet8<T>::load(vertices.data(), 8), 8,
+                  false);
+            check(move::math::triangle_packet8<T>::load(vertices.data(), 8), 8,
+                  true);
+            check(move::math::triangle_packet4<T>::load(vertices.data(), 4), 4,
+                  false);
+            check(move::math::triangle_packet4<T>::load(vertices.data(), 3), 3,
+                  true);
+        }
+
+        THEN("Segment packets match the single queries")
+        {
+            std::vector<vec3> first;
+            std::vector<vec3> second;
+            for (int i = 0; i < 8 * 2; ++i)
+            {
+                first.push_back(random_vec());
+                second.push_back(random_vec());
+            }
+            // Degenerate lanes: points on either side, both, and parallel
+            first[2 * 1 + 1] = first[2 * 1];
+            second[2 * 2 + 1] = second[2 * 2];
+            first[2 * 3 + 1] = first[2 * 3];
+            second[2 * 3 + 1] = second[2 * 3];
+            second[2 * 4 + 1] =
+                vec3(second[2 * 4] + vec3(first[2 * 4 + 1] - first[2 * 4]));
+
+            const auto check = [&](const auto& packet, const auto& other,
+                                   size_t lanes)
+            {
+                T s[8];
+                T t[8];
+                T d[8];
+                packet.closest_points(other, s, t, d);
+                for (size_t i = 0; i < lanes; ++i)
+                {
+                    vec3 c1;
+                    vec3 c2;
+                    const T expected = closest_points_on_segments(
+                        first[2 * i], first[2 * i + 1], second[2 * i],
+                        second[2 * i + 1], c1, c2);
+                    REQUIRE(d[i] == Catch::Approx(expected).margin(1e-5));
+                    const vec3 on_first = vec3(
+                        first[2 * i] +
+                        vec3(first[2 * i + 1] - first[2 * i]) * s[i]);
+                    const vec3 on_second = vec3(
+                        second[2 * i] +
+                        vec3(second[2 * i + 1] - second[2 * i]) * t[i]);
+                    REQUIRE(length_sq(vec3(on_first - on_second)) ==
+                            Catch::Approx(expected).margin(1e-5));
+                }
+            };
+
+            using packet8 = move::math::segment_packet8<T>;
+            using packet4 = move::math::segment_packet4<T>;
+            check(packet8::load(first.data(), 8),
+                  packet8::load(second.data(), 8), 8);
+            check(packet4::load(first.data(), 4),
+                  packet4::load(second.data(), 4), 4);
+
+            // One segment against the packet
+            const auto packet = packet8::load(first.data(), 8);
+            T s[8];
+            T t[8];
+            T d[8];
+            packet.closest_points(second[0], second[1], s, t, d);
+            for (size_t i = 0; i < 8; ++i)
+            {
+                REQUIRE(d[i] ==
+                        Catch::Approx(segment_distance_sq(first[2 * i],
+                                                          first[2 * i + 1],
+                                                          second[0],
+                                                          second[1]))
+                            .margin(1e-5));
+            }
+        }
+    }
+}
+
+SCENARIO("Closest point full tests")
+{
+    test_closest_point<float>();
+    test_closest_point<double>();
+}
+
+template <typename T>
+inline void benchmark_closest_point()
+{
+    using vec3 = move::math::vec3<T, move::math::Acceleration::RTM>;
+    using packet = move::math::triangle_packet8<T>;
+    using segments = move::math::segment_packet8<T>;
+
+    const auto typeName = move::meta::type_name<T>();
+
+    uint32_t seed = 77;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return T(seed >> 8) / T(1 << 24);
+    };
+    std::vector<vec3> vertices;
+    std::vector<vec3> points;
+    for (size_t i = 0; i < 4096 * 3; ++i)
+    {
+        vertices.emplace_back(next(), next(), next());
+        points.emplace_back(next(), next(), next());
+    }
+
+    BENCHMARK(alloc_appended_name(typeName, ": 4096 point-triangle"))
+    {
+        T total = 0;
+        for (size_t i = 0; i < 4096; ++i)
+        {
+            const vec3 q = move::math::closest_point_on_triangle(
+                points[i], vertices[3 * i], vertices[3 * i + 1],
+                vertices[3 * i + 2]);
+            total += q.get_x();
+        }
+        return total;
+    };
+
+    std::vector<packet> packets;
+    std::vector<T> px(4096);
+    std::vector<T> py(4096);
+    std::vector<T> pz(4096);
+    for (size_t i = 0; i < 4096; i += 8)
+    {
+        packets.push_back(packet::load(vertices.data() + 3 * i, 8));
+    }
+    for (size_t i = 0; i < 4096; ++i)
+    {
+        px[i] = points[i].get_x();
+        py[i] = points[i].get_y();
+        pz[i] = points[i].get_z();
+    }
+    BENCHMARK(alloc_appended_name(typeName, ": 4096 point-triangle x8"))
+    {
+        T total = 0;
+        T ox[8];
+        T oy[8];
+        T oz[8];
+        T d[8];
+        for (size_t i = 0; i < packets.size(); ++i)
+        {
+            packets[i].closest_points(
+                {px.data() + 8 * i, py.data() + 8 * i, pz.data() + 8 * i},
+                {ox, oy, oz}, d);
+            total += ox[0];
+        }
+        return total;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": 4096 segment-segment"))
+    {
+        T total = 0;
+        for (size_t i = 0; i < 4096; ++i)
+        {
+            total += move::math::segment_distance_sq(
+                vertices[3 * i], vertices[3 * i + 1], points[3 * i],
+                points[3 * i + 1]);
+        }
+        return total;
+    };
+
+    std::vector<segments> first;
+    std::vector<segments> second;
+    std::vector<vec3> first_ends;
+    std::vector<vec3> second_ends;
+    for (size_t i = 0; i < 4096; ++i)
+    {
+        first_ends.push_back(vertices[3 * i]);
+        first_ends.push_back(vertices[3 * i + 1]);
+        second_ends.push_back(points[3 * i]);
+        second_ends.push_back(points[3 * i + 1]);
+    }
+    for (size_t i = 0; i < 4096; i += 8)
+    {
+        first.push_back(segments::load(first_ends.data() + 2 * i, 8));
+        second.push_back(segments::load(second_ends.data() + 2 * i, 8));
+    }
+    BENCHMARK(alloc_appended_name(typeName, ": 4096 segment-segment x8"))
+    {
+        T total = 0;
+        T s[8];
+        T t[8];
+        T d[8];
+        for (size_t i = 0; i < first.size(); ++i)
+        {
+            first[i].closest_points(second[i], s, t, d);
+            total += d[0];
+        }
+        return total;
+    };
+}
+
+// SCENARIO("Closest point benchmarks", "[!benchmark]")
+// {
+//     benchmark_closest_point<float>();
+//     benchmark_closest_point<double>();
+// }
@@ -0,0 +1,391 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/collision_world.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+// A bare collide and slide step, the same loop a character controller runs
+template <typename world>
+inline void move_and_slide(const world& w,
+                           typename world::capsule_t& body,
+                           typename world::vec3_t displacement)
+{
+    using component_type = world::component_type;
+    using vec3 = world::vec3_t;
+    using hit = world::hit_t;
+
+    vec3 offset;
+    if (w.depenetrate_capsule(body, offset))
+    {
+        body = body.translated(offset);
+    }
+
+    for (int i = 0; i < 4 && displacement.length_squared() >
+                                 component_type(1e-8);
+         ++i)
+    {
+        hit h;
+        if (!w.sweep_capsule(body, displacement, h))
+        {
+            body = body.translated(displacement);
+            break;
+        }
+        if (h.started_penetrating)
+        {
+            if (w.depenetrate_capsule(body, offset))
+            {
+                body = body.translated(offset);
+            }
+            break;
+        }
+
+        body = body.translated(vec3(displacement * h.fraction));
+        const vec3 leftover =
+            vec3(displacement * (component_type(1) - h.fraction));
+        displacement =
+            vec3(leftover - h.normal * vec3::dot(leftover, h.normal));
+    }
+}
+
+template <typename world>
+inline void test_collision_world()
+{
+    using component_type = world::component_type;
+    using vec3 = world::vec3_t;
+    using plane = world::plane_t;
+    using sphere = world::sphere_t;
+    using aabb = world::aabb_t;
+    using capsule = world::capsule_t;
+    using hit = world::hit_t;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.001);
+
+    INFO("Testing collision_world with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tcollision_world: " << move::meta::type_name<world>());
+
+    world scene;
+    scene.add_plane(plane());
+    scene.add_box(aabb(vec3(2, 0, -1), vec3(4, 1, 1)));
+    scene.add_sphere(sphere(vec3(8, 0, 0), 1));
+    // A ramp rising toward -x, from y = 0 at x = -2 to y = 2 at x = -6
+    scene.add_triangle(vec3(-2, 0, -2), vec3(-6, 2, -2), vec3(-6, 2, 2));
+    scene.add_triangle(vec3(-2, 0, -2), vec3(-6, 2, 2), vec3(-2, 0, 2));
+    scene.build();
+
+    // Spans y = 0.01 to y = 1.81
+    const capsule body = capsule::vertical(vec3(0, 0.91, 0), 0.35, 0.55);
+
+    WHEN("A world is built")
+    {
+        THEN("It counts its shapes")
+        {
+            REQUIRE(scene.plane_count() == 1);
+            REQUIRE(scene.box_count() == 1);
+            REQUIRE(scene.sphere_count() == 1);
+            REQUIRE(scene.triangle_count() == 2);
+        }
+
+        THEN("Queries find exactly the overlapping bounds")
+        {
+            world boxes;
+            std::vector<aabb> placed;
+            uint32_t seed = 7;
+            const auto next = [&seed]() {
+                seed = seed * 1664525u + 1013904223u;
+                return component_type(seed >> 8) / component_type(1 << 24);
+            };
+            for (int i = 0; i < 500; ++i)
+            {
+                const vec3 min(next() * 100, next() * 100, next() * 100);
+                const vec3 size(next() * 8, next() * 8, next() * 8);
+                placed.push_back(aabb(min, vec3(min + size)));
+                boxes.add_box(placed.back());
+            }
+            boxes.build();
+
+            for (int i = 0; i < 50; ++i)
+            {
+                const vec3 min(next() * 100, next() * 100, next() * 100);
+                const aabb region(min, vec3(min + vec3(10, 10, 10)));
+                size_t expected = 0;
+                for (const aabb& box : placed)
+                {
+                    expected += box.intersects(region) ? 1 : 0;
+                }
+
+                size_t found = 0;
+                bool all_overlap = true;
+                boxes.query(region, [&](const typename world::shape_ref& ref) {
+                    ++found;
+                    all_overlap &= placed[ref.index].intersects(region);
+                });
+                REQUIRE(found == expected);
+                REQUIRE(all_overlap);
+            }
+        }
+    }
+
+    WHEN("A capsule is swept through the world")
+    {
+        THEN("The earliest contact wins")
+        {
+            hit h;
+            REQUIRE(scene.sweep_capsule(body, vec3(10, 0, 0), h));
+            REQUIRE(h.fraction == Catch::Approx(0.165).margin(epsilon));
+            REQUIRE(approx_equal(h.normal, vec3(-1, 0, 0), epsilon));
+        }
+
+        THEN("Shapes outside the swept bounds are skipped")
+        {
+            hit h;
+            REQUIRE_FALSE(scene.sweep_capsule(body.translated(vec3(0, 0, 5)),
+                                              vec3(10, 0, 0), h));
+            REQUIRE(scene.sweep_capsule(body, vec3(0, -1, 0), h));
+            REQUIRE(h.fraction == Catch::Approx(0.01).margin(epsilon));
+        }
+    }
+
+    WHEN("Capsules are swept as a packet")
+    {
+        THEN("Each lane matches sweeping its capsule alone")
+        {
+            constexpr size_t width = world::packet_width;
+            capsule capsules[width];
+            vec3 displacements[width];
+            for (size_t lane = 0; lane < width; ++lane)
+            {
+                const component_type x = component_type(lane) - 4;
+                capsules[lane] = body.translated(
+                    vec3(x, component_type(lane % 3), component_type(0)));
+                displacements[lane] =
+                    vec3(4, -component_type(lane % 4), component_type(0));
+            }
+
+            const uint32_t mask = 0b10110111;
+            hit hits[width];
+            const uint32_t hit_mask = scene.sweep_capsules(
+                capsules, displacements, width, mask, hits);
+            REQUIRE((hit_mask & ~mask) == 0);
+
+            for (size_t lane = 0; lane < width; ++lane)
+            {
+                if (!((mask >> lane) & 1))
+                {
+                    continue;
+                }
+                hit alone;
+                const bool touched =
+                    scene.sweep_capsule(capsules[lane], displacements[lane],
+                                        alone);
+                REQUIRE(touched == bool((hit_mask >> lane) & 1));
+                if (touched)
+                {
+                    REQUIRE(hits[lane].fraction ==
+                            Catch::Approx(alone.fraction).margin(epsilon));
+                    REQUIRE(approx_equal(hits[lane].normal, alone.normal,
+                                         epsilon));
+                }
+            }
+        }
+
+        THEN("Packets shorter than the width leave the rest alone")
+        {
+            hit hits[world::packet_width];
+            const capsule one[1] = {body};
+            const vec3 down[1] = {vec3(0, -1, 0)};
+            REQUIRE(scene.sweep_capsules(one, down, 1, ~uint32_t(0), hits) ==
+                    1);
+            REQUIRE(hits[0].fraction ==
+                    Catch::Approx(0.01).margin(epsilon));
+            REQUIRE(scene.sweep_capsules(one, down, 1, 0, hits) == 0);
+        }
+    }
+
+    WHEN("A capsule overlaps the world")
+    {
+        THEN("It is pushed clear of everything it touches")
+        {
+            const capsule sunk = body.translated(vec3(2.6, -0.3, 0));
+            vec3 offset;
+            REQUIRE(scene.depenetrate_capsule(sunk, offset));
+            REQUIRE(offset.get_y() > 0);
+
+            const capsule freed = sunk.translated(offset);
+            vec3 push;
+            REQUIRE_FALSE(freed.penetration(plane(), push));
+            REQUIRE_FALSE(
+                freed.penetration(aabb(vec3(2, 0, -1), vec3(4, 1, 1)), push));
+            REQUIRE_FALSE(scene.depenetrate_capsule(freed, offset));
+        }
+    }
+
+    WHEN("The ground is probed")
+    {
+        THEN("Ground within the probe distance is found")
+        {
+            vec3 normal;
+            REQUIRE(scene.probe_ground(body, 0.1, normal));
+            REQUIRE(approx_equal(normal, vec3(0, 1, 0), epsilon));
+            REQUIRE_FALSE(scene.probe_ground(body.translated(vec3(0, 1, 0)),
+                                             0.1, normal));
+
+            REQUIRE(scene.probe_ground(body.translated(vec3(-4, 1.2, 0)), 0.3,
+                                       normal));
+            const vec3 slope = vec3(1, 2, 0).normalized();
+            REQUIRE(approx_equal(normal, slope, epsilon));
+        }
+    }
+
+    WHEN("A capsule falls and walks through the world")
+    {
+        THEN("It settles on the surfaces without sinking into them")
+        {
+            capsule walker = body.translated(vec3(-4, 3, 0));
+            for (int step = 0; step < 120; ++step)
+            {
+                const component_type across =
+                    step < 60 ? component_type(0.1) : component_type(0);
+                move_and_slide(scene, walker, vec3(across, -0.2, 0));
+
+                vec3 offset;
+                const bool stuck = scene.depenetrate_capsule(walker, offset);
+                REQUIRE((!stuck || offset.length() < component_type(0.01)));
+            }
+
+            // Walked down the ramp and into the side of the box
+            REQUIRE(walker.center().get_x() ==
+                    Catch::Approx(1.65).margin(0.01));
+            REQUIRE(walker.get_a().get_y() - walker.get_radius() ==
+                    Catch::Approx(0).margin(0.01));
+        }
+    }
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_collision_world,
+                                     move::math::collision_world);
+
+SCENARIO("Collision world full tests")
+{
+    test_collision_world_multi<float, double>();
+}
+
+template <typename world>
+inline void benchmark_collision_world()
+{
+    using component_type = world::component_type;
+    using vec3 = world::vec3_t;
+    using sphere = world::sphere_t;
+    using aabb = world::aabb_t;
+    using capsule = world::capsule_t;
+
+    const auto typeName = move::meta::type_name<world>();
+
+    // Bumpy terrain of 64x64 quads, one metre apart
+    world scene;
+    const auto height = [](int x, int z) {
+        return component_type(((x * 7 + z * 13) % 5)) * component_type(0.1);
+    };
+    for (int z = 0; z < 64; ++z)
+    {
+        for (int x = 0; x < 64; ++x)
+        {
+            const vec3 p00(component_type(x), height(x, z), component_type(z));
+            const vec3 p10(component_type(x + 1), height(x + 1, z),
+                           component_type(z));
+            const vec3 p01(component_type(x), height(x, z + 1),
+                           component_type(z + 1));
+            const vec3 p11(component_type(x + 1), height(x + 1, z + 1),
+                           component_type(z + 1));
+            scene.add_triangle(p00, p01, p11);
+            scene.add_triangle(p00, p11, p10);
+        }
+    }
+    for (int i = 0; i < 64; ++i)
+    {
+        const component_type x = component_type((i * 37) % 60 + 2);
+        const component_type z = component_type((i * 23) % 60 + 2);
+        scene.add_box(aabb(vec3(x, 0, z), vec3(x + 1, 1.5, z + 1)));
+        scene.add_sphere(sphere(vec3(z, 0.5, x), 0.75));
+    }
+    scene.build();
+
+    // Thousands of characters walking in circles
+    std::vector<capsule> characters;
+    std::vector<vec3> velocities;
+    for (int i = 0; i < 4096; ++i)
+    {
+        const component_type x =
+            component_type(i % 64) + component_type(0.5);
+        const component_type z =
+            component_type(i / 64) + component_type(0.5);
+        characters.push_back(capsule::vertical(vec3(x, 2, z), 0.35, 0.55));
+        velocities.push_back(vec3(move::math::cos(component_type(i)), -2,
+                                  move::math::sin(component_type(i))));
+    }
+
+    const component_type delta_time = component_type(1) / 60;
+
+    std::vector<vec3> steps;
+    for (const vec3& velocity : velocities)
+    {
+        steps.push_back(vec3(velocity * delta_time));
+    }
+
+    BENCHMARK(alloc_appended_name(typeName, ": 4096 sweeps"))
+    {
+        uint32_t hits = 0;
+        typename world::hit_t h;
+        for (size_t i = 0; i < characters.size(); ++i)
+        {
+            hits += scene.sweep_capsule(characters[i], steps[i], h) ? 1 : 0;
+        }
+        return hits;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": 4096 sweeps in packets"))
+    {
+        constexpr size_t width = world::packet_width;
+        uint32_t hits = 0;
+        typename world::hit_t h[width];
+        for (size_t i = 0; i < characters.size(); i += width)
+        {
+            hits += uint32_t(std::popcount(scene.sweep_capsules(
+                characters.data() + i, steps.data() + i, width,
+                ~uint32_t(0), h)));
+        }
+        return hits;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": 4096 character ticks"))
+    {
+        for (size_t i = 0; i < characters.size(); ++i)
+        {
+            move_and_slide(scene, characters[i],
+                           vec3(velocities[i] * delta_time));
+        }
+        return characters[0].center();
+    };
+}
+
+// SCENARIO("Collision world benchmarks", "[!benchmark]")
+// {
+//     benchmark_collision_world<move::math::collision_worldf>();
+//     benchmark_collision_world<move::math::collision_worldd>();
+// }
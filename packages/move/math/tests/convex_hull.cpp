@@ -0,0 +1,324 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/convex_hull.hpp>
+#include <move/math/gjk.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/sphere.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+// Points spread through a unit ball, or over its surface
+template <typename T>
+inline std::vector<move::math::vec3<T, move::math::Acceleration::Scalar>>
+ball_points(size_t count, bool surface, uint32_t seed)
+{
+    using storage = move::math::vec3<T, move::math::Acceleration::Scalar>;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return T(seed >> 8) / T(1 << 24) * T(2) - T(1);
+    };
+    std::vector<storage> points;
+    while (points.size() < count)
+    {
+        const T x = next();
+        const T y = next();
+        const T z = next();
+        const T length = std::sqrt(x * x + y * y + z * z);
+        if (length > T(1) || length < T(1e-3))
+        {
+            continue;
+        }
+        const T scale = surface ? T(1) / length : T(1);
+        points.emplace_back(x * scale, y * scale, z * scale);
+    }
+    return points;
+}
+
+// Checks the hull is closed, convex, wound outward and encloses `points`
+template <typename T>
+inline void require_valid_hull(
+    const move::math::convex_hull<T>& hull,
+    const std::vector<move::math::vec3<T, move::math::Acceleration::Scalar>>&
+        points,
+    const T& tolerance)
+{
+    using vec3 = move::math::vec3<T, move::math::Acceleration::RTM>;
+    REQUIRE_FALSE(hull.empty());
+    // A closed triangulated surface of genus zero
+    REQUIRE(hull.face_count() == 2 * hull.vertex_count() - 4);
+
+    for (size_t f = 0; f < hull.face_count(); ++f)
+    {
+        const auto& plane = hull.planes()[f];
+        const vec3 a = hull.vertices()[hull.indices()[3 * f]];
+        const vec3 b = hull.vertices()[hull.indices()[3 * f + 1]];
+        const vec3 c = hull.vertices()[hull.indices()[3 * f + 2]];
+        const vec3 n = vec3::cross(vec3(b - a), vec3(c - a));
+        REQUIRE(vec3::dot(n, plane.get_normal()) > T(0));
+        REQUIRE(std::abs(plane.signed_distance(a)) <= tolerance);
+        for (size_t v = 0; v < hull.vertex_count(); ++v)
+        {
+            REQUIRE(plane.signed_distance(hull.vertices()[v]) <= tolerance);
+        }
+    }
+    for (const auto& p : points)
+    {
+        REQUIRE(
+            hull.contains(vec3(p.get_x(), p.get_y(), p.get_z()), tolerance));
+    }
+}
+
+template <typename T>
+inline void test_convex_hull()
+{
+    using vec3 = move::math::vec3<T, move::math::Acceleration::RTM>;
+    using storage = move::math::vec3<T, move::math::Acceleration::Scalar>;
+    using hull_t = move::math::convex_hull<T>;
+    using sphere = move::math::sphere<T>;
+
+    const T tolerance = std::is_same_v<T, float> ? T(1e-4) : T(1e-10);
+
+    GIVEN("A cube filled with points")
+    {
+        std::vector<storage> points;
+        for (int i = 0; i < 6; ++i)
+        {
+            for (int j = 0; j < 6; ++j)
+            {
+                for (int k = 0; k < 6; ++k)
+                {
+                    points.emplace_back(T(i) / 5, T(j) / 5, T(k) / 5);
+                }
+            }
+        }
+
+        THEN("Only the corners are vertices")
+        {
+            hull_t hull;
+            hull.build(points.data(), points.size());
+            require_valid_hull(hull, points, tolerance);
+            REQUIRE(hull.vertex_count() == 8);
+            REQUIRE(hull.face_count() == 12);
+            for (size_t v = 0; v < hull.vertex_count(); ++v)
+            {
+                const vec3 p = hull.vertices()[v];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    REQUIRE((p[axis] == T(0) || p[axis] == T(1)));
+                }
+            }
+            REQUIRE(hull.contains(vec3(T(0.5), T(0.5), T(0.5))));
+            REQUIRE_FALSE(hull.contains(vec3(T(0.5), T(1.01), T(0.5))));
+        }
+    }
+
+    GIVEN("Random point clouds")
+    {
+        THEN("Points inside a ball give a valid hull of some of them")
+        {
+            const auto points = ball_points<T>(3000, false, 11);
+            hull_t hull;
+            hull.build(points.data(), points.size());
+            require_valid_hull(hull, points, tolerance);
+            REQUIRE(hull.vertex_count() < points.size() / 4);
+
+            // Every vertex is one of the input points
+            for (size_t v = 0; v < hull.vertex_count(); ++v)
+            {
+                const vec3 p = hull.vertices()[v];
+                bool found = false;
+                for (const storage& q : points)
+                {
+                    found = found ||
+                            (q.get_x() == p.get_x() &&
+                             q.get_y() == p.get_y() && q.get_z() == p.get_z());
+                }
+                REQUIRE(found);
+            }
+        }
+
+        THEN("Points on a sphere are all vertices")
+        {
+            const auto points = ball_points<T>(1500, true, 5);
+            hull_t hull;
+            hull.build(points.data(), points.size());
+            require_valid_hull(hull, points, tolerance);
+            if constexpr (std::is_same_v<T, double>)
+            {
+                REQUIRE(hull.vertex_count() == points.size());
+            }
+        }
+
+        THEN("Rebuilding replaces the hull")
+        {
+            const auto first = ball_points<T>(500, false, 1);
+            const auto second = ball_points<T>(500, true, 2);
+            hull_t hull;
+            hull.build(first.data(), first.size());
+            hull.build(second.data(), second.size());
+            require_valid_hull(hull, second, tolerance);
+        }
+    }
+
+    GIVEN("Points that span no volume")
+    {
+        THEN("Too few, coincident, collinear or coplanar points give no hull")
+        {
+            hull_t hull;
+            std::vector<storage> points = {storage(0, 0, 0), storage(1, 0, 0),
+                                           storage(0, 1, 0)};
+            hull.build(points.data(), points.size());
+            REQUIRE(hull.empty());
+
+            points.assign(10, storage(1, 2, 3));
+            hull.build(points.data(), points.size());
+            REQUIRE(hull.empty());
+
+            points.clear();
+            for (int i = 0; i < 10; ++i)
+            {
+                points.emplace_back(T(i), T(2 * i), T(-i));
+            }
+            hull.build(points.data(), points.size());
+            REQUIRE(hull.empty());
+
+            points.clear();
+            for (int i = 0; i < 10; ++i)
+            {
+                points.emplace_back(T(i % 3), T(i / 3), T(0));
+            }
+            hull.build(points.data(), points.size());
+            REQUIRE(hull.empty());
+            REQUIRE_FALSE(hull.contains(vec3(0, 0, 0)));
+        }
+
+        THEN("Repeated corners of a tetrahedron give the tetrahedron")
+        {
+            std::vector<storage> points;
+            for (int i = 0; i < 5; ++i)
+            {
+                points.emplace_back(0, 0, 0);
+                points.emplace_back(1, 0, 0);
+                points.emplace_back(0, 1, 0);
+                points.emplace_back(0, 0, 1);
+            }
+            hull_t hull;
+            hull.build(points.data(), points.size());
+            require_valid_hull(hull, points, tolerance);
+            REQUIRE(hull.vertex_count() == 4);
+        }
+
+        THEN("Points whose horizon rounding breaks still end up enclosed")
+        {
+            // Flattened this far, a point barely above a sliver face sees
+            // faces bounded by more than one loop.  Seed 168 recovers by
+            // taking a nearer point first; in seed 50 no point of the face
+            // has a clean horizon, so its farthest one is left off.
+            if constexpr (std::is_same_v<T, double>)
+            {
+                for (const uint32_t seed : {50u, 168u})
+                {
+                    auto points = ball_points<T>(1000, false, seed);
+                    for (storage& p : points)
+                    {
+                        p = storage(p.get_x(), p.get_y(),
+                                    p.get_z() * T(3e-14));
+                    }
+                    hull_t hull;
+                    hull.build(points.data(), points.size());
+                    require_valid_hull(hull, points, tolerance);
+                }
+            }
+        }
+    }
+
+    GIVEN("A hull used as a GJK shape")
+    {
+        const auto points = ball_points<T>(2000, false, 3);
+        hull_t hull;
+        hull.build(points.data(), points.size());
+        std::vector<vec3> all;
+        for (const storage& p : points)
+        {
+            all.emplace_back(p.get_x(), p.get_y(), p.get_z());
+        }
+        const move::math::convex_point_set<T> cloud(all.data(), all.size());
+
+        THEN("It measures the same as the whole cloud")
+        {
+            for (int i = 0; i < 20; ++i)
+            {
+                const T angle = T(i) * T(0.3);
+                const vec3 center(T(2) * std::cos(angle), T(0.3) * T(i % 5),
+                                  T(2) * std::sin(angle));
+                const sphere ball(center, T(0.4));
+                move::math::gjk_simplex<T> a;
+                move::math::gjk_simplex<T> b;
+                const auto expected =
+                    move::math::collide_convex(cloud, ball, a);
+                const auto result = move::math::collide_convex(hull, ball, b);
+                REQUIRE(result.distance ==
+                        Catch::Approx(expected.distance).margin(tolerance));
+            }
+        }
+    }
+}
+
+SCENARIO("Convex hull full tests")
+{
+    test_convex_hull<float>();
+    test_convex_hull<double>();
+}
+
+template <typename T>
+inline void benchmark_convex_hull()
+{
+    using hull_t = move::math::convex_hull<T>;
+
+    const auto typeName = move::meta::type_name<T>();
+
+    for (size_t count : {size_t(10000), size_t(100000), size_t(1000000)})
+    {
+        const auto points = ball_points<T>(count, false, 17);
+        const char* label = alloc_appended_name(
+            typeName, count == 10000    ? ": quickhull 10k in a ball"
+                      : count == 100000 ? ": quickhull 100k in a ball"
+                                        : ": quickhull 1M in a ball");
+        hull_t hull;
+        BENCHMARK(label)
+        {
+            hull.build(points.data(), points.size());
+            return hull.face_count();
+        };
+    }
+
+    // Every point is a vertex, the worst case for the face searches
+    const auto surface = ball_points<T>(10000, true, 19);
+    hull_t hull;
+    BENCHMARK(alloc_appended_name(typeName, ": quickhull 10k on a sphere"))
+    {
+        hull.build(surface.data(), surface.size());
+        return hull.face_count();
+    };
+}
+
+// SCENARIO("Convex hull benchmarks", "[!benchmark]")
+// {
+//     benchmark_convex_hull<float>();
+//     benchmark_convex_hull<double>();
+// }
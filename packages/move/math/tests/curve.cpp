@@ -0,0 +1,294 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/curve.hpp>
+#include <move/math/macros.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+// Builds a vec2, vec3 or vec4 from the leading components
+template <typename V>
+inline V make_curve_vec(typename V::component_type x,
+                        typename V::component_type y,
+                        typename V::component_type z,
+                        typename V::component_type w)
+{
+    if constexpr (V::element_count == 2)
+    {
+        return V(x, y);
+    }
+    else if constexpr (V::element_count == 3)
+    {
+        return V(x, y, z);
+    }
+    else
+    {
+        return V(x, y, z, w);
+    }
+}
+
+template <typename V>
+inline bool curve_near(const V& a,
+                       const V& b,
+                       typename V::component_type epsilon)
+{
+    return V(a - b).length() <= epsilon;
+}
+
+template <typename V>
+inline void test_curve()
+{
+    using component_type = V::component_type;
+    using move::math::CurveBasis;
+    static constexpr auto epsilon = component_type(0.001);
+
+    INFO("Testing curves with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tacceleration: " << magic_enum::enum_name(V::acceleration));
+    INFO("\tvector: " << move::meta::type_name<V>());
+
+    const V c0 = make_curve_vec<V>(0, 0, 0, 1);
+    const V c1 = make_curve_vec<V>(1, 2, -1, 0);
+    const V c2 = make_curve_vec<V>(3, 3, 2, -1);
+    const V c3 = make_curve_vec<V>(4, 0, 1, 2);
+
+    const move::math::hermite_curve<V> hermite(c0, c1, c3, c2);
+    const move::math::bezier_curve<V> bezier(c0, c1, c2, c3);
+    const move::math::catmull_rom_curve<V> catmull_rom(c0, c1, c2, c3);
+    const move::math::bspline_curve<V> bspline(c0, c1, c2, c3);
+
+    WHEN("Curves are evaluated at their ends")
+    {
+        THEN("Each basis meets its defining constraints")
+        {
+            REQUIRE(curve_near(hermite.evaluate(0), c0, epsilon));
+            REQUIRE(curve_near(hermite.evaluate(1), c3, epsilon));
+            REQUIRE(curve_near(hermite.derivative(0), c1, epsilon));
+            REQUIRE(curve_near(hermite.derivative(1), c2, epsilon));
+
+            REQUIRE(curve_near(bezier.evaluate(0), c0, epsilon));
+            REQUIRE(curve_near(bezier.evaluate(1), c3, epsilon));
+            REQUIRE(curve_near(bezier.derivative(0), V(V(c1 - c0) * 3),
+                               epsilon));
+
+            REQUIRE(curve_near(catmull_rom.evaluate(0), c1, epsilon));
+            REQUIRE(curve_near(catmull_rom.evaluate(1), c2, epsilon));
+            REQUIRE(curve_near(catmull_rom.derivative(0),
+                               V(V(c2 - c0) * component_type(0.5)), epsilon));
+
+            const V bspline_start =
+                V(V(c0 + c1 * 4) + c2) * (component_type(1) / 6);
+            REQUIRE(curve_near(bspline.evaluate(0), bspline_start, epsilon));
+        }
+    }
+
+    WHEN("Curve weights are computed")
+    {
+        THEN("The point bases form a partition of unity")
+        {
+            for (component_type t : {0.0, 0.2, 0.5, 0.9, 1.0})
+            {
+                component_type w[4];
+                move::math::bezier_curve<V>::weights(t, w);
+                REQUIRE(w[0] + w[1] + w[2] + w[3] ==
+                        Catch::Approx(1).epsilon(epsilon));
+                move::math::catmull_rom_curve<V>::weights(t, w);
+                REQUIRE(w[0] + w[1] + w[2] + w[3] ==
+                        Catch::Approx(1).epsilon(epsilon));
+                move::math::bspline_curve<V>::weights(t, w);
+                REQUIRE(w[0] + w[1] + w[2] + w[3] ==
+                        Catch::Approx(1).epsilon(epsilon));
+            }
+        }
+    }
+
+    WHEN("Derivatives are evaluated")
+    {
+        const component_type t = component_type(0.4);
+        const component_type h = component_type(0.001);
+
+        THEN("They match finite differences")
+        {
+            const V first =
+                V(bspline.evaluate(t + h) - bspline.evaluate(t - h)) *
+                (component_type(1) / (2 * h));
+            REQUIRE(curve_near(bspline.derivative(t), first,
+                               component_type(0.01)));
+
+            const V second =
+                V(bezier.derivative(t + h) - bezier.derivative(t - h)) *
+                (component_type(1) / (2 * h));
+            REQUIRE(curve_near(bezier.second_derivative(t), second,
+                               component_type(0.01)));
+        }
+    }
+
+    WHEN("A curve is sampled in bulk")
+    {
+        // Seven parameters cover a full batch of four and a remainder
+        const component_type params[] = {0.0, 0.1, 0.35, 0.5,
+                                         0.6, 0.85, 1.0};
+        V sampled[7];
+        catmull_rom.sample(params, sampled, 7);
+
+        V uniform[9];
+        bezier.sample_uniform(uniform, 9);
+
+        THEN("Each sample matches evaluate")
+        {
+            for (size_t i = 0; i < 7; ++i)
+            {
+                REQUIRE(curve_near(sampled[i], catmull_rom.evaluate(params[i]),
+                                   epsilon));
+            }
+            for (size_t i = 0; i < 9; ++i)
+            {
+                REQUIRE(curve_near(uniform[i],
+                                   bezier.evaluate(component_type(i) / 8),
+                                   epsilon));
+            }
+        }
+    }
+
+    WHEN("A spline is split into segments")
+    {
+        const V points[] = {c0, c1, c2, c3, make_curve_vec<V>(6, 1, 0, 0),
+                            make_curve_vec<V>(7, -2, 3, 1)};
+        using catmull_rom_t = move::math::catmull_rom_curve<V>;
+        using bezier_t = move::math::bezier_curve<V>;
+
+        THEN("Consecutive segments join up")
+        {
+            REQUIRE(catmull_rom_t::segment_count(6) == 3);
+            REQUIRE(bezier_t::segment_count(7) == 2);
+            REQUIRE(bezier_t::segment_count(3) == 0);
+            for (size_t i = 0; i + 1 < catmull_rom_t::segment_count(6); ++i)
+            {
+                REQUIRE(curve_near(
+                    catmull_rom_t::segment(points, i).evaluate(1),
+                    catmull_rom_t::segment(points, i + 1).evaluate(0),
+                    epsilon));
+            }
+        }
+    }
+
+    WHEN("An arc length table is built")
+    {
+        const V end = make_curve_vec<V>(6, 8, 0, 0);
+        const component_type length = V(end - c0).length();
+        // Handles bunched at the ends make t advance unevenly along the line
+        const move::math::bezier_curve<V> line(c0, c0, end, end);
+        const move::math::arc_length_table<component_type, 128> table(line);
+
+        THEN("The total length matches the line")
+        {
+            REQUIRE(table.total_length() ==
+                    Catch::Approx(length).epsilon(epsilon));
+        }
+
+        THEN("Parameters found by distance are evenly spaced")
+        {
+            REQUIRE(table.parameter_at_distance(-1) == 0);
+            REQUIRE(table.parameter_at_distance(length * 2) == 1);
+            for (component_type fraction : {0.1, 0.25, 0.5, 0.8})
+            {
+                const component_type t = table.parameter_at_fraction(fraction);
+                const component_type travelled =
+                    V(line.evaluate(t) - c0).length();
+                REQUIRE(travelled == Catch::Approx(fraction * length)
+                                         .margin(component_type(0.01)));
+            }
+        }
+    }
+}
+
+template <typename V>
+inline void benchmark_curve()
+{
+    using component_type = V::component_type;
+    move::string_view typeName = move::meta::type_name<V>();
+
+    const move::math::catmull_rom_curve<V> curve(
+        make_curve_vec<V>(0, 0, 0, 1), make_curve_vec<V>(1, 2, -1, 0),
+        make_curve_vec<V>(3, 3, 2, -1), make_curve_vec<V>(4, 0, 1, 2));
+    constexpr size_t sample_count = 4096;
+    std::vector<component_type> params(sample_count);
+    for (size_t i = 0; i < sample_count; ++i)
+    {
+        params[i] = component_type(i) / (sample_count - 1);
+    }
+    std::vector<V> points(sample_count);
+
+    BENCHMARK(alloc_appended_name(typeName, ": Curve (lerp chain)"))
+    {
+        for (size_t i = 0; i < sample_count; ++i)
+        {
+            const component_type t = params[i];
+            const V a = V::lerp_unclamped(curve.controls[0],
+                                          curve.controls[1], t);
+            const V b = V::lerp_unclamped(curve.controls[1],
+                                          curve.controls[2], t);
+            const V c = V::lerp_unclamped(curve.controls[2],
+                                          curve.controls[3], t);
+            points[i] = V::lerp_unclamped(V::lerp_unclamped(a, b, t),
+                                          V::lerp_unclamped(b, c, t), t);
+        }
+        return points.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Curve (evaluate loop)"))
+    {
+        for (size_t i = 0; i < sample_count; ++i)
+        {
+            points[i] = curve.evaluate(params[i]);
+        }
+        return points.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Curve (sample)"))
+    {
+        curve.sample(params.data(), points.data(), sample_count);
+        return points.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Arc length table"))
+    {
+        return move::math::arc_length_table<component_type>(curve);
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER(test_curve, move::math::vec3);
+REPEAT_FOR_EACH_TYPE_WRAPPER(benchmark_curve, move::math::vec3);
+
+SCENARIO("Curve full tests")
+{
+    using namespace move::math;
+    using Accel = move::math::Acceleration;
+
+    test_curve_multi<Accel::Scalar, float, double>();
+    test_curve_multi<Accel::RTM, float, double>();
+    test_curve<vec2<float, Accel::Scalar>>();
+    test_curve<vec2<double, Accel::Scalar>>();
+    test_curve<vec4<float, Accel::RTM>>();
+    test_curve<vec4<double, Accel::RTM>>();
+}
+
+// SCENARIO("Curve benchmarks")
+// {
+//     using namespace move::math;
+//     using Accel = move::math::Acceleration;
+
+//     benchmark_curve_multi<Accel::RTM, float, double>();
+// }
@@ -0,0 +1,223 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/dual_quat.hpp>
+#include <move/math/macros.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include "mm_test_common.hpp"
+
+template <typename dual_quat>
+inline void test_dual_quat()
+{
+    using component_type = dual_quat::component_type;
+    using vec3 = dual_quat::vec3_t;
+    using quat = dual_quat::quat_t;
+    using mat4 = dual_quat::mat4x4_t;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing dual_quat with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tacceleration: " << magic_enum::enum_name(dual_quat::acceleration));
+    INFO("\tdual_quat: " << move::meta::type_name<dual_quat>());
+
+    const quat rotation =
+        quat::angle_axis(vec3(1, 2, 3).normalized(),
+                         move::math::deg2rad<component_type>(50));
+    const vec3 translation(4, -2, 7);
+    const vec3 point(1, -3, 2);
+    const dual_quat dq(rotation, translation);
+
+    REQUIRE(dual_quat::identity().transform_point(point) == point);
+
+    WHEN("A point is transformed")
+    {
+        const vec3 result = dq.transform_point(point);
+
+        THEN("It is rotated and then translated")
+        {
+            REQUIRE(approx_equal(result, vec3(point * rotation + translation),
+                                 epsilon));
+        }
+
+        THEN("It matches the equivalent TRS matrix")
+        {
+            const mat4 trs = mat4::trs(translation, rotation, vec3(1, 1, 1));
+            REQUIRE(approx_equal(result, vec3(trs.transform_point(point)),
+                                 epsilon));
+        }
+    }
+
+    WHEN("A direction is transformed")
+    {
+        THEN("It is only rotated")
+        {
+            REQUIRE(approx_equal(dq.transform_vector(point),
+                                 vec3(point * rotation), epsilon));
+        }
+    }
+
+    WHEN("The rotation and translation are read back")
+    {
+        THEN("They match the values it was built from")
+        {
+            REQUIRE(approx_equal(dq.get_rotation(), rotation, epsilon));
+            REQUIRE(approx_equal(dq.get_translation(), translation, epsilon));
+        }
+    }
+
+    WHEN("Two dual quaternions are multiplied")
+    {
+        const dual_quat other(quat::rotation_y(component_type(0.7)),
+                              vec3(-1, 5, 2));
+        const dual_quat combined = dq * other;
+
+        THEN("The first is applied first, like mat4x4")
+        {
+            const vec3 expected =
+                other.transform_point(dq.transform_point(point));
+            REQUIRE(approx_equal(combined.transform_point(point), expected,
+                                 epsilon));
+
+            const mat4 matrices = dq.to_mat4x4() * other.to_mat4x4();
+            REQUIRE(approx_equal(combined.to_mat4x4(), matrices, epsilon));
+        }
+    }
+
+    WHEN("A dual quaternion is inverted")
+    {
+        THEN("Composing it with the original gives the identity")
+        {
+            REQUIRE(approx_equal(dq * dq.inverse(), dual_quat::identity(),
+                                 epsilon));
+            REQUIRE(approx_equal(
+                dq.inverse().transform_point(dq.transform_point(point)), point,
+                epsilon));
+        }
+    }
+
+    WHEN("Converting to and from matrices")
+    {
+        THEN("The transform survives a round trip through mat4x4")
+        {
+            const dual_quat result = dual_quat::from_mat4x4(dq.to_mat4x4());
+            REQUIRE(approx_equal(result.transform_point(point),
+                                 dq.transform_point(point), epsilon));
+        }
+
+        THEN("The transform survives a round trip through mat3x4")
+        {
+            const dual_quat result = dual_quat::from_mat3x4(dq.to_mat3x4());
+            REQUIRE(approx_equal(result.transform_point(point),
+                                 dq.transform_point(point), epsilon));
+        }
+    }
+
+    WHEN("A scaled dual quaternion is normalized")
+    {
+        const dual_quat scaled = dual_quat::from_parts(
+            quat::from_rtm(rtm::vector_to_quat(rtm::vector_mul(
+                rtm::quat_to_vector(dq.get_real().to_rtm()),
+                component_type(3)))),
+            quat::from_rtm(rtm::vector_to_quat(rtm::vector_mul(
+                rtm::quat_to_vector(dq.get_dual().to_rtm()),
+                component_type(3)))));
+
+        THEN("The original transform is recovered")
+        {
+            REQUIRE(approx_equal(scaled.normalized(), dq, epsilon));
+        }
+    }
+
+    WHEN("Two dual quaternions are blended")
+    {
+        const dual_quat a(quat::identity(), vec3(0, 0, 0));
+        const dual_quat b(
+            quat::rotation_y(move::math::deg2rad<component_type>(90)),
+            vec3(2, 0, 0));
+        const dual_quat halfway = dual_quat::lerp(a, b, component_type(0.5));
+
+        THEN("The endpoints are reproduced")
+        {
+            REQUIRE(approx_equal(dual_quat::lerp(a, b, 0), a, epsilon));
+            REQUIRE(approx_equal(dual_quat::lerp(a, b, 1), b, epsilon));
+        }
+
+        THEN("The midpoint is a rigid transform halfway between")
+        {
+            REQUIRE(halfway.get_real().length() ==
+                    Catch::Approx(1).epsilon(epsilon));
+            REQUIRE(approx_equal(
+                halfway.get_rotation(),
+                quat::rotation_y(move::math::deg2rad<component_type>(45)),
+                epsilon));
+        }
+
+        THEN("The blend takes the short way around")
+        {
+            const dual_quat flipped = dual_quat::from_parts(
+                quat::from_rtm(rtm::quat_neg(b.get_real().to_rtm())),
+                quat::from_rtm(rtm::quat_neg(b.get_dual().to_rtm())));
+            const dual_quat result =
+                dual_quat::lerp(a, flipped, component_type(0.5));
+            REQUIRE(approx_equal(result.transform_point(point),
+                                 halfway.transform_point(point), epsilon));
+        }
+    }
+}
+
+template <typename dual_quat>
+inline void benchmark_dual_quat()
+{
+    using component_type = dual_quat::component_type;
+    using vec3 = dual_quat::vec3_t;
+    using quat = dual_quat::quat_t;
+    using mat4 = dual_quat::mat4x4_t;
+    move::string_view typeName = move::meta::type_name<dual_quat>();
+
+    const quat rotation = quat::rotation_y(component_type(0.5));
+    const vec3 translation(1, 2, 3);
+    const dual_quat a(rotation, translation);
+    const dual_quat b(quat::rotation_x(component_type(0.3)), vec3(3, 2, 1));
+    const mat4 ma = a.to_mat4x4();
+    const mat4 mb = b.to_mat4x4();
+
+    BENCHMARK(alloc_appended_name(typeName, ": Compose"))
+    {
+        return a * b;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Compose (mat4x4)"))
+    {
+        return ma * mb;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Transform point"))
+    {
+        return a.transform_point(translation);
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_dual_quat, move::math::dual_quat);
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_dual_quat,
+                                     move::math::dual_quat);
+
+SCENARIO("Dual quaternion full tests")
+{
+    test_dual_quat_multi<float, double>();
+}
+
+// SCENARIO("Dual quaternion benchmarks")
+// {
+//     benchmark_dual_quat_multi<float, double>();
+// }
@@ -0,0 +1,447 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/aabb.hpp>
+#include <move/math/capsule.hpp>
+#include <move/math/closest_point.hpp>
+#include <move/math/common.hpp>
+#include <move/math/gjk.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/quat.hpp>
+#include <move/math/sphere.hpp>
+#include <move/math/transform_qvv.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename T>
+inline T gjk_length(const move::math::vec3<T, move::math::Acceleration::RTM>& v)
+{
+    return std::sqrt(v.get_x() * v.get_x() + v.get_y() * v.get_y() +
+                     v.get_z() * v.get_z());
+}
+
+// The corners of an axis-aligned box, as a hull for convex_point_set
+template <typename T>
+inline std::vector<move::math::vec3<T, move::math::Acceleration::RTM>>
+box_corners(const T& half_x, const T& half_y, const T& half_z)
+{
+    using vec3 = move::math::vec3<T, move::math::Acceleration::RTM>;
+    std::vector<vec3> corners;
+    for (int i = 0; i < 8; ++i)
+    {
+        corners.emplace_back(i & 1 ? half_x : -half_x,
+                             i & 2 ? half_y : -half_y,
+                             i & 4 ? half_z : -half_z);
+    }
+    return corners;
+}
+
+template <typename T>
+inline void test_gjk()
+{
+    using vec3 = move::math::vec3<T, move::math::Acceleration::RTM>;
+    using aabb = move::math::aabb<T>;
+    using sphere = move::math::sphere<T>;
+    using capsule = move::math::capsule<T>;
+    using quat = move::math::quat<T>;
+    using transform = move::math::transform_qvv<T>;
+    using points = move::math::convex_point_set<T>;
+    using posed = move::math::transformed_shape<points>;
+    using simplex = move::math::gjk_simplex<T>;
+    using move::math::collide_convex;
+    using move::math::gjk_distance;
+
+    const T tolerance = std::is_same_v<T, float> ? T(2e-3) : T(1e-6);
+
+    uint32_t seed = 1234;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return T(seed >> 8) / T(1 << 24) * T(2) - T(1);
+    };
+    const auto random_vec = [&next]() { return vec3(next(), next(), next()); };
+
+    GIVEN("Shapes with their own support mappings")
+    {
+        THEN("Supports are the farthest points")
+        {
+            const aabb box(vec3(-1, -2, -3), vec3(1, 2, 3));
+            REQUIRE(box.support(vec3(1, -1, 1)) == vec3(1, -2, 3));
+            const sphere ball(vec3(1, 0, 0), 2);
+            REQUIRE(gjk_length(vec3(ball.support(vec3(0, 0, 5)) -
+                                    vec3(1, 0, 2))) < tolerance);
+            const capsule pill(vec3(0, 0, 0), vec3(0, 4, 0), 1);
+            REQUIRE(gjk_length(vec3(pill.support(vec3(1, 1, 0)) -
+                                    vec3(std::sqrt(T(0.5)),
+                                         4 + std::sqrt(T(0.5)), 0))) <
+                    tolerance);
+            REQUIRE(pill.core_support(vec3(0, -1, 0)) == vec3(0, 0, 0));
+        }
+
+        THEN("Sphere pairs match their center distance")
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                const sphere a(random_vec(), next() + T(1.1));
+                const sphere b(vec3(random_vec() * T(4)), next() + T(1.1));
+                const T expected = gjk_length(vec3(b.get_center() -
+                                                   a.get_center())) -
+                                   a.get_radius() - b.get_radius();
+                simplex cache;
+                const auto contact = collide_convex(a, b, cache);
+                REQUIRE(contact.distance ==
+                        Catch::Approx(expected).margin(tolerance));
+
+                cache.reset();
+                const auto result = gjk_distance(a, b, cache);
+                REQUIRE(result.intersecting == (expected <= T(0)));
+            }
+        }
+
+        THEN("Box pairs match their per-axis gaps and overlaps")
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                const vec3 c1 = random_vec();
+                const vec3 c2 = vec3(random_vec() * T(2));
+                const vec3 h1(next() + T(1.2), next() + T(1.2),
+                              next() + T(1.2));
+                const vec3 h2(next() + T(1.2), next() + T(1.2),
+                              next() + T(1.2));
+                const aabb a(vec3(c1 - h1), vec3(c1 + h1));
+                const aabb b(vec3(c2 - h2), vec3(c2 + h2));
+
+                T gap[3];
+                T overlap = std::numeric_limits<T>::infinity();
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    // Pushing b either way along the axis frees it
+                    const T up = a.get_max()[axis] - b.get_min()[axis];
+                    const T down = b.get_max()[axis] - a.get_min()[axis];
+                    gap[axis] = std::max(-std::min(up, down), T(0));
+                    overlap = std::min(overlap, std::min(up, down));
+                }
+                const bool separated =
+                    gap[0] > T(0) || gap[1] > T(0) || gap[2] > T(0);
+                const T expected =
+                    separated ? std::sqrt(gap[0] * gap[0] + gap[1] * gap[1] +
+                                          gap[2] * gap[2])
+                              : -overlap;
+
+                simplex cache;
+                const auto contact = collide_convex(a, b, cache);
+                REQUIRE(contact.distance ==
+                        Catch::Approx(expected).margin(tolerance));
+                REQUIRE(gjk_length(contact.normal) ==
+                        Catch::Approx(1).margin(tolerance));
+                if (separated)
+                {
+                    REQUIRE(gjk_length(vec3(contact.point_b -
+                                            contact.point_a)) ==
+                            Catch::Approx(expected).margin(tolerance));
+                    REQUIRE(a.distance_squared(contact.point_a) <
+                            tolerance);
+                    REQUIRE(b.distance_squared(contact.point_b) <
+                            tolerance);
+                }
+            }
+        }
+
+        THEN("Capsule pairs match their segment distance")
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                const capsule a(random_vec(), random_vec(),
+                                T(0.1) + T(0.2) * (next() + 1));
+                const capsule b(vec3(random_vec() * T(2)),
+                                vec3(random_vec() * T(2)),
+                                T(0.1) + T(0.2) * (next() + 1));
+                vec3 c1;
+                vec3 c2;
+                const T segment_distance =
+                    std::sqrt(move::math::closest_points_on_segments(
+                        a.get_a(), a.get_b(), b.get_a(), b.get_b(), c1, c2));
+                if (segment_distance < tolerance)
+                {
+                    // Crossing cores have no defined normal to test
+                    continue;
+                }
+                const T expected =
+                    segment_distance - a.get_radius() - b.get_radius();
+
+                simplex cache;
+                const auto contact = collide_convex(a, b, cache);
+                REQUIRE(contact.distance ==
+                        Catch::Approx(expected).margin(tolerance));
+            }
+        }
+
+        THEN("Boxes and spheres match the box's closest point")
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                const aabb box(vec3(-1, -1, -1), vec3(1, 1, 1));
+                const sphere ball(vec3(random_vec() * T(3)), T(0.25));
+                const T expected =
+                    std::sqrt(box.distance_squared(ball.get_center())) -
+                    ball.get_radius();
+                if (expected < T(0.05))
+                {
+                    continue;
+                }
+                simplex cache;
+                const auto result = gjk_distance(box, ball, cache);
+                REQUIRE_FALSE(result.intersecting);
+                REQUIRE(result.distance ==
+                        Catch::Approx(expected).margin(tolerance));
+            }
+        }
+    }
+
+    GIVEN("Hulls posed by transforms")
+    {
+        const std::vector<vec3> cube = box_corners(T(1), T(1), T(1));
+        const points hull(cube.data(), cube.size());
+
+        THEN("A cube turned 45 degrees reaches out to its edge")
+        {
+            const posed turned(
+                hull, transform(vec3(0, 0, 0),
+                                quat::angle_axis(vec3(0, 0, 1),
+                                                 T(0.7853981633974483)),
+                                vec3(1, 1, 1)));
+            const sphere ball(vec3(3, 0, 0), T(0.5));
+            simplex cache;
+            const auto result = gjk_distance(turned, ball, cache);
+            REQUIRE_FALSE(result.intersecting);
+            REQUIRE(result.distance ==
+                    Catch::Approx(T(3) - std::sqrt(T(2)) - T(0.5))
+                        .margin(tolerance));
+            REQUIRE(result.point_a.get_x() ==
+                    Catch::Approx(std::sqrt(T(2))).margin(tolerance));
+        }
+
+        THEN("Non-uniform scale stretches the hull")
+        {
+            const posed stretched(hull,
+                                  transform(vec3(1, 0, 0), quat::identity(),
+                                            vec3(3, 1, 1)));
+            const aabb box(vec3(5, -1, -1), vec3(6, 1, 1));
+            simplex cache;
+            const auto result = gjk_distance(stretched, box, cache);
+            REQUIRE(result.distance == Catch::Approx(1).margin(tolerance));
+        }
+
+        THEN("Separating by the EPA contact leaves the hulls touching")
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                const posed a(hull,
+                              transform(random_vec(),
+                                        quat::angle_axis(
+                                            vec3(random_vec() +
+                                                 vec3(0, 0, T(1.5)))
+                                                .normalized(),
+                                            next() * T(3)),
+                                        vec3(1, 1, 1)));
+                const vec3 offset = vec3(random_vec() * T(0.5));
+                const quat turn = quat::angle_axis(
+                    vec3(random_vec() + vec3(T(1.5), 0, 0)).normalized(),
+                    next() * T(3));
+                const posed b(hull, transform(offset, turn, vec3(1, 1, 1)));
+
+                simplex cache;
+                const auto contact = collide_convex(a, b, cache);
+                REQUIRE(contact.distance < T(0));
+                REQUIRE(gjk_length(contact.normal) ==
+                        Catch::Approx(1).margin(tolerance));
+
+                // Pushing b out along the normal by the depth resolves the
+                // overlap and no more
+                const posed moved(
+                    hull,
+                    transform(vec3(offset - contact.normal * contact.distance),
+                              turn, vec3(1, 1, 1)));
+                cache.reset();
+                const auto after = collide_convex(a, moved, cache);
+                REQUIRE(after.distance ==
+                        Catch::Approx(0).margin(T(20) * tolerance));
+            }
+        }
+    }
+
+    GIVEN("A contact that persists between frames")
+    {
+        // A rounded hull, where a cold start needs many support calls
+        std::vector<vec3> cloud;
+        for (int i = 0; i < 64; ++i)
+        {
+            cloud.push_back(random_vec().normalized());
+        }
+        const points hull(cloud.data(), cloud.size());
+
+        THEN("Warm starting reaches the same answer in fewer iterations")
+        {
+            const posed fixed(hull, transform::identity());
+            simplex warm;
+            uint32_t cold_iterations = 0;
+            uint32_t warm_iterations = 0;
+            for (int frame = 0; frame < 200; ++frame)
+            {
+                const T t = T(frame) / T(200);
+                const posed moving(
+                    hull, transform(vec3(T(2.2) + T(0.1) * std::sin(t * 6),
+                                         t, 0),
+                                    quat::angle_axis(vec3(0, 1, 0), t * 2),
+                                    vec3(1, 1, 1)));
+
+                simplex cold;
+                const auto expected = collide_convex(fixed, moving, cold);
+                const auto result = collide_convex(fixed, moving, warm);
+                REQUIRE(result.distance ==
+                        Catch::Approx(expected.distance).margin(tolerance));
+                cold_iterations += expected.iterations;
+                warm_iterations += result.iterations;
+            }
+            REQUIRE(warm_iterations * 4 < cold_iterations * 3);
+        }
+
+        THEN("Warm starting survives the shapes passing through each other")
+        {
+            simplex warm;
+            for (int frame = 0; frame < 60; ++frame)
+            {
+                const aabb a(vec3(-1, -1, -1), vec3(1, 1, 1));
+                const T x = T(-4) + T(frame) * T(8) / T(59);
+                const sphere ball(vec3(x, T(0.1), 0), T(0.5));
+                simplex cold;
+                const auto expected = collide_convex(a, ball, cold);
+                const auto result = collide_convex(a, ball, warm);
+                REQUIRE(result.distance ==
+                        Catch::Approx(expected.distance).margin(tolerance));
+            }
+        }
+    }
+
+    GIVEN("Degenerate contacts")
+    {
+        THEN("Concentric spheres overlap by both radii")
+        {
+            const sphere a(vec3(1, 2, 3), 1);
+            const sphere b(vec3(1, 2, 3), T(0.5));
+            simplex cache;
+            const auto contact = collide_convex(a, b, cache);
+            REQUIRE(contact.distance == Catch::Approx(-1.5).margin(tolerance));
+            REQUIRE(gjk_length(contact.normal) ==
+                    Catch::Approx(1).margin(tolerance));
+        }
+
+        THEN("Crossing capsules overlap by both radii")
+        {
+            const capsule a(vec3(-1, 0, 0), vec3(1, 0, 0), T(0.25));
+            const capsule b(vec3(0, 0, -1), vec3(0, 0, 1), T(0.25));
+            simplex cache;
+            const auto contact = collide_convex(a, b, cache);
+            REQUIRE(contact.distance == Catch::Approx(-0.5).margin(tolerance));
+            REQUIRE(std::abs(contact.normal.get_y()) ==
+                    Catch::Approx(1).margin(tolerance));
+        }
+
+        THEN("Boxes sharing a face touch")
+        {
+            const aabb a(vec3(0, 0, 0), vec3(1, 1, 1));
+            const aabb b(vec3(1, 0, 0), vec3(2, 1, 1));
+            simplex cache;
+            const auto contact = collide_convex(a, b, cache);
+            REQUIRE(contact.distance == Catch::Approx(0).margin(tolerance));
+            cache.reset();
+            REQUIRE(gjk_distance(a, b, cache).intersecting);
+        }
+    }
+}
+
+SCENARIO("GJK full tests")
+{
+    test_gjk<float>();
+    test_gjk<double>();
+}
+
+template <typename T>
+inline void benchmark_gjk()
+{
+    using vec3 = move::math::vec3<T, move::math::Acceleration::RTM>;
+    using quat = move::math::quat<T>;
+    using transform = move::math::transform_qvv<T>;
+    using points = move::math::convex_point_set<T>;
+    using posed = move::math::transformed_shape<points>;
+    using simplex = move::math::gjk_simplex<T>;
+
+    const auto typeName = move::meta::type_name<T>();
+
+    // A rough 32-point hull, posed along a slow sweep past another
+    uint32_t seed = 99;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return T(seed >> 8) / T(1 << 24) * T(2) - T(1);
+    };
+    std::vector<vec3> cloud;
+    for (int i = 0; i < 32; ++i)
+    {
+        cloud.push_back(vec3(next(), next(), next()).normalized());
+    }
+    const points hull(cloud.data(), cloud.size());
+    std::vector<transform> frames;
+    for (int i = 0; i < 1024; ++i)
+    {
+        const T t = T(i) / T(1024);
+        frames.emplace_back(vec3(T(1.5) + std::sin(t * 6), t, 0),
+                            quat::angle_axis(vec3(0, 1, 0), t * 4),
+                            vec3(1, 1, 1));
+    }
+    const posed fixed(hull, transform::identity());
+
+    BENCHMARK(alloc_appended_name(typeName, ": 1024 hull pairs, cold"))
+    {
+        T total = 0;
+        for (const transform& frame : frames)
+        {
+            simplex cache;
+            total +=
+                move::math::collide_convex(fixed, posed(hull, frame), cache)
+                    .distance;
+        }
+        return total;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": 1024 hull pairs, warm"))
+    {
+        T total = 0;
+        simplex cache;
+        for (const transform& frame : frames)
+        {
+            total +=
+                move::math::collide_convex(fixed, posed(hull, frame), cache)
+                    .distance;
+        }
+        return total;
+    };
+}
+
+// SCENARIO("GJK benchmarks", "[!benchmark]")
+// {
+//     benchmark_gjk<float>();
+//     benchmark_gjk<double>();
+// }
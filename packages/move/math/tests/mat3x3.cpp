@@ -132,6 +132,15 @@ inline void test_mat3()
                         test14 * test15 * test16);
     }
 
+    // Fused multiply-add testing
+    {
+        THEN("mul_add scales and accumulates every row")
+        {
+            mat3 result = mat3::mul_add(mat3::identity(), 2, mat3::one());
+            REQUIRE(result == mat3(3, 1, 1, 1, 3, 1, 1, 1, 3));
+        }
+    }
+
     // Rotation matrix testing
     {
         mat3 rotation = mat3::angle_axis(
@@ -449,6 +458,23 @@ inline void benchmark_mat3()
 REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_mat3, move::math::mat3x3);
 REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_mat3, move::math::mat3x3);
 
+TEST_CASE("storage_mat3x3 is usable in constant expressions")
+{
+    using move::math::storage_float3x3;
+
+    constexpr storage_float3x3 identity;
+    static_assert(identity == storage_float3x3::identity());
+    static_assert(identity.data[0] == 1 && identity.data[4] == 1 &&
+                  identity.data[8] == 1 && identity.data[1] == 0);
+
+    constexpr storage_float3x3 rotation(0, 0, -1, 0, 1, 0, 1, 0, 0);
+    constexpr storage_float3x3 copy = rotation;
+    static_assert(copy == rotation);
+    static_assert(copy != identity);
+
+    REQUIRE(copy.data[2] == -1);
+}
+
 SCENARIO("Mat3 full tests")
 {
     using namespace move::math;
@@ -14,6 +14,8 @@
 #endif
 #include <move/string.hpp>
 
+#include <vector>
+
 #include "mm_test_common.hpp"
 
 template <typename mat4>
@@ -204,6 +206,301 @@ inline void test_mat4()
         }
     }
 
+    // Fused multiply-add testing
+    {
+        mat4 transform =
+            mat4::scale(2, 3, 4) *
+            mat4::angle_axis(vec3::up(),
+                             move::math::deg2rad<component_type>(30)) *
+            mat4::translation(vec3(5, -6, 7));
+
+        THEN("transform_point matches vector-matrix multiplication")
+        {
+            vec3 test = {1, -2, 3};
+            auto result = transform.transform_point(test.fast());
+            vec4 expected = vec4(test, 1) * transform;
+
+            REQUIRE(move::math::approx_equal(result, expected.xyz().fast(),
+                                             component_type(0.001)));
+        }
+
+        THEN("transform_vector matches vector-matrix multiplication")
+        {
+            vec3 test = {1, -2, 3};
+            auto result = transform.transform_vector(test.fast());
+            vec4 expected = vec4(test, 0) * transform;
+
+            REQUIRE(move::math::approx_equal(result, expected.xyz().fast(),
+                                             component_type(0.001)));
+        }
+
+        THEN("mul_add scales and accumulates every row")
+        {
+            mat4 result = mat4::mul_add(mat4::identity(), 2, mat4::one());
+            REQUIRE(result ==
+                    mat4(3, 1, 1, 1, 1, 3, 1, 1, 1, 1, 3, 1, 1, 1, 1, 3));
+        }
+    }
+
+    // Bulk multiply testing
+    {
+        // Not a multiple of the unroll width, so the tail loop runs too
+        constexpr size_t count = 37;
+        std::vector<mat4> lhs(count);
+        std::vector<mat4> rhs(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            lhs[i] = mat4::translation(vec3(component_type(i), 1, 2));
+            rhs[i] = mat4::angle_axis(
+                vec3::up(), move::math::deg2rad(component_type(i * 10)));
+        }
+        const mat4 shared = mat4::scale(2, 3, 4);
+
+        THEN("multiply_arrays matches per-element multiplication")
+        {
+            std::vector<mat4> out(count);
+            mat4::multiply_arrays(lhs.data(), rhs.data(), out.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(out[i] == lhs[i] * rhs[i]);
+            }
+        }
+
+        THEN("The broadcast variants match per-element multiplication")
+        {
+            std::vector<mat4> out_lhs(count);
+            std::vector<mat4> out_rhs(count);
+            mat4::multiply_arrays(shared, rhs.data(), out_lhs.data(), count);
+            mat4::multiply_arrays(lhs.data(), shared, out_rhs.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(out_lhs[i] == shared * rhs[i]);
+                REQUIRE(out_rhs[i] == lhs[i] * shared);
+            }
+        }
+
+        THEN("multiply_arrays can write over one of its inputs")
+        {
+            std::vector<mat4> inout = lhs;
+            mat4::multiply_arrays(inout.data(), rhs.data(), inout.data(),
+                                  count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(inout[i] == lhs[i] * rhs[i]);
+            }
+        }
+
+        THEN("The chunked variant visits every chunk exactly once")
+        {
+            std::vector<mat4> out(count, mat4::zero());
+            size_t chunks_run = 0;
+            auto serial_for = [&](size_t chunk_count, auto&& job)
+            {
+                for (size_t i = 0; i < chunk_count; ++i)
+                {
+                    job(i);
+                    ++chunks_run;
+                }
+            };
+            mat4::multiply_arrays(lhs.data(), rhs.data(), out.data(), count,
+                                  serial_for, 8);
+
+            REQUIRE(chunks_run == 5);
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(out[i] == lhs[i] * rhs[i]);
+            }
+        }
+    }
+
+    // Decomposition testing
+    {
+        using move::math::DecomposeStatus;
+        using fast_vec3 = mat4::fast_vec3_t;
+        using move::math::approx_equal;
+        const vec3 translation(4, -3, 2);
+        const quat rotation =
+            quat::angle_axis(vec3(1, 2, -1).normalized(),
+                             move::math::deg2rad<component_type>(70));
+        const component_type epsilon = component_type(0.0001);
+
+        const vec3 scales[] = {vec3(1, 1, 1), vec3(2, 3, 0.5),
+                               vec3(-2, 3, 4), vec3(1, -1, 1),
+                               vec3(-1, -2, -3)};
+        for (const vec3& scale : scales)
+        {
+            const mat4 matrix = mat4::trs(translation, rotation, scale);
+
+            WHEN("A TRS matrix is decomposed")
+            {
+                fast_vec3 t, s;
+                quat r;
+                const DecomposeStatus status = matrix.decompose(t, r, s);
+
+                THEN("Rebuilding it with trs round-trips")
+                {
+                    REQUIRE(status == DecomposeStatus::Success);
+                    REQUIRE(approx_equal(vec3(t), translation, epsilon));
+                    REQUIRE(approx_equal(mat4::trs(t, r, s), matrix, epsilon));
+                }
+            }
+
+            WHEN("A TRS matrix is decomposed with QR")
+            {
+                fast_vec3 t, s;
+                quat r;
+                const DecomposeStatus status = matrix.decompose_qr(t, r, s);
+
+                THEN("Rebuilding it with trs round-trips")
+                {
+                    REQUIRE(status == DecomposeStatus::Success);
+                    REQUIRE(approx_equal(mat4::trs(t, r, s), matrix, epsilon));
+                }
+            }
+        }
+
+        WHEN("A matrix with positive scale is decomposed")
+        {
+            fast_vec3 t, s;
+            quat r;
+            (void)mat4::trs(translation, rotation, vec3(2, 3, 4))
+                .decompose(t, r, s);
+
+            THEN("The original components are recovered")
+            {
+                REQUIRE(approx_equal(vec3(s), vec3(2, 3, 4), epsilon));
+                const fast_vec3 forward(0, 0, 1);
+                REQUIRE(approx_equal(vec3(r.rotate_point(forward)),
+                                     vec3(rotation.rotate_point(forward)),
+                                     epsilon));
+            }
+        }
+
+        WHEN("A sheared matrix is decomposed")
+        {
+            const mat4 shear(1, 0, 0, 0, component_type(0.5), 1, 0, 0, 0, 0, 1,
+                             0, 0, 0, 0, 1);
+            const mat4 sheared =
+                shear * mat4::trs(translation, rotation, vec3(1, 2, 3));
+            fast_vec3 t, s, qr_t, qr_s;
+            quat r, qr_r;
+            const DecomposeStatus status = sheared.decompose(t, r, s);
+            const DecomposeStatus qr_status =
+                sheared.decompose_qr(qr_t, qr_r, qr_s);
+
+            THEN("Both variants report the shear")
+            {
+                REQUIRE(status == DecomposeStatus::Sheared);
+                REQUIRE(qr_status == DecomposeStatus::Sheared);
+            }
+
+            THEN("The fast variant falls back to the QR fit")
+            {
+                REQUIRE(approx_equal(vec3(s), vec3(qr_s), epsilon));
+                REQUIRE(approx_equal(vec3(t), translation, epsilon));
+                const fast_vec3 forward(0, 0, 1);
+                REQUIRE(approx_equal(vec3(r.rotate_point(forward)),
+                                     vec3(qr_r.rotate_point(forward)),
+                                     epsilon));
+            }
+        }
+
+        WHEN("A matrix with a collapsed axis is decomposed")
+        {
+            const mat4 flat = mat4::trs(translation, rotation, vec3(1, 0, 1));
+            fast_vec3 t, s;
+            quat r;
+
+            THEN("Both variants report it as singular")
+            {
+                REQUIRE(flat.decompose(t, r, s) == DecomposeStatus::Singular);
+                REQUIRE(flat.decompose_qr(t, r, s) ==
+                        DecomposeStatus::Singular);
+                REQUIRE(approx_equal(vec3(t), translation, epsilon));
+            }
+        }
+    }
+
+    // Fast inverse testing
+    {
+        using fast_vec3 = mat4::fast_vec3_t;
+        using move::math::approx_equal;
+        const component_type epsilon = component_type(0.0001);
+        const quat rotation =
+            quat::angle_axis(vec3(-1, 2, 1).normalized(),
+                             move::math::deg2rad<component_type>(35));
+        const mat4 rigid = mat4::trs(vec3(5, -2, 1), rotation, vec3(1, 1, 1));
+        const mat4 scaled = mat4::trs(vec3(5, -2, 1), rotation, vec3(2, 4, 1));
+        const mat4 shear(1, 0, 0, 0, component_type(0.5), 1, 0, 0, 0, 0, 1, 0,
+                         0, 0, 0, 1);
+        const mat4 sheared = shear * scaled;
+        const mat4 projective(1, 0, 0, component_type(0.5), 0, 1, 0, 0, 0, 0,
+                              1, 0, 0, 0, 0, 1);
+
+        WHEN("Matrices are classified")
+        {
+            THEN("Affine and orthonormal matrices are recognised")
+            {
+                REQUIRE(rigid.is_affine());
+                REQUIRE(rigid.is_orthonormal());
+                REQUIRE(sheared.is_affine());
+                REQUIRE(!scaled.is_orthonormal());
+                REQUIRE(!projective.is_affine());
+                REQUIRE(!projective.is_orthonormal());
+            }
+        }
+
+        WHEN("An affine matrix is inverted with inverse_affine")
+        {
+            THEN("The result matches the general inverse")
+            {
+                REQUIRE(approx_equal(scaled.inverse_affine(), scaled.inverse(),
+                                     epsilon));
+                REQUIRE(approx_equal(sheared.inverse_affine(),
+                                     sheared.inverse(), epsilon));
+                REQUIRE(approx_equal(sheared * sheared.inverse_affine(),
+                                     mat4::identity(), epsilon));
+            }
+        }
+
+        WHEN("A rigid matrix is inverted with inverse_orthonormal")
+        {
+            THEN("The result matches the general inverse")
+            {
+                REQUIRE(approx_equal(rigid.inverse_orthonormal(),
+                                     rigid.inverse(), epsilon));
+                REQUIRE(approx_equal(rigid * rigid.inverse_orthonormal(),
+                                     mat4::identity(), epsilon));
+            }
+        }
+
+        WHEN("A normal matrix is computed")
+        {
+            const mat4 normal_matrix = sheared.inverse_transpose_3x3();
+            const fast_vec3 tangent(1, 1, 0);
+            const fast_vec3 normal(1, -1, 0);
+
+            THEN("It matches the transposed inverse without translation")
+            {
+                REQUIRE(normal_matrix.is_affine());
+                REQUIRE(approx_equal(
+                    vec3(normal_matrix.transform_vector(normal)),
+                    vec3(sheared.inverse().transposed().transform_vector(
+                        normal)),
+                    epsilon));
+            }
+
+            THEN("Transformed normals stay perpendicular to the surface")
+            {
+                const fast_vec3 new_tangent = sheared.transform_vector(tangent);
+                const fast_vec3 new_normal =
+                    normal_matrix.transform_vector(normal);
+                REQUIRE(fast_vec3::dot(new_tangent, new_normal) ==
+                        Catch::Approx(0).margin(epsilon));
+            }
+        }
+    }
+
     // Rotation matrix testing
     {
         mat4 rotation = mat4::angle_axis(
@@ -674,11 +971,98 @@ inline void benchmark_mat4()
                        test13 * test14 * test15;
             }());
     };
+
+    const mat4 trs_matrix =
+        mat4::trs(vec3(1, 2, 3), quat::rotation_y(component_type(0.6)),
+                  vec3(2, 3, 4));
+
+    BENCHMARK(alloc_appended_name(typeName, ": Decompose"))
+    {
+        typename mat4::fast_vec3_t t, s;
+        quat r;
+        return trs_matrix.decompose(t, r, s);
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Decompose (QR)"))
+    {
+        typename mat4::fast_vec3_t t, s;
+        quat r;
+        return trs_matrix.decompose_qr(t, r, s);
+    };
+
+    const mat4 rigid_matrix =
+        mat4::trs(vec3(1, 2, 3), quat::rotation_y(component_type(0.6)),
+                  vec3(1, 1, 1));
+
+    BENCHMARK(alloc_appended_name(typeName, ": Inverse (general, TRS)"))
+    {
+        return trs_matrix.inverse();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Inverse (affine)"))
+    {
+        return trs_matrix.inverse_affine();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Inverse (orthonormal)"))
+    {
+        return rigid_matrix.inverse_orthonormal();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Inverse transpose 3x3"))
+    {
+        return trs_matrix.inverse_transpose_3x3();
+    };
+
+    constexpr size_t palette_size = 1024;
+    std::vector<mat4> bind_inverse(palette_size,
+                                   mat4::translation(vec3(1, 2, 3)));
+    std::vector<mat4> world(
+        palette_size,
+        mat4::angle_axis(vec3::up(), move::math::deg2rad<component_type>(65)));
+    std::vector<mat4> palette(palette_size);
+
+    BENCHMARK(alloc_appended_name(typeName, ": Palette (per-element loop)"))
+    {
+        for (size_t i = 0; i < palette_size; ++i)
+        {
+            palette[i] = bind_inverse[i] * world[i];
+        }
+        return palette.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Palette (multiply_arrays)"))
+    {
+        mat4::multiply_arrays(bind_inverse.data(), world.data(),
+                              palette.data(), palette_size);
+        return palette.back();
+    };
 }
 
 REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_mat4, move::math::mat4x4);
 REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_mat4, move::math::mat4x4);
 
+TEST_CASE("storage_mat4x4 is usable in constant expressions")
+{
+    using move::math::storage_float4x4;
+
+    constexpr storage_float4x4 identity;
+    static_assert(identity == storage_float4x4::identity());
+    static_assert(identity.data[0] == 1 && identity.data[1] == 0 &&
+                  identity.data[15] == 1);
+
+    constexpr storage_float4x4 table[] = {
+        storage_float4x4::translation(1, 2, 3),
+        storage_float4x4::scale(2, 2, 2),
+        storage_float4x4(0, 0, -1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1)};
+    static_assert(table[0].data[12] == 1 && table[0].data[14] == 3);
+    static_assert(table[1].data[5] == 2);
+    static_assert(table[2] != identity);
+
+    move::math::mat4x4f translation = table[0];
+    REQUIRE(translation == move::math::mat4x4f::translation({1, 2, 3}));
+}
+
 SCENARIO("Mat4 full tests")
 {
     using namespace move::math;
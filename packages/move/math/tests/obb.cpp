@@ -0,0 +1,397 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/gjk.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/obb.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+// The eight corners of a box, from its own axes and extents
+template <typename obb>
+inline std::vector<typename obb::vec3_t> obb_corners(const obb& box)
+{
+    using vec3 = typename obb::vec3_t;
+    std::vector<vec3> corners;
+    for (int i = 0; i < 8; ++i)
+    {
+        const vec3 e = box.get_extents();
+        const vec3 local((i & 1) ? e.get_x() : -e.get_x(),
+                         (i & 2) ? e.get_y() : -e.get_y(),
+                         (i & 4) ? e.get_z() : -e.get_z());
+        corners.push_back(box.get_center() +
+                          box.get_axis(0) * local.get_x() +
+                          box.get_axis(1) * local.get_y() +
+                          box.get_axis(2) * local.get_z());
+    }
+    return corners;
+}
+
+template <typename obb>
+inline void test_obb()
+{
+    using component_type = obb::component_type;
+    using T = component_type;
+    using vec3 = obb::vec3_t;
+    using mat3 = obb::mat3x3_t;
+    using mat4 = obb::mat4x4_t;
+    using aabb = obb::aabb_t;
+    using plane = obb::plane_t;
+    using scalar_vec3 =
+        move::math::vec3<component_type, move::math::Acceleration::Scalar>;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing obb with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tobb: " << move::meta::type_name<obb>());
+
+    uint32_t seed = 7;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return T(seed >> 8) / T(1 << 24);
+    };
+    const auto random_axes = [&next]() {
+        const vec3 axis(next() * 2 - 1, next() * 2 - 1, next() * 2 + T(0.1));
+        return mat3::angle_axis(axis.normalized(), next() * T(6.28));
+    };
+
+    // 2 x 4 x 6, turned 45 degrees about Z
+    const obb box(vec3(1, 2, 3), mat3::rotation_z(T(0.7853981633974483)),
+                  vec3(1, 2, 3));
+
+    WHEN("A box is created")
+    {
+        THEN("It keeps its center, axes and extents")
+        {
+            REQUIRE(approx_equal(box.get_center(), vec3(1, 2, 3), epsilon));
+            REQUIRE(approx_equal(box.get_extents(), vec3(1, 2, 3), epsilon));
+            REQUIRE(approx_equal(box.get_axis(2), vec3(0, 0, 1), epsilon));
+            REQUIRE(box.volume() == Catch::Approx(48));
+            REQUIRE(obb().volume() == 0);
+        }
+
+        THEN("An axis-aligned box converts both ways")
+        {
+            const aabb source(vec3(-1, 0, 2), vec3(3, 1, 4));
+            const obb converted = obb::from_aabb(source);
+            REQUIRE(approx_equal(converted.get_center(), vec3(1, 0.5, 3),
+                                 epsilon));
+            REQUIRE(approx_equal(converted.to_aabb(), source, epsilon));
+            REQUIRE(obb::from_aabb(aabb()).volume() == 0);
+        }
+    }
+
+    WHEN("Points are measured against a box")
+    {
+        THEN("Containment follows the turned faces")
+        {
+            REQUIRE(box.contains(vec3(1, 2, 3)));
+            REQUIRE(box.contains(box.get_center() + box.get_axis(1) * T(1.9)));
+            REQUIRE_FALSE(
+                box.contains(box.get_center() + box.get_axis(1) * T(2.1)));
+            // Inside the enclosing axis-aligned box only
+            REQUIRE(box.to_aabb().contains(vec3(1 + 1.5, 2 + 1.5, 3)));
+            REQUIRE_FALSE(box.contains(vec3(1 + 1.5, 2 + 1.5, 3)));
+        }
+
+        THEN("The closest point and distance agree")
+        {
+            for (int i = 0; i < 50; ++i)
+            {
+                const vec3 p(next() * 12 - 5, next() * 12 - 4, next() * 12 - 3);
+                const vec3 closest = box.closest_point(p);
+                const vec3 offset = p - closest;
+                REQUIRE(box.distance_squared(p) ==
+                        Catch::Approx(vec3::dot(offset, offset))
+                            .margin(epsilon));
+                REQUIRE(box.contains(closest +
+                                     (box.get_center() - closest) * T(1e-3)));
+                if (box.contains(p))
+                {
+                    REQUIRE(box.distance_squared(p) == 0);
+                }
+            }
+        }
+
+        THEN("The support point is the farthest corner")
+        {
+            const auto corners = obb_corners(box);
+            for (int i = 0; i < 20; ++i)
+            {
+                const vec3 d(next() * 2 - 1, next() * 2 - 1, next() * 2 - 1);
+                T best = -std::numeric_limits<T>::infinity();
+                for (const vec3& c : corners)
+                {
+                    best = std::max(best, vec3::dot(c, d));
+                }
+                REQUIRE(vec3::dot(box.support(d), d) ==
+                        Catch::Approx(best).margin(epsilon));
+            }
+        }
+
+        THEN("The enclosing axis-aligned box is tight")
+        {
+            const auto corners = obb_corners(box);
+            aabb expected;
+            for (const vec3& c : corners)
+            {
+                expected.expand(c);
+            }
+            REQUIRE(approx_equal(box.to_aabb(), expected, epsilon));
+        }
+    }
+
+    WHEN("A box is transformed")
+    {
+        THEN("Rotation, translation and uniform scale are exact")
+        {
+            const mat4 m = mat4::rotation_x(T(0.4)) * mat4::scale(2, 2, 2) *
+                           mat4::translation(vec3(3, -1, 2));
+            const obb moved = box.transformed(m);
+            REQUIRE(approx_equal(moved.get_extents(), vec3(2, 4, 6), epsilon));
+            REQUIRE(approx_equal(moved.get_center(),
+                                 m.transform_point(box.get_center()),
+                                 epsilon));
+            for (const vec3& c : obb_corners(box))
+            {
+                const vec3 p = m.transform_point(c);
+                REQUIRE(moved.distance_squared(p) <= epsilon);
+            }
+        }
+
+        THEN("A skewing scale gives an enclosing box")
+        {
+            const mat4 m = mat4::scale(1, 3, 1);
+            const obb moved = obb(box).transform(m);
+            for (const vec3& c : obb_corners(box))
+            {
+                const vec3 p = m.transform_point(c);
+                REQUIRE(moved.contains(moved.get_center() +
+                                       (p - moved.get_center()) *
+                                           T(0.999)));
+            }
+            REQUIRE(moved.volume() >= box.volume() * 3 - epsilon);
+        }
+    }
+
+    WHEN("Boxes are tested against planes")
+    {
+        // The inward faces of the cube [-4, 4]^3, standing in for a frustum
+        const plane frustum[6] = {
+            plane(vec3(1, 0, 0), 4),  plane(vec3(-1, 0, 0), 4),
+            plane(vec3(0, 1, 0), 4),  plane(vec3(0, -1, 0), 4),
+            plane(vec3(0, 0, 1), 4),  plane(vec3(0, 0, -1), 4)};
+
+        THEN("Planes through the box intersect it")
+        {
+            REQUIRE(box.intersects(plane(vec3(0, 0, 1), -5.9)));
+            REQUIRE_FALSE(box.intersects(plane(vec3(0, 0, 1), -6.1)));
+            // The turned corner reaches 1 + 3 / sqrt(2) along X
+            REQUIRE(box.intersects(plane(vec3(1, 0, 0), -3.1)));
+            REQUIRE_FALSE(box.intersects(plane(vec3(1, 0, 0), -3.2)));
+        }
+
+        THEN("Only boxes wholly behind one plane are culled")
+        {
+            REQUIRE(box.intersects_frustum(frustum));
+            const obb far(vec3(0, 8, 0), box.get_axes(), box.get_extents());
+            REQUIRE_FALSE(far.intersects_frustum(frustum));
+            // Its turned corner still pokes into the cube
+            const obb near(vec3(0, 6, 0), box.get_axes(), box.get_extents());
+            REQUIRE(near.intersects_frustum(frustum));
+            // Only the -Y plane rejects the far box
+            REQUIRE_FALSE(far.intersects_frustum(frustum + 3, 1));
+            REQUIRE(far.intersects_frustum(frustum, 3));
+        }
+    }
+
+    WHEN("Boxes are tested against each other")
+    {
+        THEN("Face and edge separations are found")
+        {
+            const obb unit(vec3(0, 0, 0), mat3::identity(), vec3(1, 1, 1));
+            REQUIRE(unit.intersects(unit));
+            REQUIRE(unit.intersects(obb(vec3(1.9, 0.5, 0), mat3::identity(),
+                                        vec3(1, 1, 1))));
+            REQUIRE_FALSE(unit.intersects(
+                obb(vec3(2.1, 0, 0), mat3::identity(), vec3(1, 1, 1))));
+
+            // Two sticks crossing at right angles, one above the other,
+            // each rolled 45 degrees about its length.  Only the cross
+            // product of their long edges, +Z, separates them.
+            const T roll = T(0.7853981633974483);
+            const obb a(vec3(0, 0, 0), mat3::rotation_x(roll),
+                        vec3(3, 0.1, 0.1));
+            const obb b(vec3(0, 0, 0.35), mat3::rotation_y(roll),
+                        vec3(0.1, 3, 0.1));
+            REQUIRE_FALSE(a.intersects(b));
+            REQUIRE_FALSE(b.intersects(a));
+            REQUIRE(a.intersects(obb(vec3(0, 0, 0.2), b.get_axes(),
+                                     b.get_extents())));
+        }
+
+        THEN("The separating axis test agrees with GJK")
+        {
+            int overlaps = 0;
+            int separations = 0;
+            for (int i = 0; i < 500; ++i)
+            {
+                const obb a(vec3(next() * 2, next() * 2, next() * 2),
+                            random_axes(),
+                            vec3(next() + T(0.05), next() + T(0.05),
+                                 next() * T(0.3) + T(0.05)));
+                const obb b(vec3(next() * 2, next() * 2, next() * 2),
+                            random_axes(),
+                            vec3(next() + T(0.05), next() * T(0.3) + T(0.05),
+                                 next() + T(0.05)));
+                move::math::gjk_simplex<T> simplex;
+                const auto result = move::math::gjk_distance(a, b, simplex);
+                if (result.intersecting)
+                {
+                    ++overlaps;
+                    REQUIRE(a.intersects(b));
+                    REQUIRE(b.intersects(a));
+                }
+                else if (result.distance > T(1e-3))
+                {
+                    ++separations;
+                    REQUIRE_FALSE(a.intersects(b));
+                    REQUIRE_FALSE(b.intersects(a));
+                }
+            }
+            REQUIRE(overlaps > 50);
+            REQUIRE(separations > 50);
+        }
+    }
+
+    WHEN("A box is fitted to points")
+    {
+        THEN("A turned slab of points gets a tight turned box")
+        {
+            const mat3 axes = random_axes();
+            const vec3 center(3, -2, 1);
+            std::vector<scalar_vec3> points;
+            for (int i = 0; i < 2000; ++i)
+            {
+                const vec3 local((next() * 2 - 1) * 4, (next() * 2 - 1),
+                                 (next() * 2 - 1) * T(0.5));
+                const vec3 p = center + local * axes;
+                points.emplace_back(p.get_x(), p.get_y(), p.get_z());
+            }
+            const obb fitted = obb::from_points(points.data(), points.size());
+            for (const scalar_vec3& p : points)
+            {
+                REQUIRE(fitted.distance_squared(
+                            vec3(p.get_x(), p.get_y(), p.get_z())) <=
+                        epsilon);
+            }
+            REQUIRE(fitted.volume() < T(32) * T(1.1));
+            const vec3 size = fitted.to_aabb().size();
+            REQUIRE(fitted.volume() <
+                    size.get_x() * size.get_y() * size.get_z());
+            REQUIRE(approx_equal(fitted.get_center(), center, T(0.05)));
+        }
+
+        THEN("The axis-aligned box wins when PCA is misled")
+        {
+            // A cube of points with most of them crowded along a diagonal
+            std::vector<scalar_vec3> points;
+            for (int i = 0; i < 8; ++i)
+            {
+                points.emplace_back(T(i & 1), T((i >> 1) & 1), T(i >> 2));
+            }
+            for (int i = 0; i < 200; ++i)
+            {
+                const T t = next();
+                points.emplace_back(t, t, t * T(0.9));
+            }
+            const obb fitted = obb::from_points(points.data(), points.size());
+            REQUIRE(fitted.volume() == Catch::Approx(1));
+        }
+
+        THEN("Degenerate inputs give flat boxes")
+        {
+            REQUIRE(obb::from_points(nullptr, 0).volume() == 0);
+            const scalar_vec3 single(1, 2, 3);
+            const obb point = obb::from_points(&single, 1);
+            REQUIRE(approx_equal(point.get_center(), vec3(1, 2, 3), epsilon));
+            REQUIRE(point.volume() == 0);
+        }
+    }
+}
+
+SCENARIO("OBB full tests")
+{
+    test_obb<move::math::obbf>();
+    test_obb<move::math::obbd>();
+}
+
+template <typename obb>
+inline void benchmark_obb()
+{
+    using T = obb::component_type;
+    using vec3 = obb::vec3_t;
+    using mat3 = obb::mat3x3_t;
+    using scalar_vec3 = move::math::vec3<T, move::math::Acceleration::Scalar>;
+
+    const auto typeName = move::meta::type_name<T>();
+
+    uint32_t seed = 3;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return T(seed >> 8) / T(1 << 24);
+    };
+    std::vector<obb> boxes;
+    for (int i = 0; i < 1024; ++i)
+    {
+        boxes.emplace_back(vec3(next() * 8, next() * 8, next() * 8),
+                           mat3::angle_axis(vec3(next(), next(), T(1))
+                                                .normalized(),
+                                            next() * T(6.28)),
+                           vec3(next() + T(0.1), next() + T(0.1),
+                                next() + T(0.1)));
+    }
+
+    BENCHMARK(alloc_appended_name(typeName, ": SAT 1024 box pairs"))
+    {
+        int hits = 0;
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            hits += boxes[i].intersects(boxes[(i * 7 + 1) % boxes.size()]);
+        }
+        return hits;
+    };
+
+    std::vector<scalar_vec3> points;
+    for (int i = 0; i < 100000; ++i)
+    {
+        points.emplace_back(next() * 4, next(), next() * T(0.5) + next());
+    }
+    BENCHMARK(alloc_appended_name(typeName, ": fit 100k points"))
+    {
+        return obb::from_points(points.data(), points.size()).volume();
+    };
+}
+
+// SCENARIO("OBB benchmarks", "[!benchmark]")
+// {
+//     benchmark_obb<move::math::obbf>();
+//     benchmark_obb<move::math::obbd>();
+// }
@@ -0,0 +1,283 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/plane.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename plane>
+inline void test_plane()
+{
+    using component_type = plane::component_type;
+    using vec3 = plane::vec3_t;
+    using mat4 = plane::mat4x4_t;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing plane with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tplane: " << move::meta::type_name<plane>());
+
+    // The plane y = 2, facing up
+    const plane ground = plane::from_point_normal(vec3(5, 2, -3),
+                                                  vec3(0, 4, 0));
+
+    WHEN("A plane is created from a point and normal")
+    {
+        THEN("It is normalized and passes through the point")
+        {
+            REQUIRE(approx_equal(ground.get_normal(), vec3(0, 1, 0), epsilon));
+            REQUIRE(ground.get_offset() == Catch::Approx(-2));
+            REQUIRE(ground.signed_distance(vec3(1, 5, 1)) == Catch::Approx(3));
+            REQUIRE(ground.signed_distance(vec3(1, -1, 1)) ==
+                    Catch::Approx(-3));
+        }
+    }
+
+    WHEN("A plane is created from three points")
+    {
+        const vec3 a(1, 0, 0);
+        const vec3 b(0, 1, 0);
+        const vec3 c(0, 0, 1);
+        const plane p = plane::from_points(a, b, c);
+
+        THEN("All three points lie on it")
+        {
+            REQUIRE(p.get_normal().length() == Catch::Approx(1));
+            REQUIRE(p.signed_distance(a) == Catch::Approx(0).margin(epsilon));
+            REQUIRE(p.signed_distance(b) == Catch::Approx(0).margin(epsilon));
+            REQUIRE(p.signed_distance(c) == Catch::Approx(0).margin(epsilon));
+        }
+
+        THEN("Collinear points give a zero normal")
+        {
+            const plane degenerate =
+                plane::from_points(a, vec3(2, 0, 0), vec3(3, 0, 0));
+            REQUIRE(degenerate.get_normal().length() == 0);
+        }
+    }
+
+    WHEN("An unnormalized plane is normalized")
+    {
+        plane p(vec3(0, 0, 2), 4);
+        p.normalize();
+
+        THEN("It describes the same points with a unit normal")
+        {
+            REQUIRE(approx_equal(p, plane(vec3(0, 0, 1), 2), epsilon));
+            REQUIRE(p.signed_distance(vec3(0, 0, -2)) ==
+                    Catch::Approx(0).margin(epsilon));
+            REQUIRE(p.flipped().signed_distance(vec3(0, 0, 1)) ==
+                    Catch::Approx(-3));
+        }
+    }
+
+    WHEN("A point is projected onto a plane")
+    {
+        const vec3 projected = ground.project_point(vec3(3, 7, 1));
+
+        THEN("It lands on the plane directly below the point")
+        {
+            REQUIRE(approx_equal(projected, vec3(3, 2, 1), epsilon));
+        }
+    }
+
+    WHEN("A plane is transformed")
+    {
+        const plane tilted = plane::from_points(vec3(1, 2, 0), vec3(0, 1, 3),
+                                                vec3(-2, 0, 1));
+        const mat4 mat =
+            mat4::scale(2, component_type(0.5), 3) *
+            mat4::rotation_y(component_type(0.7)) *
+            mat4::translation(vec3(4, -1, 2));
+        const plane moved = tilted.transformed(mat);
+
+        THEN("Transformed points stay on the transformed plane")
+        {
+            REQUIRE(moved.get_normal().length() == Catch::Approx(1));
+            for (const vec3& p :
+                 {vec3(1, 2, 0), vec3(0, 1, 3), vec3(-2, 0, 1)})
+            {
+                REQUIRE(moved.signed_distance(mat.transform_point(p)) ==
+                        Catch::Approx(0).margin(epsilon));
+            }
+            REQUIRE(moved.signed_distance(mat.transform_point(
+                        vec3(tilted.get_normal() + vec3(1, 2, 0)))) > 0);
+        }
+    }
+
+    WHEN("A segment is intersected with a plane")
+    {
+        THEN("Crossing segments report the fraction of the crossing")
+        {
+            component_type t = -1;
+            REQUIRE(ground.intersect_segment(vec3(0, 0, 0), vec3(0, 8, 0),
+                                             t));
+            REQUIRE(t == Catch::Approx(0.25));
+        }
+
+        THEN("Segments on one side miss")
+        {
+            component_type t = -1;
+            REQUIRE_FALSE(ground.intersect_segment(vec3(0, 3, 0),
+                                                   vec3(5, 9, 1), t));
+            REQUIRE(t == -1);
+        }
+    }
+
+    WHEN("Planes are intersected with each other")
+    {
+        const plane wall = plane::from_point_normal(vec3(1, 0, 0),
+                                                    vec3(1, 0, 0));
+        const plane back = plane::from_point_normal(vec3(0, 0, -4),
+                                                    vec3(0, 0, -1));
+        vec3 point;
+        vec3 direction;
+        vec3 corner;
+
+        THEN("Two planes meet in a line on both")
+        {
+            REQUIRE(ground.intersect_plane(wall, point, direction));
+            REQUIRE(ground.signed_distance(point) ==
+                    Catch::Approx(0).margin(epsilon));
+            REQUIRE(wall.signed_distance(point) ==
+                    Catch::Approx(0).margin(epsilon));
+            REQUIRE(approx_equal(point, vec3(1, 2, 0), epsilon));
+            REQUIRE(vec3::dot(direction, ground.get_normal()) ==
+                    Catch::Approx(0).margin(epsilon));
+            REQUIRE(vec3::dot(direction, wall.get_normal()) ==
+                    Catch::Approx(0).margin(epsilon));
+        }
+
+        THEN("Three planes meet in a point")
+        {
+            REQUIRE(plane::intersect_planes(ground, wall, back, corner));
+            REQUIRE(approx_equal(corner, vec3(1, 2, -4), epsilon));
+        }
+
+        THEN("Parallel planes do not meet")
+        {
+            REQUIRE_FALSE(ground.intersect_plane(plane(), point, direction));
+            REQUIRE_FALSE(
+                plane::intersect_planes(ground, wall, plane(), corner));
+        }
+    }
+
+    WHEN("Distances are computed in bulk")
+    {
+        using scalar_vec3 = move::math::vec3<component_type,
+                                             move::math::Acceleration::Scalar>;
+        const plane p = plane::from_points(vec3(1, 2, 0), vec3(0, 1, 3),
+                                           vec3(-2, 0, 1));
+        constexpr size_t count = 7;
+        std::vector<scalar_vec3> points;
+        component_type xs[count];
+        component_type ys[count];
+        component_type zs[count];
+        for (size_t i = 0; i < count; ++i)
+        {
+            const component_type f = component_type(i);
+            points.emplace_back(f, f * f - 3, 2 - f);
+            xs[i] = points[i].get_x();
+            ys[i] = points[i].get_y();
+            zs[i] = points[i].get_z();
+        }
+
+        component_type aos[count];
+        component_type soa[count];
+        p.signed_distances(points.data(), aos, count);
+        p.signed_distances(
+            move::math::soa_vec3<const component_type>{xs, ys, zs}, soa,
+            count);
+
+        THEN("Each distance matches signed_distance")
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const component_type expected = p.signed_distance(
+                    vec3(points[i].get_x(), points[i].get_y(),
+                         points[i].get_z()));
+                REQUIRE(aos[i] == Catch::Approx(expected).margin(epsilon));
+                REQUIRE(soa[i] == Catch::Approx(expected).margin(epsilon));
+            }
+        }
+    }
+}
+
+template <typename plane>
+inline void benchmark_plane()
+{
+    using component_type = plane::component_type;
+    using vec3 = plane::vec3_t;
+    using scalar_vec3 =
+        move::math::vec3<component_type, move::math::Acceleration::Scalar>;
+    move::string_view typeName = move::meta::type_name<plane>();
+
+    const plane p = plane::from_points(vec3(1, 2, 0), vec3(0, 1, 3),
+                                       vec3(-2, 0, 1));
+    constexpr size_t count = 4096;
+    std::vector<scalar_vec3> points(count);
+    std::vector<component_type> xs(count);
+    std::vector<component_type> ys(count);
+    std::vector<component_type> zs(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const component_type f = component_type(i) * component_type(0.01);
+        points[i] = scalar_vec3(f, -f, f * 2);
+        xs[i] = f;
+        ys[i] = -f;
+        zs[i] = f * 2;
+    }
+    std::vector<component_type> out(count);
+
+    BENCHMARK(alloc_appended_name(typeName, ": Signed distance loop"))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = p.signed_distance(
+                vec3(points[i].get_x(), points[i].get_y(), points[i].get_z()));
+        }
+        return out.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Signed distances (AoS)"))
+    {
+        p.signed_distances(points.data(), out.data(), count);
+        return out.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Signed distances (SoA)"))
+    {
+        p.signed_distances(
+            move::math::soa_vec3<const component_type>{xs.data(), ys.data(),
+                                                       zs.data()},
+            out.data(), count);
+        return out.back();
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_plane, move::math::plane);
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_plane, move::math::plane);
+
+SCENARIO("Plane full tests")
+{
+    test_plane_multi<float, double>();
+}
+
+// SCENARIO("Plane benchmarks")
+// {
+//     benchmark_plane_multi<float, double>();
+// }
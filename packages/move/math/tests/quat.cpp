@@ -14,6 +14,9 @@
 #endif
 #include <move/string.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include "mm_test_common.hpp"
 
 template <typename quat>
@@ -187,6 +190,153 @@ inline void test_quat()
             REQUIRE(move::math::abs(log_combined_w - log_sum_w) < component_type(0.001));
         }
     }
+
+    // Bulk rotation testing
+    {
+        using scalar_vec3 = move::math::vec3<component_type,
+                                             move::math::Acceleration::Scalar>;
+        using move::math::approx_equal;
+        const component_type epsilon = component_type(0.0001);
+        const quat rotation =
+            quat::angle_axis(vec3(2, -1, 1).normalized(),
+                             move::math::deg2rad<component_type>(75));
+        const scalar_vec3 points[] = {scalar_vec3(1, 0, 0),
+                                      scalar_vec3(0, 1, 0),
+                                      scalar_vec3(3, -2, 5),
+                                      scalar_vec3(-4, 1, 0.5)};
+        const quat rotations[] = {rotation, quat::rotation_x(1),
+                                  quat::rotation_y(-2), quat::identity()};
+        constexpr size_t count = 4;
+
+        component_type xs[count], ys[count], zs[count];
+        for (size_t i = 0; i < count; ++i)
+        {
+            xs[i] = points[i].get_x();
+            ys[i] = points[i].get_y();
+            zs[i] = points[i].get_z();
+        }
+        const move::math::soa_vec3<const component_type> soa_points{xs, ys,
+                                                                    zs};
+
+        WHEN("An array of points is rotated by one quaternion")
+        {
+            scalar_vec3 aos_out[count];
+            rotation.rotate_points(points, aos_out, count);
+
+            component_type ox[count], oy[count], oz[count];
+            rotation.rotate_points(soa_points, {ox, oy, oz}, count);
+
+            THEN("Each point matches rotate_point")
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const vec3 expected = rotation.rotate_point(points[i]);
+                    REQUIRE(approx_equal(vec3(aos_out[i]), expected, epsilon));
+                    REQUIRE(approx_equal(vec3(ox[i], oy[i], oz[i]), expected,
+                                         epsilon));
+                }
+            }
+        }
+
+        WHEN("Each point is rotated by its own quaternion")
+        {
+            scalar_vec3 aos_out[count];
+            quat::rotate_points(rotations, points, aos_out, count);
+
+            component_type ox[count], oy[count], oz[count];
+            quat::rotate_points(rotations, soa_points, {ox, oy, oz}, count);
+
+            THEN("Each point matches rotate_point")
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const vec3 expected = rotations[i].rotate_point(points[i]);
+                    REQUIRE(approx_equal(vec3(aos_out[i]), expected, epsilon));
+                    REQUIRE(approx_equal(vec3(ox[i], oy[i], oz[i]), expected,
+                                         epsilon));
+                }
+            }
+        }
+
+        WHEN("Points are rotated in place")
+        {
+            scalar_vec3 in_place[count];
+            std::copy(points, points + count, in_place);
+            rotation.rotate_points(in_place, in_place, count);
+
+            THEN("The result matches rotating into a separate array")
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    REQUIRE(approx_equal(vec3(in_place[i]),
+                                         rotation.rotate_point(points[i]),
+                                         epsilon));
+                }
+            }
+        }
+    }
+
+    // Interpolation testing
+    {
+        using move::math::approx_equal;
+        const component_type epsilon = component_type(0.0001);
+        const quat a = quat::rotation_y(component_type(0.2));
+        const quat b = quat::rotation_y(component_type(1.4));
+        const vec3 point(1, 2, 3);
+
+        WHEN("Two rotations are slerped")
+        {
+            THEN("The result moves at constant speed between them")
+            {
+                REQUIRE(approx_equal(quat::slerp(a, b, 0), a, epsilon));
+                REQUIRE(approx_equal(quat::slerp(a, b, 1), b, epsilon));
+                REQUIRE(approx_equal(quat::slerp(a, b, component_type(0.25)),
+                                     quat::rotation_y(component_type(0.5)),
+                                     epsilon));
+            }
+
+            THEN("The shortest path is taken")
+            {
+                const quat flipped(-b.get_x(), -b.get_y(), -b.get_z(),
+                                   -b.get_w());
+                const quat halfway = quat::slerp(a, flipped, 0.5);
+                REQUIRE(approx_equal(halfway.rotate_point(point),
+                                     quat::rotation_y(component_type(0.8))
+                                         .rotate_point(point),
+                                     epsilon));
+            }
+        }
+
+        WHEN("Squad controls are computed")
+        {
+            THEN("Evenly spaced keys about one axis need no correction")
+            {
+                const quat c = quat::rotation_y(component_type(2.6));
+                REQUIRE(approx_equal(quat::squad_control(a, b, c), b,
+                                     epsilon));
+            }
+
+            THEN("Squad with the keys as controls reduces to slerp")
+            {
+                REQUIRE(approx_equal(
+                    quat::squad(a, b, a, b, component_type(0.3)),
+                    quat::slerp(a, b, component_type(0.3)), epsilon));
+            }
+        }
+
+        WHEN("A sequence of keys is aligned")
+        {
+            quat keys[] = {a, quat(-b.get_x(), -b.get_y(), -b.get_z(),
+                                   -b.get_w())};
+            quat::align_hemispheres(keys, 2);
+
+            THEN("Neighbouring keys share a hemisphere")
+            {
+                REQUIRE(keys[0].dot(keys[1]) >= 0);
+                REQUIRE(approx_equal(keys[1], b, epsilon));
+            }
+        }
+    }
 }
 
 template <typename quat>
@@ -208,6 +358,46 @@ inline void benchmark_quat()
     {
         return identity.inverse();
     };
+
+    using scalar_vec3 =
+        move::math::vec3<component_type, move::math::Acceleration::Scalar>;
+    constexpr size_t point_count = 4096;
+    const quat rotation = quat::rotation_y(component_type(0.8));
+    std::vector<scalar_vec3> points(point_count, scalar_vec3(1, 2, 3));
+    std::vector<scalar_vec3> rotated(point_count);
+    std::vector<quat> rotations(point_count, rotation);
+    std::vector<component_type> xs(point_count, 1), ys(point_count, 2),
+        zs(point_count, 3);
+
+    BENCHMARK(alloc_appended_name(typeName, ": Rotate points (loop)"))
+    {
+        for (size_t i = 0; i < point_count; ++i)
+        {
+            rotated[i] = rotation.rotate_point(points[i]);
+        }
+        return rotated.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Rotate points (AoS)"))
+    {
+        rotation.rotate_points(points.data(), rotated.data(), point_count);
+        return rotated.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Rotate points (SoA)"))
+    {
+        rotation.rotate_points({xs.data(), ys.data(), zs.data()},
+                               {xs.data(), ys.data(), zs.data()},
+                               point_count);
+        return xs.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Rotate points (per-element)"))
+    {
+        quat::rotate_points(rotations.data(), points.data(), rotated.data(),
+                            point_count);
+        return rotated.back();
+    };
 }
 
 REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_quat, move::math::quat);
@@ -0,0 +1,194 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/quat_track.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename track>
+inline void test_quat_track()
+{
+    using component_type = track::component_type;
+    using quat = track::quat_t;
+    using vec3 = quat::vec3_t;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing quat_track with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\ttrack: " << move::meta::type_name<track>());
+
+    constexpr size_t key_count = 5;
+    const component_type times[key_count] = {0, 1, 2, 3, 4};
+    quat keys[key_count] = {
+        quat::identity(),
+        quat::angle_axis(vec3(0, 1, 0), component_type(0.8)),
+        quat::angle_axis(vec3(1, 1, 0).normalized(), component_type(1.5)),
+        quat::angle_axis(vec3(0, 0, 1), component_type(-2.5)),
+        quat::angle_axis(vec3(1, 0, 0), component_type(0.4))};
+    quat::align_hemispheres(keys, key_count);
+    quat controls[key_count];
+    quat::squad_controls(keys, controls, key_count);
+    const track rotation{times, keys, controls, key_count};
+
+    WHEN("The track is evaluated at its keys")
+    {
+        THEN("The keys are reproduced")
+        {
+            for (size_t i = 0; i < key_count; ++i)
+            {
+                REQUIRE(approx_equal(rotation.evaluate(times[i]), keys[i],
+                                     epsilon));
+            }
+        }
+
+        THEN("Times outside the track clamp to the end keys")
+        {
+            REQUIRE(rotation.evaluate(-1) == keys[0]);
+            REQUIRE(rotation.evaluate(10) == keys[key_count - 1]);
+        }
+    }
+
+    WHEN("The track passes through an interior key")
+    {
+        const vec3 point(1, 2, 3);
+        const component_type h = component_type(0.001);
+
+        THEN("The angular velocity is continuous")
+        {
+            for (size_t i = 1; i + 1 < key_count; ++i)
+            {
+                const vec3 at = rotation.evaluate(times[i]).rotate_point(point);
+                const vec3 before =
+                    rotation.evaluate(times[i] - h).rotate_point(point);
+                const vec3 after =
+                    rotation.evaluate(times[i] + h).rotate_point(point);
+                REQUIRE(approx_equal(vec3((at - before) / h),
+                                     vec3((after - at) / h),
+                                     component_type(0.05)));
+            }
+        }
+    }
+
+    WHEN("The track is evaluated with a cursor")
+    {
+        THEN("The result matches the binary search")
+        {
+            size_t cursor = 0;
+            const component_type sweep[] = {0.1, 0.5, 1.2, 1.3, 3.7,
+                                            0.4, 2.5, 2.6, 3.99};
+            for (component_type time : sweep)
+            {
+                REQUIRE(approx_equal(rotation.evaluate(time, cursor),
+                                     rotation.evaluate(time), epsilon));
+                REQUIRE(times[cursor] <= time);
+                REQUIRE(time < times[cursor + 1]);
+            }
+        }
+    }
+
+    WHEN("Degenerate tracks are evaluated")
+    {
+        const track empty{times, keys, controls, 0};
+        const track single{times + 2, keys + 2, controls + 2, 1};
+
+        THEN("They return the identity or their only key")
+        {
+            REQUIRE(empty.evaluate(1) == quat::identity());
+            REQUIRE(single.evaluate(1) == keys[2]);
+        }
+    }
+
+    WHEN("Many tracks are sampled together")
+    {
+        const track tracks[] = {rotation,
+                                track{times + 1, keys + 1, controls + 1, 3},
+                                rotation};
+        const component_type track_times[] = {0.5, 2.25, 3.5};
+        quat shared[3];
+        quat staggered[3];
+        size_t cursors[3] = {0, 0, 0};
+        track::sample(tracks, 3, component_type(1.5), shared);
+        track::sample(tracks, 3, track_times, staggered, cursors);
+
+        THEN("Each result matches evaluating its track alone")
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                REQUIRE(approx_equal(shared[i],
+                                     tracks[i].evaluate(component_type(1.5)),
+                                     epsilon));
+                REQUIRE(approx_equal(staggered[i],
+                                     tracks[i].evaluate(track_times[i]),
+                                     epsilon));
+            }
+        }
+    }
+}
+
+template <typename track>
+inline void benchmark_quat_track()
+{
+    using component_type = track::component_type;
+    using quat = track::quat_t;
+    move::string_view typeName = move::meta::type_name<track>();
+
+    constexpr size_t key_count = 64;
+    constexpr size_t track_count = 1024;
+    std::vector<component_type> times(key_count);
+    std::vector<quat> keys(key_count);
+    for (size_t i = 0; i < key_count; ++i)
+    {
+        times[i] = component_type(i) / 30;
+        keys[i] = quat::rotation_y(component_type(i) * component_type(0.1));
+    }
+    std::vector<quat> controls(key_count);
+    quat::squad_controls(keys.data(), controls.data(), key_count);
+
+    const std::vector<track> tracks(
+        track_count, track{times.data(), keys.data(), controls.data(),
+                           key_count});
+    std::vector<quat> pose(track_count);
+    std::vector<size_t> cursors(track_count, 0);
+    const component_type time = component_type(1.234);
+
+    BENCHMARK(alloc_appended_name(typeName, ": Sample (binary search)"))
+    {
+        track::sample(tracks.data(), track_count, time, pose.data());
+        return pose.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Sample (cursor)"))
+    {
+        track::sample(tracks.data(), track_count, time, pose.data(),
+                      cursors.data());
+        return pose.back();
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_quat_track, move::math::quat_track);
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_quat_track,
+                                     move::math::quat_track);
+
+SCENARIO("Quat track full tests")
+{
+    test_quat_track_multi<float, double>();
+}
+
+// SCENARIO("Quat track benchmarks")
+// {
+//     benchmark_quat_track_multi<float, double>();
+// }
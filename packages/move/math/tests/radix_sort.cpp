@@ -0,0 +1,191 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/radix_sort.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename Key>
+inline void test_radix_sort()
+{
+    INFO("Testing radix_sort_by_key with following config:");
+    INFO("\tkey: " << move::meta::type_name<Key>());
+
+    uint64_t seed = 99;
+    const auto next = [&seed]() {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        return Key(seed >> (64 - sizeof(Key) * 8));
+    };
+
+    // Few distinct keys, so stability is visible
+    std::vector<Key> keys(5000);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = (i % 3 == 0) ? Key(next() % 16) : next();
+    }
+    std::vector<uint32_t> values(keys.size());
+    std::iota(values.begin(), values.end(), 0u);
+
+    std::vector<uint32_t> expected = values;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+
+    WHEN("Keys are sorted on one thread")
+    {
+        THEN("Values follow their keys in a stable order")
+        {
+            std::vector<Key> sorted_keys = keys;
+            std::vector<uint32_t> sorted_values = values;
+            std::vector<Key> scratch_keys(keys.size());
+            std::vector<uint32_t> scratch_values(keys.size());
+            move::math::radix_sort_by_key(
+                sorted_keys.data(), sorted_values.data(), scratch_keys.data(),
+                scratch_values.data(), keys.size());
+
+            REQUIRE(sorted_values == expected);
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                REQUIRE(sorted_keys[i] == keys[sorted_values[i]]);
+            }
+        }
+    }
+
+    WHEN("Keys are sorted in chunks")
+    {
+        THEN("The result matches the single threaded sort")
+        {
+            std::vector<Key> sorted_keys = keys;
+            std::vector<uint32_t> sorted_values = values;
+            std::vector<Key> scratch_keys(keys.size());
+            std::vector<uint32_t> scratch_values(keys.size());
+
+            size_t chunks_run = 0;
+            auto serial_for = [&](size_t chunk_count, auto&& job)
+            {
+                for (size_t i = chunk_count; i-- > 0;)
+                {
+                    job(i);
+                    ++chunks_run;
+                }
+            };
+            move::math::radix_sort_by_key(
+                sorted_keys.data(), sorted_values.data(), scratch_keys.data(),
+                scratch_values.data(), keys.size(), serial_for, 700);
+
+            REQUIRE(chunks_run > 0);
+            REQUIRE(sorted_values == expected);
+            REQUIRE(std::is_sorted(sorted_keys.begin(), sorted_keys.end()));
+        }
+    }
+
+    WHEN("Only the low bits are sorted")
+    {
+        THEN("Higher bits are ignored and shared digits are skipped")
+        {
+            constexpr uint32_t bits = 12;
+            const Key mask = Key((Key(1) << bits) - 1);
+            std::vector<Key> sorted_keys = keys;
+            std::vector<uint32_t> sorted_values = values;
+            std::vector<Key> scratch_keys(keys.size());
+            std::vector<uint32_t> scratch_values(keys.size());
+            move::math::radix_sort_by_key(
+                sorted_keys.data(), sorted_values.data(), scratch_keys.data(),
+                scratch_values.data(), keys.size(), bits);
+
+            std::vector<uint32_t> low_expected = values;
+            std::stable_sort(low_expected.begin(), low_expected.end(),
+                             [&](uint32_t a, uint32_t b)
+                             { return (keys[a] & mask) < (keys[b] & mask); });
+            REQUIRE(sorted_values == low_expected);
+
+            // Every key shares its top digits, so those passes do nothing
+            std::vector<Key> small(keys.size());
+            std::vector<uint32_t> order = values;
+            for (size_t i = 0; i < small.size(); ++i)
+            {
+                small[i] = Key(keys[i] & 0xff) | Key(Key(1) << 9);
+            }
+            size_t chunks_run = 0;
+            auto serial_for = [&](size_t chunk_count, auto&& job)
+            {
+                for (size_t i = 0; i < chunk_count; ++i)
+                {
+                    job(i);
+                    ++chunks_run;
+                }
+            };
+            move::math::radix_sort_by_key(
+                small.data(), order.data(), scratch_keys.data(),
+                scratch_values.data(), small.size(), serial_for,
+                small.size());
+
+            // One count and one scatter for the low digit, a count for
+            // each other digit, then a copy back from scratch
+            constexpr size_t digits =
+                (sizeof(Key) * 8 + move::math::radix_sort_digit_bits - 1) /
+                move::math::radix_sort_digit_bits;
+            REQUIRE(chunks_run == digits + 2);
+            REQUIRE(std::is_sorted(small.begin(), small.end()));
+        }
+    }
+}
+
+SCENARIO("Radix sort full tests")
+{
+    test_radix_sort<uint32_t>();
+    test_radix_sort<uint64_t>();
+}
+
+inline void benchmark_radix_sort()
+{
+    constexpr size_t count = 1 << 20;
+    std::vector<uint64_t> keys(count);
+    uint64_t seed = 5;
+    for (auto& key : keys)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        key = seed >> 1;
+    }
+    std::vector<uint64_t> sorted_keys(count);
+    std::vector<uint32_t> values(count);
+    std::vector<uint64_t> scratch_keys(count);
+    std::vector<uint32_t> scratch_values(count);
+
+    BENCHMARK("Radix sort 1M 63 bit keys")
+    {
+        sorted_keys = keys;
+        std::iota(values.begin(), values.end(), 0u);
+        move::math::radix_sort_by_key(sorted_keys.data(), values.data(),
+                                      scratch_keys.data(),
+                                      scratch_values.data(), count, 63);
+        return values[0];
+    };
+
+    BENCHMARK("std::sort 1M 63 bit keys")
+    {
+        sorted_keys = keys;
+        std::sort(sorted_keys.begin(), sorted_keys.end());
+        return sorted_keys[0];
+    };
+}
+
+// SCENARIO("Radix sort benchmarks", "[!benchmark]")
+// {
+//     benchmark_radix_sort();
+// }
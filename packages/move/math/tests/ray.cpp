@@ -0,0 +1,513 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/ray.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+// A fan of rays around the -Z axis, some hitting and some missing the
+// shapes placed in front of the origin
+template <typename ray>
+inline std::vector<ray> make_ray_fan(size_t count)
+{
+    using T = typename ray::component_type;
+    using vec3 = typename ray::vec3_t;
+
+    std::vector<ray> rays;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const T f = T(i) / T(count);
+        const vec3 origin(T(0.2) * f, T(-0.1), T(5) - f);
+        const vec3 direction(T(1.5) * f - T(0.6), T(0.8) - T(1.7) * f, -1);
+        rays.emplace_back(origin, direction, T(0), i % 5 == 4 ? T(2) : T(50));
+    }
+    return rays;
+}
+
+template <typename ray, size_t Width>
+inline void test_ray_packet(const std::vector<ray>& rays)
+{
+    using component_type = ray::component_type;
+    using vec3 = ray::vec3_t;
+    using packet = move::math::ray_packet<component_type, Width>;
+    static constexpr auto epsilon = component_type(0.001);
+
+    const vec3 a(-1, -1, 0);
+    const vec3 b(1, -1, 0);
+    const vec3 c(0, 1, 1);
+    const typename ray::aabb_t box(vec3(-0.5, -0.5, -1), vec3(0.5, 0.5, 0));
+    const typename ray::sphere_t ball(vec3(0, 0, -1), component_type(0.7));
+    const typename ray::plane_t ground(vec3(0, 1, 0), component_type(0.5));
+
+    for (size_t first = 0; first < rays.size(); first += Width)
+    {
+        const size_t count = std::min(Width, rays.size() - first);
+        const packet rays_packet = packet::load(rays.data() + first, count);
+        component_type t[Width];
+        component_type u[Width];
+        component_type v[Width];
+
+        const uint32_t triangle_mask =
+            rays_packet.intersect_triangle(a, b, c, t, u, v);
+        for (size_t i = 0; i < Width; ++i)
+        {
+            component_type et = 0;
+            component_type eu = 0;
+            component_type ev = 0;
+            const bool hit = i < count && rays[first + i].intersect_triangle(
+                                              a, b, c, et, eu, ev);
+            REQUIRE(bool(triangle_mask & (1u << i)) == hit);
+            if (hit)
+            {
+                REQUIRE(t[i] == Catch::Approx(et).margin(epsilon));
+                REQUIRE(u[i] == Catch::Approx(eu).margin(epsilon));
+                REQUIRE(v[i] == Catch::Approx(ev).margin(epsilon));
+            }
+        }
+
+        const uint32_t box_mask = rays_packet.intersect_aabb(box, t);
+        for (size_t i = 0; i < Width; ++i)
+        {
+            component_type t_near = 0;
+            component_type t_far = 0;
+            const bool hit =
+                i < count && rays[first + i].intersect_aabb(box, t_near, t_far);
+            REQUIRE(bool(box_mask & (1u << i)) == hit);
+            if (hit)
+            {
+                REQUIRE(t[i] == Catch::Approx(t_near).margin(epsilon));
+            }
+        }
+
+        const uint32_t sphere_mask = rays_packet.intersect_sphere(ball, t);
+        for (size_t i = 0; i < Width; ++i)
+        {
+            component_type expected = 0;
+            const bool hit =
+                i < count && rays[first + i].intersect_sphere(ball, expected);
+            REQUIRE(bool(sphere_mask & (1u << i)) == hit);
+            if (hit)
+            {
+                REQUIRE(t[i] == Catch::Approx(expected).margin(epsilon));
+            }
+        }
+
+        const uint32_t plane_mask = rays_packet.intersect_plane(ground, t);
+        for (size_t i = 0; i < Width; ++i)
+        {
+            component_type expected = 0;
+            const bool hit =
+                i < count && rays[first + i].intersect_plane(ground, expected);
+            REQUIRE(bool(plane_mask & (1u << i)) == hit);
+            if (hit)
+            {
+                REQUIRE(t[i] == Catch::Approx(expected).margin(epsilon));
+            }
+        }
+    }
+}
+
+template <typename ray>
+inline void test_ray()
+{
+    using component_type = ray::component_type;
+    using vec3 = ray::vec3_t;
+    using aabb = ray::aabb_t;
+    using obb = ray::obb_t;
+    using sphere = ray::sphere_t;
+    using plane = ray::plane_t;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing ray with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tray: " << move::meta::type_name<ray>());
+
+    const ray down(vec3(0.25, 5, 0.25), vec3(0, -2, 0));
+
+    WHEN("A ray is created")
+    {
+        THEN("Its intersection constants are precomputed")
+        {
+            REQUIRE(std::isinf(down.get_inv_direction().get_x()));
+            REQUIRE(down.get_inv_direction().get_y() == Catch::Approx(-0.5));
+            REQUIRE(down.get_sign() == 2);
+            REQUIRE(ray(vec3(0, 0, 0), vec3(-1, 1, -1)).get_sign() == 5);
+            REQUIRE(approx_equal(down.point_at(2), vec3(0.25, 1, 0.25),
+                                 epsilon));
+        }
+    }
+
+    WHEN("A ray is tested against a triangle")
+    {
+        const vec3 a(0, 0, 0);
+        const vec3 b(1, 0, 0);
+        const vec3 c(0, 0, 1);
+
+        THEN("A hit reports the distance and barycentrics")
+        {
+            component_type t = -1;
+            component_type u = -1;
+            component_type v = -1;
+            REQUIRE(down.intersect_triangle(a, b, c, t, u, v));
+            REQUIRE(t == Catch::Approx(2.5));
+            REQUIRE(u == Catch::Approx(0.25));
+            REQUIRE(v == Catch::Approx(0.25));
+            REQUIRE(approx_equal(down.point_at(t), vec3(0.25, 0, 0.25),
+                                 epsilon));
+        }
+
+        THEN("Both faces are hit")
+        {
+            component_type t = -1;
+            component_type u = -1;
+            component_type v = -1;
+            REQUIRE(down.intersect_triangle(a, c, b, t, u, v));
+            REQUIRE(t == Catch::Approx(2.5));
+        }
+
+        THEN("Rays that pass beside, behind or beyond the range miss")
+        {
+            component_type t = -1;
+            component_type u = -1;
+            component_type v = -1;
+            REQUIRE_FALSE(ray(vec3(0.75, 5, 0.75), vec3(0, -1, 0))
+                              .intersect_triangle(a, b, c, t, u, v));
+            REQUIRE_FALSE(ray(vec3(0.25, 5, 0.25), vec3(0, 1, 0))
+                              .intersect_triangle(a, b, c, t, u, v));
+            REQUIRE_FALSE(ray(vec3(0.25, 5, 0.25), vec3(0, -1, 0), 0, 4)
+                              .intersect_triangle(a, b, c, t, u, v));
+            REQUIRE(t == -1);
+        }
+    }
+
+    WHEN("Rays cross the shared edge of two triangles")
+    {
+        // A unit quad split along its diagonal
+        const vec3 p0(0, 0, 0);
+        const vec3 p1(1, 0, 0);
+        const vec3 p2(1, 0, 1);
+        const vec3 p3(0, 0, 1);
+
+        THEN("No ray slips through the crack")
+        {
+            component_type t = -1;
+            component_type u = -1;
+            component_type v = -1;
+            for (int i = 1; i < 64; ++i)
+            {
+                const component_type f = component_type(i) / 64;
+                for (const vec3& direction :
+                     {vec3(0, -1, 0), vec3(0.3, -1, 0.1), vec3(-1, -1, -1)})
+                {
+                    const vec3 hit(f, 0, f);
+                    const ray r(vec3(hit - direction), direction);
+                    const int hits =
+                        int(r.intersect_triangle(p0, p1, p2, t, u, v)) +
+                        int(r.intersect_triangle(p0, p2, p3, t, u, v));
+                    REQUIRE(hits >= 1);
+                }
+            }
+        }
+    }
+
+    WHEN("A ray is tested against a box")
+    {
+        const aabb box(vec3(-1, 0, -1), vec3(1, 2, 1));
+
+        THEN("A hit reports where the ray enters and leaves")
+        {
+            component_type t_near = -1;
+            component_type t_far = -1;
+            REQUIRE(down.intersect_aabb(box, t_near, t_far));
+            REQUIRE(t_near == Catch::Approx(1.5));
+            REQUIRE(t_far == Catch::Approx(2.5));
+        }
+
+        THEN("A ray starting inside enters at its minimum distance")
+        {
+            component_type t_near = -1;
+            component_type t_far = -1;
+            const ray inside(vec3(0, 1, 0), vec3(1, 0, 0));
+            REQUIRE(inside.intersect_aabb(box, t_near, t_far));
+            REQUIRE(t_near == 0);
+            REQUIRE(t_far == Catch::Approx(1));
+        }
+
+        THEN("Axis aligned rays beside the box miss")
+        {
+            component_type t_near = -1;
+            component_type t_far = -1;
+            REQUIRE_FALSE(ray(vec3(2, 5, 0), vec3(0, -1, 0))
+                              .intersect_aabb(box, t_near, t_far));
+            REQUIRE_FALSE(ray(vec3(0, 5, 0), vec3(0, 1, 0))
+                              .intersect_aabb(box, t_near, t_far));
+            REQUIRE(t_near == -1);
+        }
+
+        THEN("Rays lying on a face hit, alone and in a packet")
+        {
+            const aabb unit(vec3(0, 0, 0), vec3(1, 1, 1));
+            const std::vector<ray> on_faces = {
+                ray(vec3(-1, 0, 0.5), vec3(1, 0, 0)),
+                ray(vec3(-1, 1, 0.5), vec3(1, 0, 0)),
+                ray(vec3(-1, 0.5, 0), vec3(1, 0, 0)),
+                ray(vec3(-1, 0.5, 1), vec3(1, 0, 0)),
+                ray(vec3(2, 0, 1), vec3(-1, 0, 0)),
+                ray(vec3(0, 1, -1), vec3(0, 0, 1))};
+            for (const ray& r : on_faces)
+            {
+                component_type t_near = -1;
+                component_type t_far = -1;
+                REQUIRE(r.intersect_aabb(unit, t_near, t_far));
+                REQUIRE(t_near == Catch::Approx(1));
+                REQUIRE(t_far == Catch::Approx(2));
+            }
+
+            const auto faces =
+                move::math::ray_packet8<component_type>::load(on_faces.data(),
+                                                              on_faces.size());
+            component_type t[8];
+            REQUIRE(faces.intersect_aabb(unit, t) == 0x3fu);
+            for (size_t i = 0; i < on_faces.size(); ++i)
+            {
+                REQUIRE(t[i] == Catch::Approx(1));
+            }
+        }
+    }
+
+    WHEN("A ray is tested against an oriented box")
+    {
+        // A unit cube turned 45 degrees about Y, a diamond seen from above
+        const obb box(vec3(0, 1, 0),
+                      ray::obb_t::mat3x3_t::rotation_y(
+                          component_type(0.7853981633974483)),
+                      vec3(1, 1, 1));
+
+        THEN("A hit reports where the ray enters and leaves")
+        {
+            component_type t_near = -1;
+            component_type t_far = -1;
+            REQUIRE(down.intersect_obb(box, t_near, t_far));
+            REQUIRE(t_near == Catch::Approx(1.5));
+            REQUIRE(t_far == Catch::Approx(2.5));
+        }
+
+        THEN("Only rays through the diamond hit")
+        {
+            component_type t_near = -1;
+            component_type t_far = -1;
+            REQUIRE(ray(vec3(1.2, 5, 0), vec3(0, -1, 0))
+                        .intersect_obb(box, t_near, t_far));
+            REQUIRE(t_near == Catch::Approx(3));
+            // Inside the enclosing axis-aligned box, outside the diamond
+            REQUIRE(box.to_aabb().contains(vec3(1.2, 1, 0.5)));
+            REQUIRE_FALSE(ray(vec3(1.2, 5, 0.5), vec3(0, -1, 0))
+                              .intersect_obb(box, t_near, t_far));
+            REQUIRE_FALSE(ray(vec3(0, 5, 0), vec3(0, 1, 0))
+                              .intersect_obb(box, t_near, t_far));
+        }
+
+        THEN("Rays lying on a face hit")
+        {
+            const obb upright(vec3(0, 1, 0),
+                              ray::obb_t::mat3x3_t::rotation_y(0),
+                              vec3(1, 1, 1));
+            for (const component_type y : {component_type(0),
+                                           component_type(2)})
+            {
+                component_type t_near = -1;
+                component_type t_far = -1;
+                REQUIRE(ray(vec3(-3, y, 0), vec3(1, 0, 0))
+                            .intersect_obb(upright, t_near, t_far));
+                REQUIRE(t_near == Catch::Approx(2));
+                REQUIRE(t_far == Catch::Approx(4));
+            }
+        }
+
+        THEN("It matches the box test on the ray in the box's frame")
+        {
+            const aabb local(vec3(-1, -1, -1), vec3(1, 1, 1));
+            for (const ray& r : make_ray_fan<ray>(64))
+            {
+                const ray moved(box.local_point(r.get_origin()),
+                                box.local_direction(r.get_direction()),
+                                r.get_t_min(), r.get_t_max());
+                component_type t_near = -1;
+                component_type t_far = -1;
+                component_type expected_near = -1;
+                component_type expected_far = -1;
+                const bool hit = r.intersect_obb(box, t_near, t_far);
+                REQUIRE(hit == moved.intersect_aabb(local, expected_near,
+                                                    expected_far));
+                if (hit)
+                {
+                    REQUIRE(t_near == Catch::Approx(expected_near));
+                    REQUIRE(t_far == Catch::Approx(expected_far));
+                }
+            }
+        }
+    }
+
+    WHEN("A ray is tested against a sphere")
+    {
+        const sphere ball(vec3(0.25, 0, 0.25), 1);
+
+        THEN("The t_near side is hit from outside")
+        {
+            component_type t = -1;
+            REQUIRE(down.intersect_sphere(ball, t));
+            REQUIRE(t == Catch::Approx(2));
+        }
+
+        THEN("The t_far side is hit from inside")
+        {
+            component_type t = -1;
+            const ray inside(vec3(0.25, 0, 0.25), vec3(0, 0, 1));
+            REQUIRE(inside.intersect_sphere(ball, t));
+            REQUIRE(t == Catch::Approx(1));
+        }
+
+        THEN("Rays passing by miss")
+        {
+            component_type t = -1;
+            REQUIRE_FALSE(ray(vec3(3, 5, 0), vec3(0, -1, 0))
+                              .intersect_sphere(ball, t));
+            REQUIRE(t == -1);
+        }
+    }
+
+    WHEN("A ray is tested against a plane")
+    {
+        const plane ground(vec3(0, 1, 0), -1);
+
+        THEN("It hits from either side")
+        {
+            component_type t = -1;
+            REQUIRE(down.intersect_plane(ground, t));
+            REQUIRE(t == Catch::Approx(2));
+            REQUIRE(ray(vec3(0, -3, 0), vec3(0, 1, 0))
+                        .intersect_plane(ground, t));
+            REQUIRE(t == Catch::Approx(4));
+        }
+
+        THEN("Parallel and receding rays miss")
+        {
+            component_type t = -1;
+            REQUIRE_FALSE(ray(vec3(0, 3, 0), vec3(1, 0, 0))
+                              .intersect_plane(ground, t));
+            REQUIRE_FALSE(ray(vec3(0, 3, 0), vec3(0, 1, 0))
+                              .intersect_plane(ground, t));
+            REQUIRE(t == -1);
+        }
+    }
+
+    WHEN("Rays are tested in packets")
+    {
+        // Eleven rays fill packets of four and eight with some lanes spare
+        const std::vector<ray> rays = make_ray_fan<ray>(11);
+
+        THEN("Each lane matches the single ray test")
+        {
+            test_ray_packet<ray, 4>(rays);
+            test_ray_packet<ray, 8>(rays);
+        }
+    }
+}
+
+template <typename ray>
+inline void benchmark_ray()
+{
+    using component_type = ray::component_type;
+    using vec3 = ray::vec3_t;
+    using packet = move::math::ray_packet8<component_type>;
+    move::string_view typeName = move::meta::type_name<ray>();
+
+    constexpr size_t ray_count = 4096;
+    const std::vector<ray> rays = make_ray_fan<ray>(ray_count);
+    std::vector<packet> packets;
+    for (size_t i = 0; i < ray_count; i += packet::width)
+    {
+        packets.push_back(packet::load(rays.data() + i, packet::width));
+    }
+    const vec3 a(-1, -1, 0);
+    const vec3 b(1, -1, 0);
+    const vec3 c(0, 1, 1);
+    const typename ray::aabb_t box(vec3(-0.5, -0.5, -1), vec3(0.5, 0.5, 0));
+
+    BENCHMARK(alloc_appended_name(typeName, ": Triangle (single)"))
+    {
+        uint32_t hits = 0;
+        component_type t;
+        component_type u;
+        component_type v;
+        for (const ray& r : rays)
+        {
+            hits += r.intersect_triangle(a, b, c, t, u, v);
+        }
+        return hits;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Triangle (packet of 8)"))
+    {
+        uint32_t hits = 0;
+        component_type t[packet::width];
+        component_type u[packet::width];
+        component_type v[packet::width];
+        for (const packet& p : packets)
+        {
+            hits += p.intersect_triangle(a, b, c, t, u, v);
+        }
+        return hits;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": AABB (single)"))
+    {
+        uint32_t hits = 0;
+        component_type t_near;
+        component_type t_far;
+        for (const ray& r : rays)
+        {
+            hits += r.intersect_aabb(box, t_near, t_far);
+        }
+        return hits;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": AABB (packet of 8)"))
+    {
+        uint32_t hits = 0;
+        component_type t_near[packet::width];
+        for (const packet& p : packets)
+        {
+            hits += p.intersect_aabb(box, t_near);
+        }
+        return hits;
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_ray, move::math::ray);
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_ray, move::math::ray);
+
+SCENARIO("Ray full tests")
+{
+    test_ray_multi<float, double>();
+}
+
+// SCENARIO("Ray benchmarks")
+// {
+//     benchmark_ray_multi<float, double>();
+// }
@@ -0,0 +1,334 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/skinning.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename mat4>
+inline void test_skinning()
+{
+    using component_type = mat4::component_type;
+    using vec3 = mat4::vec3_t;
+    using influences4 = move::math::bone_influences4<component_type>;
+    using influences8 = move::math::bone_influences8<component_type>;
+    using move::math::approx_equal;
+    using move::math::skin_linear;
+    using move::math::soa_vec3;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing skinning with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tmat4: " << move::meta::type_name<mat4>());
+
+    const mat4 palette[] = {
+        mat4::translation(vec3(1, 0, 0)),
+        mat4::translation(vec3(0, 2, 0)),
+        mat4::angle_axis(vec3::up(), move::math::deg2rad<component_type>(90)),
+        mat4::trs(vec3(3, -1, 2),
+                  mat4::quat_t::rotation_x(
+                      move::math::deg2rad<component_type>(30)),
+                  vec3(1, 1, 1)),
+    };
+
+    // Linear blend skinning is linear in the weights, so each result should
+    // equal the weighted sum of the individually transformed inputs.
+    const auto reference_point =
+        [&](const auto& influences, const vec3& point)
+    {
+        vec3 result(0, 0, 0);
+        for (size_t i = 0; i < influences.bone_count; ++i)
+        {
+            const mat4& bone = palette[influences.bones[i]];
+            result += vec3(bone.transform_point(point)) * influences.weights[i];
+        }
+        return result;
+    };
+
+    const std::vector<vec3> positions = {
+        vec3(0, 0, 0), vec3(1, 2, 3), vec3(-4, 5, 0.5), vec3(2, -2, 7)};
+    const std::vector<vec3> normals = {vec3(0, 1, 0), vec3(1, 0, 0),
+                                       vec3(0, 0, 1),
+                                       vec3(1, 1, 0).normalized()};
+    const std::vector<influences4> influences = {
+        {{0, 0, 0, 0}, {1, 0, 0, 0}},
+        {{0, 1, 0, 0}, {0.5, 0.5, 0, 0}},
+        {{2, 0, 1, 3}, {0.25, 0.25, 0.25, 0.25}},
+        {{3, 2, 0, 0}, {0.75, 0.25, 0, 0}},
+    };
+
+    WHEN("Positions are skinned with four influences per vertex")
+    {
+        std::vector<vec3> out(positions.size());
+        skin_linear(palette, influences.data(), positions.data(), out.data(),
+                    positions.size());
+
+        THEN("A single full-weight bone matches transform_point")
+        {
+            REQUIRE(approx_equal(out[0], vec3(1, 0, 0), epsilon));
+        }
+
+        THEN("Every vertex matches the weighted sum of its bones")
+        {
+            for (size_t i = 0; i < positions.size(); ++i)
+            {
+                REQUIRE(approx_equal(
+                    out[i], reference_point(influences[i], positions[i]),
+                    epsilon));
+            }
+        }
+    }
+
+    WHEN("Positions are skinned with eight influences per vertex")
+    {
+        const influences8 wide = {{0, 1, 2, 3, 0, 1, 2, 3},
+                                  {0.1, 0.2, 0.05, 0.15, 0.1, 0.2, 0.1, 0.1}};
+        const vec3 position(1, 2, 3);
+        vec3 out;
+        skin_linear(palette, &wide, &position, &out, 1);
+
+        THEN("The result matches the weighted sum of its bones")
+        {
+            REQUIRE(
+                approx_equal(out, reference_point(wide, position), epsilon));
+        }
+    }
+
+    WHEN("Positions and normals are skinned together")
+    {
+        std::vector<vec3> out_positions(positions.size());
+        std::vector<vec3> out_normals(normals.size());
+        skin_linear(palette, influences.data(), positions.data(),
+                    normals.data(), out_positions.data(), out_normals.data(),
+                    positions.size());
+
+        THEN("Normals are rotated by the blended matrix and renormalized")
+        {
+            // Translations leave normals untouched
+            REQUIRE(approx_equal(out_normals[0], normals[0], epsilon));
+            REQUIRE(approx_equal(out_normals[1], normals[1], epsilon));
+            for (const vec3& normal : out_normals)
+            {
+                REQUIRE(normal.length() == Catch::Approx(1).epsilon(epsilon));
+            }
+        }
+
+        THEN("Positions match the position-only kernel")
+        {
+            std::vector<vec3> expected(positions.size());
+            skin_linear(palette, influences.data(), positions.data(),
+                        expected.data(), positions.size());
+            for (size_t i = 0; i < positions.size(); ++i)
+            {
+                REQUIRE(out_positions[i] == expected[i]);
+            }
+        }
+    }
+
+    WHEN("Structure-of-arrays streams are skinned")
+    {
+        const size_t count = positions.size();
+        std::vector<component_type> px(count), py(count), pz(count);
+        std::vector<component_type> nx(count), ny(count), nz(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            px[i] = positions[i].x;
+            py[i] = positions[i].y;
+            pz[i] = positions[i].z;
+            nx[i] = normals[i].x;
+            ny[i] = normals[i].y;
+            nz[i] = normals[i].z;
+        }
+
+        std::vector<vec3> expected_positions(count);
+        std::vector<vec3> expected_normals(count);
+        skin_linear(palette, influences.data(), positions.data(),
+                    normals.data(), expected_positions.data(),
+                    expected_normals.data(), count);
+
+        // Skin in place to also cover aliased inputs and outputs
+        skin_linear(palette, influences.data(),
+                    soa_vec3<const component_type>{px.data(), py.data(),
+                                                   pz.data()},
+                    soa_vec3<const component_type>{nx.data(), ny.data(),
+                                                   nz.data()},
+                    soa_vec3<component_type>{px.data(), py.data(), pz.data()},
+                    soa_vec3<component_type>{nx.data(), ny.data(), nz.data()},
+                    count);
+
+        THEN("The results match the array-of-structures kernel")
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(vec3(px[i], py[i], pz[i]) == expected_positions[i]);
+                REQUIRE(vec3(nx[i], ny[i], nz[i]) == expected_normals[i]);
+            }
+        }
+    }
+
+    WHEN("Vertices are skinned with dual quaternions")
+    {
+        using dual_quat = move::math::dual_quat<component_type>;
+        using move::math::skin_dual_quat;
+
+        std::vector<dual_quat> dq_palette;
+        for (const mat4& bone : palette)
+        {
+            dq_palette.push_back(dual_quat::from_mat4x4(bone));
+        }
+
+        std::vector<vec3> out_positions(positions.size());
+        std::vector<vec3> out_normals(normals.size());
+        skin_dual_quat(dq_palette.data(), influences.data(), positions.data(),
+                       normals.data(), out_positions.data(), out_normals.data(),
+                       positions.size());
+
+        THEN("A single full-weight bone matches transform_point")
+        {
+            const vec3 expected = dq_palette[0].transform_point(positions[0]);
+            REQUIRE(approx_equal(out_positions[0], expected, epsilon));
+        }
+
+        THEN("Blending pure translations matches linear blend skinning")
+        {
+            std::vector<vec3> expected(positions.size());
+            skin_linear(palette, influences.data(), positions.data(),
+                        expected.data(), positions.size());
+            REQUIRE(approx_equal(out_positions[1], expected[1], epsilon));
+        }
+
+        THEN("Normals stay unit length")
+        {
+            for (const vec3& normal : out_normals)
+            {
+                REQUIRE(normal.length() == Catch::Approx(1).epsilon(epsilon));
+            }
+        }
+
+        THEN("The position-only and structure-of-arrays kernels agree")
+        {
+            const size_t count = positions.size();
+            std::vector<vec3> only_positions(count);
+            skin_dual_quat(dq_palette.data(), influences.data(),
+                           positions.data(), only_positions.data(), count);
+
+            std::vector<component_type> px(count), py(count), pz(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                px[i] = positions[i].x;
+                py[i] = positions[i].y;
+                pz[i] = positions[i].z;
+            }
+            skin_dual_quat(
+                dq_palette.data(), influences.data(),
+                soa_vec3<const component_type>{px.data(), py.data(), pz.data()},
+                soa_vec3<component_type>{px.data(), py.data(), pz.data()},
+                count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(only_positions[i] == out_positions[i]);
+                REQUIRE(vec3(px[i], py[i], pz[i]) == out_positions[i]);
+            }
+        }
+    }
+
+    WHEN("A joint is twisted halfway between two bones")
+    {
+        using dual_quat = move::math::dual_quat<component_type>;
+
+        const mat4 twist[] = {
+            mat4::identity(),
+            mat4::rotation_x(move::math::deg2rad<component_type>(90))};
+        const dual_quat dq_twist[] = {dual_quat::from_mat4x4(twist[0]),
+                                      dual_quat::from_mat4x4(twist[1])};
+        const influences4 halfway = {{0, 1, 0, 0}, {0.5, 0.5, 0, 0}};
+        const vec3 position(0, 1, 0);
+
+        vec3 linear;
+        vec3 dual;
+        skin_linear(twist, &halfway, &position, &linear, 1);
+        move::math::skin_dual_quat(dq_twist, &halfway, &position, &dual, 1);
+
+        THEN("Dual quaternion skinning preserves the distance to the joint")
+        {
+            REQUIRE(linear.length() < component_type(0.75));
+            REQUIRE(dual.length() == Catch::Approx(1).epsilon(epsilon));
+        }
+    }
+}
+
+template <typename mat4>
+inline void benchmark_skinning()
+{
+    using component_type = mat4::component_type;
+    using vec3 = mat4::vec3_t;
+    move::string_view typeName = move::meta::type_name<mat4>();
+
+    constexpr size_t bone_count = 64;
+    constexpr size_t vertex_count = 4096;
+    std::vector<mat4> palette(bone_count);
+    for (size_t i = 0; i < bone_count; ++i)
+    {
+        palette[i] = mat4::angle_axis(
+            vec3::up(), move::math::deg2rad<component_type>(component_type(i)));
+    }
+
+    std::vector<vec3> positions(vertex_count, vec3(1, 2, 3));
+    std::vector<vec3> normals(vertex_count, vec3(0, 1, 0));
+    std::vector<move::math::bone_influences4<component_type>> influences(
+        vertex_count);
+    for (size_t i = 0; i < vertex_count; ++i)
+    {
+        influences[i] = {{uint16_t(i % bone_count),
+                          uint16_t((i + 1) % bone_count),
+                          uint16_t((i + 7) % bone_count),
+                          uint16_t((i + 13) % bone_count)},
+                         {0.4, 0.3, 0.2, 0.1}};
+    }
+    std::vector<vec3> out_positions(vertex_count);
+    std::vector<vec3> out_normals(vertex_count);
+
+    BENCHMARK(alloc_appended_name(typeName, ": Skin positions"))
+    {
+        move::math::skin_linear(palette.data(), influences.data(),
+                                positions.data(), out_positions.data(),
+                                vertex_count);
+        return out_positions.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Skin positions and normals"))
+    {
+        move::math::skin_linear(palette.data(), influences.data(),
+                                positions.data(), normals.data(),
+                                out_positions.data(), out_normals.data(),
+                                vertex_count);
+        return out_positions.back();
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_skinning, move::math::mat4x4);
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_skinning, move::math::mat4x4);
+
+SCENARIO("Skinning full tests")
+{
+    test_skinning_multi<float, double>();
+}
+
+// SCENARIO("Skinning benchmarks")
+// {
+//     benchmark_skinning_multi<float, double>();
+// }
@@ -0,0 +1,302 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/aabb.hpp>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/space_filling_curve.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename aabb>
+inline void test_space_filling_curve()
+{
+    using component_type = aabb::component_type;
+    using vec3 = aabb::vec3_t;
+    using move::math::hilbert_decode2;
+    using move::math::hilbert_decode3;
+    using move::math::hilbert_encode;
+    using move::math::morton_decode2;
+    using move::math::morton_decode3;
+    using move::math::morton_encode;
+    using move::math::storage_int2;
+    using move::math::storage_int3;
+    using move::math::storage_uint2;
+    using move::math::storage_uint3;
+
+    INFO("Testing space filling curves with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+
+    uint32_t seed = 2024;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return seed;
+    };
+
+    WHEN("Coordinates are Morton encoded")
+    {
+        THEN("Bits interleave with x lowest")
+        {
+            REQUIRE(morton_encode(1u, 0u) == 1u);
+            REQUIRE(morton_encode(0u, 1u) == 2u);
+            REQUIRE(morton_encode(3u, 5u) == 0b100111u);
+            REQUIRE(morton_encode(1u, 0u, 0u) == 1u);
+            REQUIRE(morton_encode(0u, 1u, 0u) == 2u);
+            REQUIRE(morton_encode(0u, 0u, 1u) == 4u);
+            REQUIRE(morton_encode(3u, 0u, 1u) == 0b001101u);
+            REQUIRE(morton_encode(0xffffffffu, 0xffffffffu) == ~uint64_t(0));
+            REQUIRE(morton_encode(0x1fffffu, 0x1fffffu, 0x1fffffu) ==
+                    (uint64_t(1) << 63) - 1);
+            REQUIRE(morton_encode(0xffe00000u, 0u, 0u) == 0u);
+        }
+
+        THEN("Decoding recovers the coordinates")
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                const storage_uint2 a(next(), next());
+                REQUIRE(morton_decode2(morton_encode(a)) == a);
+
+                const storage_uint3 b(next() >> 11, next() >> 11,
+                                      next() >> 11);
+                REQUIRE(morton_decode3(morton_encode(b)) == b);
+            }
+        }
+
+        THEN("Signed coordinates sort in coordinate order")
+        {
+            REQUIRE(morton_encode(storage_int3(-1, 0, 0)) <
+                    morton_encode(storage_int3(0, 0, 0)));
+            REQUIRE(morton_encode(storage_int3(-(1 << 20), -(1 << 20),
+                                               -(1 << 20))) == 0u);
+            REQUIRE(morton_encode(storage_int2(-5, 7)) <
+                    morton_encode(storage_int2(3, 7)));
+            REQUIRE(morton_decode3(morton_encode(storage_int3(-3, 4, 0))) ==
+                    storage_uint3((1 << 20) - 3, (1 << 20) + 4, 1 << 20));
+        }
+    }
+
+    WHEN("Coordinates are Hilbert encoded")
+    {
+        THEN("The first cells of the curve fill the first block")
+        {
+            std::vector<bool> seen(16 * 16 * 16, false);
+            storage_uint3 previous = hilbert_decode3(0);
+            REQUIRE(previous == storage_uint3(0, 0, 0));
+            for (uint64_t code = 0; code < 16 * 16 * 16; ++code)
+            {
+                const storage_uint3 cell = hilbert_decode3(code);
+                REQUIRE(hilbert_encode(cell) == code);
+                REQUIRE(cell.get_x() < 16);
+                REQUIRE(cell.get_y() < 16);
+                REQUIRE(cell.get_z() < 16);
+                const size_t slot =
+                    cell.get_x() + 16 * (cell.get_y() + 16 * cell.get_z());
+                REQUIRE_FALSE(seen[slot]);
+                seen[slot] = true;
+            }
+
+            for (uint64_t code = 0; code < 64 * 64; ++code)
+            {
+                const storage_uint2 cell = hilbert_decode2(code);
+                REQUIRE(hilbert_encode(cell) == code);
+                REQUIRE(cell.get_x() < 64);
+                REQUIRE(cell.get_y() < 64);
+            }
+        }
+
+        THEN("Consecutive codes are neighbouring cells")
+        {
+            const auto steps3 = [](const storage_uint3& a,
+                                   const storage_uint3& b) {
+                return std::abs(int64_t(a.get_x()) - int64_t(b.get_x())) +
+                       std::abs(int64_t(a.get_y()) - int64_t(b.get_y())) +
+                       std::abs(int64_t(a.get_z()) - int64_t(b.get_z()));
+            };
+            const auto steps2 = [](const storage_uint2& a,
+                                   const storage_uint2& b) {
+                return std::abs(int64_t(a.get_x()) - int64_t(b.get_x())) +
+                       std::abs(int64_t(a.get_y()) - int64_t(b.get_y()));
+            };
+
+            for (int i = 0; i < 1000; ++i)
+            {
+                const uint64_t code3 =
+                    ((uint64_t(next()) << 32) | next()) >> 2;
+                REQUIRE(steps3(hilbert_decode3(code3),
+                               hilbert_decode3(code3 + 1)) == 1);
+
+                const uint64_t code2 =
+                    ((uint64_t(next()) << 32) | next()) >> 1;
+                REQUIRE(steps2(hilbert_decode2(code2),
+                               hilbert_decode2(code2 + 1)) == 1);
+            }
+        }
+
+        THEN("Encoding and decoding round trip")
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                const storage_uint2 a(next(), next());
+                REQUIRE(hilbert_decode2(hilbert_encode(a)) == a);
+
+                const storage_uint3 b(next() >> 11, next() >> 11,
+                                      next() >> 11);
+                REQUIRE(hilbert_decode3(hilbert_encode(b)) == b);
+            }
+            REQUIRE(hilbert_encode(storage_int3(-(1 << 20), -(1 << 20),
+                                                -(1 << 20))) == 0u);
+        }
+    }
+
+    WHEN("Points are quantized within bounds")
+    {
+        const aabb bounds(vec3(-1, 0, 2), vec3(1, 4, 2));
+        constexpr uint32_t top = (1u << 21) - 1;
+
+        THEN("The corners map to the ends of the grid")
+        {
+            REQUIRE(move::math::quantize_to_curve(vec3(-1, 0, 2), bounds) ==
+                    storage_uint3(0, 0, 0));
+            REQUIRE(move::math::quantize_to_curve(vec3(1, 4, 2), bounds) ==
+                    storage_uint3(top, top, 0));
+            REQUIRE(move::math::quantize_to_curve(vec3(5, -3, 9), bounds) ==
+                    storage_uint3(top, 0, 0));
+            const storage_uint3 middle =
+                move::math::quantize_to_curve(vec3(0, 2, 2), bounds);
+            REQUIRE(middle.get_x() == top / 2);
+            REQUIRE(middle.get_y() == top / 2);
+        }
+
+        THEN("2D points span the whole 2^32 grid")
+        {
+            using vec2 = move::math::vec2<component_type,
+                                          move::math::Acceleration::Scalar>;
+            constexpr uint32_t top2 = ~0u;
+            const vec2 lo(-1, 0);
+            const vec2 hi(1, 4);
+            REQUIRE(move::math::quantize_to_curve(vec2(-1, 0), lo, hi) ==
+                    storage_uint2(0, 0));
+            REQUIRE(move::math::quantize_to_curve(vec2(1, 4), lo, hi) ==
+                    storage_uint2(top2, top2));
+            REQUIRE(move::math::quantize_to_curve(vec2(5, -3), lo, hi) ==
+                    storage_uint2(top2, 0));
+            REQUIRE(move::math::quantize_to_curve(vec2(0, 2), lo, lo) ==
+                    storage_uint2(0, 0));
+            const storage_uint2 middle =
+                move::math::quantize_to_curve(vec2(0, 2), lo, hi);
+            REQUIRE(middle.get_x() == top2 / 2);
+            REQUIRE(middle.get_y() == top2 / 2);
+            REQUIRE(morton_encode(vec2(0, 2), lo, hi) == morton_encode(middle));
+            REQUIRE(hilbert_encode(vec2(0, 2), lo, hi) ==
+                    hilbert_encode(middle));
+        }
+
+        THEN("Batches match single points")
+        {
+            std::vector<move::math::vec3<component_type,
+                                         move::math::Acceleration::Scalar>>
+                points;
+            for (int i = 0; i < 257; ++i)
+            {
+                points.emplace_back(component_type(next() % 2001) / 1000 - 1,
+                                    component_type(next() % 4001) / 1000,
+                                    component_type(2));
+            }
+
+            std::vector<uint64_t> mortons(points.size());
+            std::vector<uint64_t> hilberts(points.size());
+            move::math::morton_codes(points.data(), bounds, mortons.data(),
+                                     points.size());
+            move::math::hilbert_codes(points.data(), bounds, hilberts.data(),
+                                      points.size());
+
+            std::vector<storage_uint3> cells(points.size());
+            std::vector<uint64_t> cell_mortons(points.size());
+            std::vector<uint64_t> cell_hilberts(points.size());
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                const vec3 p(points[i].get_x(), points[i].get_y(),
+                             points[i].get_z());
+                REQUIRE(mortons[i] == morton_encode(p, bounds));
+                REQUIRE(hilberts[i] == hilbert_encode(p, bounds));
+                cells[i] = move::math::quantize_to_curve(p, bounds);
+            }
+            move::math::morton_codes(cells.data(), cell_mortons.data(),
+                                     cells.size());
+            move::math::hilbert_codes(cells.data(), cell_hilberts.data(),
+                                      cells.size());
+            REQUIRE(cell_mortons == mortons);
+            REQUIRE(cell_hilberts == hilberts);
+        }
+    }
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_space_filling_curve,
+                                     move::math::aabb);
+
+SCENARIO("Space filling curve full tests")
+{
+    test_space_filling_curve_multi<float, double>();
+}
+
+template <typename aabb>
+inline void benchmark_space_filling_curve()
+{
+    using component_type = aabb::component_type;
+    using vec3 = aabb::vec3_t;
+    using point = move::math::vec3<component_type,
+                                   move::math::Acceleration::Scalar>;
+
+    const auto typeName = move::meta::type_name<aabb>();
+
+    uint32_t seed = 7;
+    std::vector<point> points;
+    for (int i = 0; i < 1 << 16; ++i)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const component_type x = component_type(seed >> 8);
+        seed = seed * 1664525u + 1013904223u;
+        const component_type y = component_type(seed >> 8);
+        seed = seed * 1664525u + 1013904223u;
+        points.emplace_back(x, y, component_type(seed >> 8));
+    }
+    const aabb bounds(vec3(0, 0, 0), vec3(1 << 24, 1 << 24, 1 << 24));
+    std::vector<uint64_t> codes(points.size());
+
+    BENCHMARK(alloc_appended_name(typeName, ": 64k Morton codes"))
+    {
+        move::math::morton_codes(points.data(), bounds, codes.data(),
+                                 points.size());
+        return codes.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": 64k Hilbert codes"))
+    {
+        move::math::hilbert_codes(points.data(), bounds, codes.data(),
+                                  points.size());
+        return codes.back();
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_space_filling_curve,
+                                     move::math::aabb);
+
+// SCENARIO("Space filling curve benchmarks", "[!benchmark]")
+// {
+//     benchmark_space_filling_curve_multi<float, double>();
+// }
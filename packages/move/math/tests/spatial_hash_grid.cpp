@@ -0,0 +1,401 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/spatial_hash_grid.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+// Points scattered through a cube of the given half size, clumped a little
+// so some cells hold several
+template <typename grid>
+inline std::vector<typename grid::storage_vec3_t> make_points(
+    size_t count, typename grid::component_type half_size, uint32_t seed)
+{
+    using component_type = grid::component_type;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return component_type(seed >> 8) / component_type(1 << 24) *
+                   component_type(2) -
+               component_type(1);
+    };
+
+    std::vector<typename grid::storage_vec3_t> points;
+    points.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const component_type clump = (i % 4 == 0) ? component_type(0.25)
+                                                  : component_type(1);
+        points.emplace_back(next() * half_size * clump,
+                            next() * half_size * clump,
+                            next() * half_size * clump);
+    }
+    return points;
+}
+
+template <typename grid>
+inline void test_spatial_hash_grid()
+{
+    using component_type = grid::component_type;
+    using vec3 = grid::vec3_t;
+    using aabb = grid::aabb_t;
+    using ray = grid::ray_t;
+    using cell = grid::cell_t;
+
+    INFO("Testing spatial_hash_grid with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tgrid: " << move::meta::type_name<grid>());
+
+    const auto points = make_points<grid>(2000, 10, 777);
+    const auto to_vec = [](const typename grid::storage_vec3_t& p) {
+        return vec3(p.get_x(), p.get_y(), p.get_z());
+    };
+
+    WHEN("Points are bucketed into cells")
+    {
+        THEN("Each point is found in its own cell")
+        {
+            grid g(1.5);
+            g.build(points.data(), points.size());
+            REQUIRE(g.size() == points.size());
+            REQUIRE(g.bucket_count() >= 2 * points.size());
+            REQUIRE(g.get_cell_size() == component_type(1.5));
+
+            size_t visited = 0;
+            for (size_t i = 0; i < points.size(); i += 37)
+            {
+                bool found = false;
+                g.for_each_in_cell(g.cell_of(to_vec(points[i])),
+                                   [&](uint32_t index)
+                                   {
+                                       found = found || index == i;
+                                       ++visited;
+                                   });
+                REQUIRE(found);
+            }
+            REQUIRE(visited < points.size());
+        }
+
+        THEN("Cell coordinates round toward negative infinity")
+        {
+            const grid g(2);
+            REQUIRE(g.cell_of(vec3(0, 1.9, -0.1)) == cell(0, 0, -1));
+            REQUIRE(g.cell_of(vec3(-2, 2, -4.5)) == cell(-1, 1, -3));
+        }
+
+        THEN("An empty grid finds nothing")
+        {
+            grid g;
+            g.build(points.data(), 0);
+            REQUIRE(g.empty());
+            size_t found = 0;
+            g.query_radius(vec3(0, 0, 0), 100, [&](uint32_t) { ++found; });
+            g.walk_ray(ray(vec3(0, 0, 0), vec3(1, 0, 0)),
+                       [&](uint32_t, component_type)
+                       {
+                           ++found;
+                           return true;
+                       });
+            REQUIRE(found == 0);
+        }
+    }
+
+    WHEN("Radius and box queries are compared against brute force")
+    {
+        THEN("They report exactly the points inside, once each")
+        {
+            grid g(1.25);
+            g.build(points.data(), points.size());
+
+            uint32_t seed = 99;
+            for (int q = 0; q < 50; ++q)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                const vec3 center(component_type(int(seed % 23) - 11),
+                                  component_type(int(seed % 19) - 9),
+                                  component_type(int(seed % 17) - 8));
+                const component_type radius =
+                    component_type(0.5) + component_type(q % 5);
+
+                std::vector<uint32_t> found;
+                g.query_radius(center, radius,
+                               [&](uint32_t index) { found.push_back(index); });
+                std::sort(found.begin(), found.end());
+
+                std::vector<uint32_t> expected;
+                for (uint32_t i = 0; i < points.size(); ++i)
+                {
+                    if (vec3(to_vec(points[i]) - center).length_squared() <=
+                        radius * radius)
+                    {
+                        expected.push_back(i);
+                    }
+                }
+                REQUIRE(found == expected);
+
+                const vec3 extent(radius, radius * 2, radius / 2);
+                const aabb box(vec3(center - extent), vec3(center + extent));
+                found.clear();
+                g.query_aabb(box,
+                             [&](uint32_t index) { found.push_back(index); });
+                std::sort(found.begin(), found.end());
+
+                expected.clear();
+                for (uint32_t i = 0; i < points.size(); ++i)
+                {
+                    if (box.contains(to_vec(points[i])))
+                    {
+                        expected.push_back(i);
+                    }
+                }
+                REQUIRE(found == expected);
+            }
+        }
+
+        THEN("A query covering everything returns every point")
+        {
+            grid g(0.5);
+            g.build(points.data(), points.size());
+            size_t found = 0;
+            g.query_radius(vec3(0, 0, 0), 1000, [&](uint32_t) { ++found; });
+            REQUIRE(found == points.size());
+        }
+    }
+
+    WHEN("The grid is built in parallel chunks")
+    {
+        THEN("It matches the serial build")
+        {
+            grid serial(1);
+            serial.build(points.data(), points.size());
+
+            size_t chunks_run = 0;
+            auto serial_for = [&](size_t chunk_count, auto&& job)
+            {
+                // Back to front, so the scatter does not happen to run in
+                // index order
+                for (size_t i = chunk_count; i-- > 0;)
+                {
+                    job(i);
+                    ++chunks_run;
+                }
+            };
+            grid chunked(1);
+            chunked.build(points.data(), points.size(), serial_for, 300);
+
+            // Two passes over the points and one over bucket partitions
+            const size_t point_chunks = (points.size() + 299) / 300;
+            const size_t partitions = (chunked.bucket_count() + 299) / 300;
+            REQUIRE(chunks_run == 2 * point_chunks + partitions);
+            REQUIRE(chunked.size() == serial.size());
+            REQUIRE(chunked.bucket_count() == serial.bucket_count());
+            REQUIRE(chunked.bounds() == serial.bounds());
+
+            for (size_t i = 0; i < points.size(); i += 11)
+            {
+                std::vector<uint32_t> a;
+                std::vector<uint32_t> b;
+                const vec3 center = to_vec(points[i]);
+                serial.query_radius(
+                    center, 2, [&](uint32_t index) { a.push_back(index); });
+                chunked.query_radius(
+                    center, 2, [&](uint32_t index) { b.push_back(index); });
+                REQUIRE(a == b);
+            }
+        }
+    }
+
+    WHEN("A ray walks the grid")
+    {
+        THEN("It visits the points of every cell it crosses, in order")
+        {
+            const component_type cell_size = 1.5;
+            grid g(cell_size);
+            g.build(points.data(), points.size());
+
+            uint32_t seed = 4242;
+            const auto next = [&seed]() {
+                seed = seed * 1664525u + 1013904223u;
+                return component_type(seed >> 8) / component_type(1 << 24) *
+                           component_type(2) -
+                       component_type(1);
+            };
+
+            for (int q = 0; q < 40; ++q)
+            {
+                const vec3 origin(next() * 15, next() * 15, next() * 15);
+                vec3 direction(next(), next(), next());
+                if (q % 8 == 0)
+                {
+                    // Axis aligned rays have zero components
+                    direction = vec3(0, 0, q % 16 == 0 ? 1 : -1);
+                }
+                const ray r(origin, direction, 0, 30);
+
+                std::vector<uint32_t> found;
+                component_type last_exit = 0;
+                g.walk_ray(r,
+                           [&](uint32_t index, component_type t_exit)
+                           {
+                               REQUIRE(t_exit >= last_exit);
+                               last_exit = t_exit;
+                               found.push_back(index);
+                               return true;
+                           });
+                std::sort(found.begin(), found.end());
+                REQUIRE(std::adjacent_find(found.begin(), found.end()) ==
+                        found.end());
+
+                // Every point whose cell the ray passes through within its
+                // range, give or take a hair at the corners
+                std::vector<uint32_t> expected;
+                for (uint32_t i = 0; i < points.size(); ++i)
+                {
+                    const cell c = g.cell_of(to_vec(points[i]));
+                    const vec3 lo(component_type(c.get_x()) * cell_size,
+                                  component_type(c.get_y()) * cell_size,
+                                  component_type(c.get_z()) * cell_size);
+                    const vec3 hi(vec3(lo + vec3(cell_size, cell_size,
+                                                 cell_size)));
+                    component_type t_near;
+                    component_type t_far;
+                    const bool crosses = r.intersect_aabb(aabb(lo, hi), t_near,
+                                                          t_far);
+                    const bool solid = crosses &&
+                                       t_far - t_near > component_type(1e-3);
+                    const bool reported = std::binary_search(
+                        found.begin(), found.end(), i);
+                    if (solid)
+                    {
+                        REQUIRE(reported);
+                    }
+                    if (reported)
+                    {
+                        aabb padded(lo, hi);
+                        padded.inflate(component_type(1e-3));
+                        REQUIRE(r.intersect_aabb(padded, t_near, t_far));
+                    }
+                }
+            }
+        }
+
+        THEN("Returning false stops the walk")
+        {
+            grid g(1);
+            g.build(points.data(), points.size());
+            size_t calls = 0;
+            const bool finished =
+                g.walk_ray(ray(vec3(-20, 0, 0), vec3(1, 0, 0)),
+                           [&](uint32_t, component_type)
+                           {
+                               ++calls;
+                               return calls < 3;
+                           });
+            REQUIRE_FALSE(finished);
+            REQUIRE(calls == 3);
+        }
+
+        THEN("A ray that misses the points visits nothing")
+        {
+            grid g(1);
+            g.build(points.data(), points.size());
+            size_t calls = 0;
+            REQUIRE(g.walk_ray(ray(vec3(-20, 50, 0), vec3(1, 0, 0)),
+                               [&](uint32_t, component_type)
+                               {
+                                   ++calls;
+                                   return true;
+                               }));
+            REQUIRE(calls == 0);
+        }
+    }
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_spatial_hash_grid,
+                                     move::math::spatial_hash_grid);
+
+SCENARIO("Spatial hash grid full tests")
+{
+    test_spatial_hash_grid_multi<float, double>();
+}
+
+template <typename grid>
+inline void benchmark_spatial_hash_grid()
+{
+    using vec3 = grid::vec3_t;
+
+    const auto typeName = move::meta::type_name<grid>();
+    const auto points = make_points<grid>(1 << 20, 200, 31337);
+
+    // One chunk per thread at a time, handed out from a shared counter
+    auto thread_for = [](size_t chunk_count, auto&& job)
+    {
+        std::atomic<size_t> next = 0;
+        const auto worker = [&]()
+        {
+            for (size_t i = next++; i < chunk_count; i = next++)
+            {
+                job(i);
+            }
+        };
+        std::vector<std::thread> threads(
+            std::max(1u, std::thread::hardware_concurrency()) - 1);
+        for (auto& thread : threads)
+        {
+            thread = std::thread(worker);
+        }
+        worker();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    };
+
+    grid g(1);
+    BENCHMARK(alloc_appended_name(typeName, ": build 1M points"))
+    {
+        g.build(points.data(), points.size());
+        return g.size();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": parallel build 1M points"))
+    {
+        g.build(points.data(), points.size(), thread_for);
+        return g.size();
+    };
+
+    g.build(points.data(), points.size());
+    BENCHMARK(alloc_appended_name(typeName, ": 4096 radius queries"))
+    {
+        size_t found = 0;
+        for (size_t i = 0; i < 4096; ++i)
+        {
+            const auto& p = points[i * 97];
+            g.query_radius(vec3(p.get_x(), p.get_y(), p.get_z()), 1,
+                           [&](uint32_t) { ++found; });
+        }
+        return found;
+    };
+}
+
+// SCENARIO("Spatial hash grid benchmarks", "[!benchmark]")
+// {
+//     benchmark_spatial_hash_grid<move::math::spatial_hash_gridf>();
+//     benchmark_spatial_hash_grid<move::math::spatial_hash_gridd>();
+// }
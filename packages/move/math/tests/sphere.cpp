@@ -0,0 +1,238 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/sphere.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include <vector>
+
+#include "mm_test_common.hpp"
+
+template <typename sphere>
+inline void test_sphere()
+{
+    using component_type = sphere::component_type;
+    using vec3 = sphere::vec3_t;
+    using plane = sphere::plane_t;
+    using mat4 = sphere::mat4x4_t;
+    using scalar_vec3 =
+        move::math::vec3<component_type, move::math::Acceleration::Scalar>;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing sphere with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tsphere: " << move::meta::type_name<sphere>());
+
+    const sphere s(vec3(1, 2, 3), 2);
+
+    WHEN("Points are measured against a sphere")
+    {
+        THEN("The signed distance is negative inside")
+        {
+            REQUIRE(s.signed_distance(vec3(1, 2, 3)) == Catch::Approx(-2));
+            REQUIRE(s.signed_distance(vec3(1, 2, 8)) == Catch::Approx(3));
+            REQUIRE(s.contains(vec3(2, 3, 3)));
+            REQUIRE_FALSE(s.contains(vec3(3, 4, 3)));
+        }
+
+        THEN("Points are projected onto the surface")
+        {
+            REQUIRE(approx_equal(s.project_point(vec3(1, 9, 3)),
+                                 vec3(1, 4, 3), epsilon));
+            REQUIRE(approx_equal(s.project_point(vec3(1, 2, 3.5)),
+                                 vec3(1, 2, 5), epsilon));
+            REQUIRE(approx_equal(s.project_point(vec3(1, 2, 3)),
+                                 vec3(1, 4, 3), epsilon));
+        }
+
+        THEN("The closest point of the solid sphere clamps outside points")
+        {
+            REQUIRE(approx_equal(s.closest_point(vec3(-5, 2, 3)),
+                                 vec3(-1, 2, 3), epsilon));
+            REQUIRE(approx_equal(s.closest_point(vec3(1, 2, 4)),
+                                 vec3(1, 2, 4), epsilon));
+        }
+    }
+
+    WHEN("Spheres are tested against other shapes")
+    {
+        THEN("Overlapping spheres intersect")
+        {
+            REQUIRE(s.intersects(sphere(vec3(4, 2, 3), 1.5)));
+            REQUIRE_FALSE(s.intersects(sphere(vec3(4, 2, 3), 0.5)));
+        }
+
+        THEN("Planes through the sphere intersect")
+        {
+            REQUIRE(s.intersects(plane(vec3(0, 1, 0), -3)));
+            REQUIRE(s.intersects(plane(vec3(0, -1, 0), 3)));
+            REQUIRE_FALSE(s.intersects(plane(vec3(0, 1, 0), -5)));
+        }
+    }
+
+    WHEN("Spheres are merged")
+    {
+        const sphere a(vec3(0, 0, 0), 1);
+        const sphere b(vec3(4, 0, 0), 2);
+        const sphere merged = sphere::merged(a, b);
+
+        THEN("The result tightly encloses both")
+        {
+            REQUIRE(approx_equal(merged, sphere(vec3(2.5, 0, 0), 3.5),
+                                 epsilon));
+            REQUIRE(sphere::merged(sphere(vec3(1, 2, 4), 1), s) == s);
+            REQUIRE(sphere::merged(sphere(vec3(1, 2, 3), 10), a) ==
+                    sphere(vec3(1, 2, 3), 10));
+        }
+    }
+
+    WHEN("A sphere is built from points")
+    {
+        std::vector<scalar_vec3> points;
+        for (int i = 0; i < 20; ++i)
+        {
+            const component_type f = component_type(i);
+            points.emplace_back(f * component_type(0.3), 5 - f,
+                                (i % 3) * component_type(2));
+        }
+        const sphere bounds = sphere::from_points(points.data(),
+                                                  points.size());
+
+        THEN("Every point is inside")
+        {
+            for (const scalar_vec3& p : points)
+            {
+                REQUIRE(bounds.signed_distance(vec3(p.get_x(), p.get_y(),
+                                                    p.get_z())) <= epsilon);
+            }
+            REQUIRE(sphere::from_points(points.data(), 0) == sphere());
+        }
+    }
+
+    WHEN("A sphere is transformed")
+    {
+        const mat4 mat = mat4::scale(1, 3, 2) *
+                         mat4::rotation_z(component_type(0.4)) *
+                         mat4::translation(vec3(-2, 1, 5));
+        const sphere moved = s.transformed(mat);
+
+        THEN("The center moves and the radius takes the largest scale")
+        {
+            REQUIRE(approx_equal(moved.get_center(),
+                                 mat.transform_point(s.get_center()),
+                                 epsilon));
+            REQUIRE(moved.get_radius() == Catch::Approx(6));
+        }
+    }
+
+    WHEN("Distances are computed in bulk")
+    {
+        constexpr size_t count = 7;
+        std::vector<scalar_vec3> points;
+        component_type xs[count];
+        component_type ys[count];
+        component_type zs[count];
+        for (size_t i = 0; i < count; ++i)
+        {
+            const component_type f = component_type(i);
+            points.emplace_back(f, f * f - 3, 2 - f);
+            xs[i] = points[i].get_x();
+            ys[i] = points[i].get_y();
+            zs[i] = points[i].get_z();
+        }
+
+        component_type aos[count];
+        component_type soa[count];
+        s.signed_distances(points.data(), aos, count);
+        s.signed_distances(
+            move::math::soa_vec3<const component_type>{xs, ys, zs}, soa,
+            count);
+
+        THEN("Each distance matches signed_distance")
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const component_type expected = s.signed_distance(
+                    vec3(points[i].get_x(), points[i].get_y(),
+                         points[i].get_z()));
+                REQUIRE(aos[i] == Catch::Approx(expected).margin(epsilon));
+                REQUIRE(soa[i] == Catch::Approx(expected).margin(epsilon));
+            }
+        }
+    }
+}
+
+template <typename sphere>
+inline void benchmark_sphere()
+{
+    using component_type = sphere::component_type;
+    using vec3 = sphere::vec3_t;
+    using scalar_vec3 =
+        move::math::vec3<component_type, move::math::Acceleration::Scalar>;
+    move::string_view typeName = move::meta::type_name<sphere>();
+
+    const sphere s(vec3(1, 2, 3), 2);
+    constexpr size_t count = 4096;
+    std::vector<scalar_vec3> points(count);
+    std::vector<component_type> xs(count);
+    std::vector<component_type> ys(count);
+    std::vector<component_type> zs(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const component_type f = component_type(i) * component_type(0.01);
+        points[i] = scalar_vec3(f, -f, f * 2);
+        xs[i] = f;
+        ys[i] = -f;
+        zs[i] = f * 2;
+    }
+    std::vector<component_type> out(count);
+
+    BENCHMARK(alloc_appended_name(typeName, ": Signed distance loop"))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = s.signed_distance(
+                vec3(points[i].get_x(), points[i].get_y(), points[i].get_z()));
+        }
+        return out.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Signed distances (AoS)"))
+    {
+        s.signed_distances(points.data(), out.data(), count);
+        return out.back();
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Signed distances (SoA)"))
+    {
+        s.signed_distances(
+            move::math::soa_vec3<const component_type>{xs.data(), ys.data(),
+                                                       zs.data()},
+            out.data(), count);
+        return out.back();
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_sphere, move::math::sphere);
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_sphere, move::math::sphere);
+
+SCENARIO("Sphere full tests")
+{
+    test_sphere_multi<float, double>();
+}
+
+// SCENARIO("Sphere benchmarks")
+// {
+//     benchmark_sphere_multi<float, double>();
+// }
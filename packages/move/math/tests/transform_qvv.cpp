@@ -0,0 +1,191 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <magic_enum.hpp>
+
+#include <movemm/memory-allocator.h>
+#include <move/math/common.hpp>
+#include <move/math/macros.hpp>
+#include <move/math/transform_qvv.hpp>
+#if __has_include(<move/meta/type_utils.hpp>)
+#define MVM_HAS_MOVE_CORE
+#include <move/meta/type_utils.hpp>
+#endif
+#include <move/string.hpp>
+
+#include "mm_test_common.hpp"
+
+template <typename qvv>
+inline void test_transform_qvv()
+{
+    using component_type = qvv::component_type;
+    using vec3 = qvv::vec3_t;
+    using quat = qvv::quat_t;
+    using mat4 = qvv::mat4x4_t;
+    using move::math::approx_equal;
+    static constexpr auto epsilon = component_type(0.0001);
+
+    INFO("Testing transform_qvv with following config:");
+    INFO("\tcomponent_type: " << move::meta::type_name<component_type>());
+    INFO("\tacceleration: " << magic_enum::enum_name(qvv::acceleration));
+    INFO("\tqvv: " << move::meta::type_name<qvv>());
+
+    const vec3 translation(3, -1, 2);
+    const quat rotation =
+        quat::angle_axis(vec3(1, 1, 0).normalized(),
+                         move::math::deg2rad<component_type>(40));
+    const vec3 scale(2, 3, 4);
+    const qvv transform(translation, rotation, scale);
+    const mat4 matrix = mat4::trs(translation, rotation, scale);
+    const vec3 point(1, -2, 5);
+
+    REQUIRE(qvv::identity().transform_point(point) == point);
+
+    WHEN("The components are read back")
+    {
+        THEN("They match the values it was built from")
+        {
+            REQUIRE(transform.get_translation() == translation);
+            REQUIRE(transform.get_rotation() == rotation);
+            REQUIRE(transform.get_scale() == scale);
+        }
+    }
+
+    WHEN("Points and vectors are transformed")
+    {
+        THEN("The results match the equivalent TRS matrix")
+        {
+            const vec3 expected_point = matrix.transform_point(point);
+            const vec3 expected_vector = matrix.transform_vector(point);
+            REQUIRE(approx_equal(transform.transform_point(point),
+                                 expected_point, epsilon));
+            REQUIRE(approx_equal(transform.transform_vector(point),
+                                 expected_vector, epsilon));
+        }
+
+        THEN("Converting to a matrix matches mat4x4::trs")
+        {
+            REQUIRE(approx_equal(transform.to_mat4x4(), matrix, epsilon));
+        }
+    }
+
+    WHEN("Transforms with uniform scale are composed")
+    {
+        const qvv child(vec3(1, 2, 3), quat::rotation_y(component_type(0.4)),
+                        vec3(2, 2, 2));
+        const qvv parent(vec3(-4, 0, 1), quat::rotation_x(component_type(1.1)),
+                         vec3(0.5, 0.5, 0.5));
+        const qvv combined = child * parent;
+
+        THEN("The result matches multiplying their matrices")
+        {
+            REQUIRE(approx_equal(combined.to_mat4x4(),
+                                 child.to_mat4x4() * parent.to_mat4x4(),
+                                 epsilon));
+
+            const vec3 expected =
+                parent.transform_point(child.transform_point(point));
+            REQUIRE(approx_equal(combined.transform_point(point), expected,
+                                 epsilon));
+        }
+
+        THEN("Composing with the inverse gives the identity")
+        {
+            REQUIRE(approx_equal(combined * combined.inverse(), qvv::identity(),
+                                 epsilon));
+        }
+    }
+
+    WHEN("Transforms are interpolated")
+    {
+        const qvv a(vec3(0, 0, 0), quat::identity(), vec3(1, 1, 1));
+        const qvv b(vec3(4, 2, 0),
+                    quat::rotation_z(move::math::deg2rad<component_type>(90)),
+                    vec3(3, 3, 3));
+        const qvv halfway = qvv::lerp(a, b, component_type(0.5));
+
+        THEN("The midpoint is halfway along each component")
+        {
+            REQUIRE(approx_equal(halfway.get_translation(), vec3(2, 1, 0),
+                                 epsilon));
+            REQUIRE(approx_equal(halfway.get_scale(), vec3(2, 2, 2), epsilon));
+            REQUIRE(approx_equal(
+                halfway.get_rotation(),
+                quat::rotation_z(move::math::deg2rad<component_type>(45)),
+                epsilon));
+        }
+
+        THEN("A two-way blend matches lerp")
+        {
+            const qvv poses[] = {a, b};
+            const component_type even[] = {0.5, 0.5};
+            const component_type first_only[] = {1, 0};
+            REQUIRE(approx_equal(qvv::blend(poses, even, 2), halfway, epsilon));
+            REQUIRE(approx_equal(qvv::blend(poses, first_only, 2), a, epsilon));
+        }
+    }
+
+    WHEN("A transform is serialized")
+    {
+        capture_archive<component_type> saver;
+        qvv(transform).serialize(saver);
+
+        qvv loaded;
+        replay_archive<component_type> loader{saver.values};
+        loaded.serialize(loader);
+
+        THEN("The serialized values round-trip correctly")
+        {
+            REQUIRE(saver.values.size() == 10);
+            REQUIRE(loaded == transform);
+        }
+    }
+}
+
+template <typename qvv>
+inline void benchmark_transform_qvv()
+{
+    using component_type = qvv::component_type;
+    using vec3 = qvv::vec3_t;
+    using quat = qvv::quat_t;
+    using mat4 = qvv::mat4x4_t;
+    move::string_view typeName = move::meta::type_name<qvv>();
+
+    const qvv a(vec3(1, 2, 3), quat::rotation_y(component_type(0.4)),
+                vec3(2, 2, 2));
+    const qvv b(vec3(-4, 0, 1), quat::rotation_x(component_type(1.1)),
+                vec3(1, 1, 1));
+    const mat4 ma = a.to_mat4x4();
+    const mat4 mb = b.to_mat4x4();
+
+    BENCHMARK(alloc_appended_name(typeName, ": Compose"))
+    {
+        return a * b;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": Compose (mat4x4)"))
+    {
+        return ma * mb;
+    };
+
+    BENCHMARK(alloc_appended_name(typeName, ": To mat4x4"))
+    {
+        return a.to_mat4x4();
+    };
+}
+
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(test_transform_qvv,
+                                     move::math::transform_qvv);
+REPEAT_FOR_EACH_TYPE_WRAPPER_NOACCEL(benchmark_transform_qvv,
+                                     move::math::transform_qvv);
+
+SCENARIO("Transform qvv full tests")
+{
+    test_transform_qvv_multi<float, double>();
+}
+
+// SCENARIO("Transform qvv benchmarks")
+// {
+//     benchmark_transform_qvv_multi<float, double>();
+// }
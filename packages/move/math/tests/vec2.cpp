@@ -191,6 +191,38 @@ inline void test_vec2()
             REQUIRE(test.length_squared() == 25);
         }
     }
+
+    WHEN("Computing fused multiply-adds")
+    {
+        using component_type = typename vec2::component_type;
+        vec2 a = {1, 2};
+        vec2 b = {4, 3};
+        vec2 c = {5, 6};
+
+        THEN("The results match the unfused expressions")
+        {
+            REQUIRE(vec2::mul_add(a, b, c) == vec2(9, 12));
+            REQUIRE(vec2::mul_add(a, component_type(2), c) == vec2(7, 10));
+            REQUIRE(vec2::mul_sub(b, c, a) == vec2(19, 16));
+            REQUIRE(vec2::neg_mul_sub(a, b, c) == vec2(1, 0));
+            REQUIRE(vec2::neg_mul_sub(a, component_type(2), c) == vec2(3, 2));
+        }
+    }
+}
+
+TEST_CASE("vec2 is usable in constant expressions")
+{
+    using move::math::float2;
+
+    constexpr float2 a = {1, 2};
+    constexpr float2 b = {3, 4};
+    static_assert(a + b == float2(4, 6));
+    static_assert(float2::dot(a, b) == 11);
+    static_assert(float2::mul_add(a, 2.0f, b) == float2(5, 8));
+    static_assert(a[1] == 2);
+    static_assert(b.length_squared() == 25);
+
+    REQUIRE(a.aspect_ratio() == Catch::Approx(0.5f));
 }
 
 SCENARIO("Vec2 tests")
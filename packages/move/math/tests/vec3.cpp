@@ -638,6 +638,23 @@ inline void test_vec3()
         REQUIRE(vec3::lerp(test1, test2, {1, 2, 1}) == vec3(5, 5, 5));
     }
 
+    WHEN("Computing fused multiply-adds")
+    {
+        vec3 a = {1, 2, 3};
+        vec3 b = {4, 3, 2};
+        vec3 c = {5, 6, 7};
+
+        THEN("The results match the unfused expressions")
+        {
+            REQUIRE(vec3::mul_add(a, b, c) == vec3(9, 12, 13));
+            REQUIRE(vec3::mul_add(a, component_type(2), c) == vec3(7, 10, 13));
+            REQUIRE(vec3::mul_sub(b, c, a) == vec3(19, 16, 11));
+            REQUIRE(vec3::neg_mul_sub(a, b, c) == vec3(1, 0, 1));
+            REQUIRE(vec3::neg_mul_sub(a, component_type(2), c) ==
+                    vec3(3, 2, 1));
+        }
+    }
+
     WHEN("Computing the minimum of two vectors")
     {
         vec3 test1 = {1, 2, 3};
@@ -740,6 +757,42 @@ TEST_CASE("vec3 wrapper compound assignments return self")
     REQUIRE(&(lhs /= move::math::float3(1.0f, 1.0f, 1.0f)) == &lhs);
 }
 
+TEST_CASE("scalar vec3 is usable in constant expressions")
+{
+    using move::math::storage_float3;
+    using move::math::storage_int3;
+
+    constexpr storage_float3 directions[] = {
+        storage_float3::right(), storage_float3::left(), storage_float3::up(),
+        storage_float3::down(),  storage_float3::forward(),
+        storage_float3::backward()};
+    static_assert(directions[2] == storage_float3(0, 1, 0));
+    static_assert(directions[0] + directions[1] == storage_float3::zero());
+
+    constexpr storage_int3 a = {1, 2, 3};
+    constexpr storage_int3 b = {4, 5, 6};
+    static_assert(storage_int3::dot(a, b) == 32);
+    static_assert(storage_int3::cross(a, b) == storage_int3(-3, 6, -3));
+    static_assert(a * 2 - b == storage_int3(-2, -1, 0));
+    static_assert(storage_int3::abs(-a) == a);
+    static_assert(storage_int3::mul_add(a, 2, b) == storage_int3(6, 9, 12));
+    static_assert(storage_int3::clamp(b, 0, 5) == storage_int3(4, 5, 5));
+    static_assert(a[1] == 2);
+    static_assert(a.length_squared() == 14);
+
+    constexpr storage_int3 accumulated = []
+    {
+        storage_int3 result;
+        result += {1, 1, 1};
+        result *= 3;
+        result[2] = 7;
+        return result;
+    }();
+    static_assert(accumulated == storage_int3(3, 3, 7));
+
+    REQUIRE(directions[4] == storage_float3(0, 0, 1));
+}
+
 SCENARIO("Vec3 tests")
 {
     using namespace move::math;
@@ -566,6 +566,24 @@ inline void test_vec4()
         }
     }
 
+    WHEN("Computing fused multiply-adds")
+    {
+        vec4 a = {1, 2, 3, 1};
+        vec4 b = {4, 3, 2, 5};
+        vec4 c = {5, 6, 7, 8};
+
+        THEN("The results match the unfused expressions")
+        {
+            REQUIRE(vec4::mul_add(a, b, c) == vec4(9, 12, 13, 13));
+            REQUIRE(vec4::mul_add(a, component_type(2), c) ==
+                    vec4(7, 10, 13, 10));
+            REQUIRE(vec4::mul_sub(b, c, a) == vec4(19, 16, 11, 39));
+            REQUIRE(vec4::neg_mul_sub(a, b, c) == vec4(1, 0, 1, 3));
+            REQUIRE(vec4::neg_mul_sub(a, component_type(2), c) ==
+                    vec4(3, 2, 1, 6));
+        }
+    }
+
     WHEN("Computing the minimum of two vectors")
     {
         vec4 test1 = {1, 2, 3, 4};
@@ -754,6 +772,28 @@ TEST_CASE("vec4 wrapper compound assignments return self")
     REQUIRE(&(lhs /= move::math::float4(1.0f, 1.0f, 1.0f, 1.0f)) == &lhs);
 }
 
+TEST_CASE("scalar vec4 is usable in constant expressions")
+{
+    using move::math::storage_double4;
+    using move::math::storage_long4;
+
+    constexpr storage_double4 a = {1, 2, 3, 4};
+    constexpr storage_double4 b = {4, 3, 2, 1};
+    static_assert(storage_double4::dot(a, b) == 20);
+    static_assert(storage_double4::lerp(a, b, 0.5) ==
+                  storage_double4::filled(2.5));
+    static_assert(storage_double4::min(a, b) == storage_double4(1, 2, 2, 1));
+    static_assert(-a + a == storage_double4::zero());
+    static_assert(a[3] == 4);
+
+    constexpr storage_long4 c = {1, -2, 3, -4};
+    static_assert(storage_long4::clamp(c, -1, 1) ==
+                  storage_long4(1, -1, 1, -1));
+    static_assert(c * c == storage_long4(1, 4, 9, 16));
+
+    REQUIRE(storage_double4::dot(a, b) == 20);
+}
+
 // SCENARIO("Vec4 Benchmarks")
 // {
 //     using namespace move::math;
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include "transform_component.hpp"
 
@@ -45,8 +49,64 @@ namespace examples
                                   T half_height,
                                   T probe_distance,
                                   vector_type& out_normal) const = 0;
+
+        // Sweeps a packet of `count` capsules, the lanes whose bit is set in
+        // `active_mask`, and returns the mask of lanes that hit something.
+        // Masks hold one bit per lane, so `count` is at most 32.  The default
+        // sweeps one lane at a time; worlds that can share work across a
+        // packet should override it.
+        virtual std::uint32_t sweep_capsules(
+            const vector_type* centers,
+            const T* radii,
+            const T* half_heights,
+            const vector_type* displacements,
+            std::uint32_t count,
+            std::uint32_t active_mask,
+            CharacterSweepHit<T>* out_hits) const
+        {
+            std::uint32_t hit_mask = 0;
+            for (std::uint32_t lane = 0; lane < count; ++lane)
+            {
+                if (((active_mask >> lane) & 1u) &&
+                    sweep_capsule(centers[lane], radii[lane],
+                                  half_heights[lane], displacements[lane],
+                                  out_hits[lane]))
+                {
+                    hit_mask |= 1u << lane;
+                }
+            }
+            return hit_mask;
+        }
+
+        // Packet form of probe_ground, with the same masks as sweep_capsules
+        virtual std::uint32_t probe_ground_capsules(
+            const vector_type* centers,
+            const T* radii,
+            const T* half_heights,
+            const T* probe_distances,
+            std::uint32_t count,
+            std::uint32_t active_mask,
+            vector_type* out_normals) const
+        {
+            std::uint32_t hit_mask = 0;
+            for (std::uint32_t lane = 0; lane < count; ++lane)
+            {
+                if (((active_mask >> lane) & 1u) &&
+                    probe_ground(centers[lane], radii[lane],
+                                 half_heights[lane], probe_distances[lane],
+                                 out_normals[lane]))
+                {
+                    hit_mask |= 1u << lane;
+                }
+            }
+            return hit_mask;
+        }
     };
 
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    struct CharacterControllerBatch;
+
     template <typename T = float>
         requires std::is_floating_point_v<T>
     struct CollideAndSlideCharacterController
@@ -112,25 +172,55 @@ namespace examples
                     break;
                 }
 
-                const T travel_fraction = move::math::clamp(
-                    hit.fraction - skin_fraction(remaining.length()), T(0), T(1));
-                set_position(position() + remaining * travel_fraction);
+                set_position(position() + slide(hit, remaining));
+            }
 
-                const vector_type leftover =
-                    remaining * (T(1) - travel_fraction);
-                remaining = project_onto_plane(leftover, hit.normal);
+            vector_type probe_normal = vector_type::up();
+            const bool found_ground =
+                world.probe_ground(position(), radius, half_height(),
+                                   ground_probe_distance, probe_normal);
+            settle(found_ground, probe_normal);
+        }
 
-                if (is_ground(hit.normal))
-                {
-                    grounded = true;
-                    ground_normal = hit.normal.normalized();
-                }
+        void integrate(const CharacterPhysicsWorld<T>& world,
+                       T delta_time,
+                       const vector_type& gravity)
+        {
+            if (!grounded)
+            {
+                velocity += gravity * delta_time;
             }
 
-            vector_type probe_normal = vector_type::up();
-            if (world.probe_ground(position(), radius, half_height(),
-                                   ground_probe_distance, probe_normal) &&
-                is_ground(probe_normal))
+            move_and_slide(world, velocity * delta_time);
+        }
+
+    private:
+        friend struct CharacterControllerBatch<T>;
+
+        // Moves up to the hit, less the skin width, and turns what is left
+        // of `remaining` along the surface.  Returns the displacement applied.
+        [[nodiscard]] vector_type slide(const CharacterSweepHit<T>& hit,
+                                        vector_type& remaining)
+        {
+            const T travel_fraction = move::math::clamp(
+                hit.fraction - skin_fraction(remaining.length()), T(0), T(1));
+            const vector_type travel = remaining * travel_fraction;
+
+            const vector_type leftover = remaining * (T(1) - travel_fraction);
+            remaining = project_onto_plane(leftover, hit.normal);
+
+            if (is_ground(hit.normal))
+            {
+                grounded = true;
+                ground_normal = hit.normal.normalized();
+            }
+            return travel;
+        }
+
+        // Applies the ground probe and stops any velocity into the ground
+        void settle(bool found_ground, const vector_type& probe_normal)
+        {
+            if (found_ground && is_ground(probe_normal))
             {
                 grounded = true;
                 ground_normal = probe_normal.normalized();
@@ -146,19 +236,6 @@ namespace examples
             }
         }
 
-        void integrate(const CharacterPhysicsWorld<T>& world,
-                       T delta_time,
-                       const vector_type& gravity)
-        {
-            if (!grounded)
-            {
-                velocity += gravity * delta_time;
-            }
-
-            move_and_slide(world, velocity * delta_time);
-        }
-
-    private:
         [[nodiscard]] T skin_fraction(T displacement_length) const
         {
             if (displacement_length <= T(1.0e-6))
@@ -194,4 +271,202 @@ namespace examples
             }
         }
     };
+
+    // Moves many characters with the same result as calling move_and_slide
+    // on each.  Characters are sorted by grid cell and gathered into packets
+    // of `packet_width` lanes, so each packet stays close together, and
+    // every packet runs its slide iterations in lockstep with one
+    // sweep_capsules call per iteration.  Lanes leave the active mask as
+    // they finish.
+    template <typename T = float>
+        requires std::is_floating_point_v<T>
+    struct CharacterControllerBatch
+    {
+        using scalar_type = T;
+        using vector_type =
+            move::math::vec3<T, move::math::Acceleration::Default>;
+        using controller_type = CollideAndSlideCharacterController<T>;
+
+        static constexpr std::uint32_t packet_width = 8;
+
+        // Characters are grouped into packets by cells this wide
+        T packet_cell_size = T(4);
+
+        void move_and_slide(const CharacterPhysicsWorld<T>& world,
+                            controller_type* controllers,
+                            const vector_type* desired_displacements,
+                            std::size_t count)
+        {
+            // Sort by grid cell on the ground plane, so each packet covers
+            // one small area
+            keys.resize(count);
+            const T inv_cell = T(1) / packet_cell_size;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const vector_type p = controllers[i].position();
+                const auto cell_x = static_cast<std::int64_t>(
+                    move::math::floor(p.get_x() * inv_cell));
+                const auto cell_z = static_cast<std::int64_t>(
+                    move::math::floor(p.get_z() * inv_cell));
+                keys[i] = cell_z * (std::int64_t(1) << 32) + cell_x;
+            }
+
+            // Characters rarely change cells between ticks, so last tick's
+            // order is nearly sorted and an insertion sort is close to
+            // linear
+            const auto by_key = [this](std::uint32_t a, std::uint32_t b) {
+                return keys[a] < keys[b];
+            };
+            if (order.size() != count)
+            {
+                order.resize(count);
+                std::iota(order.begin(), order.end(), std::uint32_t(0));
+                std::sort(order.begin(), order.end(), by_key);
+            }
+            else
+            {
+                for (std::size_t i = 1; i < count; ++i)
+                {
+                    const std::uint32_t index = order[i];
+                    std::size_t j = i;
+                    for (; j > 0 && by_key(index, order[j - 1]); --j)
+                    {
+                        order[j] = order[j - 1];
+                    }
+                    order[j] = index;
+                }
+            }
+
+            for (std::size_t start = 0; start < count; start += packet_width)
+            {
+                const auto lanes = static_cast<std::uint32_t>(
+                    std::min<std::size_t>(packet_width, count - start));
+                move_packet(world, controllers, desired_displacements,
+                            order.data() + start, lanes);
+            }
+        }
+
+        void integrate(const CharacterPhysicsWorld<T>& world,
+                       controller_type* controllers,
+                       std::size_t count,
+                       T delta_time,
+                       const vector_type& gravity)
+        {
+            displacements.resize(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                controller_type& controller = controllers[i];
+                if (!controller.grounded)
+                {
+                    controller.velocity += gravity * delta_time;
+                }
+                displacements[i] = controller.velocity * delta_time;
+            }
+
+            move_and_slide(world, controllers, displacements.data(), count);
+        }
+
+    private:
+        std::vector<std::int64_t> keys;
+        std::vector<std::uint32_t> order;
+        std::vector<vector_type> displacements;
+
+        static void move_packet(const CharacterPhysicsWorld<T>& world,
+                                controller_type* controllers,
+                                const vector_type* desired_displacements,
+                                const std::uint32_t* indices,
+                                std::uint32_t lanes)
+        {
+            controller_type* packet[packet_width];
+            vector_type centers[packet_width];
+            vector_type remaining[packet_width];
+            T radii[packet_width];
+            T half_heights[packet_width];
+            T probe_distances[packet_width];
+            CharacterSweepHit<T> hits[packet_width];
+            vector_type probe_normals[packet_width];
+
+            std::uint32_t active = 0;
+            for (std::uint32_t lane = 0; lane < lanes; ++lane)
+            {
+                controller_type& controller = controllers[indices[lane]];
+                controller.grounded = false;
+                controller.ground_normal = vector_type::up();
+                controller.resolve_penetration(world);
+
+                packet[lane] = &controller;
+                centers[lane] = controller.position();
+                remaining[lane] = desired_displacements[indices[lane]];
+                radii[lane] = controller.radius;
+                half_heights[lane] = controller.half_height();
+                probe_distances[lane] = controller.ground_probe_distance;
+                probe_normals[lane] = vector_type::up();
+                if (remaining[lane].length_squared() > T(1.0e-8))
+                {
+                    active |= 1u << lane;
+                }
+            }
+
+            for (std::uint32_t iteration = 0; active != 0; ++iteration)
+            {
+                for (std::uint32_t lane = 0; lane < lanes; ++lane)
+                {
+                    if (iteration >= packet[lane]->max_slide_iterations)
+                    {
+                        active &= ~(1u << lane);
+                    }
+                }
+                if (active == 0)
+                {
+                    break;
+                }
+
+                const std::uint32_t hit_mask =
+                    world.sweep_capsules(centers, radii, half_heights,
+                                         remaining, lanes, active, hits);
+                for (std::uint32_t lane = 0; lane < lanes; ++lane)
+                {
+                    const std::uint32_t bit = 1u << lane;
+                    if (!(active & bit))
+                    {
+                        continue;
+                    }
+
+                    controller_type& controller = *packet[lane];
+                    if (!(hit_mask & bit))
+                    {
+                        centers[lane] += remaining[lane];
+                        active &= ~bit;
+                    }
+                    else if (hits[lane].started_penetrating)
+                    {
+                        controller.set_position(centers[lane]);
+                        controller.resolve_penetration(world);
+                        centers[lane] = controller.position();
+                        active &= ~bit;
+                    }
+                    else
+                    {
+                        centers[lane] +=
+                            controller.slide(hits[lane], remaining[lane]);
+                        if (remaining[lane].length_squared() <= T(1.0e-8))
+                        {
+                            active &= ~bit;
+                        }
+                    }
+                }
+            }
+
+            const std::uint32_t all = (1u << lanes) - 1u;
+            const std::uint32_t ground_mask = world.probe_ground_capsules(
+                centers, radii, half_heights, probe_distances, lanes, all,
+                probe_normals);
+            for (std::uint32_t lane = 0; lane < lanes; ++lane)
+            {
+                packet[lane]->set_position(centers[lane]);
+                packet[lane]->settle(((ground_mask >> lane) & 1u) != 0,
+                                     probe_normals[lane]);
+            }
+        }
+    };
 }  // namespace examples
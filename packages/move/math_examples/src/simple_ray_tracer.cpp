@@ -109,7 +109,7 @@ namespace
         }
 
         out_hit.distance = root;
-        out_hit.position = ray.origin + ray.direction * root;
+        out_hit.position = vector_type::mul_add(ray.direction, root, ray.origin);
         const vector_type outward_normal =
             (out_hit.position - sphere.center) * (1.0f / sphere.radius);
         out_hit.front_face =
@@ -124,8 +124,8 @@ namespace
     {
         const scalar_type t =
             move::math::lerp(0.0f, 1.0f, direction.normalized().get_y() * 0.5f + 0.5f);
-        return color_type(0.85f, 0.92f, 1.0f) * (1.0f - t) +
-               color_type(0.35f, 0.55f, 0.95f) * t;
+        return color_type::lerp_unclamped(color_type(0.85f, 0.92f, 1.0f),
+                                          color_type(0.35f, 0.55f, 0.95f), t);
     }
 
     [[nodiscard]] bool scatter(const Ray& ray_in,
@@ -151,7 +151,8 @@ namespace
         if (roughness > 0.0f)
         {
             bounce_direction =
-                (bounce_direction + random_in_unit_sphere(rng) * roughness)
+                vector_type(vector_type::mul_add(random_in_unit_sphere(rng),
+                                                 roughness, bounce_direction))
                     .normalized();
         }
 
@@ -161,7 +162,7 @@ namespace
         }
 
         out_attenuation = hit.material.albedo;
-        out_ray.origin = hit.position + hit.normal * 0.001f;
+        out_ray.origin = vector_type::mul_add(hit.normal, 0.001f, hit.position);
         out_ray.direction = bounce_direction.normalized();
         return true;
     }
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include <move/math/collision_world.hpp>
+
+#include "character_controller.hpp"
+
+namespace examples
+{
+    // Reference CharacterPhysicsWorld over a static
+    // move::math::collision_world.
+    // Add planes, spheres, boxes and triangles to `shapes`, then call
+    // `shapes.build()` before moving any characters.
+    template <typename T = float>
+        requires std::is_floating_point_v<T>
+    struct StaticPhysicsWorld final : CharacterPhysicsWorld<T>
+    {
+        using vector_type =
+            move::math::vec3<T, move::math::Acceleration::Default>;
+        using world_type = move::math::collision_world<T>;
+        using capsule_type = typename world_type::capsule_t;
+
+        world_type shapes;
+
+        bool sweep_capsule(const vector_type& center,
+                           T radius,
+                           T half_height,
+                           const vector_type& displacement,
+                           CharacterSweepHit<T>& out_hit) const override
+        {
+            typename world_type::hit_t hit;
+            if (!shapes.sweep_capsule(
+                    make_capsule(center, radius, half_height),
+                    displacement.fast(), hit))
+            {
+                return false;
+            }
+
+            out_hit.fraction = hit.fraction;
+            out_hit.point = to_vector(hit.point);
+            out_hit.normal = to_vector(hit.normal);
+            out_hit.started_penetrating = hit.started_penetrating;
+            return true;
+        }
+
+        bool depenetrate_capsule(const vector_type& center,
+                                 T radius,
+                                 T half_height,
+                                 vector_type& out_offset) const override
+        {
+            typename world_type::vec3_t offset;
+            if (!shapes.depenetrate_capsule(
+                    make_capsule(center, radius, half_height), offset))
+            {
+                return false;
+            }
+
+            out_offset = to_vector(offset);
+            return true;
+        }
+
+        bool probe_ground(const vector_type& center,
+                          T radius,
+                          T half_height,
+                          T probe_distance,
+                          vector_type& out_normal) const override
+        {
+            typename world_type::vec3_t normal;
+            if (!shapes.probe_ground(make_capsule(center, radius, half_height),
+                                     probe_distance, normal))
+            {
+                return false;
+            }
+
+            out_normal = to_vector(normal);
+            return true;
+        }
+
+        std::uint32_t sweep_capsules(
+            const vector_type* centers,
+            const T* radii,
+            const T* half_heights,
+            const vector_type* displacements,
+            std::uint32_t count,
+            std::uint32_t active_mask,
+            CharacterSweepHit<T>* out_hits) const override
+        {
+            std::uint32_t hit_mask = 0;
+            for (std::uint32_t start = 0; start < count;
+                 start += world_type::packet_width)
+            {
+                const auto lanes = std::min<std::uint32_t>(
+                    world_type::packet_width, count - start);
+                capsule_type capsules[world_type::packet_width];
+                typename world_type::vec3_t moves[world_type::packet_width];
+                typename world_type::hit_t hits[world_type::packet_width];
+                for (std::uint32_t lane = 0; lane < lanes; ++lane)
+                {
+                    capsules[lane] =
+                        make_capsule(centers[start + lane], radii[start + lane],
+                                     half_heights[start + lane]);
+                    moves[lane] = displacements[start + lane].fast();
+                }
+
+                const std::uint32_t packet_mask = shapes.sweep_capsules(
+                    capsules, moves, lanes, active_mask >> start, hits);
+                for (std::uint32_t lane = 0; lane < lanes; ++lane)
+                {
+                    if ((packet_mask >> lane) & 1u)
+                    {
+                        CharacterSweepHit<T>& out = out_hits[start + lane];
+                        out.fraction = hits[lane].fraction;
+                        out.point = to_vector(hits[lane].point);
+                        out.normal = to_vector(hits[lane].normal);
+                        out.started_penetrating =
+                            hits[lane].started_penetrating;
+                    }
+                }
+                hit_mask |= packet_mask << start;
+            }
+            return hit_mask;
+        }
+
+        // A ground probe is a short sweep straight down, so packets of
+        // probes share the packet sweep
+        std::uint32_t probe_ground_capsules(
+            const vector_type* centers,
+            const T* radii,
+            const T* half_heights,
+            const T* probe_distances,
+            std::uint32_t count,
+            std::uint32_t active_mask,
+            vector_type* out_normals) const override
+        {
+            std::uint32_t hit_mask = 0;
+            for (std::uint32_t start = 0; start < count;
+                 start += world_type::packet_width)
+            {
+                const auto lanes = std::min<std::uint32_t>(
+                    world_type::packet_width, count - start);
+                capsule_type capsules[world_type::packet_width];
+                typename world_type::vec3_t moves[world_type::packet_width];
+                typename world_type::hit_t hits[world_type::packet_width];
+                for (std::uint32_t lane = 0; lane < lanes; ++lane)
+                {
+                    capsules[lane] =
+                        make_capsule(centers[start + lane], radii[start + lane],
+                                     half_heights[start + lane]);
+                    moves[lane] = typename world_type::vec3_t(
+                        T(0), -probe_distances[start + lane], T(0));
+                }
+
+                const std::uint32_t packet_mask = shapes.sweep_capsules(
+                    capsules, moves, lanes, active_mask >> start, hits);
+                for (std::uint32_t lane = 0; lane < lanes; ++lane)
+                {
+                    if ((packet_mask >> lane) & 1u)
+                    {
+                        out_normals[start + lane] =
+                            to_vector(hits[lane].normal);
+                    }
+                }
+                hit_mask |= packet_mask << start;
+            }
+            return hit_mask;
+        }
+
+    private:
+        [[nodiscard]] static capsule_type make_capsule(
+            const vector_type& center, T radius, T half_height)
+        {
+            return capsule_type::vertical(center.fast(), radius, half_height);
+        }
+
+        [[nodiscard]] static vector_type to_vector(
+            const typename world_type::vec3_t& value)
+        {
+            return value.template to_accel<move::math::Acceleration::Default>();
+        }
+    };
+}  // namespace examples
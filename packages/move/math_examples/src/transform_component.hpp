@@ -15,6 +15,7 @@ namespace examples
             move::math::vec3<T, move::math::Acceleration::Default>;
         using quaternion_type = move::math::quat<T>;
         using matrix_type = move::math::mat4x4<T>;
+        using qvv_type = move::math::transform_qvv<T>;
 
         TransformComponent* parent = nullptr;
         vector_type local_position = vector_type::zero();
@@ -27,6 +28,21 @@ namespace examples
                 local_position.fast(), local_rotation, local_scale.fast());
         }
 
+        [[nodiscard]] qvv_type local_transform() const
+        {
+            return qvv_type(
+                local_position.fast(), local_rotation, local_scale.fast());
+        }
+
+        // Composing as qvv is cheaper than multiplying matrices up the
+        // hierarchy.  It matches world_matrix() unless a parent combines
+        // rotation with non-uniform scale, which a qvv cannot shear.
+        [[nodiscard]] qvv_type world_transform() const
+        {
+            const qvv_type local = local_transform();
+            return parent ? local * parent->world_transform() : local;
+        }
+
         [[nodiscard]] matrix_type world_matrix() const
         {
             const matrix_type local = local_matrix();
@@ -0,0 +1,75 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "../src/character_controller.hpp"
+#include "../src/static_physics_world.hpp"
+
+template <typename T>
+inline void test_character_controller_batch()
+{
+    using world_type = examples::StaticPhysicsWorld<T>;
+    using controller = examples::CollideAndSlideCharacterController<T>;
+    using vec3 = typename controller::vector_type;
+
+    world_type world;
+    world.shapes.add_plane(typename world_type::world_type::plane_t(
+        vec3(0, 1, 0), T(0)));
+    for (int i = 0; i < 6; ++i)
+    {
+        const T x = T(i * 3 - 8);
+        world.shapes.add_box(typename world_type::world_type::aabb_t(
+            vec3(x, 0, -1), vec3(x + T(1.5), T(0.5 + i * 0.3), 1)));
+        world.shapes.add_sphere(typename world_type::world_type::sphere_t(
+            vec3(x, T(0.4), 3), T(1)));
+    }
+    world.shapes.build();
+
+    GIVEN("Characters scattered over boxes, spheres and the ground")
+    {
+        uint32_t seed = 7;
+        const auto next = [&seed]() {
+            seed = seed * 1664525u + 1013904223u;
+            return T(seed >> 8) / T(1 << 24) * T(2) - T(1);
+        };
+
+        std::vector<controller> single(300);
+        for (controller& c : single)
+        {
+            c.set_position(vec3(next() * 10, T(2) + next(), next() * 5));
+            c.velocity = vec3(next() * 4, 0, next() * 4);
+        }
+        std::vector<controller> batched = single;
+
+        THEN("The batch moves every character like move_and_slide does")
+        {
+            examples::CharacterControllerBatch<T> batch;
+            const T delta_time = T(1) / 60;
+            const vec3 gravity(0, T(-9.81), 0);
+            for (int tick = 0; tick < 60; ++tick)
+            {
+                for (controller& c : single)
+                {
+                    c.integrate(world, delta_time, gravity);
+                }
+                batch.integrate(world, batched.data(), batched.size(),
+                                delta_time, gravity);
+            }
+
+            for (size_t i = 0; i < single.size(); ++i)
+            {
+                REQUIRE(batched[i].position() == single[i].position());
+                REQUIRE(batched[i].velocity == single[i].velocity);
+                REQUIRE(batched[i].grounded == single[i].grounded);
+            }
+        }
+    }
+}
+
+SCENARIO("Character controller batch tests")
+{
+    test_character_controller_batch<float>();
+    test_character_controller_batch<double>();
+}